@@ -33,6 +33,7 @@
 #include <cstdint>
 
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/with_alignment.h"
 
 namespace mongo {
 /**
@@ -66,4 +67,62 @@ public:
 private:
     AtomicInt64 _counter;
 };
+
+/**
+ * A 64bit counter sharded across cache-line-aligned stripes, with the same interface as
+ * Counter64.
+ *
+ * Each thread is assigned a stripe round-robin the first time it touches any striped counter and
+ * increments only that stripe, so concurrent writers on different stripes never share a cache
+ * line. Reading sums every stripe and is correspondingly more expensive, making this the right
+ * choice for counters that are written on every operation but read only by serverStatus-style
+ * reporting, and the wrong one for counters that are read on hot paths.
+ */
+class StripedCounter64 {
+public:
+    static const size_t kNumStripes = 64;
+
+    /**
+     * Increments by 'n' with relaxed memory order. Returns the new value of the stripe the
+     * calling thread updated, which is a lower bound on the counter's total; callers can compare
+     * it against a per-stripe limit as a cheap overflow check.
+     */
+    int64_t increment(uint64_t n = 1) {
+        return _stripes[_currentThreadStripe()].fetchAndAddRelaxed(n) + n;
+    }
+
+    /** Decrements by 'n'. */
+    void decrement(uint64_t n = 1) {
+        _stripes[_currentThreadStripe()].fetchAndSubtract(n);
+    }
+
+    /** Returns the sum of all stripes. Concurrent updates may or may not be visible. */
+    long long get() const {
+        int64_t sum = 0;
+        for (size_t i = 0; i < kNumStripes; i++) {
+            sum += _stripes[i].loadRelaxed();
+        }
+        return sum;
+    }
+
+    operator long long() const {
+        return get();
+    }
+
+    /** Resets every stripe to zero. Racy with respect to concurrent increments. */
+    void reset() {
+        for (size_t i = 0; i < kNumStripes; i++) {
+            _stripes[i].store(0);
+        }
+    }
+
+private:
+    static size_t _currentThreadStripe() {
+        static AtomicUInt32 nextStripe;
+        thread_local const size_t stripe = nextStripe.fetchAndAdd(1) % kNumStripes;
+        return stripe;
+    }
+
+    CacheAligned<AtomicInt64> _stripes[kNumStripes];
+};
 }  // namespace mongo
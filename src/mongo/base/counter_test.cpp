@@ -56,5 +56,19 @@ TEST(CounterTest, Test1) {
     ASSERT_EQUALS(static_cast<long long>(c), 0);
 }
 
+TEST(CounterTest, StripedCounter) {
+    StripedCounter64 c;
+    ASSERT_EQUALS(c.get(), 0);
+    c.increment();
+    ASSERT_EQUALS(c.get(), 1);
+    c.decrement();
+    ASSERT_EQUALS(c.get(), 0);
+    c.increment(3);
+    ASSERT_EQUALS(c.get(), 3);
+    ASSERT_EQUALS(static_cast<long long>(c), 3);
+    c.reset();
+    ASSERT_EQUALS(c.get(), 0);
+}
+
 }  // namespace
 }  // namespace mongo
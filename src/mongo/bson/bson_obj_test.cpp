@@ -49,6 +49,19 @@ TEST(BSONObjToString, EmptyArray) {
     ASSERT_EQUALS(text, o1_str);
 }
 
+TEST(BSONObjCompare, IdenticalShapeCommonPrefix) {
+    // Identically-shaped documents take the bytewise-equal element fast path for the common
+    // prefix; the first differing element must still be compared with full type dispatch.
+    ASSERT_BSONOBJ_LT(BSON("t" << 1 << "host"
+                               << "a"
+                               << "v" << 1.5),
+                      BSON("t" << 1 << "host"
+                               << "a"
+                               << "v" << 2LL));
+    ASSERT_BSONOBJ_EQ(BSON("t" << 1 << "v" << 2.0), BSON("t" << 1 << "v" << 2LL));
+    ASSERT_BSONOBJ_EQ(BSON("t" << 1 << "v" << 2.0), BSON("t" << 1 << "v" << 2.0));
+}
+
 TEST(BSONObjCompare, Timestamp) {
     ASSERT_BSONOBJ_LT(BSON("" << Timestamp(0, 3)), BSON("" << Timestamp(~0U, 2)));
     ASSERT_BSONOBJ_GT(BSON("" << Timestamp(2, 3)), BSON("" << Timestamp(2, 2)));
@@ -40,8 +40,15 @@
 #include "mongo/bson/oid.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 
+// TODO replace this with #if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION in boost 1.60
+#if defined(_M_AMD64) || defined(__amd64__)
+#define MONGO_BSON_VALIDATE_HAVE_FAST_PATH 1
+#include <emmintrin.h>
+#endif
+
 namespace mongo {
 
 namespace {
@@ -417,6 +424,208 @@ Status validateBSONIterative(Buffer* buffer) {
     return Status::OK();
 }
 
+#ifdef MONGO_BSON_VALIDATE_HAVE_FAST_PATH
+/**
+ * Single-sweep validator that checks every embedded length prefix and scans c-string field
+ * names 16 bytes at a time with SSE2 wide compares. It performs exactly the checks of
+ * validateBSONIterative(), but reports failures as a bare bool: on any anomaly the caller
+ * falls back to the state machine pass, which is authoritative and produces the detailed
+ * error Status. This validator must never accept a buffer the state machine would reject.
+ */
+class FastValidator {
+public:
+    FastValidator(const char* buffer, uint64_t maxLength) : _buffer(buffer), _maxLength(maxLength) {
+        _frames.reserve(16);
+    }
+
+    bool validate() {
+        if (!_beginObj())
+            return false;
+        while (!_frames.empty()) {
+            if (!_validateElement())
+                return false;
+        }
+        return true;
+    }
+
+private:
+    struct Frame {
+        uint64_t endPosition;
+        bool isCodeWithScope;
+    };
+
+    bool _readByte(uint8_t* out) {
+        if (_position + 1 > _maxLength)
+            return false;
+        *out = static_cast<uint8_t>(_buffer[_position]);
+        ++_position;
+        return true;
+    }
+
+    bool _readInt32(int32_t* out) {
+        if (_position + sizeof(int32_t) > _maxLength)
+            return false;
+        *out = ConstDataView(_buffer).read<LittleEndian<int32_t>>(_position);
+        _position += sizeof(int32_t);
+        return true;
+    }
+
+    // Mirrors Buffer::skip(): requires at least one byte to remain after the skip, since a
+    // valid object always has more data (at minimum the EOO byte) following any element.
+    bool _skip(uint64_t sz) {
+        _position += sz;
+        return _position < _maxLength;
+    }
+
+    // Advances past the NUL terminator of the c-string starting at the current position.
+    bool _scanCString() {
+        uint64_t pos = _position;
+        while (pos + 16 <= _maxLength) {
+            const __m128i chunk =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(_buffer + pos));
+            const uint32_t mask =
+                _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128()));
+            if (mask) {
+                _position = pos + countTrailingZeros64(mask) + 1;
+                return true;
+            }
+            pos += 16;
+        }
+        for (; pos < _maxLength; ++pos) {
+            if (_buffer[pos] == '\0') {
+                _position = pos + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Validates the body of a String/Code/Symbol after its int32 size prefix.
+    bool _validateString() {
+        int32_t sz;
+        if (!_readInt32(&sz))
+            return false;
+        if (sz <= 0)
+            return false;
+        if (!_skip(static_cast<uint64_t>(sz) - 1))
+            return false;
+        uint8_t terminator;
+        if (!_readByte(&terminator))
+            return false;
+        return terminator == 0;
+    }
+
+    bool _beginObj() {
+        if (_frames.size() > BSONDepth::getMaxAllowableDepth())
+            return false;
+        const uint64_t startPosition = _position;
+        int32_t size;
+        if (!_readInt32(&size))
+            return false;
+        if (size < 5)
+            return false;
+        _frames.push_back({startPosition + static_cast<uint64_t>(size), false});
+        return true;
+    }
+
+    bool _endObj() {
+        if (_position != _frames.back().endPosition)
+            return false;
+        _frames.pop_back();
+        if (!_frames.empty() && _frames.back().isCodeWithScope) {
+            if (_position != _frames.back().endPosition)
+                return false;
+            _frames.pop_back();
+            // CodeWScope is always an element of an enclosing object.
+            if (_frames.empty())
+                return false;
+        }
+        return true;
+    }
+
+    bool _validateElement() {
+        uint8_t type;
+        if (!_readByte(&type))
+            return false;
+
+        if (type == EOO)
+            return _endObj();
+
+        if (!_scanCString())
+            return false;
+
+        switch (type) {
+            case MinKey:
+            case MaxKey:
+            case jstNULL:
+            case Undefined:
+                return true;
+
+            case jstOID:
+                return _skip(OID::kOIDSize);
+
+            case NumberInt:
+                return _skip(sizeof(int32_t));
+
+            case Bool: {
+                uint8_t val;
+                return _readByte(&val) && val <= 1;
+            }
+
+            case NumberDouble:
+            case NumberLong:
+            case bsonTimestamp:
+            case Date:
+                return _skip(sizeof(int64_t));
+
+            case NumberDecimal:
+                return _skip(sizeof(Decimal128::Value));
+
+            case DBRef:
+                return _validateString() && _skip(OID::kOIDSize);
+
+            case RegEx:
+                return _scanCString() && _scanCString();
+
+            case Code:
+            case Symbol:
+            case String:
+                return _validateString();
+
+            case BinData: {
+                int32_t sz;
+                if (!_readInt32(&sz))
+                    return false;
+                if (sz < 0 || sz == std::numeric_limits<int32_t>::max())
+                    return false;
+                return _skip(1 + static_cast<uint64_t>(sz));
+            }
+
+            case CodeWScope: {
+                const uint64_t startPosition = _position;
+                int32_t size;
+                if (!_readInt32(&size))
+                    return false;
+                _frames.push_back({startPosition + static_cast<uint64_t>(size), true});
+                return _validateString() && _beginObj();
+            }
+
+            case Object:
+            case Array:
+                return _beginObj();
+
+            default:
+                return false;
+        }
+    }
+
+    const char* const _buffer;
+    uint64_t _position = 0;
+    const uint64_t _maxLength;
+    std::vector<Frame> _frames;
+};
+#endif  // MONGO_BSON_VALIDATE_HAVE_FAST_PATH
+
 }  // namespace
 
 Status validateBSON(const char* originalBuffer, uint64_t maxLength, BSONVersion version) {
@@ -424,6 +633,14 @@ Status validateBSON(const char* originalBuffer, uint64_t maxLength, BSONVersion
         return Status(ErrorCodes::InvalidBSON, "bson data has to be at least 5 bytes");
     }
 
+#ifdef MONGO_BSON_VALIDATE_HAVE_FAST_PATH
+    if (FastValidator(originalBuffer, maxLength).validate()) {
+        return Status::OK();
+    }
+    // The buffer is malformed (or has a rare shape the fast path declined): rerun the state
+    // machine pass to build the detailed error Status, including the _id of the object.
+#endif
+
     Buffer buf(originalBuffer, maxLength, version);
     return validateBSONIterative(&buf);
 }
@@ -66,7 +66,7 @@ string BSONElement::jsonString(JsonStringFormat format, bool includeFieldNames,
 void BSONElement::jsonStringStream(JsonStringFormat format,
                                    bool includeFieldNames,
                                    int pretty,
-                                   std::stringstream& s) const {
+                                   std::ostream& s) const {
     if (includeFieldNames)
         s << '"' << escape(fieldName()) << "\" : ";
     switch (type()) {
@@ -34,6 +34,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <iosfwd>
 #include <string.h>  // strlen
 #include <string>
 #include <vector>
@@ -218,7 +219,7 @@ public:
     void jsonStringStream(JsonStringFormat format,
                           bool includeFieldNames,
                           int pretty,
-                          std::stringstream& s) const;
+                          std::ostream& s) const;
 
     operator std::string() const {
         return toString();
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <bitset>
+#include <iosfwd>
 #include <list>
 #include <set>
 #include <string>
@@ -265,10 +266,14 @@ public:
                            int pretty = 0,
                            bool isArray = false) const;
 
+    /** Streams the JSON representation directly into 's' without building an intermediate
+        string. Callers that serialize large objects can pass an ostream over a
+        caller-supplied buffer (or a socket) to avoid the copy jsonString() makes.
+    */
     void jsonStringStream(JsonStringFormat format,
                           int pretty,
                           bool isArray,
-                          std::stringstream& s) const;
+                          std::ostream& s) const;
 
     /** note: addFields always adds _id even if not specified */
     int addFields(BSONObj& from, std::set<std::string>& fields); /* returns n added */
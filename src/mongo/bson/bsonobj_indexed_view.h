@@ -0,0 +1,108 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+/**
+ * A caller-held view over a BSONObj that accelerates repeated field lookups.
+ *
+ * BSONObj::getField() is a linear scan, so k lookups against an n-field document cost
+ * O(n * k). This view builds a small (field name, element offset) index on the first lookup,
+ * sorted by name, and answers subsequent lookups with a binary search: O(n log n) once, then
+ * O(log n) per lookup. It pays off when several lookups hit the same wide document, e.g.
+ * shard key extraction or projection over documents with hundreds of fields.
+ *
+ * The view does not own the object's buffer; the BSONObj it was constructed from must stay
+ * valid for the view's lifetime. Lookups are not safe to call concurrently from multiple
+ * threads, since the first one builds the index.
+ */
+class BSONObjIndexedView {
+public:
+    explicit BSONObjIndexedView(const BSONObj& obj) : _obj(obj) {}
+
+    /**
+     * Returns the first element with the given field name, like BSONObj::getField(), or an
+     * EOO element if there is none.
+     */
+    BSONElement getField(StringData name) const {
+        if (_entries.empty() && !_obj.isEmpty()) {
+            _buildIndex();
+        }
+        auto it = std::lower_bound(
+            _entries.begin(), _entries.end(), name, [](const Entry& entry, StringData name) {
+                return entry.name < name;
+            });
+        if (it == _entries.end() || it->name != name) {
+            return BSONElement();
+        }
+        return BSONElement(_obj.objdata() + it->offset);
+    }
+
+    BSONElement operator[](StringData name) const {
+        return getField(name);
+    }
+
+    bool hasField(StringData name) const {
+        return !getField(name).eoo();
+    }
+
+private:
+    struct Entry {
+        StringData name;
+        int offset;
+    };
+
+    void _buildIndex() const {
+        for (BSONObjIterator it(_obj); it.more();) {
+            const BSONElement e = it.next();
+            const int offset = static_cast<int>(e.rawdata() - _obj.objdata());
+            _entries.push_back({e.fieldNameStringData(), offset});
+        }
+        // Order duplicate names by offset so getField() returns the first occurrence, as
+        // BSONObj::getField() does.
+        std::sort(_entries.begin(), _entries.end(), [](const Entry& lhs, const Entry& rhs) {
+            if (lhs.name != rhs.name)
+                return lhs.name < rhs.name;
+            return lhs.offset < rhs.offset;
+        });
+    }
+
+    BSONObj _obj;
+    mutable std::vector<Entry> _entries;
+};
+
+}  // namespace mongo
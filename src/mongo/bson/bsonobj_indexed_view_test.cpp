@@ -0,0 +1,82 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/bsonobj_indexed_view.h"
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONObjIndexedView, FindsEveryFieldOfWideObject) {
+    BSONObjBuilder builder;
+    for (int i = 0; i < 250; ++i) {
+        builder.append("field" + std::to_string(i), i);
+    }
+    const BSONObj obj = builder.obj();
+
+    BSONObjIndexedView view(obj);
+    for (int i = 0; i < 250; ++i) {
+        const std::string name = "field" + std::to_string(i);
+        ASSERT_EQUALS(view.getField(name).numberInt(), i);
+        ASSERT_BSONELT_EQ(view.getField(name), obj.getField(name));
+    }
+}
+
+TEST(BSONObjIndexedView, MissingFieldIsEOO) {
+    const BSONObj obj = BSON("a" << 1 << "b" << 2);
+    BSONObjIndexedView view(obj);
+    ASSERT_TRUE(view.getField("c").eoo());
+    ASSERT_FALSE(view.hasField("c"));
+    ASSERT_TRUE(view.hasField("b"));
+}
+
+TEST(BSONObjIndexedView, EmptyObject) {
+    BSONObjIndexedView view(BSONObj{});
+    ASSERT_TRUE(view.getField("a").eoo());
+}
+
+TEST(BSONObjIndexedView, DuplicateFieldsReturnFirstOccurrence) {
+    // Build a document with a duplicated field name, as getField() callers may see from
+    // untrusted inputs. The view must agree with BSONObj::getField() and return the first.
+    BSONObjBuilder builder;
+    builder.append("a", 1);
+    builder.append("dup", 10);
+    builder.append("dup", 20);
+    const BSONObj obj = builder.obj();
+
+    BSONObjIndexedView view(obj);
+    ASSERT_EQUALS(view.getField("dup").numberInt(), 10);
+    ASSERT_BSONELT_EQ(view.getField("dup"), obj.getField("dup"));
+}
+
+}  // namespace
+}  // namespace mongo
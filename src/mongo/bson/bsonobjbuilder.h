@@ -60,6 +60,40 @@ namespace mongo {
 #pragma warning(disable : 4355)
 #endif
 
+/** A caller-owned pool holding one reusable buffer for BSONObjBuilders on hot paths.
+    A builder constructed with an arena draws its buffer from the arena instead of allocating,
+    and returns it (retaining the high-water-mark capacity) when the builder is destroyed.
+    Code that builds one document per loop iteration against the same arena therefore stops
+    paying the per-document malloc/realloc chain once the arena has grown to the size of the
+    largest document seen.
+
+    The arena must outlive any builder using it, and only one builder may draw from it at a
+    time. If the built object escapes via obj(), the buffer goes with it and the arena simply
+    allocates a fresh one for the next builder.
+*/
+class BSONObjBuilderArena {
+    MONGO_DISALLOW_COPYING(BSONObjBuilderArena);
+
+public:
+    explicit BSONObjBuilderArena(int initsize = 512) : _buf(SharedBuffer::allocate(initsize)) {}
+
+private:
+    friend class BSONObjBuilder;
+
+    SharedBuffer acquire() {
+        return std::move(_buf);
+    }
+
+    void recycle(SharedBuffer buf) {
+        // A shared buffer has escaped into a BSONObj and cannot be handed to another builder.
+        if (buf && !buf.isShared() && buf.capacity() > _buf.capacity()) {
+            _buf = std::move(buf);
+        }
+    }
+
+    SharedBuffer _buf;
+};
+
 /** Utility for creating a BSONObj.
     See also the BSON() and BSON_ARRAY() macros.
 */
@@ -97,6 +131,18 @@ public:
         _b.reserveBytes(1);
     }
 
+    /** @param arena construct a BSONObjBuilder that draws its buffer from a caller-owned
+     *  arena and hands it back on destruction. See BSONObjBuilderArena.
+     */
+    BSONObjBuilder(BSONObjBuilderArena& arena)
+        : _b(_buf), _buf(0), _offset(0), _s(this), _tracker(0), _doneCalled(false), _arena(&arena) {
+        _buf.useSharedBuffer(arena.acquire());
+
+        // See the comments in the first constructor for details.
+        _b.skip(sizeof(int));
+        _b.reserveBytes(1);
+    }
+
     // Tag for a special overload of BSONObjBuilder that allows the user to continue
     // building in to an existing BufBuilder that has already been built in to. Use with caution.
     struct ResumeBuildingTag {};
@@ -162,7 +208,9 @@ public:
           _offset(std::move(other._offset)),
           _s(this),  // Don't move from other._s because that will leave it pointing to other.
           _tracker(std::move(other._tracker)),
-          _doneCalled(std::move(other._doneCalled)) {
+          _doneCalled(std::move(other._doneCalled)),
+          _arena(other._arena) {
+        other._arena = nullptr;
         other.abandon();
     }
 
@@ -174,6 +222,11 @@ public:
         if (!_doneCalled && _b.buf() && _buf.getSize() == 0) {
             _done();
         }
+
+        // Hand our buffer back for reuse by the next builder, unless obj() gave it away.
+        if (_arena && owned()) {
+            _arena->recycle(_buf.release());
+        }
     }
 
     /**
@@ -806,6 +859,7 @@ private:
     BSONObjBuilderValueStream _s;
     BSONSizeTracker* _tracker;
     bool _doneCalled;
+    BSONObjBuilderArena* _arena = nullptr;
 
     static const std::string numStrs[100];  // cache of 0 to 99 inclusive
     static bool numStrsReady;               // for static init safety
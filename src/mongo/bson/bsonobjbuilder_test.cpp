@@ -510,6 +510,42 @@ TEST(BSONObjBuilderTest, SizeChecks) {
     }
 }
 
+TEST(BSONObjBuilderTest, ArenaBuilderReusesBufferAcrossDocuments) {
+    BSONObjBuilderArena arena(16);
+    const char* firstBuf = nullptr;
+    {
+        BSONObjBuilder builder(arena);
+        builder.append("a", std::string(128, 'x'));
+        BSONObj obj = builder.done();
+        ASSERT_EQUALS(obj["a"].str(), std::string(128, 'x'));
+        firstBuf = obj.objdata();
+    }
+    {
+        // The second builder should pick up the first builder's grown buffer.
+        BSONObjBuilder builder(arena);
+        builder.append("b", 1);
+        BSONObj obj = builder.done();
+        ASSERT_EQUALS(obj["b"].numberInt(), 1);
+        ASSERT_EQUALS(firstBuf, obj.objdata());
+    }
+}
+
+TEST(BSONObjBuilderTest, ArenaBuilderObjTakesOwnershipAwayFromArena) {
+    BSONObjBuilderArena arena;
+    BSONObj escaped;
+    {
+        BSONObjBuilder builder(arena);
+        builder.append("a", 1);
+        escaped = builder.obj();
+    }
+    // The escaped object must remain valid after the builder is gone, and the arena must
+    // still be usable for subsequent builders.
+    ASSERT_EQUALS(escaped["a"].numberInt(), 1);
+    BSONObjBuilder builder(arena);
+    builder.append("b", 2);
+    ASSERT_EQUALS(builder.done()["b"].numberInt(), 2);
+}
+
 
 }  // namespace
 }  // namespace mongo
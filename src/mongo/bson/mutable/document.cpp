@@ -41,6 +41,7 @@
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/inline_decls.h"
 #include "mongo/bson/mutable/damage_vector.h"
+#include "mongo/stdx/memory.h"
 #include "mongo/util/debug_util.h"
 
 namespace mongo {
@@ -2259,6 +2260,11 @@ Document::Document() : _impl(new Impl(Document::kInPlaceDisabled)), _root(makeRo
     dassert(_root._repIdx == kRootRepIdx);
 }
 
+Document::Document(DocumentArena& arena)
+    : _impl(arena.acquire()), _root(makeRootElement()), _arena(&arena) {
+    dassert(_root._repIdx == kRootRepIdx);
+}
+
 Document::Document(const BSONObj& value, InPlaceMode inPlaceMode)
     : _impl(new Impl(inPlaceMode)), _root(makeRootElement(value)) {
     dassert(_root._repIdx == kRootRepIdx);
@@ -2278,7 +2284,29 @@ void Document::reset(const BSONObj& value, InPlaceMode inPlaceMode) {
     dassert(_root._repIdx == kRootRepIdx);
 }
 
-Document::~Document() {}
+Document::~Document() {
+    if (_arena)
+        _arena->recycle(std::move(_impl));
+}
+
+DocumentArena::DocumentArena() {}
+
+DocumentArena::~DocumentArena() {}
+
+std::unique_ptr<Document::Impl> DocumentArena::acquire() {
+    if (_pool.empty())
+        return stdx::make_unique<Document::Impl>(Document::kInPlaceDisabled);
+    std::unique_ptr<Document::Impl> impl = std::move(_pool.back());
+    _pool.pop_back();
+    // Bring the recycled storage back to the state a fresh Impl starts in; its buffers keep
+    // the capacity they grew to during their previous life.
+    impl->reset(Document::kInPlaceDisabled);
+    return impl;
+}
+
+void DocumentArena::recycle(std::unique_ptr<Document::Impl> impl) {
+    _pool.push_back(std::move(impl));
+}
 
 void Document::reserveDamageEvents(size_t expectedEvents) {
     return getImpl().reserveDamageEvents(expectedEvents);
@@ -31,6 +31,8 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "mongo/base/disallow_copying.h"
 #include "mongo/base/string_data.h"
@@ -232,6 +234,8 @@ namespace mutablebson {
  *  ConstElement for the root. ConstElement is much like Element, but does not permit
  *  mutations. See the class comment for ConstElement for more information.
  */
+class DocumentArena;
+
 class Document {
     // TODO: In principle there is nothing that prevents implementing a deep copy for
     // Document, but for now it is not permitted.
@@ -245,6 +249,11 @@ public:
     /** Construct a new empty document. */
     Document();
 
+    /** Construct a new empty document whose storage is drawn from 'arena' and returned to
+     *  it on destruction. The arena must outlive this document. See DocumentArena.
+     */
+    explicit Document(DocumentArena& arena);
+
     enum InPlaceMode {
         kInPlaceDisabled = 0,
         kInPlaceEnabled = 1,
@@ -503,6 +512,7 @@ public:
 
 private:
     friend class Element;
+    friend class DocumentArena;
 
     // For now, the implementation of Document is firewalled.
     class Impl;
@@ -513,10 +523,41 @@ private:
     Element makeRootElement(const BSONObj& value);
     Element makeElement(ConstElement element, const StringData* fieldName);
 
-    const std::unique_ptr<Impl> _impl;
+    std::unique_ptr<Impl> _impl;
 
     // The root element of this document.
     const Element _root;
+
+    // Non-null if this document's storage was drawn from an arena, to which it returns on
+    // destruction.
+    DocumentArena* const _arena = nullptr;
+};
+
+/** A reuse pool for the storage behind Document.
+ *
+ *  A Document constructed from an arena draws its internal storage (element vectors, field
+ *  name heap, leaf buffer) from the pool and returns it, capacities intact, when the
+ *  Document is destroyed. Code that creates and destroys Documents at a high rate (e.g. one
+ *  update driver per operation) can hold one arena per thread and stop paying the
+ *  allocation and warm-up cost for every Document.
+ *
+ *  The arena is not synchronized: it must not be used, and Documents drawing from it must
+ *  not be destroyed, on any thread other than the arena's own.
+ */
+class DocumentArena {
+    MONGO_DISALLOW_COPYING(DocumentArena);
+
+public:
+    DocumentArena();
+    ~DocumentArena();
+
+private:
+    friend class Document;
+
+    std::unique_ptr<Document::Impl> acquire();
+    void recycle(std::unique_ptr<Document::Impl> impl);
+
+    std::vector<std::unique_ptr<Document::Impl>> _pool;
 };
 
 }  // namespace mutablebson
@@ -1085,6 +1085,22 @@ TEST(Document, LifecycleConstructDefault) {
     ASSERT_FALSE(doc.root().hasValue());
 }
 
+TEST(Document, LifecycleConstructFromArena) {
+    // Documents drawing from an arena behave like default-constructed ones, and storage is
+    // recycled between successive documents.
+    mmb::DocumentArena arena;
+    for (int i = 0; i < 3; ++i) {
+        mmb::Document doc(arena);
+        ASSERT_TRUE(doc.root().ok());
+        ASSERT_TRUE(doc.root().isType(mongo::Object));
+        ASSERT_OK(doc.root().appendInt("a", i));
+        ASSERT_EQUALS(mongo::BSON("a" << i), doc.getObject());
+
+        doc.reset(mongo::BSON("b" << i), mmb::Document::kInPlaceEnabled);
+        ASSERT_EQUALS(mongo::BSON("b" << i), doc.getObject());
+    }
+}
+
 TEST(Document, LifecycleConstructEmptyBSONObj) {
     // Verify the state of a newly created empty Document where the construction argument
     // is an empty BSONObj.
@@ -62,16 +62,37 @@ MONGO_INITIALIZER_GENERAL(OIDGeneration, MONGO_NO_PREREQUISITES, ("default"))
     return Status::OK();
 }
 
-OID::Increment OID::Increment::next() {
-    uint64_t nextCtr = counter->fetchAndAdd(1);
+namespace {
+OID::Increment incrementFromCounter(uint64_t ctr) {
     OID::Increment incr;
 
-    incr.bytes[0] = uint8_t(nextCtr >> 16);
-    incr.bytes[1] = uint8_t(nextCtr >> 8);
-    incr.bytes[2] = uint8_t(nextCtr);
+    incr.bytes[0] = uint8_t(ctr >> 16);
+    incr.bytes[1] = uint8_t(ctr >> 8);
+    incr.bytes[2] = uint8_t(ctr);
 
     return incr;
 }
+}  // namespace
+
+OID::Increment OID::Increment::next() {
+    return incrementFromCounter(counter->fetchAndAdd(1));
+}
+
+void OID::genBatch(size_t count, OID* out) {
+    if (count == 0)
+        return;
+
+    // Reserve the whole range of increments with one atomic add. The 3-byte increment wraps
+    // naturally, exactly as repeated single-OID generation would.
+    uint64_t nextCtr = counter->fetchAndAdd(static_cast<uint32_t>(count));
+    const Timestamp timestamp = time(0);
+
+    for (size_t i = 0; i != count; ++i, ++nextCtr) {
+        out[i].setTimestamp(timestamp);
+        out[i].setInstanceUnique(_instanceUnique);
+        out[i].setIncrement(incrementFromCounter(nextCtr));
+    }
+}
 
 OID::InstanceUnique OID::InstanceUnique::generate(SecureRandom& entropy) {
     int64_t rand = entropy.nextInt64();
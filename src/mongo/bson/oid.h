@@ -118,6 +118,14 @@ public:
         return o;
     }
 
+    /**
+     * Generates 'count' fresh OIDs into 'out'. The whole batch shares a single reservation
+     * on the process-wide counter (one atomic add instead of one per OID), so this is the
+     * preferred way to assign ids to a batch of documents, e.g. inserts without a
+     * client-supplied _id.
+     */
+    static void genBatch(size_t count, OID* out);
+
     MONGO_STATIC_ASSERT_MSG(sizeof(int64_t) == kInstanceUniqueSize + kIncrementSize,
                             "size of term must be size of instance unique + increment");
 
@@ -28,6 +28,10 @@
  *    it in the license file.
  */
 
+#include <cstring>
+#include <set>
+#include <vector>
+
 #include "mongo/bson/oid.h"
 
 #include "mongo/platform/endian.h"
@@ -54,6 +58,26 @@ TEST(NotEquals, Simple) {
     ASSERT_NOT_EQUALS(o1.compare(o2), 0);
 }
 
+TEST(GenBatch, UniqueAndConsecutive) {
+    const size_t count = 100;
+    std::vector<mongo::OID> batch(count);
+    mongo::OID::genBatch(count, batch.data());
+
+    std::set<mongo::OID> unique(batch.begin(), batch.end());
+    ASSERT_EQUALS(unique.size(), count);
+
+    // The batch shares one reservation on the counter, so increments are consecutive.
+    for (size_t i = 1; i < count; ++i) {
+        ASSERT_EQUALS(memcmp(batch[i - 1].getInstanceUnique().bytes,
+                             batch[i].getInstanceUnique().bytes,
+                             mongo::OID::kInstanceUniqueSize),
+                      0);
+    }
+
+    // A subsequently generated OID must not collide with the batch.
+    ASSERT_EQUALS(unique.count(mongo::OID::gen()), 0u);
+}
+
 TEST(Increasing, Simple) {
     OID o1 = OID::gen();
     OID o2 = OID::gen();
@@ -0,0 +1,169 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstring>
+
+#include "mongo/base/data_view.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/oid.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+/**
+ * Precomputed byte template for documents whose shape is fixed.
+ *
+ * A stencil is built once from a prototype document and captures its entire BSON byte image:
+ * length header, type bytes, field names, and any constant values. Producing a document is
+ * then a single memcpy of the image plus in-place writes of the variable fields, instead of
+ * a field-by-field rebuild through BSONObjBuilder. Intended for internal documents with a
+ * compile-time-known shape (oplog entries, config.transactions records) on hot write paths.
+ *
+ * Only fixed-width value types can be patched after stamping: NumberInt, NumberLong,
+ * NumberDouble, Date, bsonTimestamp, Bool and jstOID. Variable-width values (strings,
+ * subobjects, arrays) must be part of the constant image.
+ *
+ * Usage:
+ *     static const BSONStencil stencil(BSON("op" << "i" << "ts" << Timestamp() << "t" << 0LL));
+ *     static const auto tsField = stencil.field("ts");
+ *     static const auto tField = stencil.field("t");
+ *
+ *     BufBuilder bb;
+ *     auto writer = stencil.stamp(bb);
+ *     writer.set(tsField, newTs);
+ *     writer.set(tField, term);
+ */
+class BSONStencil {
+public:
+    /**
+     * Opaque handle naming a patchable field of the stencil. Resolve handles once, next to
+     * the stencil itself; resolution is a field lookup, stamping is not.
+     */
+    class Field {
+    public:
+        Field() = default;
+
+    private:
+        friend class BSONStencil;
+        Field(int offset, BSONType type) : _offset(offset), _type(type) {}
+
+        int _offset = 0;
+        BSONType _type = EOO;
+    };
+
+    /**
+     * Patches variable fields of one stamped image. Remains valid while the underlying
+     * BufBuilder holds the stamped bytes, even across reallocation.
+     */
+    class Writer {
+    public:
+        void set(Field field, int value) {
+            _write(field, NumberInt, value);
+        }
+        void set(Field field, long long value) {
+            _write(field, NumberLong, value);
+        }
+        void set(Field field, double value) {
+            _write(field, NumberDouble, value);
+        }
+        void set(Field field, bool value) {
+            _write(field, Bool, static_cast<char>(value ? 1 : 0));
+        }
+        void set(Field field, Date_t value) {
+            _write(field, Date, value.toMillisSinceEpoch());
+        }
+        void set(Field field, Timestamp value) {
+            _write(field, bsonTimestamp, value.asULL());
+        }
+        void set(Field field, const OID& value) {
+            dassert(field._type == jstOID);
+            memcpy(_builder->buf() + _start + field._offset, value.view().view(), OID::kOIDSize);
+        }
+
+    private:
+        friend class BSONStencil;
+        Writer(BufBuilder& builder, int start) : _builder(&builder), _start(start) {}
+
+        template <typename T>
+        void _write(Field field, BSONType type, T value) {
+            dassert(field._type == type);
+            DataView(_builder->buf() + _start + field._offset).write(tagLittleEndian(value));
+        }
+
+        BufBuilder* _builder;
+        int _start;
+    };
+
+    explicit BSONStencil(const BSONObj& prototype) : _image(prototype.getOwned()) {}
+
+    /**
+     * Resolves the handle for a top-level field of the prototype. The field must exist and
+     * hold a fixed-width type; anything else is a programming error.
+     */
+    Field field(StringData name) const {
+        BSONElement elem = _image.getField(name);
+        invariant(!elem.eoo());
+        switch (elem.type()) {
+            case NumberInt:
+            case NumberLong:
+            case NumberDouble:
+            case Bool:
+            case Date:
+            case bsonTimestamp:
+            case jstOID:
+                break;
+            default:
+                invariant(!"BSONStencil fields must hold fixed-width types");
+        }
+        return Field(static_cast<int>(elem.value() - _image.objdata()), elem.type());
+    }
+
+    /**
+     * Appends a fresh copy of the image to 'builder' and returns a Writer positioned over
+     * it. The image is a complete, valid document; unpatched fields keep their prototype
+     * values.
+     */
+    Writer stamp(BufBuilder& builder) const {
+        memcpy(builder.grow(_image.objsize()), _image.objdata(), _image.objsize());
+        return Writer(builder, builder.len() - _image.objsize());
+    }
+
+    int objsize() const {
+        return _image.objsize();
+    }
+
+private:
+    BSONObj _image;
+};
+
+}  // namespace mongo
@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/bson/util/bson_stencil.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONStencil, StampedImageMatchesPrototype) {
+    const BSONStencil stencil(BSON("op"
+                                   << "i"
+                                   << "t" << 0LL));
+    BufBuilder bb;
+    stencil.stamp(bb);
+    BSONObj obj(bb.buf());
+    ASSERT_BSONOBJ_EQ(obj,
+                      BSON("op"
+                           << "i"
+                           << "t" << 0LL));
+}
+
+TEST(BSONStencil, PatchesFixedWidthFields) {
+    const BSONStencil stencil(BSON("op"
+                                   << "i"
+                                   << "ts" << Timestamp() << "t" << 0LL << "v" << 0.0 << "b"
+                                   << false << "_id" << OID()));
+    const auto tsField = stencil.field("ts");
+    const auto tField = stencil.field("t");
+    const auto vField = stencil.field("v");
+    const auto bField = stencil.field("b");
+    const auto idField = stencil.field("_id");
+
+    const OID oid = OID::gen();
+    BufBuilder bb;
+    auto writer = stencil.stamp(bb);
+    writer.set(tsField, Timestamp(42, 7));
+    writer.set(tField, 12345LL);
+    writer.set(vField, 2.5);
+    writer.set(bField, true);
+    writer.set(idField, oid);
+
+    BSONObj obj(bb.buf());
+    ASSERT_EQUALS(obj["op"].str(), "i");
+    ASSERT_EQUALS(obj["ts"].timestamp().asULL(), Timestamp(42, 7).asULL());
+    ASSERT_EQUALS(obj["t"].numberLong(), 12345LL);
+    ASSERT_EQUALS(obj["v"].numberDouble(), 2.5);
+    ASSERT_EQUALS(obj["b"].boolean(), true);
+    ASSERT_EQUALS(obj["_id"].OID(), oid);
+}
+
+TEST(BSONStencil, RepeatedStampsIntoOneBuffer) {
+    const BSONStencil stencil(BSON("n" << 0));
+    const auto nField = stencil.field("n");
+
+    BufBuilder bb;
+    for (int i = 0; i < 3; ++i) {
+        auto writer = stencil.stamp(bb);
+        writer.set(nField, i);
+    }
+
+    const char* p = bb.buf();
+    for (int i = 0; i < 3; ++i) {
+        BSONObj obj(p);
+        ASSERT_EQUALS(obj["n"].numberInt(), i);
+        p += obj.objsize();
+    }
+}
+
+}  // namespace
+}  // namespace mongo
@@ -34,6 +34,7 @@
 
 #include <cfloat>
 #include <cinttypes>
+#include <cmath>
 #include <cstdint>
 #include <sstream>
 #include <stdio.h>
@@ -53,6 +54,7 @@
 #include "mongo/stdx/type_traits.h"
 #include "mongo/util/allocator.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/buffer_pool.h"
 #include "mongo/util/itoa.h"
 #include "mongo/util/shared_buffer.h"
 
@@ -155,6 +157,49 @@ private:
     void* _ptr = _buf;
 };
 
+/**
+ * Allocator that recycles builder buffers through the global size-classed BufferPool instead of
+ * hitting malloc/free on every use. Because every buffer must return to the pool, release() is
+ * not supported: use it for builders whose output is copied out (str(), BSONObj copies), not
+ * handed off.
+ */
+class PooledBufferAllocator {
+    MONGO_DISALLOW_COPYING(PooledBufferAllocator);
+
+public:
+    PooledBufferAllocator() = default;
+    ~PooledBufferAllocator() {
+        free();
+    }
+
+    void malloc(size_t sz) {
+        _ptr = BufferPool::allocate(sz);
+        _size = sz;
+    }
+    void realloc(size_t sz) {
+        _ptr = BufferPool::reallocate(_ptr, _size, sz);
+        _size = sz;
+    }
+    void free() {
+        if (_ptr) {
+            BufferPool::deallocate(_ptr, _size);
+            _ptr = nullptr;
+            _size = 0;
+        }
+    }
+
+    // Not supported on this allocator.
+    void release() = delete;
+
+    char* get() const {
+        return _ptr;
+    }
+
+private:
+    char* _ptr = nullptr;
+    size_t _size = 0;
+};
+
 template <class BufferAllocator>
 class _BufBuilder {
 public:
@@ -368,6 +413,10 @@ private:
 typedef _BufBuilder<SharedBufferAllocator> BufBuilder;
 MONGO_STATIC_ASSERT(std::is_move_constructible<BufBuilder>::value);
 
+/** A BufBuilder whose buffer is drawn from and returned to the global BufferPool. release() is
+    not available; see PooledBufferAllocator. */
+typedef _BufBuilder<PooledBufferAllocator> PooledBufBuilder;
+
 /** The StackBufBuilder builds smaller datasets on the stack instead of using malloc.
       this can be significantly faster for small bufs.  However, you can not release() the
       buffer with StackBufBuilder.
@@ -398,6 +447,16 @@ public:
     StringBuilderImpl() {}
 
     StringBuilderImpl& operator<<(double x) {
+        // Fast path for integral values small enough that %g would print every digit anyway:
+        // the common case for counters carried as doubles in log lines and serverStatus. The
+        // range check also rejects NaN and infinity before the cast. Everything else keeps
+        // snprintf.
+        if (x > -1e6 && x < 1e6) {
+            const auto asInt = static_cast<long long>(x);
+            if (static_cast<double>(asInt) == x && !(asInt == 0 && std::signbit(x))) {
+                return appendIntegral(asInt, MONGO_S64_SIZE);
+            }
+        }
         return SBNUM(x, MONGO_DBL_SIZE, "%g");
     }
     StringBuilderImpl& operator<<(int x) {
@@ -466,6 +525,18 @@ public:
     StringBuilderImpl& operator<<(R (*val)(Args...)) = delete;
 
     void appendDoubleNice(double x) {
+        // Integral doubles below 10^15 print under %.16g as plain digits with no exponent, so
+        // format them with the integer fast path and add the trailing ".0" directly. This is
+        // the BSON-to-JSON double path. Negative zero falls through so it keeps its sign.
+        if (x > -1e15 && x < 1e15) {
+            const auto asInt = static_cast<long long>(x);
+            if (static_cast<double>(asInt) == x && !(asInt == 0 && std::signbit(x))) {
+                *this << asInt;
+                write(".0", 2);
+                return;
+            }
+        }
+
         const int prev = _buf.l;
         const int maxSize = 32;
         char* start = _buf.grow(maxSize);
@@ -538,4 +609,5 @@ private:
 
 typedef StringBuilderImpl<SharedBufferAllocator> StringBuilder;
 typedef StringBuilderImpl<StackAllocator> StackStringBuilder;
+typedef StringBuilderImpl<PooledBufferAllocator> PooledStringBuilder;
 }  // namespace mongo
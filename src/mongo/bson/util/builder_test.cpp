@@ -87,6 +87,27 @@ TEST(Builder, StackAllocatorShouldNotLeak) {
     // Let the builder go out of scope. If this leaks, it will trip the ASAN leak detector.
 }
 
+TEST(Builder, PooledBufBuilderRecyclesBuffers) {
+    const auto hitsBefore = BufferPool::stats().hits;
+    {
+        PooledBufBuilder b;
+        b.appendStr("hello");
+    }
+    {
+        // The first builder's buffer went back to this thread's cache; this one should get it.
+        PooledBufBuilder b;
+        b.appendStr("world");
+        ASSERT_EQUALS(6, b.len());
+    }
+    ASSERT_GT(BufferPool::stats().hits, hitsBefore);
+}
+
+TEST(Builder, PooledStringBuilderBasic) {
+    PooledStringBuilder sb;
+    sb << "pooled " << 42;
+    ASSERT_EQUALS("pooled 42", sb.str());
+}
+
 template <typename T>
 void testStringBuilderIntegral() {
     auto check = [](T num) { ASSERT_EQ(std::string(str::stream() << num), std::to_string(num)); };
@@ -803,6 +803,7 @@ void AuthorizationSessionImpl::_refreshUserInfoAsNeeded(OperationContext* opCtx)
 
 void AuthorizationSessionImpl::_buildAuthenticatedRolesVector() {
     _authenticatedRoleNames.clear();
+    _mergedPrivileges.clear();
     for (UserSet::iterator it = _authenticatedUsers.begin(); it != _authenticatedUsers.end();
          ++it) {
         RoleNameIterator roles = (*it)->getIndirectRoles();
@@ -810,6 +811,12 @@ void AuthorizationSessionImpl::_buildAuthenticatedRolesVector() {
             RoleName roleName = roles.next();
             _authenticatedRoleNames.push_back(RoleName(roleName.getRole(), roleName.getDB()));
         }
+
+        // Merge this user's privileges into the per-resource-pattern map consulted by privilege
+        // checks, so the checks do not have to walk the user set.
+        for (const auto& privilege : (*it)->getPrivileges()) {
+            _mergedPrivileges[privilege.first].addAllActionsFromSet(privilege.second.getActions());
+        }
     }
 }
 
@@ -868,10 +875,9 @@ bool AuthorizationSessionImpl::isAuthorizedForAnyActionOnResource(const Resource
         buildResourceSearchList(resource, resourceSearchList.data());
 
     for (int i = 0; i < resourceSearchListLength; ++i) {
-        for (const auto& user : _authenticatedUsers) {
-            if (user->hasActionsForResource(resourceSearchList[i])) {
-                return true;
-            }
+        const auto it = _mergedPrivileges.find(resourceSearchList[i]);
+        if (it != _mergedPrivileges.end() && !it->second.empty()) {
+            return true;
         }
     }
 
@@ -902,14 +908,16 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
         }
     }
 
-    for (const auto& user : _authenticatedUsers) {
-        for (int i = 0; i < resourceSearchListLength; ++i) {
-            ActionSet userActions = user->getActionsForResource(resourceSearchList[i]);
-            unmetRequirements.removeAllActionsFromSet(userActions);
+    for (int i = 0; i < resourceSearchListLength; ++i) {
+        const auto it = _mergedPrivileges.find(resourceSearchList[i]);
+        if (it == _mergedPrivileges.end()) {
+            continue;
+        }
 
-            if (unmetRequirements.empty()) {
-                return true;
-            }
+        unmetRequirements.removeAllActionsFromSet(it->second);
+
+        if (unmetRequirements.empty()) {
+            return true;
         }
     }
 
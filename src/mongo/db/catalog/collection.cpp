@@ -100,21 +100,30 @@ std::string CompactOptions::toString() const {
 // CappedInsertNotifier
 //
 
-CappedInsertNotifier::CappedInsertNotifier() : _version(0), _dead(false) {}
+CappedInsertNotifier::CappedInsertNotifier() : _dead(false) {}
 
 void CappedInsertNotifier::notifyAll() {
+    // The version must be advanced before we look for waiters. Both counters are sequentially
+    // consistent, so either this thread observes the waiter below, or the waiter observes the new
+    // version before it goes to sleep; a wakeup cannot be lost.
+    _version.fetchAndAdd(1);
+    if (_waiters.load() == 0) {
+        // Nobody is tailing this collection, so the insert path can skip the mutex entirely.
+        return;
+    }
     stdx::lock_guard<stdx::mutex> lk(_mutex);
-    ++_version;
     _notifier.notify_all();
 }
 
 void CappedInsertNotifier::waitUntil(uint64_t prevVersion, Date_t deadline) const {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
-    while (!_dead && prevVersion == _version) {
+    _waiters.fetchAndAdd(1);
+    while (!_dead && prevVersion == _version.load()) {
         if (stdx::cv_status::timeout == _notifier.wait_until(lk, deadline.toSystemTimePoint())) {
-            return;
+            break;
         }
     }
+    _waiters.fetchAndSubtract(1);
 }
 
 void CappedInsertNotifier::kill() {
@@ -56,6 +56,7 @@
 #include "mongo/db/storage/capped_callback.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/snapshot.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/functional.h"
 #include "mongo/stdx/mutex.h"
@@ -64,6 +65,7 @@ namespace mongo {
 class CollectionCatalogEntry;
 class DatabaseCatalogEntry;
 class ExtentManager;
+class FieldRefSetWithStorage;
 class IndexCatalog;
 class IndexDescriptor;
 class DatabaseImpl;
@@ -98,6 +100,12 @@ struct CollectionUpdateArgs {
     bool fromMigrate = false;
 
     StoreDocOption storeDocOption = StoreDocOption::None;
+
+    // When non-null, the set of paths modified by the update, as reported by the UpdateDriver.
+    // Allows the index catalog to skip key generation for indexes whose paths are unaffected.
+    // Null when the set of modified paths is unknown (e.g. full document replacements). Must
+    // outlive the updateDocument() call.
+    const FieldRefSetWithStorage* modifiedPaths = nullptr;
 };
 
 /**
@@ -125,7 +133,7 @@ public:
      * Returns the version for use as an additional wake condition when used above.
      */
     uint64_t getVersion() const {
-        return _version;
+        return _version.load();
     }
 
     /**
@@ -142,14 +150,19 @@ private:
     // Signalled when a successful insert is made into a capped collection.
     mutable stdx::condition_variable _notifier;
 
-    // Mutex used with '_notifier'. Protects access to '_version'.
+    // Mutex used with '_notifier'. Protects access to '_dead'.
     mutable stdx::mutex _mutex;
 
     // A counter, incremented on insertion of new data into the capped collection.
     //
     // The condition which '_cappedNewDataNotifier' is being notified of is an increment of this
-    // counter. Access to this counter is synchronized with '_mutex'.
-    uint64_t _version;
+    // counter. It is incremented atomically so that the insert path only takes '_mutex' when
+    // there is a waiter to wake.
+    AtomicUInt64 _version;
+
+    // The number of threads blocked in waitUntil(). Incremented and decremented while holding
+    // '_mutex'; read atomically by the insert path to decide whether anyone needs waking.
+    mutable AtomicUInt32 _waiters;
 
     // True once the notifier is dead.
     bool _dead;
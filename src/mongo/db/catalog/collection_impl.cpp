@@ -665,8 +665,13 @@ RecordId CollectionImpl::updateDocument(OperationContext* opCtx,
     if (indexesAffected) {
         int64_t keysInserted, keysDeleted;
 
-        uassertStatusOK(_indexCatalog->updateRecord(
-            opCtx, args->preImageDoc.get(), newDoc, oldLocation, &keysInserted, &keysDeleted));
+        uassertStatusOK(_indexCatalog->updateRecord(opCtx,
+                                                    args->preImageDoc.get(),
+                                                    newDoc,
+                                                    oldLocation,
+                                                    args->modifiedPaths,
+                                                    &keysInserted,
+                                                    &keysDeleted));
 
         if (opDebug) {
             opDebug->additiveMetrics.incrementKeysInserted(keysInserted);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "mongo/db/collection_index_usage_tracker.h"
+#include "mongo/db/collection_query_shape_stats_tracker.h"
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/query_settings.h"
 #include "mongo/db/update_index_data.h"
@@ -39,6 +40,7 @@ namespace mongo {
 class Collection;
 class IndexDescriptor;
 class OperationContext;
+struct PlanSummaryStats;
 
 /**
  * this is for storing things that you want to cache about a single collection
@@ -99,11 +101,28 @@ public:
     virtual void clearQueryCache() = 0;
 
     /**
-     * Signal to the cache that a query operation has completed.  'indexesUsed' should list the
-     * set of indexes used by the winning plan, if any.
+     * Returns a snapshot of the cached per-query-shape execution statistics for this collection.
+     */
+    virtual CollectionQueryShapeStatsList getQueryShapeStats() const = 0;
+
+    /**
+     * Signal to the cache that a query operation has completed.  'summaryStats' describes the
+     * winning plan's execution: the indexes it used each have an access recorded against them,
+     * attributed with the operation's examined-keys and examined-documents totals.
      */
     virtual void notifyOfQuery(OperationContext* const opCtx,
-                               const std::set<std::string>& indexesUsed) = 0;
+                               const PlanSummaryStats& summaryStats) = 0;
+
+    /**
+     * Record execution statistics for a completed operation whose shape is identified by
+     * 'queryHash'. 'representativeQuery' is copied the first time a shape is recorded.
+     */
+    virtual void notifyOfQueryShape(const uint32_t queryHash,
+                                    const BSONObj& representativeQuery,
+                                    const long long keysExamined,
+                                    const long long docsExamined,
+                                    const long long nreturned,
+                                    const long long micros) = 0;
 
     virtual void setNs(NamespaceString ns) = 0;
 };
@@ -43,6 +43,7 @@
 #include "mongo/db/index_legacy.h"
 #include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/plan_cache.h"
+#include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/query/planner_ixselect.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/ttl_collection_cache.h"
@@ -58,7 +59,8 @@ CollectionInfoCacheImpl::CollectionInfoCacheImpl(Collection* collection, const N
       _keysComputed(false),
       _planCache(stdx::make_unique<PlanCache>(ns.ns())),
       _querySettings(stdx::make_unique<QuerySettings>()),
-      _indexUsageTracker(getGlobalServiceContext()->getPreciseClockSource()) {}
+      _indexUsageTracker(getGlobalServiceContext()->getPreciseClockSource()),
+      _queryShapeStatsTracker(getGlobalServiceContext()->getPreciseClockSource()) {}
 
 CollectionInfoCacheImpl::~CollectionInfoCacheImpl() {
     // Necessary because the collection cache will not explicitly get updated upon database drop.
@@ -161,17 +163,28 @@ void CollectionInfoCacheImpl::computeIndexKeys(OperationContext* opCtx) {
 }
 
 void CollectionInfoCacheImpl::notifyOfQuery(OperationContext* opCtx,
-                                            const std::set<std::string>& indexesUsed) {
+                                            const PlanSummaryStats& summaryStats) {
     // Record indexes used to fulfill query.
-    for (auto it = indexesUsed.begin(); it != indexesUsed.end(); ++it) {
+    for (auto it = summaryStats.indexesUsed.begin(); it != summaryStats.indexesUsed.end(); ++it) {
         // This index should still exist, since the PlanExecutor would have been killed if the
         // index was dropped (and we would not get here).
         dassert(NULL != _collection->getIndexCatalog()->findIndexByName(opCtx, *it));
 
-        _indexUsageTracker.recordIndexAccess(*it);
+        _indexUsageTracker.recordIndexAccess(
+            *it, summaryStats.totalKeysExamined, summaryStats.totalDocsExamined);
     }
 }
 
+void CollectionInfoCacheImpl::notifyOfQueryShape(uint32_t queryHash,
+                                                 const BSONObj& representativeQuery,
+                                                 long long keysExamined,
+                                                 long long docsExamined,
+                                                 long long nreturned,
+                                                 long long micros) {
+    _queryShapeStatsTracker.recordShape(
+        queryHash, representativeQuery, keysExamined, docsExamined, nreturned, micros);
+}
+
 void CollectionInfoCacheImpl::clearQueryCache() {
     LOG(1) << _collection->ns().ns() << ": clearing plan cache - collection info cache reset";
     if (NULL != _planCache.get()) {
@@ -248,6 +261,10 @@ CollectionIndexUsageMap CollectionInfoCacheImpl::getIndexUsageStats() const {
     return _indexUsageTracker.getUsageStats();
 }
 
+CollectionQueryShapeStatsList CollectionInfoCacheImpl::getQueryShapeStats() const {
+    return _queryShapeStatsTracker.getShapeStats();
+}
+
 void CollectionInfoCacheImpl::setNs(NamespaceString ns) {
     auto oldNs = _ns;
     _ns = std::move(ns);
@@ -77,6 +77,11 @@ public:
      */
     CollectionIndexUsageMap getIndexUsageStats() const;
 
+    /**
+     * Returns a snapshot of the cached per-query-shape execution statistics for this collection.
+     */
+    CollectionQueryShapeStatsList getQueryShapeStats() const;
+
     /**
      * Builds internal cache state based on the current state of the Collection's IndexCatalog
      */
@@ -104,10 +109,22 @@ public:
     void clearQueryCache();
 
     /**
-     * Signal to the cache that a query operation has completed.  'indexesUsed' should list the
-     * set of indexes used by the winning plan, if any.
+     * Signal to the cache that a query operation has completed.  'summaryStats' describes the
+     * winning plan's execution: the indexes it used each have an access recorded against them,
+     * attributed with the operation's examined-keys and examined-documents totals.
      */
-    void notifyOfQuery(OperationContext* opCtx, const std::set<std::string>& indexesUsed);
+    void notifyOfQuery(OperationContext* opCtx, const PlanSummaryStats& summaryStats);
+
+    /**
+     * Record execution statistics for a completed operation whose shape is identified by
+     * 'queryHash'.
+     */
+    void notifyOfQueryShape(uint32_t queryHash,
+                            const BSONObj& representativeQuery,
+                            long long keysExamined,
+                            long long docsExamined,
+                            long long nreturned,
+                            long long micros);
 
     void setNs(NamespaceString ns) override;
 
@@ -139,6 +156,9 @@ private:
     // Tracks index usage statistics for this collection.
     CollectionIndexUsageTracker _indexUsageTracker;
 
+    // Tracks per-query-shape execution statistics for this collection.
+    CollectionQueryShapeStatsTracker _queryShapeStatsTracker;
+
     bool _hasTTLIndex = false;
 };
 
@@ -663,7 +663,8 @@ void DatabaseImpl::_clearCollectionCache(OperationContext* opCtx,
                                          const std::string& reason,
                                          bool collectionGoingAway) {
     verify(_name == nsToDatabaseSubstring(fullns));
-    CollectionMap::const_iterator it = _collections.find(fullns.toString());
+    // StringMap supports heterogeneous lookup; no need to materialize a std::string key.
+    CollectionMap::const_iterator it = _collections.find(fullns);
 
     if (it == _collections.end())
         return;
@@ -45,6 +45,7 @@
 namespace mongo {
 class Client;
 class Collection;
+class FieldRefSetWithStorage;
 
 class IndexDescriptor;
 class IndexAccessMethod;
@@ -373,12 +374,17 @@ public:
      * Both 'keysInsertedOut' and 'keysDeletedOut' are required and will be set to the number of
      * index keys inserted and deleted by this operation, respectively.
      *
+     * 'modifiedPaths', when non-null, is the set of paths modified by the update and is used to
+     * skip key generation for ready indexes whose indexed paths cannot be affected. Passing null
+     * means the modified paths are unknown and all indexes are updated.
+     *
      * This method may throw.
      */
     virtual Status updateRecord(OperationContext* const opCtx,
                                 const BSONObj& oldDoc,
                                 const BSONObj& newDoc,
                                 const RecordId& recordId,
+                                const FieldRefSetWithStorage* modifiedPaths,
                                 int64_t* const keysInsertedOut,
                                 int64_t* const keysDeletedOut) = 0;
 
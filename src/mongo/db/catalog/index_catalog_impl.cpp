@@ -51,8 +51,10 @@
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/field_ref.h"
+#include "mongo/db/field_ref_set.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/index/wildcard_access_method.h"
 #include "mongo/db/index_legacy.h"
 #include "mongo/db/index_names.h"
 #include "mongo/db/jsobj.h"
@@ -64,10 +66,12 @@
 #include "mongo/db/query/collation/collation_spec.h"
 #include "mongo/db/query/collation/collator_factory_interface.h"
 #include "mongo/db/query/internal_plans.h"
+#include "mongo/db/query/planner_ixselect.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/update_index_data.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
@@ -1279,10 +1283,62 @@ Status IndexCatalogImpl::indexRecords(OperationContext* opCtx,
     return Status::OK();
 }
 
+namespace {
+/**
+ * Returns true if an update that modified only 'modifiedPaths' cannot change any key generated by
+ * 'entry''s index, so the index needs no update for this document. Conservatively returns false
+ * whenever the answer cannot be determined cheaply, e.g. for text indexes or wildcard indexes with
+ * exclusion projections.
+ */
+bool updateCannotAffectIndex(const FieldRefSetWithStorage& modifiedPaths,
+                             IndexCatalogEntry* entry) {
+    IndexDescriptor* descriptor = entry->descriptor();
+
+    UpdateIndexData indexedPaths;
+    if (descriptor->getAccessMethodName() == IndexNames::WILDCARD) {
+        const auto* pathProj =
+            static_cast<WildcardAccessMethod*>(entry->accessMethod())->getProjectionExec();
+        if (pathProj->getType() == ProjectionExecAgg::ProjectionType::kExclusionProjection) {
+            // The set of indexed paths is not exhaustively known.
+            return false;
+        }
+        for (const auto& path : pathProj->getExhaustivePaths()) {
+            indexedPaths.addPath(path);
+        }
+    } else if (descriptor->getAccessMethodName() == IndexNames::TEXT) {
+        // Extracting the paths of a text index requires parsing the FTS spec, which is too
+        // expensive to do per update.
+        return false;
+    } else {
+        BSONObjIterator it(descriptor->keyPattern());
+        while (it.more()) {
+            indexedPaths.addPath(FieldRef(it.next().fieldName()));
+        }
+    }
+
+    // A partial index may start or stop matching the document based on paths in its filter.
+    if (const MatchExpression* filter = entry->getFilterExpression()) {
+        stdx::unordered_set<std::string> filterPaths;
+        QueryPlannerIXSelect::getFields(filter, &filterPaths);
+        for (const auto& path : filterPaths) {
+            indexedPaths.addPath(FieldRef(path));
+        }
+    }
+
+    for (const FieldRef* modifiedPath : modifiedPaths) {
+        if (indexedPaths.mightBeIndexed(*modifiedPath)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
                                       const BSONObj& oldDoc,
                                       const BSONObj& newDoc,
                                       const RecordId& recordId,
+                                      const FieldRefSetWithStorage* modifiedPaths,
                                       int64_t* const keysInsertedOut,
                                       int64_t* const keysDeletedOut) {
     *keysInsertedOut = 0;
@@ -1294,6 +1350,12 @@ Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
          ++it) {
         IndexCatalogEntry* entry = it->get();
 
+        // When the update's modified paths are known, skip key generation for indexes whose
+        // indexed paths are disjoint from them: old and new keys would be identical.
+        if (modifiedPaths && updateCannotAffectIndex(*modifiedPaths, entry)) {
+            continue;
+        }
+
         IndexDescriptor* descriptor = entry->descriptor();
         IndexAccessMethod* iam = entry->accessMethod();
 
@@ -312,6 +312,7 @@ public:
                         const BSONObj& oldDoc,
                         const BSONObj& newDoc,
                         const RecordId& recordId,
+                        const FieldRefSetWithStorage* modifiedPaths,
                         int64_t* const keysInsertedOut,
                         int64_t* const keysDeletedOut) override;
     /**
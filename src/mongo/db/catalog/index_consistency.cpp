@@ -72,7 +72,8 @@ IndexConsistency::IndexConsistency(OperationContext* opCtx,
       _collLk(std::move(collLk)),
       _tracker(opCtx->getServiceContext()->getFastClockSource(),
                internalQueryExecYieldIterations.load(),
-               Milliseconds(internalQueryExecYieldPeriodMS.load())) {
+               Milliseconds(internalQueryExecYieldPeriodMS.load())),
+      _indexKeyCount(_kNumHashBuckets) {
 
     IndexCatalog* indexCatalog = _collection->getIndexCatalog();
     std::unique_ptr<IndexCatalog::IndexIterator> indexIterator =
@@ -201,8 +202,8 @@ int64_t IndexConsistency::getNumRecords(int indexNumber) const {
 bool IndexConsistency::haveEntryMismatch() const {
 
     stdx::lock_guard<stdx::mutex> lock(_classMutex);
-    for (auto iterator = _indexKeyCount.begin(); iterator != _indexKeyCount.end(); iterator++) {
-        if (iterator->second != 0) {
+    for (uint32_t count : _indexKeyCount) {
+        if (count != 0) {
             return true;
         }
     }
@@ -276,6 +277,6 @@ uint32_t IndexConsistency::_hashKeyString(const KeyString& ks, int indexNumber)
     MurmurHash3_x86_32(
         ks.getTypeBits().getBuffer(), ks.getTypeBits().getSize(), indexNsHash, &indexNsHash);
     MurmurHash3_x86_32(ks.getBuffer(), ks.getSize(), indexNsHash, &indexNsHash);
-    return indexNsHash % (1U << 22);
+    return indexNsHash % _kNumHashBuckets;
 }
 }  // namespace mongo
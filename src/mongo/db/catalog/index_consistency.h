@@ -173,8 +173,13 @@ private:
     std::unique_ptr<Lock::CollectionLock> _collLk;
     ElapsedTracker _tracker;
 
+    // The number of buckets the hashed KeyString values are mapped into.
+    static const uint32_t _kNumHashBuckets = 1U << 22;
+
     // We map the hashed KeyString values to a bucket which contain the count of how many
-    // index keys and document keys we've seen in each bucket.
+    // index keys and document keys we've seen in each bucket. The table is a flat array sized to
+    // the full hash range so that each key costs one O(1) increment with bounded memory, rather
+    // than a tree insertion per key.
     // Count rules:
     //     - If the count is 0 in the bucket, we have index consistency for
     //       KeyStrings that mapped to it
@@ -182,7 +187,7 @@ private:
     //       are too few index entries.
     //     - If the count is < 0 in the bucket at the end of the validation pass, then there
     //       are too many index entries.
-    std::map<uint32_t, uint32_t> _indexKeyCount;
+    std::vector<uint32_t> _indexKeyCount;
 
     // Contains the corresponding index number for each index namespace
     std::map<std::string, int> _indexNumber;
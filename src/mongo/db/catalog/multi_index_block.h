@@ -159,6 +159,14 @@ public:
      */
     virtual Status drainBackgroundWritesIfNeeded() = 0;
 
+    /**
+     * Returns the approximate number of intercepted side writes, summed across all indexes in the
+     * build, that have not yet been drained into the indexes. Returns zero for builds which do not
+     * intercept writes. Callers can repeat drainBackgroundWritesIfNeeded() under intent locks
+     * until this is small, so the final drains that stop writes have a bounded amount of work.
+     */
+    virtual int64_t numSideWritesRemaining() const = 0;
+
     /**
      * Marks the index ready for use. Should only be called as the last method after
      * doneInserting() or insertAllDocumentsInCollection() return success.
@@ -34,6 +34,7 @@
 
 #include "mongo/db/catalog/multi_index_block_impl.h"
 
+#include <algorithm>
 #include <ostream>
 
 #include "mongo/base/error_codes.h"
@@ -43,6 +44,7 @@
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
+#include "mongo/db/concurrency/locker.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/exec/working_set_common.h"
@@ -56,6 +58,7 @@
 #include "mongo/logger/redaction.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
@@ -63,6 +66,7 @@
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
@@ -78,6 +82,12 @@ const StringData kCommitReadyMembersFieldName = "commitReadyMembers"_sd;
 
 MONGO_EXPORT_SERVER_PARAMETER(useReadOnceCursorsForIndexBuilds, bool, true);
 
+// Token bucket rates for the collection scan of background index builds. Values of zero or less
+// disable the corresponding limit. The limits only engage while foreground operations are queued
+// for a global throttling ticket; see insertAllDocumentsInCollection().
+MONGO_EXPORT_SERVER_PARAMETER(backgroundIndexBuildMaxRecordsPerSecond, int, 0);
+MONGO_EXPORT_SERVER_PARAMETER(backgroundIndexBuildMaxMegabytesPerSecond, int, 0);
+
 using std::unique_ptr;
 using std::string;
 using std::endl;
@@ -407,6 +417,133 @@ Status MultiIndexBlockImpl::insertAllDocumentsInCollection() {
     bool readOnce = !_buildInBackground && useReadOnceCursorsForIndexBuilds.load();
     _opCtx->recoveryUnit()->setReadOnce(readOnce);
 
+    // When building several indexes in the foreground, key generation and sorting dominate the
+    // scan: each document passes through every index's key generator and Sorter. Bulk builders
+    // never touch the OperationContext or storage, so documents are batched here and each index's
+    // bulk builder is fed on its own worker thread. Background builds stay serial because they
+    // write through the access method under the scan's write unit of work.
+    const bool parallelKeyGeneration = !_buildInBackground && _indexes.size() > 1 &&
+        std::all_of(_indexes.begin(), _indexes.end(), [](const IndexToBuild& index) {
+                                          return static_cast<bool>(index.bulk);
+                                      });
+
+    ThreadPool::Options keyGenPoolOptions;
+    keyGenPoolOptions.poolName = "IndexBuildKeyGen";
+    keyGenPoolOptions.threadNamePrefix = "IndexBuildKeyGen-";
+    keyGenPoolOptions.minThreads = 0;
+    keyGenPoolOptions.maxThreads =
+        std::min(_indexes.size(), static_cast<size_t>(ProcessInfo::getNumAvailableCores()));
+    ThreadPool keyGenPool(keyGenPoolOptions);
+    auto keyGenPoolGuard = MakeGuard([&keyGenPool] {
+        keyGenPool.shutdown();
+        keyGenPool.join();
+    });
+    if (parallelKeyGeneration) {
+        keyGenPool.startup();
+    }
+
+    const size_t kKeyGenBatchSize = 1000;
+    std::vector<std::pair<BSONObj, RecordId>> keyGenBatch;
+    if (parallelKeyGeneration) {
+        keyGenBatch.reserve(kKeyGenBatchSize);
+    }
+
+    // Feeds the current batch to every index's bulk builder, one worker task per index. The batch
+    // is only reused once all workers have drained it.
+    auto flushKeyGenBatch = [&]() -> Status {
+        if (keyGenBatch.empty()) {
+            return Status::OK();
+        }
+        std::vector<Status> results(_indexes.size(), Status::OK());
+        for (size_t i = 0; i < _indexes.size(); i++) {
+            uassertStatusOK(keyGenPool.schedule([this, i, &keyGenBatch, &results] {
+                // Key generation reports problem documents by throwing (getKeys rethrows every
+                // indexing error under kEnforceConstraints, and the Sorter throws on spill
+                // failures). Letting an exception escape a pool task terminates the server, so
+                // convert it to the Status the serial path would have surfaced.
+                try {
+                    for (const auto& entry : keyGenBatch) {
+                        if (_indexes[i].filterExpression &&
+                            !_indexes[i].filterExpression->matchesBSON(entry.first)) {
+                            continue;
+                        }
+                        Status status = _indexes[i].bulk->insert(
+                            _opCtx, entry.first, entry.second, _indexes[i].options);
+                        if (!status.isOK()) {
+                            results[i] = status;
+                            return;
+                        }
+                    }
+                } catch (...) {
+                    results[i] = exceptionToStatus();
+                }
+            }));
+        }
+        keyGenPool.waitForIdle();
+        keyGenBatch.clear();
+        for (const auto& result : results) {
+            if (!result.isOK()) {
+                return result;
+            }
+        }
+        return Status::OK();
+    };
+
+    // Background builds can be rate limited so that they leave I/O and CPU to foreground
+    // operations. The limits are token buckets over the records and bytes consumed by the scan.
+    // Since no per-operation latency signal is available here, foreground pressure is inferred
+    // from the global throttling ticket queues: the limits only engage while other operations are
+    // queued for a read or write ticket, so an otherwise idle server runs the build at full speed.
+    Timer throttleWindowTimer;
+    long long throttleWindowRecords = 0;
+    long long throttleWindowBytes = 0;
+    auto throttleBackgroundBuild = [&](int docSize) {
+        const long long maxRecordsPerSec = backgroundIndexBuildMaxRecordsPerSecond.load();
+        const long long maxBytesPerSec =
+            static_cast<long long>(backgroundIndexBuildMaxMegabytesPerSecond.load()) * 1024 * 1024;
+        if (maxRecordsPerSec <= 0 && maxBytesPerSec <= 0) {
+            return;
+        }
+
+        if (Locker::getGlobalThrottlingQueueDepth(MODE_IX) == 0 &&
+            Locker::getGlobalThrottlingQueueDepth(MODE_IS) == 0) {
+            throttleWindowTimer.reset();
+            throttleWindowRecords = 0;
+            throttleWindowBytes = 0;
+            return;
+        }
+
+        throttleWindowRecords++;
+        throttleWindowBytes += docSize;
+
+        // Sleep until the records and bytes consumed this window fit within the configured rates.
+        for (;;) {
+            double minElapsedSecs = 0.0;
+            if (maxRecordsPerSec > 0) {
+                minElapsedSecs = std::max(
+                    minElapsedSecs, static_cast<double>(throttleWindowRecords) / maxRecordsPerSec);
+            }
+            if (maxBytesPerSec > 0) {
+                minElapsedSecs = std::max(minElapsedSecs,
+                                          static_cast<double>(throttleWindowBytes) / maxBytesPerSec);
+            }
+            const double elapsedSecs = throttleWindowTimer.micros() / 1000000.0;
+            if (elapsedSecs >= minElapsedSecs) {
+                break;
+            }
+            sleepmillis(
+                std::min(1000, static_cast<int>((minElapsedSecs - elapsedSecs) * 1000) + 1));
+        }
+
+        // Restart the accounting window periodically so that rate changes made through
+        // setParameter take effect promptly.
+        if (throttleWindowTimer.seconds() >= 1) {
+            throttleWindowTimer.reset();
+            throttleWindowRecords = 0;
+            throttleWindowBytes = 0;
+        }
+    };
+
     Snapshotted<BSONObj> objToIndex;
     RecordId loc;
     PlanExecutor::ExecState state;
@@ -439,20 +576,35 @@ Status MultiIndexBlockImpl::insertAllDocumentsInCollection() {
 
             failPointHangDuringBuild(&hangBeforeIndexBuildOf, "before", objToIndex.value());
 
-            WriteUnitOfWork wunit(_opCtx);
-            Status ret = insert(objToIndex.value(), loc);
-            if (_buildInBackground)
-                exec->saveState();
-            if (!ret.isOK()) {
-                // Fail the index build hard.
-                return ret;
-            }
-            wunit.commit();
-            if (_buildInBackground) {
-                try {
-                    exec->restoreState();  // Handles any WCEs internally.
-                } catch (...) {
-                    return exceptionToStatus();
+            if (parallelKeyGeneration) {
+                keyGenBatch.emplace_back(objToIndex.value().getOwned(), loc);
+                if (keyGenBatch.size() >= kKeyGenBatchSize) {
+                    Status ret = flushKeyGenBatch();
+                    if (!ret.isOK()) {
+                        // Fail the index build hard.
+                        return ret;
+                    }
+                }
+            } else {
+                if (_buildInBackground) {
+                    throttleBackgroundBuild(objToIndex.value().objsize());
+                }
+
+                WriteUnitOfWork wunit(_opCtx);
+                Status ret = insert(objToIndex.value(), loc);
+                if (_buildInBackground)
+                    exec->saveState();
+                if (!ret.isOK()) {
+                    // Fail the index build hard.
+                    return ret;
+                }
+                wunit.commit();
+                if (_buildInBackground) {
+                    try {
+                        exec->restoreState();  // Handles any WCEs internally.
+                    } catch (...) {
+                        return exceptionToStatus();
+                    }
                 }
             }
 
@@ -507,6 +659,12 @@ Status MultiIndexBlockImpl::insertAllDocumentsInCollection() {
 
     progress->finished();
 
+    if (parallelKeyGeneration) {
+        Status flushStatus = flushKeyGenBatch();
+        if (!flushStatus.isOK())
+            return flushStatus;
+    }
+
     Status ret = dumpInsertsFromBulk();
     if (!ret.isOK())
         return ret;
@@ -637,6 +795,17 @@ Status MultiIndexBlockImpl::drainBackgroundWritesIfNeeded() {
     return Status::OK();
 }
 
+int64_t MultiIndexBlockImpl::numSideWritesRemaining() const {
+    int64_t remaining = 0;
+    for (size_t i = 0; i < _indexes.size(); i++) {
+        auto interceptor = _indexes[i].block->getEntry()->indexBuildInterceptor();
+        if (!interceptor)
+            continue;
+
+        remaining += interceptor->numSideWritesRemaining();
+    }
+    return remaining;
+}
 
 void MultiIndexBlockImpl::abortWithoutCleanup() {
     _setStateToAbortedIfNotCommitted("aborted without cleanup"_sd);
@@ -88,6 +88,8 @@ public:
      */
     Status drainBackgroundWritesIfNeeded() override;
 
+    int64_t numSideWritesRemaining() const override;
+
     Status commit() override;
     Status commit(stdx::function<void(const BSONObj& spec)> onCreateFn) override;
 
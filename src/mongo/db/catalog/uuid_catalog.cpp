@@ -167,9 +167,9 @@ void UUIDCatalog::onOpenCatalog(OperationContext* opCtx) {
 }
 
 Collection* UUIDCatalog::lookupCollectionByUUID(CollectionUUID uuid) const {
-    stdx::lock_guard<stdx::mutex> lock(_catalogLock);
-    auto foundIt = _catalog.find(uuid);
-    return foundIt == _catalog.end() ? nullptr : foundIt->second;
+    const auto snapshot = std::atomic_load(&_catalogSnapshot);
+    auto foundIt = snapshot->find(uuid);
+    return foundIt == snapshot->end() ? nullptr : foundIt->second;
 }
 
 NamespaceString UUIDCatalog::lookupNSSByUUID(CollectionUUID uuid) const {
@@ -262,6 +262,7 @@ void UUIDCatalog::_registerUUIDCatalogEntry_inlock(CollectionUUID uuid, Collecti
         std::pair<CollectionUUID, Collection*> entry = std::make_pair(uuid, coll);
         LOG(2) << "registering collection " << coll->ns() << " with UUID " << uuid.toString();
         invariant(_catalog.insert(entry).second == true);
+        _publishCatalogSnapshot_inlock();
     }
 }
 Collection* UUIDCatalog::_removeUUIDCatalogEntry_inlock(CollectionUUID uuid) {
@@ -275,6 +276,12 @@ Collection* UUIDCatalog::_removeUUIDCatalogEntry_inlock(CollectionUUID uuid) {
     auto foundCol = foundIt->second;
     LOG(2) << "unregistering collection " << foundCol->ns() << " with UUID " << uuid.toString();
     _catalog.erase(foundIt);
+    _publishCatalogSnapshot_inlock();
     return foundCol;
 }
+
+void UUIDCatalog::_publishCatalogSnapshot_inlock() {
+    std::atomic_store(&_catalogSnapshot,
+                      std::shared_ptr<const CatalogMap>(std::make_shared<CatalogMap>(_catalog)));
+}
 }  // namespace mongo
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 
 #include "mongo/base/disallow_copying.h"
@@ -191,6 +192,9 @@ public:
      * required locks should be obtained prior to calling this function, or else the found
      * Collection pointer might no longer be valid when the call returns.
      *
+     * Reads an immutable snapshot of the catalog and takes no lock; safe to call on every
+     * operation.
+     *
      * Returns nullptr if the 'uuid' is not known.
      */
     Collection* lookupCollectionByUUID(CollectionUUID uuid) const;
@@ -234,10 +238,14 @@ public:
     boost::optional<CollectionUUID> next(const StringData& db, CollectionUUID uuid);
 
 private:
+    using CatalogMap =
+        mongo::stdx::unordered_map<CollectionUUID, Collection*, CollectionUUID::Hash>;
+
     const std::vector<CollectionUUID>& _getOrdering_inlock(const StringData& db,
                                                            const stdx::lock_guard<stdx::mutex>&);
     void _registerUUIDCatalogEntry_inlock(CollectionUUID uuid, Collection* coll);
     Collection* _removeUUIDCatalogEntry_inlock(CollectionUUID uuid);
+    void _publishCatalogSnapshot_inlock();
 
     mutable mongo::stdx::mutex _catalogLock;
     /**
@@ -255,7 +263,14 @@ private:
      * not all databases are guaranteed to have an ordering in it.
      */
     StringMap<std::vector<CollectionUUID>> _orderedCollections;
-    mongo::stdx::unordered_map<CollectionUUID, Collection*, CollectionUUID::Hash> _catalog;
+    CatalogMap _catalog;
+
+    // Immutable snapshot of '_catalog'. Read with std::atomic_load without holding '_catalogLock';
+    // replaced wholesale with std::atomic_store under '_catalogLock' after every mutation. DDL is
+    // rare while lookupCollectionByUUID runs on every operation, so readers get the common case
+    // lock-free. Never null. Note that lookupNSSByUUID cannot use the snapshot: Collection::ns()
+    // reads are synchronized by '_catalogLock' (see setCollectionNamespace).
+    std::shared_ptr<const CatalogMap> _catalogSnapshot = std::make_shared<const CatalogMap>();
 };
 
 }  // namespace mongo
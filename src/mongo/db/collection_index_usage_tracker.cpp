@@ -44,11 +44,49 @@ CollectionIndexUsageTracker::CollectionIndexUsageTracker(ClockSource* clockSourc
     invariant(_clockSource);
 }
 
-void CollectionIndexUsageTracker::recordIndexAccess(StringData indexName) {
+void CollectionIndexUsageTracker::IndexUsageStats::recordAccess(Date_t now,
+                                                                long long opKeysExamined,
+                                                                long long opDocsExamined) {
+    accesses.add(1);
+    keysExamined.add(opKeysExamined);
+    docsExamined.add(opDocsExamined);
+
+    const long long hourNow = durationCount<Hours>(now.toDurationSinceEpoch());
+    auto& bucket = hourlyBuckets[hourNow % kNumHourlyBuckets];
+    const long long bucketHour = bucket.hour.load();
+    if (bucketHour != hourNow) {
+        // The bucket still holds counts from at least a full ring-length ago. Whichever thread
+        // wins the swap resets the count; increments racing with the reset may land on either
+        // side of it, perturbing window totals by at most a few operations.
+        if (bucket.hour.compareAndSwap(bucketHour, hourNow) == bucketHour) {
+            bucket.ops.store(0);
+        }
+    }
+    bucket.ops.fetchAndAdd(1);
+}
+
+long long CollectionIndexUsageTracker::IndexUsageStats::accessesInWindow(Date_t now,
+                                                                         int hours) const {
+    invariant(hours > 0 && static_cast<size_t>(hours) <= kNumHourlyBuckets);
+
+    const long long hourNow = durationCount<Hours>(now.toDurationSinceEpoch());
+    long long total = 0;
+    for (size_t i = 0; i < kNumHourlyBuckets; i++) {
+        const long long bucketHour = hourlyBuckets[i].hour.load();
+        if (bucketHour > hourNow - hours && bucketHour <= hourNow) {
+            total += hourlyBuckets[i].ops.load();
+        }
+    }
+    return total;
+}
+
+void CollectionIndexUsageTracker::recordIndexAccess(StringData indexName,
+                                                    long long keysExamined,
+                                                    long long docsExamined) {
     invariant(!indexName.empty());
     dassert(_indexUsageMap.find(indexName) != _indexUsageMap.end());
 
-    _indexUsageMap[indexName].accesses.fetchAndAdd(1);
+    _indexUsageMap[indexName].recordAccess(_clockSource->now(), keysExamined, docsExamined);
 }
 
 void CollectionIndexUsageTracker::registerIndex(StringData indexName, const BSONObj& indexKey) {
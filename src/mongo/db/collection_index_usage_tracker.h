@@ -34,6 +34,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/string_map.h"
 #include "mongo/util/time_support.h"
 
@@ -52,31 +53,118 @@ class CollectionIndexUsageTracker {
     MONGO_DISALLOW_COPYING(CollectionIndexUsageTracker);
 
 public:
+    /**
+     * A 64-bit counter spread over several cache-line-sized stripes so that threads finishing
+     * operations on different cores do not all contend on the same line. add() only touches the
+     * stripe selected by the calling thread's id; load() sums every stripe, so a reader racing
+     * with writers sees a value that is merely eventually consistent, which is fine for usage
+     * statistics. Copying collapses the source's stripes into the first stripe of the copy.
+     */
+    class StripedCounter {
+    public:
+        StripedCounter() = default;
+
+        StripedCounter(const StripedCounter& other) {
+            _stripes[0].value.store(other.load());
+        }
+
+        StripedCounter& operator=(const StripedCounter& other) {
+            _stripes[0].value.store(other.load());
+            for (size_t i = 1; i < kStripes; i++) {
+                _stripes[i].value.store(0);
+            }
+            return *this;
+        }
+
+        long long load() const {
+            long long total = 0;
+            for (size_t i = 0; i < kStripes; i++) {
+                total += _stripes[i].value.load();
+            }
+            return total;
+        }
+
+        void add(long long delta) {
+            _stripes[_myStripe()].value.fetchAndAdd(delta);
+        }
+
+    private:
+        static const size_t kStripes = 8;
+
+        struct alignas(64) Stripe {
+            AtomicInt64 value;
+        };
+
+        size_t _myStripe() const {
+            return std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) % kStripes;
+        }
+
+        Stripe _stripes[kStripes];
+    };
+
     struct IndexUsageStats {
+        // Number of buckets in the hourly ring below. Must be large enough to answer the widest
+        // rolling-window query we expose (one day).
+        static const size_t kNumHourlyBuckets = 24;
+
         IndexUsageStats() = default;
         explicit IndexUsageStats(Date_t now, const BSONObj& key)
             : trackerStartTime(now), indexKey(key.getOwned()) {}
 
-        IndexUsageStats(const IndexUsageStats& other)
-            : accesses(other.accesses.load()),
-              trackerStartTime(other.trackerStartTime),
-              indexKey(other.indexKey) {}
+        IndexUsageStats(const IndexUsageStats& other) {
+            *this = other;
+        }
 
         IndexUsageStats& operator=(const IndexUsageStats& other) {
-            accesses.store(other.accesses.load());
+            accesses = other.accesses;
+            keysExamined = other.keysExamined;
+            docsExamined = other.docsExamined;
             trackerStartTime = other.trackerStartTime;
             indexKey = other.indexKey;
+            for (size_t i = 0; i < kNumHourlyBuckets; i++) {
+                hourlyBuckets[i].hour.store(other.hourlyBuckets[i].hour.load());
+                hourlyBuckets[i].ops.store(other.hourlyBuckets[i].ops.load());
+            }
             return *this;
         }
 
-        // Number of operations that have used this index.
-        AtomicInt64 accesses;
+        /**
+         * Records one operation that used this index, along with the operation-wide totals of
+         * index keys and documents the operation examined. Safe to call from multiple threads
+         * concurrently.
+         */
+        void recordAccess(Date_t now, long long opKeysExamined, long long opDocsExamined);
+
+        /**
+         * Returns the number of recorded operations that fell within the trailing 'hours'
+         * clock-hours, ending with the clock-hour containing 'now'. 'hours' must be between 1
+         * and kNumHourlyBuckets. Window totals are approximate: counts are kept at clock-hour
+         * granularity, and bucket recycling racing with concurrent writers can misattribute a
+         * handful of operations across an hour boundary.
+         */
+        long long accessesInWindow(Date_t now, int hours) const;
+
+        // Number of operations that have used this index. The examined counters accumulate the
+        // operation-wide totals of keys and documents examined by those operations; an operation
+        // that used several indexes contributes its totals to each of them.
+        StripedCounter accesses;
+        StripedCounter keysExamined;
+        StripedCounter docsExamined;
 
         // Date/Time that we started tracking index usage.
         Date_t trackerStartTime;
 
         // An owned copy of the associated IndexDescriptor's index key.
         BSONObj indexKey;
+
+        // Ring of per-clock-hour operation counts backing accessesInWindow(). A bucket is lazily
+        // recycled by the first operation recorded in a clock-hour that maps onto it.
+        struct HourlyBucket {
+            // Hours since the Unix epoch covered by this bucket.
+            AtomicInt64 hour;
+            AtomicInt64 ops;
+        };
+        HourlyBucket hourlyBuckets[kNumHourlyBuckets];
     };
 
     /**
@@ -88,10 +176,10 @@ public:
     explicit CollectionIndexUsageTracker(ClockSource* clockSource);
 
     /**
-     * Record that an operation used index 'indexName'. Safe to be called by multiple threads
-     * concurrently.
+     * Record that an operation used index 'indexName', examining 'keysExamined' index keys and
+     * 'docsExamined' documents in total. Safe to be called by multiple threads concurrently.
      */
-    void recordIndexAccess(StringData indexName);
+    void recordIndexAccess(StringData indexName, long long keysExamined, long long docsExamined);
 
     /**
      * Add map entry for 'indexName' stats collection. Must be called under exclusive collection
@@ -69,20 +69,57 @@ TEST_F(CollectionIndexUsageTrackerTest, Empty) {
 // Test that recording of a single index hit is reflected in returned stats map.
 TEST_F(CollectionIndexUsageTrackerTest, SingleHit) {
     getTracker()->registerIndex("foo", BSON("foo" << 1));
-    getTracker()->recordIndexAccess("foo");
+    getTracker()->recordIndexAccess("foo", 0, 0);
     CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(1, statsMap["foo"].accesses.loadRelaxed());
+    ASSERT_EQUALS(1, statsMap["foo"].accesses.load());
 }
 
 // Test that recording of multiple index hits are reflected in stats map.
 TEST_F(CollectionIndexUsageTrackerTest, MultipleHit) {
     getTracker()->registerIndex("foo", BSON("foo" << 1));
-    getTracker()->recordIndexAccess("foo");
-    getTracker()->recordIndexAccess("foo");
+    getTracker()->recordIndexAccess("foo", 0, 0);
+    getTracker()->recordIndexAccess("foo", 0, 0);
     CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(2, statsMap["foo"].accesses.loadRelaxed());
+    ASSERT_EQUALS(2, statsMap["foo"].accesses.load());
+}
+
+// Test that the examined-keys and examined-documents totals accumulate across operations.
+TEST_F(CollectionIndexUsageTrackerTest, ExaminedCounters) {
+    getTracker()->registerIndex("foo", BSON("foo" << 1));
+    getTracker()->recordIndexAccess("foo", 5, 3);
+    getTracker()->recordIndexAccess("foo", 2, 1);
+    CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
+    ASSERT(statsMap.find("foo") != statsMap.end());
+    ASSERT_EQUALS(7, statsMap["foo"].keysExamined.load());
+    ASSERT_EQUALS(4, statsMap["foo"].docsExamined.load());
+}
+
+// Test that rolling-window totals follow the clock while the all-time counter does not.
+TEST_F(CollectionIndexUsageTrackerTest, RollingWindowCounts) {
+    getTracker()->registerIndex("foo", BSON("foo" << 1));
+    getTracker()->recordIndexAccess("foo", 0, 0);
+    getTracker()->recordIndexAccess("foo", 0, 0);
+
+    CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
+    ASSERT_EQUALS(2, statsMap["foo"].accessesInWindow(getClockSource()->now(), 1));
+    ASSERT_EQUALS(2, statsMap["foo"].accessesInWindow(getClockSource()->now(), 24));
+
+    // An access in a later clock-hour leaves the one-hour window while staying in the day window.
+    getClockSource()->advance(Hours(2));
+    getTracker()->recordIndexAccess("foo", 0, 0);
+
+    statsMap = getTracker()->getUsageStats();
+    ASSERT_EQUALS(1, statsMap["foo"].accessesInWindow(getClockSource()->now(), 1));
+    ASSERT_EQUALS(3, statsMap["foo"].accessesInWindow(getClockSource()->now(), 24));
+    ASSERT_EQUALS(3, statsMap["foo"].accesses.load());
+
+    // After a full day every bucket has aged out of the day window.
+    getClockSource()->advance(Hours(24));
+    statsMap = getTracker()->getUsageStats();
+    ASSERT_EQUALS(0, statsMap["foo"].accessesInWindow(getClockSource()->now(), 24));
+    ASSERT_EQUALS(3, statsMap["foo"].accesses.load());
 }
 
 TEST_F(CollectionIndexUsageTrackerTest, IndexKey) {
@@ -114,21 +151,21 @@ TEST_F(CollectionIndexUsageTrackerTest, Deregister) {
 // Test that index deregistration results in reset of the usage counter.
 TEST_F(CollectionIndexUsageTrackerTest, HitAfterDeregister) {
     getTracker()->registerIndex("foo", BSON("foo" << 1));
-    getTracker()->recordIndexAccess("foo");
-    getTracker()->recordIndexAccess("foo");
+    getTracker()->recordIndexAccess("foo", 0, 0);
+    getTracker()->recordIndexAccess("foo", 0, 0);
     CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(2, statsMap["foo"].accesses.loadRelaxed());
+    ASSERT_EQUALS(2, statsMap["foo"].accesses.load());
 
     getTracker()->unregisterIndex("foo");
     statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") == statsMap.end());
 
     getTracker()->registerIndex("foo", BSON("foo" << 1));
-    getTracker()->recordIndexAccess("foo");
+    getTracker()->recordIndexAccess("foo", 0, 0);
     statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(1, statsMap["foo"].accesses.loadRelaxed());
+    ASSERT_EQUALS(1, statsMap["foo"].accesses.load());
 }
 
 // Test that index tracker start date/time is reset on index deregistration/registration.
@@ -0,0 +1,113 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kQuery
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/collection_query_shape_stats_tracker.h"
+
+#include "mongo/stdx/memory.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/clock_source.h"
+#include "mongo/util/log.h"
+
+namespace mongo {
+
+CollectionQueryShapeStatsTracker::CollectionQueryShapeStatsTracker(ClockSource* clockSource)
+    : _clockSource(clockSource) {
+    invariant(_clockSource);
+}
+
+void CollectionQueryShapeStatsTracker::recordShape(uint32_t queryHash,
+                                                   const BSONObj& representativeQuery,
+                                                   long long keysExamined,
+                                                   long long docsExamined,
+                                                   long long nreturned,
+                                                   long long micros) {
+    ShapeStats* stats;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        auto it = _shapeMap.find(queryHash);
+        if (it == _shapeMap.end()) {
+            if (_shapeMap.size() >= kMaxTrackedShapes) {
+                _untrackedOps.fetchAndAddRelaxed(1);
+                return;
+            }
+            it = _shapeMap
+                     .emplace(queryHash,
+                              stdx::make_unique<ShapeStats>(_clockSource->now(),
+                                                            representativeQuery.getOwned()))
+                     .first;
+        }
+        stats = it->second.get();
+    }
+
+    stats->ops.fetchAndAddRelaxed(1);
+    stats->keysExamined.fetchAndAddRelaxed(keysExamined);
+    stats->docsExamined.fetchAndAddRelaxed(docsExamined);
+    stats->returned.fetchAndAddRelaxed(nreturned);
+    stats->totalMicros.fetchAndAddRelaxed(micros);
+
+    long long maxSeen = stats->maxMicros.loadRelaxed();
+    while (micros > maxSeen) {
+        const long long prev = stats->maxMicros.compareAndSwap(maxSeen, micros);
+        if (prev == maxSeen) {
+            break;
+        }
+        maxSeen = prev;
+    }
+}
+
+std::vector<CollectionQueryShapeStatsTracker::ShapeStatsSnapshot>
+CollectionQueryShapeStatsTracker::getShapeStats() const {
+    std::vector<ShapeStatsSnapshot> snapshots;
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    snapshots.reserve(_shapeMap.size());
+    for (const auto& entry : _shapeMap) {
+        const ShapeStats& stats = *entry.second;
+        ShapeStatsSnapshot snapshot;
+        snapshot.queryHash = entry.first;
+        snapshot.ops = stats.ops.loadRelaxed();
+        snapshot.keysExamined = stats.keysExamined.loadRelaxed();
+        snapshot.docsExamined = stats.docsExamined.loadRelaxed();
+        snapshot.returned = stats.returned.loadRelaxed();
+        snapshot.totalMicros = stats.totalMicros.loadRelaxed();
+        snapshot.maxMicros = stats.maxMicros.loadRelaxed();
+        snapshot.firstSeen = stats.firstSeen;
+        snapshot.representativeQuery = stats.representativeQuery;
+        snapshots.push_back(std::move(snapshot));
+    }
+
+    return snapshots;
+}
+
+}  // namespace mongo
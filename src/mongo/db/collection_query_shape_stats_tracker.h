@@ -0,0 +1,152 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class ClockSource;
+
+/**
+ * CollectionQueryShapeStatsTracker keeps lightweight per-query-shape execution statistics for a
+ * collection, keyed by the query hash computed from the plan cache shape encoding. It is the
+ * query-shape analogue of CollectionIndexUsageTracker: always on, bounded in size, and far
+ * cheaper than the profiler's per-operation document writes.
+ *
+ * Unlike index registration, query shapes arrive on the query path without the exclusive
+ * collection lock, so map insertion is guarded by a mutex. Counter updates use atomics on
+ * pointer-stable map entries and happen outside the lock.
+ */
+class CollectionQueryShapeStatsTracker {
+    MONGO_DISALLOW_COPYING(CollectionQueryShapeStatsTracker);
+
+public:
+    // Maximum number of distinct query shapes tracked per collection. Operations whose shape
+    // arrives once the map is full are counted in the untracked-operations overflow counter.
+    static const size_t kMaxTrackedShapes = 256;
+
+    struct ShapeStats {
+        ShapeStats(Date_t now, BSONObj representative)
+            : firstSeen(now), representativeQuery(std::move(representative)) {}
+
+        // Number of operations with this shape.
+        AtomicInt64 ops;
+
+        // Totals across all operations with this shape.
+        AtomicInt64 keysExamined;
+        AtomicInt64 docsExamined;
+        AtomicInt64 returned;
+        AtomicInt64 totalMicros;
+
+        // The slowest operation observed for this shape.
+        AtomicInt64 maxMicros;
+
+        // Date/time this shape was first recorded.
+        const Date_t firstSeen;
+
+        // The (owned) description of the first operation recorded for this shape, so consumers
+        // can tell what the hash stands for.
+        const BSONObj representativeQuery;
+    };
+
+    /**
+     * A point-in-time copy of one shape's statistics, for reporting.
+     */
+    struct ShapeStatsSnapshot {
+        uint32_t queryHash;
+        long long ops;
+        long long keysExamined;
+        long long docsExamined;
+        long long returned;
+        long long totalMicros;
+        long long maxMicros;
+        Date_t firstSeen;
+        BSONObj representativeQuery;
+    };
+
+    /**
+     * Does not take ownership of 'clockSource', which must outlive this tracker.
+     */
+    explicit CollectionQueryShapeStatsTracker(ClockSource* clockSource);
+
+    /**
+     * Record one completed operation for the shape identified by 'queryHash'. Safe to be called
+     * by multiple threads concurrently. 'representativeQuery' is only consulted (and copied) the
+     * first time a shape is seen.
+     */
+    void recordShape(uint32_t queryHash,
+                     const BSONObj& representativeQuery,
+                     long long keysExamined,
+                     long long docsExamined,
+                     long long nreturned,
+                     long long micros);
+
+    /**
+     * Returns a snapshot of the statistics for every tracked shape.
+     */
+    std::vector<ShapeStatsSnapshot> getShapeStats() const;
+
+    /**
+     * Number of operations that were not recorded because the shape map was full.
+     */
+    long long getUntrackedOps() const {
+        return _untrackedOps.loadRelaxed();
+    }
+
+private:
+    // Guards insertion into and iteration over '_shapeMap'. The mapped ShapeStats objects are
+    // pointer-stable, so counter updates happen outside this mutex.
+    mutable stdx::mutex _mutex;
+
+    // Map from query hash to that shape's statistics.
+    stdx::unordered_map<uint32_t, std::unique_ptr<ShapeStats>> _shapeMap;
+
+    // Operations dropped because '_shapeMap' had reached kMaxTrackedShapes.
+    AtomicInt64 _untrackedOps;
+
+    // Clock source used to stamp ShapeStats::firstSeen.
+    ClockSource* _clockSource;
+};
+
+typedef std::vector<CollectionQueryShapeStatsTracker::ShapeStatsSnapshot>
+    CollectionQueryShapeStatsList;
+
+}  // namespace mongo
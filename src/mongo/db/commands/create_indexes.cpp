@@ -424,13 +424,22 @@ public:
             MONGO_FAIL_POINT_PAUSE_WHILE_SET(hangAfterIndexBuildDumpsInsertsFromBulk);
         }
 
-        // Perform the first drain while holding an intent lock.
-        {
+        // Perform the first drains while holding an intent lock. Each pass only applies the side
+        // writes visible in its snapshot, so keep draining until the side-writes tables are nearly
+        // empty; this bounds the amount of work left for the drains below that stop writes. The
+        // pass limit guards against a writer that outpaces the drain indefinitely.
+        static constexpr int64_t kDrainRemainingThreshold = 100;
+        static constexpr int kMaxIntentLockDrainPasses = 10;
+        for (int pass = 0; pass < kMaxIntentLockDrainPasses; pass++) {
             opCtx->recoveryUnit()->abandonSnapshot();
             Lock::CollectionLock colLock(opCtx->lockState(), ns.ns(), MODE_IS);
 
-            LOG(1) << "performing first index build drain";
+            LOG(1) << "performing index build drain pass " << (pass + 1) << " under intent lock";
             uassertStatusOK(indexer.drainBackgroundWritesIfNeeded());
+
+            if (indexer.numSideWritesRemaining() <= kDrainRemainingThreshold) {
+                break;
+            }
         }
 
         if (MONGO_FAIL_POINT(hangAfterIndexBuildFirstDrain)) {
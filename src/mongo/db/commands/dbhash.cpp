@@ -96,7 +96,8 @@ public:
                            BSONObjBuilder& result) {
         Timer timer;
 
-        std::set<std::string> desiredCollections;
+        // The StringData entries view 'cmdObj', which outlives this set.
+        std::set<StringData> desiredCollections;
         if (cmdObj["collections"].type() == Array) {
             BSONObjIterator i(cmdObj["collections"].Obj());
             while (i.more()) {
@@ -105,7 +106,7 @@ public:
                     errmsg = "collections entries have to be strings";
                     return false;
                 }
-                desiredCollections.insert(e.String());
+                desiredCollections.insert(e.valueStringData());
             }
         }
 
@@ -159,8 +160,7 @@ public:
             }
 
             // Only include 'system' collections that are replicated.
-            bool isReplicatedSystemColl =
-                (replicatedSystemCollections.count(collNss.coll().toString()) > 0);
+            bool isReplicatedSystemColl = (replicatedSystemCollections.count(collNss.coll()) > 0);
             if (collNss.isSystem() && !isReplicatedSystemColl)
                 continue;
 
@@ -169,8 +169,7 @@ public:
                 continue;
             }
 
-            if (desiredCollections.size() > 0 &&
-                desiredCollections.count(collNss.coll().toString()) == 0)
+            if (desiredCollections.size() > 0 && desiredCollections.count(collNss.coll()) == 0)
                 continue;
 
             // Don't include 'drop pending' collections.
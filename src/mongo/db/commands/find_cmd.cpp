@@ -33,6 +33,7 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/catalog/collection_info_cache.h"
 #include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands.h"
@@ -40,12 +41,15 @@
 #include "mongo/db/curop_failpoint_helpers.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/matcher/extensions_callback_real.h"
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/explain.h"
+#include "mongo/db/query/express_find.h"
 #include "mongo/db/query/find.h"
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/get_executor.h"
+#include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/server_parameters.h"
@@ -315,6 +319,49 @@ public:
                 opCtx->recoveryUnit()->setReadOnce(true);
             }
 
+            // An _id point read that doesn't need a projection, sort, or shard filter can be
+            // answered with a single index seek and record fetch, skipping PlanExecutor
+            // construction entirely.
+            if (const IndexDescriptor* idIndex =
+                    express_find::getEligibleIdIndex(opCtx, collection, *cq)) {
+                {
+                    stdx::lock_guard<Client> lk(*opCtx->getClient());
+                    CurOp::get(opCtx)->setPlanSummary_inlock("IDHACK");
+                }
+
+                auto doc = express_find::findById(opCtx, collection, idIndex, *cq);
+
+                // Whatever we found (or didn't) must be validated against the expected
+                // collection version, same as a regular plan.
+                auto css = CollectionShardingState::get(opCtx, nss);
+                css->checkShardVersionOrThrow(opCtx);
+
+                CursorResponseBuilder::Options options;
+                options.isInitialResponse = true;
+                CursorResponseBuilder firstBatch(result, options);
+                long long numResults = 0;
+                if (doc) {
+                    firstBatch.append(*doc);
+                    numResults = 1;
+                }
+
+                // Fill out curop based on the result. There is no executor to summarize, so
+                // report the metrics of the single seek directly.
+                auto curOp = CurOp::get(opCtx);
+                curOp->debug().nreturned = numResults;
+                curOp->debug().cursorid = -1;
+                curOp->debug().cursorExhausted = true;
+                PlanSummaryStats summaryStats;
+                summaryStats.totalKeysExamined = numResults;
+                summaryStats.totalDocsExamined = numResults;
+                summaryStats.indexesUsed.insert(idIndex->indexName());
+                curOp->debug().setPlanSummaryMetrics(summaryStats);
+                collection->infoCache()->notifyOfQuery(opCtx, summaryStats);
+
+                firstBatch.done(0 /* cursorId */, nss.ns());
+                return;
+            }
+
             // Get the execution plan for the query.
             auto exec = uassertStatusOK(getExecutorFind(opCtx, collection, nss, std::move(cq)));
 
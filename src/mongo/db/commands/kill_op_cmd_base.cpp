@@ -37,6 +37,7 @@
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
 #include "mongo/util/mongoutils/str.h"
 
 namespace mongo {
@@ -74,17 +75,7 @@ bool KillOpCmdBase::isKillingLocalOp(const BSONElement& opElem) {
 
 boost::optional<std::tuple<stdx::unique_lock<Client>, OperationContext*>>
 KillOpCmdBase::findOperationContext(ServiceContext* serviceContext, unsigned int opId) {
-    for (ServiceContext::LockedClientsCursor cursor(serviceContext);
-         Client* opClient = cursor.next();) {
-        stdx::unique_lock<Client> lk(*opClient);
-
-        OperationContext* opCtx = opClient->getOperationContext();
-        if (opCtx && opCtx->getOpID() == opId) {
-            return {std::make_tuple(std::move(lk), opCtx)};
-        }
-    }
-
-    return boost::none;
+    return serviceContext->findOperationContext(opId);
 }
 
 boost::optional<std::tuple<stdx::unique_lock<Client>, OperationContext*>>
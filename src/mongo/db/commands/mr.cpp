@@ -1577,8 +1577,7 @@ public:
                 // TODO SERVER-23261: Confirm whether this is the correct place to gather all
                 // metrics. There is no harm adding here for the time being.
                 curOp->debug().setPlanSummaryMetrics(stats);
-                scopedAutoColl->getCollection()->infoCache()->notifyOfQuery(opCtx,
-                                                                            stats.indexesUsed);
+                scopedAutoColl->getCollection()->infoCache()->notifyOfQuery(opCtx, stats);
 
                 if (curOp->shouldDBProfile()) {
                     BSONObjBuilder execStatsBob;
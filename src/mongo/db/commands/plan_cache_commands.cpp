@@ -386,7 +386,7 @@ Status listPlansOriginalFormat(std::unique_ptr<CanonicalQuery> cq,
 
         // Create the plan details field. Currently, this is a simple string representation of
         // SolutionCacheData.
-        SolutionCacheData* scd = entry->plannerData[i];
+        const SolutionCacheData* scd = entry->plannerData[i].get();
         BSONObjBuilder detailsBob(planBob.subobjStart("details"));
         detailsBob.append("solution", scd->toString());
         detailsBob.doneFast();
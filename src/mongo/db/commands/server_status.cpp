@@ -38,6 +38,7 @@
 #include "mongo/db/commands/server_status_internal.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/log.h"
 #include "mongo/util/net/socket_utils.h"
 #include "mongo/util/ramlog.h"
@@ -125,7 +126,12 @@ public:
                 continue;
             }
 
-            section->appendSection(opCtx, elem, &result);
+            const auto staleness = section->maxCacheStaleness();
+            if (staleness > Milliseconds(0)) {
+                _appendCachedSection(opCtx, section, elem, staleness, &result);
+            } else {
+                section->appendSection(opCtx, elem, &result);
+            }
             timeBuilder.appendNumber(
                 static_cast<string>(str::stream() << "after " << section->getSectionName()),
                 durationCount<Milliseconds>(clock->now() - runStart));
@@ -181,11 +187,71 @@ public:
     }
 
 private:
+    /**
+     * The last generated copy of a section that declared a nonzero maxCacheStaleness().
+     * Rapid-fire serverStatus calls are served from here; whichever caller first finds the
+     * copy older than the declared staleness regenerates it, while concurrent callers keep
+     * getting the stale copy rather than generating the section several times in parallel.
+     */
+    struct SectionCache {
+        stdx::mutex mutex;
+        Date_t refreshedAt;
+        BSONObj data;
+        bool refreshing = false;
+    };
+
+    SectionCache& _getSectionCache(const string& sectionName) {
+        stdx::lock_guard<stdx::mutex> lk(_sectionCachesMutex);
+        return _sectionCaches[sectionName];
+    }
+
+    void _appendCachedSection(OperationContext* opCtx,
+                              ServerStatusSection* section,
+                              const BSONElement& configElement,
+                              Milliseconds staleness,
+                              BSONObjBuilder* result) {
+        auto& cache = _getSectionCache(section->getSectionName());
+        const auto clock = opCtx->getServiceContext()->getFastClockSource();
+
+        {
+            stdx::lock_guard<stdx::mutex> lk(cache.mutex);
+            if (!cache.data.isEmpty() &&
+                (clock->now() - cache.refreshedAt <= staleness || cache.refreshing)) {
+                result->append(section->getSectionName(), cache.data);
+                return;
+            }
+            cache.refreshing = true;
+        }
+
+        BSONObj fresh;
+        try {
+            fresh = section->generateSection(opCtx, configElement).getOwned();
+        } catch (...) {
+            stdx::lock_guard<stdx::mutex> lk(cache.mutex);
+            cache.refreshing = false;
+            throw;
+        }
+
+        {
+            stdx::lock_guard<stdx::mutex> lk(cache.mutex);
+            cache.data = fresh;
+            cache.refreshedAt = clock->now();
+            cache.refreshing = false;
+        }
+
+        if (!fresh.isEmpty()) {
+            result->append(section->getSectionName(), fresh);
+        }
+    }
+
     const Date_t _started;
     bool _runCalled;
 
     typedef map<string, ServerStatusSection*> SectionMap;
     SectionMap _sections;
+
+    stdx::mutex _sectionCachesMutex;
+    map<string, SectionCache> _sectionCaches;
 };
 
 namespace {
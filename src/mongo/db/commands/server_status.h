@@ -36,6 +36,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/time_support.h"
 #include <string>
 
 namespace mongo {
@@ -73,6 +74,17 @@ public:
      */
     virtual void addRequiredPrivileges(std::vector<Privilege>* out){};
 
+    /**
+     * The maximum age of a cached copy of this section that the serverStatus command may
+     * serve instead of calling generateSection() again. Sections that are expensive to
+     * generate and are polled several times a second by monitoring agents can return a
+     * nonzero bound here; the default of zero disables caching. Only sections that implement
+     * generateSection() and ignore their configElement beyond inclusion may opt in.
+     */
+    virtual Milliseconds maxCacheStaleness() const {
+        return Milliseconds(0);
+    }
+
     /**
      * actually generate the result
      *
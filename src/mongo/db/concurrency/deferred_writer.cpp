@@ -94,34 +94,80 @@ StatusWith<std::unique_ptr<AutoGetCollection>> DeferredWriter::_getCollection(
     return std::move(agc);
 }
 
-void DeferredWriter::_worker(InsertStatement stmt) {
+void DeferredWriter::_worker() {
+    std::vector<InsertStatement> batch;
+    {
+        stdx::lock_guard<stdx::mutex> lock(_mutex);
+        batch.swap(_buffer);
+    }
+
+    int64_t batchBytes = 0;
+    for (const auto& stmt : batch) {
+        batchBytes += stmt.doc.objsize();
+    }
+
     auto uniqueOpCtx = Client::getCurrent()->makeOperationContext();
     OperationContext* opCtx = uniqueOpCtx.get();
-    auto result = _getCollection(opCtx);
 
-    if (!result.isOK()) {
-        _logFailure(result.getStatus());
-        return;
-    }
+    Status status = [&] {
+        auto result = _getCollection(opCtx);
+        if (!result.isOK()) {
+            return result.getStatus();
+        }
 
-    auto agc = std::move(result.getValue());
+        auto agc = std::move(result.getValue());
 
-    Collection& collection = *agc->getCollection();
+        Collection& collection = *agc->getCollection();
 
-    Status status = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
-        WriteUnitOfWork wuow(opCtx);
-        Status status = collection.insertDocument(opCtx, stmt, nullptr, false);
-        if (!status.isOK()) {
-            return status;
+        // Insert the whole batch under one WriteUnitOfWork, so the buffered documents share a
+        // single journal commit instead of paying one per document.
+        Status batchStatus = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
+            WriteUnitOfWork wuow(opCtx);
+            Status status =
+                collection.insertDocuments(opCtx, batch.cbegin(), batch.cend(), nullptr, false);
+            if (!status.isOK()) {
+                return status;
+            }
+
+            wuow.commit();
+            return Status::OK();
+        });
+
+        if (batchStatus.isOK() || batch.size() == 1) {
+            return batchStatus;
         }
 
-        wuow.commit();
-        return Status::OK();
-    });
+        // The batch failed; retry the documents one at a time so a single bad document cannot
+        // discard the rest of the buffer.
+        for (const auto& stmt : batch) {
+            Status status = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
+                WriteUnitOfWork wuow(opCtx);
+                Status status = collection.insertDocument(opCtx, stmt, nullptr, false);
+                if (!status.isOK()) {
+                    return status;
+                }
+
+                wuow.commit();
+                return Status::OK();
+            });
+            if (!status.isOK()) {
+                batchStatus = status;
+            }
+        }
+        return batchStatus;
+    }();
 
     stdx::lock_guard<stdx::mutex> lock(_mutex);
 
-    _numBytes -= stmt.doc.objsize();
+    _numBytes -= batchBytes;
+
+    // If documents arrived while this batch was being written, they become the next batch;
+    // otherwise let the next insert schedule a new flush.
+    if (!_buffer.empty()) {
+        fassert(51028, _pool->schedule([this] { _worker(); }));
+    } else {
+        _flushScheduled = false;
+    }
 
     // If a write to a deferred collection fails, periodically tell the log.
     if (!status.isOK()) {
@@ -134,6 +180,7 @@ DeferredWriter::DeferredWriter(NamespaceString nss, CollectionOptions opts, int6
       _maxNumBytes(maxSize),
       _nss(nss),
       _numBytes(0),
+      _flushScheduled(false),
       _droppedEntries(0),
       _lastLogged(TimePoint::clock::now() - kLogInterval) {}
 
@@ -179,7 +226,14 @@ bool DeferredWriter::insertDocument(BSONObj obj) {
 
     // Add the object to the buffer.
     _numBytes += obj.objsize();
-    fassert(40588, _pool->schedule([this, obj] { _worker(InsertStatement(obj.getOwned())); }));
+    _buffer.emplace_back(obj.getOwned());
+
+    // Schedule a flush unless one is already in flight; an in-flight flush picks up everything
+    // buffered by the time it drains the buffer.
+    if (!_flushScheduled) {
+        _flushScheduled = true;
+        fassert(40588, _pool->schedule([this] { _worker(); }));
+    }
     return true;
 }
 
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -134,9 +136,11 @@ private:
     StatusWith<std::unique_ptr<AutoGetCollection>> _getCollection(OperationContext* opCtx);
 
     /**
-     * The method that the worker thread will run.
+     * The method that the worker thread will run. Drains the whole in-memory buffer and inserts
+     * its contents as one batch, inside a single WriteUnitOfWork, falling back to one-by-one
+     * inserts if the batch fails.
      */
-    void _worker(InsertStatement stmt);
+    void _worker();
 
     /**
      * The options for the collection, in case we need to create it.
@@ -165,6 +169,18 @@ private:
      */
     int64_t _numBytes;
 
+    /**
+     * Documents waiting to be written.  The worker task takes the whole buffer at once, so
+     * documents that accumulate while a write is in progress become the next batch.
+     */
+    std::vector<InsertStatement> _buffer;
+
+    /**
+     * Whether a worker task is scheduled or running.  Ensures at most one flush is in flight, so
+     * concurrent producers coalesce into batches instead of scheduling a task per document.
+     */
+    bool _flushScheduled;
+
     /**
      * The number of deffered entries that have been dropped. Resets when the
      * rate-limited system log is written out.
@@ -45,6 +45,7 @@
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/stringutils.h"
 #include "mongo/util/timer.h"
 
@@ -412,9 +413,19 @@ void LockHead::migratePartitionedLockHeads() {
 // Have more buckets than CPUs to reduce contention on lock and caches
 const unsigned LockManager::_numLockBuckets(128);
 
-// Balance scalability of intent locks against potential added cost of conflicting locks.
-// The exact value doesn't appear very important, but should be power of two
-const unsigned LockManager::_numPartitions = 32;
+// Balance scalability of intent locks against potential added cost of conflicting locks. The
+// exact value doesn't appear very important, but should be power of two. Scale with the number
+// of available cores so that concurrent lockers on large machines are unlikely to share a
+// partition, since a shared partition mutex puts independent intent acquisitions back in
+// contention with each other.
+const unsigned LockManager::_numPartitions = [] {
+    unsigned partitions = 32;
+    const auto cores = ProcessInfo::getNumAvailableCores();
+    while (partitions < cores) {
+        partitions *= 2;
+    }
+    return partitions;
+}();
 
 LockManager::LockManager() {
     _lockBuckets = new LockBucket[_numLockBuckets];
@@ -246,6 +246,17 @@ void Locker::setGlobalThrottling(class TicketHolder* reading, class TicketHolder
     ticketHolders[MODE_IX] = writing;
 }
 
+/* static */
+int Locker::getGlobalThrottlingQueueDepth(LockMode mode) {
+    auto holder = ticketHolders[mode];
+    return holder ? holder->queued() : 0;
+}
+
+/* static */
+TicketHolder* Locker::getGlobalThrottlingTicketHolder(LockMode mode) {
+    return ticketHolders[mode];
+}
+
 LockerImpl::LockerImpl()
     : _id(idCounter.addAndFetch(1)), _wuowNestingLevel(0), _threadId(stdx::this_thread::get_id()) {}
 
@@ -261,6 +272,29 @@ void LockerImpl::unsetThreadId() {
     _threadId = stdx::thread::id();  // Reset to represent a non-executing thread.
 }
 
+bool LockerImpl::prepareForReuse() {
+    // These mirror the destructor's invariants; a locker which fails them is in active use.
+    if (inAWriteUnitOfWork() || !_requests.empty() || _modeForTicket != MODE_NONE ||
+        _numResourcesToUnlockAtEndUnitOfWork != 0) {
+        return false;
+    }
+
+    // Flags which live on the Locker base class cannot be reset from here, so refuse to recycle
+    // a locker whose behavior was customized rather than leak the customization into the next
+    // operation.
+    if (!shouldConflictWithSecondaryBatchApplication() || !shouldAcquireTicket() ||
+        _uninterruptibleLocksRequested != 0 || _clientState.load() != kInactive) {
+        return false;
+    }
+
+    // The LockerId is intentionally retained; it only needs to be unique per locker object.
+    _stats.reset();
+    _sharedLocksShouldTwoPhaseLock = false;
+    _maxLockTimeout = boost::none;
+    unsetThreadId();
+    return true;
+}
+
 LockerImpl::~LockerImpl() {
     // Cannot delete the Locker while there are still outstanding requests, because the
     // LockManager may attempt to access deleted memory. Besides it is probably incorrect
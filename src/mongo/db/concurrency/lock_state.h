@@ -113,6 +113,8 @@ public:
     void updateThreadIdToCurrentThread() override;
     void unsetThreadId() override;
 
+    bool prepareForReuse() override;
+
     void setSharedLocksShouldTwoPhaseLock(bool sharedLocksShouldTwoPhaseLock) override {
         _sharedLocksShouldTwoPhaseLock = sharedLocksShouldTwoPhaseLock;
     }
@@ -66,6 +66,16 @@ public:
         return false;
     }
 
+    /**
+     * If the locker holds no resources and all of its tunable behavior is at the defaults, resets
+     * its per-operation state (statistics, timeouts, owning thread) and returns true, indicating
+     * that it may be handed to a subsequent operation instead of constructing a fresh locker.
+     * Returns false and leaves the locker unchanged if it cannot be reused.
+     */
+    virtual bool prepareForReuse() {
+        return false;
+    }
+
     /**
      * Require global lock attempts to obtain tickets from 'reading' (for MODE_S and MODE_IS),
      * and from 'writing' (for MODE_IX), which must have static lifetimes. There is no throttling
@@ -75,6 +85,19 @@ public:
      */
     static void setGlobalThrottling(class TicketHolder* reading, class TicketHolder* writing);
 
+    /**
+     * Returns the number of operations currently queued for a global throttling ticket of the
+     * given mode, or zero if throttling is not enabled for that mode. This is a cheap proxy for
+     * foreground load that background tasks may use to decide whether to back off.
+     */
+    static int getGlobalThrottlingQueueDepth(LockMode mode);
+
+    /**
+     * Returns the TicketHolder used for global throttling of the given mode, or nullptr if
+     * throttling is not enabled for that mode. The returned holder has static lifetime.
+     */
+    static class TicketHolder* getGlobalThrottlingTicketHolder(LockMode mode);
+
     /**
      * State for reporting the number of active and queued reader and writer clients.
      */
@@ -37,11 +37,28 @@
 #include "mongo/util/log.h"
 #include "mongo/util/log_and_backoff.h"
 #include "mongo/util/stacktrace.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
+namespace {
+
+// Striped by namespace hash. Distinct namespaces that happen to share a slot serialize their
+// pessimistic retriers together, which is harmless and keeps the table fixed-size and
+// allocation-free.
+const size_t kNumSerializationSlots = 64;
+stdx::timed_mutex serializationSlots[kNumSerializationSlots];
+
+}  // namespace
+
 AtomicBool WriteConflictException::trace(false);
 
+const int WriteConflictException::kSerializeAfterAttempts;
+
+stdx::timed_mutex& WriteConflictException::serializationSlot(StringData ns) {
+    return serializationSlots[StringMapHasher()(ns) % kNumSerializationSlots];
+}
+
 WriteConflictException::WriteConflictException()
     : DBException(Status(ErrorCodes::WriteConflict, "WriteConflict")) {
     if (trace.load()) {
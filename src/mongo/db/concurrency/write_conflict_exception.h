@@ -36,6 +36,8 @@
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/curop.h"
+#include "mongo/stdx/chrono.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
@@ -57,6 +59,20 @@ public:
      */
     static void logAndBackoff(int attempt, StringData operation, StringData ns);
 
+    /**
+     * Once a single retry loop has seen this many consecutive conflicts, further attempts stop
+     * optimistic-retrying and queue behind the other heavily conflicting writers on the same
+     * serialization slot, which drains hot-key convoys instead of letting them collide again.
+     */
+    static const int kSerializeAfterAttempts = 4;
+
+    /**
+     * Returns the serialization slot for 'ns': one of a fixed set of mutexes, striped by
+     * namespace hash. The conflicting RecordId is not carried on the exception, so the namespace
+     * is the finest key the retry loop can serialize on.
+     */
+    static stdx::timed_mutex& serializationSlot(StringData ns);
+
     /**
      * If true, will call printStackTrace on every WriteConflictException created.
      * Can be set via setParameter named traceWriteConflictExceptions.
@@ -87,6 +103,10 @@ auto writeConflictRetry(OperationContext* opCtx, StringData opStr, StringData ns
         return f();
     }
 
+    // Held (released when the loop exits) once this operation has conflicted enough times in a
+    // row that optimistic retrying is clearly losing to the other writers of the same hot key.
+    stdx::unique_lock<stdx::timed_mutex> serializedRetries;
+
     int attempts = 0;
     while (true) {
         try {
@@ -96,6 +116,17 @@ auto writeConflictRetry(OperationContext* opCtx, StringData opStr, StringData ns
             WriteConflictException::logAndBackoff(attempts, opStr, ns);
             ++attempts;
             opCtx->recoveryUnit()->abandonSnapshot();
+
+            if (attempts >= WriteConflictException::kSerializeAfterAttempts &&
+                !serializedRetries.owns_lock()) {
+                // Acquisition is bounded by a timeout rather than unconditional: f may block on
+                // locks while another serialized retrier holds the slot, and some callers enter
+                // this loop already holding locks of their own. On timeout we simply keep
+                // retrying optimistically.
+                serializedRetries = stdx::unique_lock<stdx::timed_mutex>(
+                    WriteConflictException::serializationSlot(ns), stdx::defer_lock);
+                serializedRetries.try_lock_for(stdx::chrono::milliseconds(100));
+            }
         }
     }
 }
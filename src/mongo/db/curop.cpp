@@ -48,6 +48,7 @@
 #include "mongo/db/json.h"
 #include "mongo/db/query/getmore_request.h"
 #include "mongo/db/query/plan_summary_stats.h"
+#include "mongo/db/stats/slow_op_ring.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/rpc/metadata/client_metadata_ismaster.h"
 #include "mongo/rpc/metadata/impersonated_user_metadata.h"
@@ -403,12 +404,29 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
 
     const bool shouldSample =
         client->getPrng().nextCanonicalDouble() < serverGlobalParams.sampleRate;
+    const bool isSlowOp = _debug.executionTimeMicros > slowMs * 1000LL;
 
-    if (shouldLogOp || (shouldSample && _debug.executionTimeMicros > slowMs * 1000LL)) {
+    if (shouldLogOp || (shouldSample && isSlowOp)) {
         auto lockerInfo = opCtx->lockState()->getLockerInfo(_lockStatsBase);
         log(component) << _debug.report(client, *this, (lockerInfo ? &lockerInfo->stats : nullptr));
     }
 
+    // Capture a report of the slow operation into the in-memory ring, if enabled. Unlike the
+    // profiler this takes no collection locks and performs no storage writes, so it remains
+    // usable when a write to system.profile would make an overloaded server worse.
+    if (isSlowOp && SlowOpRing::enabled()) {
+        BufBuilder ringBufBuilder(1024);
+        BSONObjBuilder b(ringBufBuilder);
+        if (auto lockerInfo = opCtx->lockState()->getLockerInfo(_lockStatsBase)) {
+            _debug.append(*this, lockerInfo->stats, b);
+        } else {
+            _debug.append(*this, SingleThreadedLockStats(), b);
+        }
+        b.appendDate("ts", jsTime());
+        b.append("client", client->clientAddress());
+        SlowOpRing::get(opCtx->getServiceContext()).record(b.obj());
+    }
+
     // Return 'true' if this operation should also be added to the profiler.
     return shouldDBProfile(shouldSample);
 }
@@ -34,6 +34,8 @@
 
 #include "mongo/db/cursor_manager.h"
 
+#include <algorithm>
+
 #include "mongo/base/data_cursor.h"
 #include "mongo/base/init.h"
 #include "mongo/db/audit.h"
@@ -495,17 +497,36 @@ bool CursorManager::cursorShouldTimeout_inlock(const ClientCursor* cursor, Date_
 std::size_t CursorManager::timeoutCursors(OperationContext* opCtx, Date_t now) {
     std::vector<std::unique_ptr<ClientCursor, ClientCursor::Deleter>> toDisposeWithoutMutex;
 
+    const auto timeout = Milliseconds(getCursorTimeoutMillis());
+
     for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
         auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
+
+        // Skip walking this partition's cursors if nothing in it can have reached the timeout
+        // since the last sweep. Cursors registered or unpinned since then have a newer last-use
+        // time than the recorded watermark, so they cannot beat it to expiry.
+        if (now - _oldestEligibleLastUse[partitionId] < timeout) {
+            continue;
+        }
+
+        // Anything registered, unpinned or left behind by this sweep has a last-use time of at
+        // least 'now', except for the idle eligible survivors accounted for below.
+        Date_t oldestEligible = now;
+
         for (auto it = lockedPartition->begin(); it != lockedPartition->end();) {
             auto* cursor = it->second;
             if (cursorShouldTimeout_inlock(cursor, now)) {
                 toDisposeWithoutMutex.emplace_back(cursor);
                 it = lockedPartition->erase(it);
             } else {
+                if (!cursor->isNoTimeout() && !cursor->_operationUsingCursor) {
+                    oldestEligible = std::min(oldestEligible, cursor->_lastUseDate);
+                }
                 ++it;
             }
         }
+
+        _oldestEligibleLastUse[partitionId] = oldestEligible;
     }
 
     // Be careful not to dispose of cursors while holding the partition lock.
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <array>
 #include <utility>
 
 #include "mongo/db/catalog/util/partitioned.h"
@@ -308,5 +309,12 @@ private:
         _registeredPlanExecutors;
     std::unique_ptr<Partitioned<stdx::unordered_map<CursorId, ClientCursor*>, kNumPartitions>>
         _cursorMap;
+
+    // For each '_cursorMap' partition, the oldest last-use time an idle, timeout-eligible cursor
+    // in it could possibly have. Refreshed by each sweep and only accessed under that partition's
+    // lock. Lets timeoutCursors() skip partitions in which nothing can have reached the timeout
+    // yet, so sweep cost does not scale with the total number of open cursors. The default of the
+    // epoch makes the first sweep examine everything.
+    std::array<Date_t, kNumPartitions> _oldestEligibleLastUse;
 };
 }  // namespace mongo
@@ -95,6 +95,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/periodic_runner_job_abort_expired_transactions.h"
 #include "mongo/db/periodic_runner_job_decrease_snapshot_cache_pressure.h"
+#include "mongo/db/periodic_runner_job_flow_control.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/repair_database_and_check_version.h"
 #include "mongo/db/repl/drop_pending_collection_reaper.h"
@@ -331,6 +332,29 @@ ExitCode _initAndListen(int listenPort) {
         }
         serviceContext->setTransportLayer(std::move(tl));
     }
+    // The contents of "_tmp" are leftovers from interrupted external sorts, and removing them can
+    // take a while when a large index build was cut short. The removal only touches that one
+    // subdirectory, so it can proceed while the storage engine replays its journal and opens its
+    // tables; it is joined below, before anything can start a new external sort.
+    stdx::thread tmpDirCleanupThread;
+    if (!storageGlobalParams.readOnly && !storageGlobalParams.repair &&
+        boost::filesystem::exists(storageGlobalParams.dbpath)) {
+        tmpDirCleanupThread = stdx::thread([dbpath = storageGlobalParams.dbpath] {
+            Client::initThread("tmpDirCleanup");
+            try {
+                boost::filesystem::remove_all(dbpath + "/_tmp/");
+            } catch (const std::exception& e) {
+                warning() << "Failed to remove " << dbpath << "/_tmp/: " << e.what();
+            }
+        });
+    }
+    const auto joinTmpDirCleanupThread = [&tmpDirCleanupThread] {
+        if (tmpDirCleanupThread.joinable()) {
+            tmpDirCleanupThread.join();
+        }
+    };
+    ON_BLOCK_EXIT(joinTmpDirCleanupThread);
+
     initializeStorageEngine(serviceContext, StorageEngineInitFlags::kNone);
 
 #ifdef MONGO_CONFIG_WIREDTIGER_ENABLED
@@ -403,7 +427,10 @@ ExitCode _initAndListen(int listenPort) {
 
     initializeSNMP();
 
-    if (!storageGlobalParams.readOnly) {
+    // From here on, external sorts (e.g. index rebuilds) may create files under "_tmp", so the
+    // cleanup of the previous incarnation's files must be complete.
+    joinTmpDirCleanupThread();
+    if (storageGlobalParams.repair && !storageGlobalParams.readOnly) {
         boost::filesystem::remove_all(storageGlobalParams.dbpath + "/_tmp/");
     }
 
@@ -623,6 +650,12 @@ ExitCode _initAndListen(int listenPort) {
         startPeriodicThreadToDecreaseSnapshotHistoryCachePressure(serviceContext);
     }
 
+    // Start up a background task which, when flow control is enabled, throttles write ticket
+    // issuance on a primary whose majority commit point is lagging too far behind.
+    if (replSettings.usingReplSets()) {
+        startPeriodicThreadToAdjustWriteTicketsForReplicationLag(serviceContext);
+    }
+
     // Set up the logical session cache
     LogicalSessionCacheServer kind = LogicalSessionCacheServer::kStandalone;
     if (serverGlobalParams.clusterRole == ClusterRole::ShardServer) {
@@ -34,6 +34,9 @@
 
 #include "mongo/db/exec/cached_plan.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/multi_plan.h"
@@ -62,12 +65,15 @@ CachedPlanStage::CachedPlanStage(OperationContext* opCtx,
                                  CanonicalQuery* cq,
                                  const QueryPlannerParams& params,
                                  size_t decisionWorks,
+                                 std::vector<std::shared_ptr<const SolutionCacheData>>
+                                     cachedPlannerData,
                                  PlanStage* root)
     : RequiresCollectionStage(kStageType, opCtx, collection),
       _ws(ws),
       _canonicalQuery(cq),
       _plannerParams(params),
-      _decisionWorks(decisionWorks) {
+      _decisionWorks(decisionWorks),
+      _cachedPlannerData(std::move(cachedPlannerData)) {
     _children.emplace_back(root);
 }
 
@@ -85,29 +91,48 @@ Status CachedPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     // The trial period ends without replanning if the cached plan produces this many results.
     size_t numResults = MultiPlanStage::getTrialPeriodNumToReturn(*_canonicalQuery);
 
-    for (size_t i = 0; i < maxWorksBeforeReplan; ++i) {
-        // Might need to yield between calls to work due to the timer elapsing.
+    // Pull results out of the child in batches rather than one work() call at a time. The batch
+    // size bounds how much work can happen between yield checks.
+    const size_t kWorkBatchSize = 64;
+    const size_t baseWorks = child()->getCommonStats()->works;
+    std::vector<WorkingSetID> batch;
+    batch.reserve(kWorkBatchSize);
+
+    size_t worksDone = 0;
+    while (worksDone < maxWorksBeforeReplan) {
+        // Might need to yield between batches due to the timer elapsing.
         Status yieldStatus = tryYield(yieldPolicy);
         if (!yieldStatus.isOK()) {
             return yieldStatus;
         }
 
+        const size_t resultsNeeded =
+            numResults > _results.size() ? numResults - _results.size() : 1;
+        const size_t batchSize =
+            std::min({kWorkBatchSize, maxWorksBeforeReplan - worksDone, resultsNeeded});
+
+        batch.clear();
         WorkingSetID id = WorkingSet::INVALID_ID;
-        PlanStage::StageState state = child()->work(&id);
+        PlanStage::StageState state = child()->workBatch(batchSize, &batch, &id);
+        worksDone = child()->getCommonStats()->works - baseWorks;
 
-        if (PlanStage::ADVANCED == state) {
-            // Save result for later.
-            WorkingSetMember* member = _ws->get(id);
+        // Save results for later, even if the batch ended with a terminating state.
+        for (WorkingSetID resultId : batch) {
+            WorkingSetMember* member = _ws->get(resultId);
             // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
             member->makeObjOwnedIfNeeded();
-            _results.push(id);
+            _results.push(resultId);
+        }
 
-            if (_results.size() >= numResults) {
-                // Once a plan returns enough results, stop working. Update cache with stats
-                // from this run and return.
-                updatePlanCache();
-                return Status::OK();
-            }
+        if (!_results.empty() && _results.size() >= numResults) {
+            // Once a plan returns enough results, stop working. Update cache with stats
+            // from this run and return.
+            updatePlanCache();
+            return Status::OK();
+        }
+
+        if (PlanStage::ADVANCED == state || PlanStage::NEED_TIME == state) {
+            // The work budget for this batch ran out; keep working the plan.
         } else if (PlanStage::IS_EOF == state) {
             // Cached plan hit EOF quickly enough. No need to replan. Update cache with stats
             // from this run and return.
@@ -152,7 +177,7 @@ Status CachedPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
 
             return WorkingSetCommon::getMemberObjectStatus(statusObj);
         } else {
-            invariant(PlanStage::NEED_TIME == state);
+            MONGO_UNREACHABLE;
         }
     }
 
@@ -199,6 +224,40 @@ Status CachedPlanStage::replan(PlanYieldPolicy* yieldPolicy, bool shouldCache) {
         cache->deactivate(*_canonicalQuery);
     }
 
+    // Before re-enumerating the whole plan space, try re-ranking the plans already stored in
+    // the cache entry. The entry holds the cached data for every candidate from the original
+    // multi-planning, so this trials the same set of plans while skipping the planner and
+    // enumerator. If any candidate can no longer be rebuilt (e.g. the catalog has changed
+    // under the entry), fall through to planning from scratch.
+    if (_cachedPlannerData.size() > 1) {
+        std::vector<std::unique_ptr<QuerySolution>> solutions;
+        solutions.reserve(_cachedPlannerData.size());
+        Status rebuildStatus = Status::OK();
+        for (auto&& solnCacheData : _cachedPlannerData) {
+            auto statusWithQs =
+                QueryPlanner::planFromCacheData(*_canonicalQuery, _plannerParams, *solnCacheData);
+            if (!statusWithQs.isOK()) {
+                rebuildStatus = statusWithQs.getStatus();
+                break;
+            }
+            auto solution = std::move(statusWithQs.getValue());
+            // Solutions built from cached data don't carry cache data of their own, but the
+            // MultiPlanStage can only refresh the cache entry if every candidate has it.
+            solution->cacheData.reset(solnCacheData->clone());
+            solutions.push_back(std::move(solution));
+        }
+
+        if (rebuildStatus.isOK()) {
+            LOG(1) << "Re-ranking " << solutions.size() << " cached candidate plans for "
+                   << redact(_canonicalQuery->toStringShort());
+            return pickAmongCandidates(std::move(solutions), yieldPolicy, shouldCache);
+        }
+
+        LOG(1) << "Could not rebuild all cached candidate plans, replanning from scratch."
+               << " query: " << redact(_canonicalQuery->toStringShort())
+               << " status: " << redact(rebuildStatus);
+    }
+
     // Use the query planning module to plan the whole query.
     auto statusWithSolutions = QueryPlanner::plan(*_canonicalQuery, _plannerParams);
     if (!statusWithSolutions.isOK()) {
@@ -235,8 +294,16 @@ Status CachedPlanStage::replan(PlanYieldPolicy* yieldPolicy, bool shouldCache) {
         return Status::OK();
     }
 
-    // Many solutions. Create a MultiPlanStage to pick the best, update the cache,
-    // and so on. The working set will be shared by all candidate plans.
+    // Many solutions. Trial them against each other to pick the best, update the cache, and
+    // so on.
+    return pickAmongCandidates(std::move(solutions), yieldPolicy, shouldCache);
+}
+
+Status CachedPlanStage::pickAmongCandidates(std::vector<std::unique_ptr<QuerySolution>> solutions,
+                                            PlanYieldPolicy* yieldPolicy,
+                                            bool shouldCache) {
+    // Create a MultiPlanStage to pick the best, update the cache, and so on. The working set
+    // will be shared by all candidate plans.
     auto cachingMode = shouldCache ? MultiPlanStage::CachingMode::AlwaysCache
                                    : MultiPlanStage::CachingMode::NeverCache;
     _children.emplace_back(
@@ -37,6 +37,7 @@
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/record_id.h"
@@ -54,12 +55,19 @@ class PlanYieldPolicy;
  */
 class CachedPlanStage final : public RequiresCollectionStage {
 public:
+    /**
+     * 'cachedPlannerData' is the full set of plans stored in the cache entry this stage was
+     * built from: the winner first, followed by the runner-ups in ranked order. If the cached
+     * plan underperforms, the runner-ups are re-ranked against the incumbent before falling
+     * back to planning from scratch.
+     */
     CachedPlanStage(OperationContext* opCtx,
                     Collection* collection,
                     WorkingSet* ws,
                     CanonicalQuery* cq,
                     const QueryPlannerParams& params,
                     size_t decisionWorks,
+                    std::vector<std::shared_ptr<const SolutionCacheData>> cachedPlannerData,
                     PlanStage* root);
 
     bool isEOF() final;
@@ -111,6 +119,15 @@ private:
      */
     Status replan(PlanYieldPolicy* yieldPolicy, bool shouldCache);
 
+    /**
+     * Builds stage trees for 'solutions' and delegates winner selection to a MultiPlanStage
+     * trial. Used both when re-ranking the cached candidates and when replanning from scratch
+     * produces multiple solutions.
+     */
+    Status pickAmongCandidates(std::vector<std::unique_ptr<QuerySolution>> solutions,
+                               PlanYieldPolicy* yieldPolicy,
+                               bool shouldCache);
+
     /**
      * May yield during the cached plan stage's trial period or replanning phases.
      *
@@ -132,6 +149,11 @@ private:
     // cached.
     size_t _decisionWorks;
 
+    // The cached data for every plan in the cache entry, winner first, shared immutably with
+    // the plan cache. Allows underperforming plans to be re-ranked against their original
+    // runner-ups without re-enumeration.
+    std::vector<std::shared_ptr<const SolutionCacheData>> _cachedPlannerData;
+
     // If we fall back to re-planning the query, and there is just one resulting query solution,
     // that solution is owned here.
     std::unique_ptr<QuerySolution> _replannedQs;
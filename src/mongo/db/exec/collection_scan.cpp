@@ -173,6 +173,63 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     return returnIfMatches(member, id, out);
 }
 
+PlanStage::StageState CollectionScan::doWorkBatch(size_t maxResults,
+                                                  std::vector<WorkingSetID>* results,
+                                                  WorkingSetID* out) {
+    // The batched path only handles the steady state of a plain scan. Cursor creation, tailable
+    // cursors, and oplog timestamp tracking keep the single-record path's semantics.
+    if (!_cursor || _params.tailable || _params.shouldTrackLatestOplogTimestamp ||
+        _commonStats.isEOF) {
+        return PlanStage::doWorkBatch(maxResults, results, out);
+    }
+
+    size_t unitsLeft = maxResults;
+    size_t numProduced = 0;
+
+    // Tight loop over the record cursor: one try/catch per batch and no per-record work()
+    // bookkeeping.
+    try {
+        while (unitsLeft > 0) {
+            ++_commonStats.works;
+            --unitsLeft;
+
+            boost::optional<Record> record = _cursor->next();
+            if (!record) {
+                _commonStats.isEOF = true;
+                return PlanStage::IS_EOF;
+            }
+            _lastSeenId = record->id;
+
+            WorkingSetID id = _workingSet->allocate();
+            WorkingSetMember* member = _workingSet->get(id);
+            member->recordId = record->id;
+            member->obj = {getOpCtx()->recoveryUnit()->getSnapshotId(),
+                           record->data.releaseToBson()};
+            _workingSet->transitionToRecordIdAndObj(id);
+
+            WorkingSetID matchedId = WorkingSet::INVALID_ID;
+            StageState state = returnIfMatches(member, id, &matchedId);
+            if (PlanStage::ADVANCED == state) {
+                ++_commonStats.advanced;
+                results->push_back(matchedId);
+                ++numProduced;
+            } else if (PlanStage::NEED_TIME == state) {
+                ++_commonStats.needTime;
+            } else {
+                // The end condition for a bounded oplog scan was hit.
+                invariant(PlanStage::IS_EOF == state);
+                return state;
+            }
+        }
+    } catch (const WriteConflictException&) {
+        ++_commonStats.needYield;
+        *out = WorkingSet::INVALID_ID;
+        return PlanStage::NEED_YIELD;
+    }
+
+    return numProduced > 0 ? PlanStage::ADVANCED : PlanStage::NEED_TIME;
+}
+
 Status CollectionScan::setLatestOplogEntryTimestamp(const Record& record) {
     auto tsElem = record.data.toBson()[repl::OpTime::kTimestampFieldName];
     if (tsElem.type() != BSONType::bsonTimestamp) {
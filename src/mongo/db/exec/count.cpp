@@ -76,8 +76,34 @@ PlanStage::StageState CountStage::doWork(WorkingSetID* out) {
     // For cases where we can't ask the record store directly, we should always have a child stage
     // from which we can retrieve results.
     invariant(child());
+
+    // Pull results from the child a batch at a time; count doesn't need to look at them, so
+    // there's no reason to pay the per-document work() protocol. Cap the batch so that a skip or
+    // limit is never overshot.
+    size_t batchSize = kCountBatchSize;
+    if (_params.limit > 0) {
+        long long needed = _leftToSkip + (_params.limit - _specificStats.nCounted);
+        if (needed < static_cast<long long>(batchSize)) {
+            batchSize = static_cast<size_t>(needed);
+        }
+    }
+
+    _batch.clear();
     WorkingSetID id = WorkingSet::INVALID_ID;
-    PlanStage::StageState state = child()->work(&id);
+    PlanStage::StageState state = child()->workBatch(batchSize, &_batch, &id);
+
+    // If we're still skipping, then decrement the number left to skip. Otherwise increment the
+    // count until we hit the limit. Count doesn't need the actual results, so we just discard
+    // the working set members that got returned from the child.
+    for (WorkingSetID memberId : _batch) {
+        if (_leftToSkip > 0) {
+            _leftToSkip--;
+            _specificStats.nSkipped++;
+        } else {
+            _specificStats.nCounted++;
+        }
+        _ws->free(memberId);
+    }
 
     if (PlanStage::IS_EOF == state) {
         _commonStats.isEOF = true;
@@ -88,21 +114,6 @@ PlanStage::StageState CountStage::doWork(WorkingSetID* out) {
         invariant(WorkingSet::INVALID_ID != id);
         *out = id;
         return state;
-    } else if (PlanStage::ADVANCED == state) {
-        // We got a result. If we're still skipping, then decrement the number left to skip.
-        // Otherwise increment the count until we hit the limit.
-        if (_leftToSkip > 0) {
-            _leftToSkip--;
-            _specificStats.nSkipped++;
-        } else {
-            _specificStats.nCounted++;
-        }
-
-        // Count doesn't need the actual results, so we just discard any valid working
-        // set members that got returned from the child.
-        if (WorkingSet::INVALID_ID != id) {
-            _ws->free(id);
-        }
     } else if (PlanStage::NEED_YIELD == state) {
         *out = id;
         return PlanStage::NEED_YIELD;
@@ -82,6 +82,11 @@ public:
     static const char* kStageType;
 
 private:
+    // Number of child results counted per work() call. Results are counted in blocks so that
+    // count-heavy plans don't pay the one-document-at-a-time stage protocol; the executor still
+    // gets a yield check between blocks.
+    static constexpr size_t kCountBatchSize = 1000;
+
     CountStageParams _params;
 
     // The number of documents that we still need to skip.
@@ -91,6 +96,9 @@ private:
     // by us.
     WorkingSet* _ws;
 
+    // Reused buffer for ids returned by the child's workBatch().
+    std::vector<WorkingSetID> _batch;
+
     CountStats _specificStats;
 };
 
@@ -148,6 +148,75 @@ PlanStage::StageState CountScan::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+PlanStage::StageState CountScan::doWorkBatch(size_t maxResults,
+                                             std::vector<WorkingSetID>* results,
+                                             WorkingSetID* out) {
+    if (_commonStats.isEOF)
+        return PlanStage::IS_EOF;
+
+    size_t unitsLeft = maxResults;
+    size_t numProduced = 0;
+
+    // Let the single-key path position the cursor; it has the retry-on-WriteConflict semantics
+    // for the initial seek.
+    if (!_cursor) {
+        ++_commonStats.works;
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        StageState state = doWork(&id);
+        if (PlanStage::ADVANCED == state) {
+            ++_commonStats.advanced;
+            results->push_back(id);
+            ++numProduced;
+        } else if (PlanStage::NEED_TIME == state) {
+            ++_commonStats.needTime;
+        } else {
+            if (PlanStage::NEED_YIELD == state) {
+                ++_commonStats.needYield;
+            }
+            *out = id;
+            return state;
+        }
+        --unitsLeft;
+    }
+
+    // Count the rest of the batch in a tight loop over the index cursor: one try/catch per
+    // batch and no per-key work() bookkeeping.
+    try {
+        const auto kWantLoc = SortedDataInterface::Cursor::kWantLoc;
+        while (unitsLeft > 0) {
+            ++_commonStats.works;
+            --unitsLeft;
+
+            boost::optional<IndexKeyEntry> entry = _cursor->next(kWantLoc);
+            ++_specificStats.keysExamined;
+
+            if (!entry) {
+                _commonStats.isEOF = true;
+                _cursor.reset();
+                return PlanStage::IS_EOF;
+            }
+
+            if (_shouldDedup && !_returned.insert(entry->loc).second) {
+                // *loc was already in _returned.
+                ++_commonStats.needTime;
+                continue;
+            }
+
+            WorkingSetID id = _workingSet->allocate();
+            _workingSet->transitionToRecordIdAndObj(id);
+            results->push_back(id);
+            ++_commonStats.advanced;
+            ++numProduced;
+        }
+    } catch (const WriteConflictException&) {
+        ++_commonStats.needYield;
+        *out = WorkingSet::INVALID_ID;
+        return PlanStage::NEED_YIELD;
+    }
+
+    return numProduced > 0 ? PlanStage::ADVANCED : PlanStage::NEED_TIME;
+}
+
 bool CountScan::isEOF() {
     return _commonStats.isEOF;
 }
@@ -90,6 +90,9 @@ public:
     CountScan(OperationContext* opCtx, CountScanParams params, WorkingSet* workingSet);
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
     bool isEOF() final;
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
@@ -32,11 +32,14 @@
 
 #include "mongo/db/exec/fetch.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/mongoutils/str.h"
@@ -58,7 +61,8 @@ FetchStage::FetchStage(OperationContext* opCtx,
     : RequiresCollectionStage(kStageType, opCtx, collection),
       _ws(ws),
       _filter(filter),
-      _idRetrying(WorkingSet::INVALID_ID) {
+      _idRetrying(WorkingSet::INVALID_ID),
+      _batchSize(std::max(1, internalQueryFetchBatchSize.load())) {
     _children.emplace_back(child);
 }
 
@@ -70,6 +74,11 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (!_prefetchBuffer.empty() || !_pendingFetches.empty()) {
+        // We have buffered results that haven't been returned yet.
+        return false;
+    }
+
     return child()->isEOF();
 }
 
@@ -78,6 +87,10 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_batchSize > 1) {
+        return workBatched(out);
+    }
+
     // Either retry the last WSM we worked on or get a new one from our child.
     WorkingSetID id;
     StageState status;
@@ -132,6 +145,114 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::workBatched(WorkingSetID* out) {
+    // Drain results that have already been through a batched fetch.
+    if (_batchReady) {
+        WorkingSetID id = _prefetchBuffer.front();
+        _prefetchBuffer.pop_front();
+        if (_prefetchBuffer.empty()) {
+            _batchReady = false;
+        }
+        return returnIfMatches(_ws->get(id), id, out);
+    }
+
+    // Resume a batch of lookups that was interrupted by a WriteConflictException.
+    if (!_pendingFetches.empty()) {
+        return fetchPendingBatch(out);
+    }
+
+    // Fill the buffer from our child.
+    if (!child()->isEOF()) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        StageState status = child()->work(&id);
+
+        if (PlanStage::ADVANCED == status) {
+            WorkingSetMember* member = _ws->get(id);
+            _prefetchBuffer.push_back(id);
+
+            // If there's an obj there, there is no fetching to perform.
+            if (member->hasObj()) {
+                ++_specificStats.alreadyHasObj;
+            } else {
+                // We need a valid RecordId to fetch from and this is the only state that has one.
+                verify(WorkingSetMember::RID_AND_IDX == member->getState());
+                verify(member->hasRecordId());
+                _pendingFetches.push_back(id);
+            }
+
+            if (_prefetchBuffer.size() < _batchSize) {
+                return PlanStage::NEED_TIME;
+            }
+        } else if (PlanStage::FAILURE == status || PlanStage::DEAD == status) {
+            // The stage which produces a failure is responsible for allocating a working set
+            // member with error details.
+            invariant(WorkingSet::INVALID_ID != id);
+            *out = id;
+            return status;
+        } else if (PlanStage::NEED_YIELD == status) {
+            *out = id;
+            return status;
+        } else if (PlanStage::NEED_TIME == status) {
+            return status;
+        } else {
+            invariant(PlanStage::IS_EOF == status);
+            // Fall through and fetch whatever we have buffered.
+        }
+    }
+
+    if (_pendingFetches.empty()) {
+        if (_prefetchBuffer.empty()) {
+            return PlanStage::IS_EOF;
+        }
+        _batchReady = true;
+        return PlanStage::NEED_TIME;
+    }
+
+    // The buffer is full (or the child is exhausted).  Look up the missing documents in
+    // RecordId order so that consecutive cold fetches walk the collection in physical order.
+    std::sort(_pendingFetches.begin(),
+              _pendingFetches.end(),
+              [this](WorkingSetID lhs, WorkingSetID rhs) {
+                  return _ws->get(lhs)->recordId < _ws->get(rhs)->recordId;
+              });
+    return fetchPendingBatch(out);
+}
+
+PlanStage::StageState FetchStage::fetchPendingBatch(WorkingSetID* out) {
+    try {
+        if (!_cursor)
+            _cursor = collection()->getCursor(getOpCtx());
+
+        while (_nextPendingFetch < _pendingFetches.size()) {
+            WorkingSetID id = _pendingFetches[_nextPendingFetch];
+            if (!WorkingSetCommon::fetch(getOpCtx(), _ws, id, _cursor)) {
+                // The record vanished out from under us; drop it from the output buffer too.
+                _ws->free(id);
+                _prefetchBuffer.erase(
+                    std::find(_prefetchBuffer.begin(), _prefetchBuffer.end(), id));
+            }
+            ++_nextPendingFetch;
+        }
+    } catch (const WriteConflictException&) {
+        // Ensure that the BSONObj underlying the WorkingSetMember is owned because it may be
+        // freed when we yield.  We pick up at '_nextPendingFetch' once restored.
+        _ws->get(_pendingFetches[_nextPendingFetch])->makeObjOwnedIfNeeded();
+        *out = WorkingSet::INVALID_ID;
+        return PlanStage::NEED_YIELD;
+    }
+
+    _pendingFetches.clear();
+    _nextPendingFetch = 0;
+
+    if (_prefetchBuffer.empty()) {
+        // Every record in the batch was deleted while we were buffering.
+        return PlanStage::NEED_TIME;
+    }
+
+    _batchReady = true;
+    return PlanStage::NEED_TIME;
+}
+
 void FetchStage::doSaveStateRequiresCollection() {
     if (_cursor) {
         _cursor->saveUnpositioned();
@@ -30,7 +30,9 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/requires_collection_stage.h"
 #include "mongo/db/jsobj.h"
@@ -47,6 +49,11 @@ class SeekableRecordCursor;
  * In WorkingSetMember terms, it transitions from RID_AND_IDX to RID_AND_OBJ by reading
  * the record at the provided RecordId.  Returns verbatim any data that already has an object.
  *
+ * When internalQueryFetchBatchSize is greater than 1, the stage buffers that many results from
+ * its child and performs the outstanding record lookups in RecordId order before emitting them
+ * in child order.  Consecutive cold-cache fetches then walk the collection in physical order
+ * instead of hopping around it in index order.
+ *
  * Preconditions: Valid RecordId.
  */
 class FetchStage : public RequiresCollectionStage {
@@ -87,6 +94,19 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * Performs one unit of work in batched mode: fills '_prefetchBuffer' from the child, runs
+     * the RecordId-ordered lookups once the buffer is full (or the child is exhausted), and then
+     * drains the buffer one result per call.
+     */
+    StageState workBatched(WorkingSetID* out);
+
+    /**
+     * Fetches the members in '_pendingFetches', resuming where the previous attempt left off if
+     * it was interrupted by a WriteConflictException.
+     */
+    StageState fetchPendingBatch(WorkingSetID* out);
+
     // Used to fetch Records from _collection.
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
@@ -99,6 +119,21 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Number of child results buffered per fetch batch; snapshot of internalQueryFetchBatchSize
+    // taken at construction.  A value of 1 preserves the one-document-per-work behavior.
+    const size_t _batchSize;
+
+    // Buffered child results in output order, some of which may still need fetching.
+    std::deque<WorkingSetID> _prefetchBuffer;
+
+    // The subset of '_prefetchBuffer' that needs a record lookup, sorted by RecordId once the
+    // buffer is full.  '_nextPendingFetch' is the resume point after a WriteConflictException.
+    std::vector<WorkingSetID> _pendingFetches;
+    size_t _nextPendingFetch = 0;
+
+    // True once the current batch has been fetched and '_prefetchBuffer' is ready to drain.
+    bool _batchReady = false;
+
     // Stats
     FetchStats _specificStats;
 };
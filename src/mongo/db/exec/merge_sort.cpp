@@ -34,6 +34,7 @@
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/mongoutils/str.h"
 
@@ -54,6 +55,7 @@ MergeSortStage::MergeSortStage(OperationContext* opCtx,
     : PlanStage(kStageType, opCtx),
       _ws(ws),
       _pattern(params.pattern),
+      _ordering(Ordering::make(params.pattern)),
       _collator(params.collator),
       _dedup(params.dedup),
       _merging(StageWithValueComparison(ws, params.pattern, params.collator)) {}
@@ -118,6 +120,11 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
             StageWithValue value;
             value.id = id;
             value.stage = child;
+            // A collator-aware comparison can't be done on serialized keys, so only cache them
+            // for the binary-comparison case.
+            if (!_collator) {
+                value.keyString = makeKeyString(member);
+            }
             // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
             member->makeObjOwnedIfNeeded();
             _mergingData.push_front(value);
@@ -166,10 +173,34 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+std::string MergeSortStage::makeKeyString(WorkingSetMember* member) const {
+    // Pull out the fields of the sort pattern in order; the field names don't participate in
+    // the comparison.
+    BSONObjBuilder keyBob;
+    BSONObjIterator it(_pattern);
+    while (it.more()) {
+        BSONElement patternElt = it.next();
+        BSONElement elt;
+        verify(member->getFieldDotted(patternElt.fieldName(), &elt));
+        keyBob.appendAs(elt, "");
+    }
+
+    // The keys are never persisted, so the KeyString version only needs to be consistent within
+    // this merge.
+    KeyString keyString(KeyString::kLatestVersion, keyBob.done(), _ordering);
+    return std::string(keyString.getBuffer(), keyString.getSize());
+}
+
 // Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
 // the return from the expected value.
 bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
                                                           const MergingRef& rhs) {
+    // When both heads carry a cached serialized key (no collator), the comparison is a single
+    // memcmp in place of per-field extraction and BSONElement comparison.
+    if (!lhs->keyString.empty() && !rhs->keyString.empty()) {
+        return lhs->keyString > rhs->keyString;
+    }
+
     WorkingSetMember* lhsMember = _ws->get(lhs->id);
     WorkingSetMember* rhsMember = _ws->get(rhs->id);
 
@@ -32,6 +32,7 @@
 
 #include <list>
 #include <queue>
+#include <string>
 #include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
@@ -80,6 +81,10 @@ private:
         StageWithValue() : id(WorkingSet::INVALID_ID), stage(NULL) {}
         WorkingSetID id;
         PlanStage* stage;
+        // Serialized sort key of the buffered result, cached so that each comparison during the
+        // merge is a single memcmp rather than extracting and comparing every pattern field.
+        // Only populated when the merge is not collator-aware; empty otherwise.
+        std::string keyString;
     };
 
     // This stage maintains a priority queue of results from each child stage so that it can quickly
@@ -103,12 +108,21 @@ private:
         const CollatorInterface* _collator;
     };
 
+    /**
+     * Returns the serialized sort key of 'member' under '_pattern', whose byte order matches
+     * the merge order. Only valid when there is no collator.
+     */
+    std::string makeKeyString(WorkingSetMember* member) const;
+
     // Not owned by us.
     WorkingSet* _ws;
 
     // The pattern that we're sorting by.
     BSONObj _pattern;
 
+    // The directions of '_pattern', used to serialize the cached sort keys.
+    const Ordering _ordering;
+
     // Null if this merge sort stage orders strings according to simple binary compare. If non-null,
     // represents the collator used to compare strings.
     const CollatorInterface* _collator;
@@ -204,10 +204,15 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     size_t numWorks = getTrialPeriodWorks(getOpCtx(), collection());
     size_t numResults = getTrialPeriodNumToReturn(*_query);
 
-    // Work the plans, stopping when a plan hits EOF or returns some
-    // fixed number of results.
-    for (size_t ix = 0; ix < numWorks; ++ix) {
-        bool moreToDo = workAllPlans(numResults, yieldPolicy);
+    // Work the plans, stopping when a plan hits EOF or returns some fixed number of results.
+    // Each candidate gets a batch of consecutive work cycles per round; this keeps the works
+    // budget split evenly across candidates while amortizing the per-work overhead (yield
+    // checks, switching between candidate plan trees) over the batch.
+    const size_t worksPerRound =
+        static_cast<size_t>(internalQueryPlanEvaluationWorksPerRound.load());
+    for (size_t worksDone = 0; worksDone < numWorks; worksDone += worksPerRound) {
+        bool moreToDo =
+            workAllPlans(numResults, std::min(worksPerRound, numWorks - worksDone), yieldPolicy);
         if (!moreToDo) {
             break;
         }
@@ -332,7 +337,9 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     return Status::OK();
 }
 
-bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy) {
+bool MultiPlanStage::workAllPlans(size_t numResults,
+                                  size_t worksThisRound,
+                                  PlanYieldPolicy* yieldPolicy) {
     bool doneWorking = false;
 
     for (size_t ix = 0; ix < _candidates.size(); ++ix) {
@@ -341,58 +348,64 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
             continue;
         }
 
-        // Might need to yield between calls to work due to the timer elapsing.
+        // Might need to yield between rounds due to the timer elapsing.
         if (!(tryYield(yieldPolicy)).isOK()) {
             return false;
         }
 
-        WorkingSetID id = WorkingSet::INVALID_ID;
-        PlanStage::StageState state = candidate.root->work(&id);
-
-        if (PlanStage::ADVANCED == state) {
-            // Save result for later.
-            WorkingSetMember* member = candidate.ws->get(id);
-            // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we choose to
-            // return the results from the 'candidate' plan.
-            member->makeObjOwnedIfNeeded();
-            candidate.results.push(id);
-
-            // Once a plan returns enough results, stop working.
-            if (candidate.results.size() >= numResults) {
+        for (size_t i = 0; i < worksThisRound; ++i) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = candidate.root->work(&id);
+
+            if (PlanStage::ADVANCED == state) {
+                // Save result for later.
+                WorkingSetMember* member = candidate.ws->get(id);
+                // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we
+                // choose to return the results from the 'candidate' plan.
+                member->makeObjOwnedIfNeeded();
+                candidate.results.push(id);
+
+                // Once a plan returns enough results, stop working. The rest of this round
+                // still runs so that every candidate gets the same share of the works budget.
+                if (candidate.results.size() >= numResults) {
+                    doneWorking = true;
+                    break;
+                }
+            } else if (PlanStage::IS_EOF == state) {
+                // First plan to hit EOF wins automatically.  Stop evaluating other plans.
+                // Assumes that the ranking will pick this plan.
                 doneWorking = true;
-            }
-        } else if (PlanStage::IS_EOF == state) {
-            // First plan to hit EOF wins automatically.  Stop evaluating other plans.
-            // Assumes that the ranking will pick this plan.
-            doneWorking = true;
-        } else if (PlanStage::NEED_YIELD == state) {
-            invariant(id == WorkingSet::INVALID_ID);
-            if (!yieldPolicy->canAutoYield()) {
-                throw WriteConflictException();
-            }
-
-            if (yieldPolicy->canAutoYield()) {
-                yieldPolicy->forceYield();
-            }
-
-            if (!(tryYield(yieldPolicy)).isOK()) {
-                return false;
-            }
-        } else if (PlanStage::NEED_TIME != state) {
-            // FAILURE or DEAD.  Do we want to just tank that plan and try the rest?  We
-            // probably want to fail globally as this shouldn't happen anyway.
-
-            candidate.failed = true;
-            ++_failureCount;
-
-            // Propagate most recent seen failure to parent.
-            if (PlanStage::FAILURE == state) {
-                _statusMemberId = id;
-            }
-
-            if (_failureCount == _candidates.size()) {
-                _failure = true;
-                return false;
+                break;
+            } else if (PlanStage::NEED_YIELD == state) {
+                invariant(id == WorkingSet::INVALID_ID);
+                if (!yieldPolicy->canAutoYield()) {
+                    throw WriteConflictException();
+                }
+
+                if (yieldPolicy->canAutoYield()) {
+                    yieldPolicy->forceYield();
+                }
+
+                if (!(tryYield(yieldPolicy)).isOK()) {
+                    return false;
+                }
+            } else if (PlanStage::NEED_TIME != state) {
+                // FAILURE or DEAD.  Do we want to just tank that plan and try the rest?  We
+                // probably want to fail globally as this shouldn't happen anyway.
+
+                candidate.failed = true;
+                ++_failureCount;
+
+                // Propagate most recent seen failure to parent.
+                if (PlanStage::FAILURE == state) {
+                    _statusMemberId = id;
+                }
+
+                if (_failureCount == _candidates.size()) {
+                    _failure = true;
+                    return false;
+                }
+                break;
             }
         }
     }
@@ -58,6 +58,46 @@ PlanStage::StageState PlanStage::work(WorkingSetID* out) {
     return workResult;
 }
 
+PlanStage::StageState PlanStage::workBatch(size_t maxResults,
+                                           std::vector<WorkingSetID>* results,
+                                           WorkingSetID* out) {
+    invariant(_opCtx);
+    ScopedTimer timer(getClock(), &_commonStats.executionTimeMillis);
+
+    return doWorkBatch(maxResults, results, out);
+}
+
+PlanStage::StageState PlanStage::doWorkBatch(size_t maxResults,
+                                             std::vector<WorkingSetID>* results,
+                                             WorkingSetID* out) {
+    size_t numProduced = 0;
+
+    // NEED_TIME consumes work budget too, so a single call is always bounded by 'maxResults'
+    // units of work regardless of how much filtering happens below us.
+    for (size_t i = 0; i < maxResults; ++i) {
+        ++_commonStats.works;
+
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        StageState workResult = doWork(&id);
+
+        if (StageState::ADVANCED == workResult) {
+            ++_commonStats.advanced;
+            results->push_back(id);
+            ++numProduced;
+        } else if (StageState::NEED_TIME == workResult) {
+            ++_commonStats.needTime;
+        } else {
+            if (StageState::NEED_YIELD == workResult) {
+                ++_commonStats.needYield;
+            }
+            *out = id;
+            return workResult;
+        }
+    }
+
+    return numProduced > 0 ? ADVANCED : NEED_TIME;
+}
+
 void PlanStage::saveState() {
     ++_commonStats.yields;
     for (auto&& child : _children) {
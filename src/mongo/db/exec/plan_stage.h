@@ -189,6 +189,22 @@ public:
      */
     StageState work(WorkingSetID* out);
 
+    /**
+     * Batched form of work(). Performs up to 'maxResults' units of work and appends the id of
+     * each result produced to 'results'. Amortizes the per-call bookkeeping (clock reads, stats
+     * updates) across the batch, which matters for scan-heavy plans that otherwise pay it once
+     * per document per stage.
+     *
+     * Stops as soon as a unit of work yields anything other than ADVANCED or NEED_TIME and
+     * returns that state, with '*out' populated exactly as work() would populate it. Results
+     * produced before the terminating state are still appended to 'results'. If the work budget
+     * is exhausted first, returns ADVANCED if at least one result was produced by this call and
+     * NEED_TIME otherwise. At most 'maxResults' units of work are performed per call, so callers
+     * retain control over yield frequency; consult CommonStats::works to see how much work a
+     * call actually performed.
+     */
+    StageState workBatch(size_t maxResults, std::vector<WorkingSetID>* results, WorkingSetID* out);
+
     /**
      * Returns true if no more work can be done on the query / out of results.
      */
@@ -337,6 +353,18 @@ protected:
      */
     virtual StageState doWork(WorkingSetID* out) = 0;
 
+    /**
+     * Performs up to 'maxResults' units of work.  See comment at workBatch() above.
+     *
+     * The default implementation drives doWork() in a loop and needs no per-stage support.
+     * Stages that can produce results more cheaply in bulk may override this; overriding stages
+     * are responsible for updating CommonStats themselves, mirroring what work() does per unit
+     * of work.
+     */
+    virtual StageState doWorkBatch(size_t maxResults,
+                                   std::vector<WorkingSetID>* results,
+                                   WorkingSetID* out);
+
     /**
      * Saves any stage-specific state required to resume where it was if the underlying data
      * changes.
@@ -96,6 +96,9 @@ ProjectionStage::ProjectionStage(OperationContext* opCtx,
                     // If we are including this key field store its field name.
                     _keyFieldNames.push_back(fieldIt->first);
                     _includeKey.push_back(true);
+                    // Type byte, field name, and its NUL terminator; the per-document part of
+                    // the output size is just the value bytes.
+                    _includedKeyNamesSize += 1 + fieldIt->first.size() + 1;
                 }
             }
         } else {
@@ -150,37 +153,53 @@ Status ProjectionStage::transform(WorkingSetMember* member) {
         return _exec->transform(member);
     }
 
-    BSONObjBuilder bob;
+    BSONObj output;
 
     // SIMPLE_DOC implies that we expect an object so it's kind of redundant.
     if ((ProjectionStageParams::SIMPLE_DOC == _projImpl) || member->hasObj()) {
         // If we got here because of SIMPLE_DOC the planner shouldn't have messed up.
         invariant(member->hasObj());
 
-        // Apply the SIMPLE_DOC projection.
+        // Apply the SIMPLE_DOC projection. The output can't be larger than the input, so
+        // pre-sizing to the input avoids buffer regrowth while building.
+        BSONObjBuilder bob(member->obj.value().objsize());
         transformSimpleInclusion(member->obj.value(), _includedFields, bob);
+        output = bob.obj();
     } else {
         invariant(ProjectionStageParams::COVERED_ONE_INDEX == _projImpl);
         // We're pulling data out of the key.
         invariant(1 == member->keyData.size());
-        size_t keyIndex = 0;
 
-        // Look at every key element...
-        BSONObjIterator keyIterator(member->keyData[0].keyData);
-        while (keyIterator.more()) {
-            BSONElement elt = keyIterator.next();
+        // One pass over the key to find the included elements and the exact output size; the
+        // name bytes were precomputed at construction, so only the value bytes vary per key.
+        _keyElts.clear();
+        int outputSize = 5 + _includedKeyNamesSize;  // Length header plus EOO byte.
+        {
+            BSONObjIterator keyIterator(member->keyData[0].keyData);
+            while (keyIterator.more()) {
+                BSONElement elt = keyIterator.next();
+                if (_includeKey[_keyElts.size()]) {
+                    outputSize += elt.valuesize();
+                }
+                _keyElts.push_back(elt);
+            }
+        }
+
+        // A second pass writes the output with a single exactly-sized buffer allocation.
+        BSONObjBuilder bob(outputSize);
+        for (size_t keyIndex = 0; keyIndex < _keyElts.size(); ++keyIndex) {
             // If we're supposed to include it...
             if (_includeKey[keyIndex]) {
                 // Do so.
-                bob.appendAs(elt, _keyFieldNames[keyIndex]);
+                bob.appendAs(_keyElts[keyIndex], _keyFieldNames[keyIndex]);
             }
-            ++keyIndex;
         }
+        output = bob.obj();
     }
 
     member->keyData.clear();
     member->recordId = RecordId();
-    member->obj = Snapshotted<BSONObj>(SnapshotId(), bob.obj());
+    member->obj = Snapshotted<BSONObj>(SnapshotId(), output);
     member->transitionToOwnedObj();
     return Status::OK();
 }
@@ -218,6 +237,51 @@ PlanStage::StageState ProjectionStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState ProjectionStage::doWorkBatch(size_t maxResults,
+                                                   std::vector<WorkingSetID>* results,
+                                                   WorkingSetID* out) {
+    // Pull a whole batch from our child and project each result in place, so that batched
+    // callers don't pay a work() round trip per document.
+    std::vector<WorkingSetID> childResults;
+    childResults.reserve(maxResults);
+    WorkingSetID childOut = WorkingSet::INVALID_ID;
+    StageState status = child()->workBatch(maxResults, &childResults, &childOut);
+
+    for (size_t i = 0; i < childResults.size(); ++i) {
+        ++_commonStats.works;
+        WorkingSetID id = childResults[i];
+        Status projStatus = transform(_ws->get(id));
+        if (!projStatus.isOK()) {
+            warning() << "Couldn't execute projection, status = " << redact(projStatus);
+            // Free the results we won't hand out before reporting the failure.
+            _ws->free(id);
+            for (size_t j = i + 1; j < childResults.size(); ++j) {
+                _ws->free(childResults[j]);
+            }
+            *out = WorkingSetCommon::allocateStatusMember(_ws, projStatus);
+            return PlanStage::FAILURE;
+        }
+        results->push_back(id);
+        ++_commonStats.advanced;
+    }
+
+    if (PlanStage::FAILURE == status || PlanStage::DEAD == status) {
+        // The stage which produces a failure is responsible for allocating a working set member
+        // with error details.
+        invariant(WorkingSet::INVALID_ID != childOut);
+        *out = childOut;
+    } else if (PlanStage::NEED_YIELD == status) {
+        ++_commonStats.works;
+        ++_commonStats.needYield;
+        *out = childOut;
+    } else if (PlanStage::NEED_TIME == status) {
+        ++_commonStats.works;
+        ++_commonStats.needTime;
+    }
+
+    return status;
+}
+
 unique_ptr<PlanStageStats> ProjectionStage::getStats() {
     _commonStats.isEOF = isEOF();
     unique_ptr<PlanStageStats> ret = make_unique<PlanStageStats>(_commonStats, STAGE_PROJECTION);
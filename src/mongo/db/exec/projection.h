@@ -84,6 +84,9 @@ public:
 
     bool isEOF() final;
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
 
     StageType stageType() const final {
         return STAGE_PROJECTION;
@@ -146,6 +149,13 @@ private:
 
     // If the i-th entry of _includeKey is true this is the field name for the i-th key field.
     std::vector<StringData> _keyFieldNames;
+
+    // Total bytes of type tags and field names (with NUL terminators) of the included key
+    // fields, so the exact output size of a covered projection only needs the value bytes.
+    int _includedKeyNamesSize = 0;
+
+    // Reusable scratch space for the elements of the key being projected.
+    std::vector<BSONElement> _keyElts;
 };
 
 }  // namespace mongo
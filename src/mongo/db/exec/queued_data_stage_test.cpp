@@ -125,4 +125,61 @@ TEST_F(QueuedDataStageTest, validateStats) {
     unique_ptr<PlanStageStats> allStats(mock->getStats());
     ASSERT_TRUE(stats->isEOF);
 }
+
+//
+// Test the default workBatch() shim: it drains multiple results per call, consumes NEED_TIME
+// internally, surfaces terminating states, and keeps CommonStats consistent with work().
+//
+TEST_F(QueuedDataStageTest, workBatchCollectsResultsAndStats) {
+    WorkingSet ws;
+    auto mock = make_unique<QueuedDataStage>(getOpCtx(), &ws);
+
+    mock->pushBack(PlanStage::NEED_TIME);
+    WorkingSetID firstId = ws.allocate();
+    mock->pushBack(firstId);
+    WorkingSetID secondId = ws.allocate();
+    mock->pushBack(secondId);
+
+    // The queue holds fewer than 'maxResults' units of work, so the batch ends on IS_EOF with
+    // both results collected and the NEED_TIME absorbed.
+    std::vector<WorkingSetID> results;
+    WorkingSetID out = WorkingSet::INVALID_ID;
+    ASSERT_EQUALS(PlanStage::IS_EOF, mock->workBatch(8, &results, &out));
+    ASSERT_EQUALS(results.size(), 2U);
+    ASSERT_EQUALS(results[0], firstId);
+    ASSERT_EQUALS(results[1], secondId);
+
+    const CommonStats* stats = mock->getCommonStats();
+    ASSERT_EQUALS(stats->works, 4U);
+    ASSERT_EQUALS(stats->advanced, 2U);
+    ASSERT_EQUALS(stats->needTime, 1U);
+}
+
+//
+// Test that workBatch() stops once the work budget is consumed.
+//
+TEST_F(QueuedDataStageTest, workBatchHonorsWorkBudget) {
+    WorkingSet ws;
+    auto mock = make_unique<QueuedDataStage>(getOpCtx(), &ws);
+
+    for (int i = 0; i < 4; ++i) {
+        mock->pushBack(ws.allocate());
+    }
+
+    std::vector<WorkingSetID> results;
+    WorkingSetID out = WorkingSet::INVALID_ID;
+    ASSERT_EQUALS(PlanStage::ADVANCED, mock->workBatch(3, &results, &out));
+    ASSERT_EQUALS(results.size(), 3U);
+    ASSERT_EQUALS(mock->getCommonStats()->works, 3U);
+
+    // Drain the remaining result, then check that a budget spent entirely on NEED_TIME reports
+    // NEED_TIME.
+    results.clear();
+    mock->pushBack(PlanStage::NEED_TIME);
+    ASSERT_EQUALS(PlanStage::ADVANCED, mock->workBatch(1, &results, &out));
+    ASSERT_EQUALS(results.size(), 1U);
+    results.clear();
+    ASSERT_EQUALS(PlanStage::NEED_TIME, mock->workBatch(1, &results, &out));
+    ASSERT_EQUALS(results.size(), 0U);
+}
 }
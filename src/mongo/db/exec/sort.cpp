@@ -43,6 +43,7 @@
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/query_knobs.h"
 #include "mongo/db/query/query_planner.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/log.h"
 
@@ -78,19 +79,13 @@ SortStage::SortStage(OperationContext* opCtx,
       _pattern(params.pattern),
       _limit(params.limit),
       _sorted(false),
+      _keyStringOrdering(Ordering::make(FindCommon::transformSortSpec(params.pattern))),
       _resultIterator(_data.end()),
       _memUsage(0) {
     _children.emplace_back(child);
 
     BSONObj sortComparator = FindCommon::transformSortSpec(_pattern);
     _sortKeyComparator = stdx::make_unique<WorkingSetComparator>(sortComparator);
-
-    // If limit > 1, we need to initialize _dataSet here to maintain ordered set of data items while
-    // fetching from the child stage.
-    if (_limit > 1) {
-        const WorkingSetComparator& cmp = *_sortKeyComparator;
-        _dataSet.reset(new SortableDataItemSet(cmp));
-    }
 }
 
 SortStage::~SortStage() {}
@@ -206,10 +201,11 @@ const SpecificStats* SortStage::getSpecificStats() const {
  *                     Updates memory usage if item was replaced.
  *     sortBuffer() - Does nothing.
  * limit > 1:
- *     addToBuffer() - Does not update vector. Adds item to set.
- *                     If size of set exceeds limit, remove item from set
- *                     with lowest key. Updates memory usage accordingly.
- *     sortBuffer() - Copies items from set to vectors.
+ *     addToBuffer() - Does not update vector. Adds item to the top-k heap.
+ *                     If the heap is full, replaces the item with the worst
+ *                     key if the new item sorts before it. Updates memory
+ *                     usage accordingly.
+ *     sortBuffer() - Sorts the heap contents into the vector.
  */
 void SortStage::addToBuffer(const SortableDataItem& item) {
     // Holds ID of working set member to be freed at end of this function.
@@ -238,33 +234,37 @@ void SortStage::addToBuffer(const SortableDataItem& item) {
             _memUsage = member->getMemUsage();
         }
     } else {
-        // Update data item set instead of vector
+        // Update the top-k heap instead of the vector. The heap is ordered on a serialization
+        // of (sortKey, recordId) whose byte order matches the sort order, so maintaining it
+        // costs one memcmp per comparison rather than a BSONObj::woCompare(). The worst
+        // retained item sits at the front of the heap.
+        const auto sortsAfter = [](const SortableDataItem& lhs, const SortableDataItem& rhs) {
+            return lhs.keyString < rhs.keyString;
+        };
+
+        SortableDataItem heapItem(item);
+        heapItem.keyString = makeKeyString(item);
+
         // Limit not reached - insert and return
-        vector<SortableDataItem>::size_type limit(_limit);
-        if (_dataSet->size() < limit) {
+        if (_topK.size() < _limit) {
             member->makeObjOwnedIfNeeded();
-            _dataSet->insert(item);
             _memUsage += member->getMemUsage();
+            _topK.push_back(std::move(heapItem));
+            std::push_heap(_topK.begin(), _topK.end(), sortsAfter);
             return;
         }
-        // Limit will be exceeded - compare with item with lowest key
-        // If new item does not have a lower key value than last item,
+        // Limit will be exceeded - compare with the worst retained item.
+        // If new item does not have a lower key value than the worst item,
         // do nothing.
         wsidToFree = item.wsid;
-        SortableDataItemSet::const_iterator lastItemIt = --(_dataSet->end());
-        const SortableDataItem& lastItem = *lastItemIt;
-        const WorkingSetComparator& cmp = *_sortKeyComparator;
-        if (cmp(item, lastItem)) {
-            _memUsage -= _ws->get(lastItem.wsid)->getMemUsage();
+        if (heapItem.keyString < _topK.front().keyString) {
+            _memUsage -= _ws->get(_topK.front().wsid)->getMemUsage();
             _memUsage += member->getMemUsage();
-            wsidToFree = lastItem.wsid;
-            // According to std::set iterator validity rules,
-            // it does not matter which of erase()/insert() happens first.
-            // Here, we choose to erase first to release potential resources
-            // used by the last item and to keep the scope of the iterator to a minimum.
-            _dataSet->erase(lastItemIt);
+            wsidToFree = _topK.front().wsid;
+            std::pop_heap(_topK.begin(), _topK.end(), sortsAfter);
             member->makeObjOwnedIfNeeded();
-            _dataSet->insert(item);
+            _topK.back() = std::move(heapItem);
+            std::push_heap(_topK.begin(), _topK.end(), sortsAfter);
         }
     }
 
@@ -284,13 +284,25 @@ void SortStage::sortBuffer() {
         // Buffer contains either 0 or 1 item so it is already in a sorted state.
         return;
     } else {
-        // Set already contains items in sorted order, so we simply copy the items
-        // from the set to the vector.
-        // Release the memory for the set after the copy.
-        vector<SortableDataItem> newData(_dataSet->begin(), _dataSet->end());
-        _data.swap(newData);
-        _dataSet.reset();
+        // Sort the heap contents and hand the buffer over to the vector. sort_heap produces
+        // ascending order under the same comparator that maintained the heap.
+        std::sort_heap(_topK.begin(),
+                       _topK.end(),
+                       [](const SortableDataItem& lhs, const SortableDataItem& rhs) {
+                           return lhs.keyString < rhs.keyString;
+                       });
+        _data.swap(_topK);
+        _topK.clear();
+        _topK.shrink_to_fit();
     }
 }
 
+std::string SortStage::makeKeyString(const SortableDataItem& item) const {
+    // The keys are never persisted, so the KeyString version only needs to be consistent within
+    // this sort. Appending the RecordId reproduces the comparator's tie-breaking.
+    KeyString keyString(
+        KeyString::kLatestVersion, item.sortKey, _keyStringOrdering, item.recordId);
+    return std::string(keyString.getBuffer(), keyString.getSize());
+}
+
 }  // namespace mongo
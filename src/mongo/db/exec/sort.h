@@ -30,7 +30,7 @@
 
 #pragma once
 
-#include <set>
+#include <string>
 #include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
@@ -116,6 +116,9 @@ private:
         // RecordId to break sortKey ties.
         // See sorta.js.
         RecordId recordId;
+        // Serialization of (sortKey, recordId) whose byte order matches the sort order, so the
+        // top-k path (1 < _limit) can compare items with a single memcmp. Empty otherwise.
+        std::string keyString;
     };
 
     // Comparison object for data buffers (vector and set). Items are compared on (sortKey, loc).
@@ -146,20 +149,29 @@ private:
      */
     void sortBuffer();
 
+    /**
+     * Returns the memcmp-able serialization of 'item's (sortKey, recordId), ordered the same
+     * way as WorkingSetComparator orders items.
+     */
+    std::string makeKeyString(const SortableDataItem& item) const;
+
     // Comparator for data buffer
     // Initialization follows sort key generator
     std::unique_ptr<WorkingSetComparator> _sortKeyComparator;
 
+    // The directions of the sort pattern, used to serialize sort keys for the top-k path.
+    const Ordering _keyStringOrdering;
+
     // The data we buffer and sort.
     // _data will contain sorted data when all data is gathered
     // and sorted.
     // When _limit is greater than 1 and not all data has been gathered from child stage,
-    // _dataSet is used instead to maintain an ordered set of the incomplete data set.
-    // When the data set is complete, we copy the items from _dataSet to _data which will
-    // be used to provide the results of this stage through _resultIterator.
+    // '_topK' holds the best _limit results seen so far as a binary heap on
+    // SortableDataItem::keyString, with the worst retained result at the front. When the data
+    // set is complete, the heap is sorted and moved into _data, which provides the results of
+    // this stage through _resultIterator.
     std::vector<SortableDataItem> _data;
-    typedef std::set<SortableDataItem, WorkingSetComparator> SortableDataItemSet;
-    std::unique_ptr<SortableDataItemSet> _dataSet;
+    std::vector<SortableDataItem> _topK;
 
     // Iterates through _data post-sort returning it.
     std::vector<SortableDataItem>::iterator _resultIterator;
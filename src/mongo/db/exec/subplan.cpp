@@ -47,6 +47,8 @@
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/query/stage_builder.h"
 #include "mongo/stdx/memory.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/transitional_tools_do_not_use/vector_spooling.h"
@@ -107,6 +109,12 @@ bool SubplanStage::canUseSubplanning(const CanonicalQuery& query) {
 
 Status SubplanStage::planSubqueries() {
     _orExpression = _query->root()->shallowClone();
+
+    // Branch shapes planned from scratch so far. A branch whose shape matches an earlier
+    // branch is not planned again; choosePlanForSubqueries() reuses the earlier branch's
+    // winning index assignments.
+    stdx::unordered_set<PlanCacheKey, PlanCacheKeyHasher> plannedBranchShapes;
+
     for (size_t i = 0; i < _plannerParams.indices.size(); ++i) {
         const IndexEntry& ie = _plannerParams.indices[i];
         const auto insertionRes = _indexMap.insert(std::make_pair(ie.identifier, i));
@@ -140,6 +148,7 @@ Status SubplanStage::planSubqueries() {
         // Populate branchResult->cachedSolution if an active cachedSolution entry exists.
         if (planCache->shouldCacheQuery(*branchResult->canonicalQuery)) {
             auto planCacheKey = planCache->computeKey(*branchResult->canonicalQuery);
+            branchResult->cacheKey = planCacheKey;
             if (auto cachedSol = planCache->getCacheEntryIfActive(planCacheKey)) {
                 // We have a CachedSolution. Store it for later.
                 LOG(5) << "Subplanner: cached plan found for child " << i << " of "
@@ -150,6 +159,14 @@ Status SubplanStage::planSubqueries() {
         }
 
         if (!branchResult->cachedSolution) {
+            if (branchResult->cacheKey &&
+                !plannedBranchShapes.insert(*branchResult->cacheKey).second) {
+                // An earlier branch of this query has the same shape. Skip planning; the
+                // earlier branch's winning index assignments will be reused for this one.
+                LOG(5) << "Subplanner: child " << i << " shares its shape with an earlier child";
+                continue;
+            }
+
             // No CachedSolution found. We'll have to plan from scratch.
             LOG(5) << "Subplanner: planning child " << i << " of " << _orExpression->numChildren();
 
@@ -186,7 +203,7 @@ namespace {
  * plan for 'orChild') to 'compositeCacheData'.
  */
 Status tagOrChildAccordingToCache(PlanCacheIndexTree* compositeCacheData,
-                                  SolutionCacheData* branchCacheData,
+                                  const SolutionCacheData* branchCacheData,
                                   MatchExpression* orChild,
                                   const std::map<IndexEntry::Identifier, size_t>& indexMap) {
     invariant(compositeCacheData);
@@ -227,14 +244,39 @@ Status SubplanStage::choosePlanForSubqueries(PlanYieldPolicy* yieldPolicy) {
     // This is the skeleton of index selections that is inserted into the cache.
     std::unique_ptr<PlanCacheIndexTree> cacheData(new PlanCacheIndexTree());
 
+    // The winning index tag tree for each branch shape handled so far. Duplicate branch shapes
+    // are tagged from here instead of being planned and ranked a second time. The mapped
+    // pointers are into 'cacheData', which owns the trees until the cache entry is written.
+    stdx::unordered_map<PlanCacheKey, const PlanCacheIndexTree*, PlanCacheKeyHasher>
+        chosenTreeForShape;
+
     for (size_t i = 0; i < _orExpression->numChildren(); ++i) {
         MatchExpression* orChild = _orExpression->getChild(i);
         BranchPlanningResult* branchResult = _branchResults[i].get();
 
+        if (branchResult->cacheKey) {
+            auto it = chosenTreeForShape.find(*branchResult->cacheKey);
+            if (it != chosenTreeForShape.end()) {
+                Status tagStatus =
+                    QueryPlanner::tagAccordingToCache(orChild, it->second, _indexMap);
+                if (!tagStatus.isOK()) {
+                    mongoutils::str::stream ss;
+                    ss << "Failed to extract indices from subchild " << orChild->toString();
+                    return Status(ErrorCodes::BadValue, ss);
+                }
+
+                cacheData->children.push_back(it->second->clone());
+                continue;
+            }
+        }
+
         if (branchResult->cachedSolution.get()) {
             // We can get the index tags we need out of the cache.
             Status tagStatus = tagOrChildAccordingToCache(
-                cacheData.get(), branchResult->cachedSolution->plannerData[0], orChild, _indexMap);
+                cacheData.get(),
+                branchResult->cachedSolution->plannerData[0].get(),
+                orChild,
+                _indexMap);
             if (!tagStatus.isOK()) {
                 return tagStatus;
             }
@@ -324,6 +366,11 @@ Status SubplanStage::choosePlanForSubqueries(PlanYieldPolicy* yieldPolicy) {
 
             cacheData->children.push_back(bestSoln->cacheData->tree->clone());
         }
+
+        // Remember the winning tag tree so later branches with the same shape can reuse it.
+        if (branchResult->cacheKey) {
+            chosenTreeForShape.emplace(*branchResult->cacheKey, cacheData->children.back());
+        }
     }
 
     // Must do this before using the planner functionality.
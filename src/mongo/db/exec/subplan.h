@@ -34,6 +34,8 @@
 #include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "mongo/base/owned_pointer_vector.h"
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
@@ -152,6 +154,11 @@ private:
         // composite solution.
         std::unique_ptr<CachedSolution> cachedSolution;
 
+        // The plan cache key for this branch's shape, if the branch is eligible for the plan
+        // cache. Branches that share a key within a single query are planned once; the winning
+        // index assignments are reused for the duplicates.
+        boost::optional<PlanCacheKey> cacheKey;
+
         // Query solutions resulting from planning the $or branch.
         std::vector<std::unique_ptr<QuerySolution>> solutions;
     };
@@ -229,10 +229,21 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
         }
         immutablePaths.keepShortest(&idFieldRef);
     }
+    // Tracks the paths modified by the update so that disjoint indexes can skip key generation.
+    // Replacement updates do not report modified paths, so the set stays unused for them.
+    FieldRefSetWithStorage modifiedPaths;
+    FieldRefSetWithStorage* trackModifiedPaths =
+        driver->isDocReplacement() ? nullptr : &modifiedPaths;
+
     if (!driver->needMatchDetails()) {
         // If we don't need match details, avoid doing the rematch
-        status = driver->update(
-            StringData(), &_doc, validateForStorage, immutablePaths, &logObj, &docWasModified);
+        status = driver->update(StringData(),
+                                &_doc,
+                                validateForStorage,
+                                immutablePaths,
+                                &logObj,
+                                &docWasModified,
+                                trackModifiedPaths);
     } else {
         // If there was a matched field, obtain it.
         MatchDetails matchDetails;
@@ -245,8 +256,13 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
         if (matchDetails.hasElemMatchKey())
             matchedField = matchDetails.elemMatchKey();
 
-        status = driver->update(
-            matchedField, &_doc, validateForStorage, immutablePaths, &logObj, &docWasModified);
+        status = driver->update(matchedField,
+                                &_doc,
+                                validateForStorage,
+                                immutablePaths,
+                                &logObj,
+                                &docWasModified,
+                                trackModifiedPaths);
     }
 
     if (!status.isOK()) {
@@ -300,6 +316,7 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
                     !request->isMulti() || args.criteria.hasField("_id"_sd));
             args.fromMigrate = request->isFromMigration();
             args.storeDocOption = getStoreDocMode(*request);
+            args.modifiedPaths = trackModifiedPaths;
             if (args.storeDocOption == CollectionUpdateArgs::StoreDocOption::PreImage) {
                 args.preImageDoc = oldObj.value().getOwned();
             }
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
@@ -122,14 +123,23 @@ private:
         // Free list link if freed. Points to self if in use.
         WorkingSetID nextFreeOrSelf;
 
-        // Owning pointer
+        // Points into one of the slabs in '_slabs', which owns the member.
         WorkingSetMember* member;
     };
 
+    // Number of members allocated per slab. Members are carved out of slabs rather than
+    // allocated individually so that growing the working set performs one heap allocation per
+    // slab instead of one per member.
+    static constexpr size_t kMembersPerSlab = 16;
+
     // All WorkingSetIDs are indexes into this, except for INVALID_ID.
     // Elements are added to _freeList rather than removed when freed.
     std::vector<MemberHolder> _data;
 
+    // Slabs of members. Slabs are never moved or freed until clear() or destruction, so member
+    // pointers handed out by get() stay valid as '_data' grows.
+    std::vector<std::unique_ptr<WorkingSetMember[]>> _slabs;
+
     // Index into _data, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
     // link. INVALID_ID is the list terminator since 0 is a valid index.
     // If _freeList == INVALID_ID, the free list is empty and all elements in _data are in use.
@@ -156,4 +156,30 @@ TEST_F(WorkingSetFixture, getDottedFieldFromIndex) {
     ASSERT_FALSE(member->getFieldDotted("y", &elt));
 }
 
+TEST_F(WorkingSetFixture, MemberPointersStableAcrossGrowth) {
+    // Members are carved out of slabs; handing out new ids must not move existing members.
+    std::vector<WorkingSetID> ids;
+    std::vector<WorkingSetMember*> members;
+    for (int i = 0; i < 100; i++) {
+        WorkingSetID allocatedId = ws->allocate();
+        ids.push_back(allocatedId);
+        members.push_back(ws->get(allocatedId));
+    }
+    ASSERT_EQUALS(ws->get(id), member);
+    for (size_t i = 0; i < ids.size(); i++) {
+        ASSERT_EQUALS(ws->get(ids[i]), members[i]);
+    }
+}
+
+TEST_F(WorkingSetFixture, FreedMembersAreRecycled) {
+    WorkingSetID first = ws->allocate();
+    ws->free(first);
+    ASSERT_TRUE(ws->isFree(first));
+
+    // The freed id is handed out again rather than growing the working set.
+    WorkingSetID second = ws->allocate();
+    ASSERT_EQUALS(first, second);
+    ASSERT_FALSE(ws->isFree(second));
+}
+
 }  // namespace
@@ -156,6 +156,14 @@ public:
         return _fieldRefSet.empty();
     }
 
+    FieldRefSet::const_iterator begin() const {
+        return _fieldRefSet.begin();
+    }
+
+    FieldRefSet::const_iterator end() const {
+        return _fieldRefSet.end();
+    }
+
     void clear() {
         _ownedFieldRefs.clear();
         _fieldRefSet.clear();
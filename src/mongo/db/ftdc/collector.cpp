@@ -32,6 +32,8 @@
 
 #include "mongo/db/ftdc/collector.h"
 
+#include <algorithm>
+
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -40,13 +42,15 @@
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/stdx/memory.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
 void FTDCCollectorCollection::add(std::unique_ptr<FTDCCollectorInterface> collector) {
     // TODO: ensure the collectors all have unique names.
-    _collectors.emplace_back(std::move(collector));
+    _collectors.emplace_back(stdx::make_unique<CollectorState>(std::move(collector)));
 }
 
 std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
@@ -56,7 +60,9 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
         return std::tuple<BSONObj, Date_t>(BSONObj(), Date_t());
     }
 
-    BSONObjBuilder builder;
+    // Pre-size the buffer to the largest sample seen so far; samples share one schema, so this
+    // avoids regrowing and copying the buffer every collection period.
+    BSONObjBuilder builder(_sampleBufferSize);
 
     Date_t start = client->getServiceContext()->getPreciseClockSource()->now();
     Date_t end;
@@ -74,7 +80,8 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
     // Explicitly start future read transactions without a timestamp.
     opCtx->recoveryUnit()->setTimestampReadSource(RecoveryUnit::ReadSource::kNoTimestamp);
 
-    for (auto& collector : _collectors) {
+    for (auto& state : _collectors) {
+        auto& collector = state->collector;
         BSONObjBuilder subObjBuilder(builder.subobjStart(collector->name()));
 
         // Add a Date_t before and after each BSON is collected so that we can track timing of the
@@ -89,7 +96,30 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
 
         subObjBuilder.appendDate(kFTDCCollectStartField, now);
 
-        collector->collect(opCtx.get(), subObjBuilder);
+        // If the collector declares a change epoch and it has not moved since the previous
+        // sample, reuse the previously collected section instead of re-serializing it.
+        const auto epoch = collector->changeEpoch();
+        if (epoch != FTDCCollectorInterface::kAlwaysCollect && epoch == state->epoch &&
+            !state->cachedData.isEmpty()) {
+            subObjBuilder.appendElements(state->cachedData);
+        } else {
+            Timer timer;
+
+            if (epoch != FTDCCollectorInterface::kAlwaysCollect) {
+                // Collect into a separate object so the section can be reused as long as the
+                // epoch holds.
+                BSONObjBuilder dataBuilder;
+                collector->collect(opCtx.get(), dataBuilder);
+                state->cachedData = dataBuilder.obj();
+                state->epoch = epoch;
+                subObjBuilder.appendElements(state->cachedData);
+            } else {
+                collector->collect(opCtx.get(), subObjBuilder);
+            }
+
+            state->collectCount.addAndFetch(1);
+            state->totalCollectMicros.addAndFetch(timer.micros());
+        }
 
         end = client->getServiceContext()->getPreciseClockSource()->now();
         subObjBuilder.appendDate(kFTDCCollectEndField, end);
@@ -97,7 +127,18 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
 
     builder.appendDate(kFTDCCollectEndField, end);
 
-    return std::tuple<BSONObj, Date_t>(builder.obj(), start);
+    auto sample = builder.obj();
+    _sampleBufferSize = std::max(_sampleBufferSize, sample.objsize());
+
+    return std::tuple<BSONObj, Date_t>(std::move(sample), start);
+}
+
+void FTDCCollectorCollection::appendCollectionStats(BSONObjBuilder* builder) const {
+    for (auto& state : _collectors) {
+        BSONObjBuilder subObjBuilder(builder->subobjStart(state->collector->name()));
+        subObjBuilder.appendNumber("count", state->collectCount.load());
+        subObjBuilder.appendNumber("totalTimeMicros", state->totalCollectMicros.load());
+    }
 }
 
 }  // namespace mongo
@@ -30,15 +30,17 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <tuple>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 
-class BSONObj;
 class BSONObjBuilder;
 class Date_t;
 class Client;
@@ -70,6 +72,21 @@ public:
      */
     virtual void collect(OperationContext* opCtx, BSONObjBuilder& builder) = 0;
 
+    /**
+     * Returns a number that changes whenever the output of collect() would change.
+     *
+     * Collectors whose output is expensive to produce but changes rarely can override this to
+     * return an epoch they bump on change. When the epoch matches the one observed at the
+     * previous sample, the previously collected section is reused without calling collect().
+     * The default of kAlwaysCollect disables reuse; the FTDC format already delta-encodes
+     * repeated values, so a reused section compresses to nearly nothing.
+     */
+    static const std::uint64_t kAlwaysCollect = 0;
+
+    virtual std::uint64_t changeEpoch() {
+        return kAlwaysCollect;
+    }
+
 protected:
     FTDCCollectorInterface() = default;
 };
@@ -109,9 +126,33 @@ public:
      */
     std::tuple<BSONObj, Date_t> collect(Client* client);
 
+    /**
+     * Append cumulative per-collector collection counts and time so that expensive sections can
+     * be identified. Safe to call from any thread once collection has started: the collector set
+     * is fixed after the first collect() and the counters are atomic.
+     */
+    void appendCollectionStats(BSONObjBuilder* builder) const;
+
 private:
+    // A collector and its per-collector collection state: the change epoch and section data of
+    // the previous sample for reuse, and cumulative cost counters for appendCollectionStats.
+    struct CollectorState {
+        explicit CollectorState(std::unique_ptr<FTDCCollectorInterface> c)
+            : collector(std::move(c)) {}
+
+        std::unique_ptr<FTDCCollectorInterface> collector;
+        std::uint64_t epoch = FTDCCollectorInterface::kAlwaysCollect;
+        BSONObj cachedData;
+        AtomicInt64 collectCount{0};
+        AtomicInt64 totalCollectMicros{0};
+    };
+
     // collection of collectors
-    std::vector<std::unique_ptr<FTDCCollectorInterface>> _collectors;
+    std::vector<std::unique_ptr<CollectorState>> _collectors;
+
+    // Size in bytes of the largest sample built so far; used to pre-size the next sample's
+    // buffer so that building it does not repeatedly grow and copy the buffer.
+    int _sampleBufferSize = 512;
 };
 
 }  // namespace mongo
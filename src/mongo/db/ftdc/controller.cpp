@@ -136,6 +136,12 @@ BSONObj FTDCController::getMostRecentPeriodicDocument() {
     }
 }
 
+void FTDCController::appendPeriodicCollectionStats(BSONObjBuilder* builder) const {
+    // The collector set is fixed once the controller starts and the cost counters are atomic,
+    // so no lock is needed here.
+    _periodicCollectors.appendCollectionStats(builder);
+}
+
 void FTDCController::start() {
     log() << "Initializing full-time diagnostic data capture with directory '"
           << _path.generic_string() << "'";
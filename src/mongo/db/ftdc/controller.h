@@ -143,6 +143,11 @@ public:
      */
     BSONObj getMostRecentPeriodicDocument();
 
+    /**
+     * Append cumulative per-collector collection cost statistics for the periodic collectors.
+     */
+    void appendPeriodicCollectionStats(BSONObjBuilder* builder) const;
+
 private:
     /**
      * Do periodic statistics collection, and all other work on the background thread.
@@ -39,6 +39,7 @@
 #include "mongo/base/status.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/ftdc/collector.h"
 #include "mongo/db/ftdc/config.h"
 #include "mongo/db/ftdc/controller.h"
@@ -243,6 +244,32 @@ public:
     }
 
 } exportedFTDCInterimChunkSizeParameter;
+
+/**
+ * Reports cumulative per-collector collection counts and time so that expensive periodic
+ * collectors can be identified from serverStatus and, over time, from the captured data itself.
+ */
+class DiagnosticDataCollectionServerStatusSection : public ServerStatusSection {
+public:
+    DiagnosticDataCollectionServerStatusSection()
+        : ServerStatusSection("diagnosticDataCollection") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        auto controller = FTDCController::get(opCtx->getServiceContext());
+        if (!controller) {
+            return BSONObj();
+        }
+
+        BSONObjBuilder builder;
+        controller->appendPeriodicCollectionStats(&builder);
+        return builder.obj();
+    }
+} diagnosticDataCollectionServerStatusSection;
 }  // namespace
 
 FTDCSimpleInternalCommandCollector::FTDCSimpleInternalCommandCollector(StringData command,
@@ -51,7 +51,9 @@ extern const double MAX_WEIGHT;
 extern const double MAX_WORD_WEIGHT;
 extern const double DEFAULT_WEIGHT;
 
-typedef std::map<std::string, double> Weights;  // TODO cool map
+// Ordered so that prefix scans over dotted paths work (see FTSElementIterator); the
+// transparent comparator lets lookups take StringData without building a std::string key.
+typedef std::map<std::string, double, std::less<>> Weights;
 typedef stdx::unordered_map<std::string, double> TermFrequencyMap;
 
 struct ScoreHelperStruct {
@@ -124,7 +124,7 @@ void FTSSpec::_scoreStringV1(const Tools& tools,
 }
 
 bool FTSSpec::_weightV1(StringData field, double* out) const {
-    Weights::const_iterator i = _weights.find(field.toString());
+    Weights::const_iterator i = _weights.find(field);
     if (i == _weights.end())
         return false;
     *out = i->second;
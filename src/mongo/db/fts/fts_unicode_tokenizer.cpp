@@ -53,6 +53,7 @@ UnicodeFTSTokenizer::UnicodeFTSTokenizer(const FTSLanguage* language)
       _delimListLanguage(_language->str() == "english"
                              ? unicode::DelimiterListLanguage::kEnglish
                              : unicode::DelimiterListLanguage::kNotEnglish),
+      _asciiDelimiters(unicode::asciiDelimiterTable(_delimListLanguage)),
       _caseFoldMode(_language->str() == "turkish" ? unicode::CaseFoldMode::kTurkish
                                                   : unicode::CaseFoldMode::kNormal) {}
 
@@ -74,8 +75,7 @@ bool UnicodeFTSTokenizer::moveNext() {
 
         // Traverse through non-delimiters and build the next token.
         size_t start = _pos++;
-        while (_pos < _document.size() &&
-               (!unicode::codepointIsDelimiter(_document[_pos], _delimListLanguage))) {
+        while (_pos < _document.size() && !_isDelimiter(_document[_pos])) {
             ++_pos;
         }
         const size_t len = _pos - start;
@@ -113,8 +113,7 @@ StringData UnicodeFTSTokenizer::get() const {
 }
 
 void UnicodeFTSTokenizer::_skipDelimiters() {
-    while (_pos < _document.size() &&
-           unicode::codepointIsDelimiter(_document[_pos], _delimListLanguage)) {
+    while (_pos < _document.size() && _isDelimiter(_document[_pos])) {
         ++_pos;
     }
 }
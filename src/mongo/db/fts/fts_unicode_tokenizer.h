@@ -75,10 +75,22 @@ private:
      */
     void _skipDelimiters();
 
+    /**
+     * Returns whether 'codepoint' is a delimiter, indexing the ASCII delimiter table directly for
+     * the common case.
+     */
+    bool _isDelimiter(char32_t codepoint) const {
+        if (codepoint <= 0x7f) {
+            return _asciiDelimiters[codepoint];
+        }
+        return unicode::codepointIsDelimiter(codepoint, _delimListLanguage);
+    }
+
     const FTSLanguage* const _language;
     const Stemmer _stemmer;
     const StopWords* const _stopWords;
     const unicode::DelimiterListLanguage _delimListLanguage;
+    const bool* const _asciiDelimiters;
     const unicode::CaseFoldMode _caseFoldMode;
 
     unicode::String _document;
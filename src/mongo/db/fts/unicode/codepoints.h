@@ -69,6 +69,14 @@ bool codepointIsDiacritic(char32_t codepoint);
  */
 bool codepointIsDelimiter(char32_t codepoint, DelimiterListLanguage lang);
 
+/**
+ * Returns a 128-entry table mapping each ASCII codepoint to whether it is considered a delimiter in
+ * the language 'lang'. Callers classifying codepoints in a tight loop can index the table directly
+ * for the ASCII range (avoiding a function call per codepoint), falling back to
+ * codepointIsDelimiter() for the rest.
+ */
+const bool* asciiDelimiterTable(DelimiterListLanguage lang);
+
 /**
  * Return a version of the given codepoint without any diacritics. These mappings are generated by
  * taking all of the characters within a set of Unicode code blocks (see gen_diacritic_map.py to see
@@ -71,7 +71,14 @@ def generate(unicode_proplist_file, target):
         out.write("    %d, // 0x%x\n" % (cp in delim_codepoints, cp))
     out.write("};\n")
 
-    out.write("""bool codepointIsDelimiter(char32_t codepoint, DelimiterListLanguage lang) {
+    out.write("""const bool* asciiDelimiterTable(DelimiterListLanguage lang) {
+    if (lang == DelimiterListLanguage::kEnglish) {
+        return englishAsciiDelimiters;
+    }
+    return nonEnglishAsciiDelimiters;
+}
+
+bool codepointIsDelimiter(char32_t codepoint, DelimiterListLanguage lang) {
     if (codepoint <= 0x7f) {
         if (lang == DelimiterListLanguage::kEnglish) {
             return englishAsciiDelimiters[codepoint];
@@ -30,6 +30,8 @@
 
 #include "mongo/db/index/btree_key_generator.h"
 
+#include <algorithm>
+
 #include <boost/optional.hpp>
 
 #include "mongo/bson/bsonobjbuilder.h"
@@ -77,6 +79,13 @@ BtreeKeyGenerator::BtreeKeyGenerator(std::vector<const char*> fieldNames,
         invariant(pathLength > 0);
         _pathLengths.push_back(pathLength);
     }
+
+    // Classify the key pattern once: when every indexed path is a single top-level component,
+    // documents without indexed arrays can be handled by a simple per-field lookup instead of the
+    // recursive array-expanding machinery.
+    _isSimplePattern = std::all_of(_pathLengths.begin(), _pathLengths.end(), [](size_t pathLength) {
+        return pathLength == 1;
+    });
 }
 
 static void assertParallelArrays(const char* first, const char* second) {
@@ -144,6 +153,38 @@ void BtreeKeyGenerator::_getKeysArrEltFixed(std::vector<const char*>* fieldNames
                       multikeyPaths);
 }
 
+bool BtreeKeyGenerator::_tryGetKeysSimple(const BSONObj& obj,
+                                          BSONObjSet* keys,
+                                          MultikeyPaths* multikeyPaths) const {
+    BSONObjBuilder keyBuilder(_sizeTracker);
+    size_t numNotFound = 0;
+    for (const char* fieldName : _fieldNames) {
+        BSONElement e = obj.getField(fieldName);
+        if (e.eoo()) {
+            keyBuilder.appendNull("");
+            ++numNotFound;
+        } else if (e.type() == Array) {
+            // Arrays require the multikey machinery; leave 'keys' and 'multikeyPaths' untouched
+            // so the generic path starts from a clean slate.
+            return false;
+        } else {
+            CollationIndexKey::collationAwareIndexKeyAppend(e, _collator, &keyBuilder);
+        }
+    }
+
+    // A sparse index generates no key when none of its fields are present in the document.
+    if (!_isSparse || numNotFound < _fieldNames.size()) {
+        keys->insert(keyBuilder.obj());
+    }
+
+    // Nothing here can make the index multikey; report an empty component set per field.
+    if (multikeyPaths) {
+        invariant(multikeyPaths->empty());
+        multikeyPaths->resize(_fieldNames.size());
+    }
+    return true;
+}
+
 void BtreeKeyGenerator::getKeys(const BSONObj& obj,
                                 BSONObjSet* keys,
                                 MultikeyPaths* multikeyPaths) const {
@@ -171,6 +212,9 @@ void BtreeKeyGenerator::getKeys(const BSONObj& obj,
         if (multikeyPaths) {
             multikeyPaths->resize(1);
         }
+    } else if (_isSimplePattern && _tryGetKeysSimple(obj, keys, multikeyPaths)) {
+        // Fast path: all indexed fields are top-level non-array values and the single key has
+        // been generated without any recursion or vector copies.
     } else {
         if (multikeyPaths) {
             invariant(multikeyPaths->empty());
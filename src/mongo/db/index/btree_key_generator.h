@@ -70,9 +70,21 @@ public:
     void getKeys(const BSONObj& obj, BSONObjSet* keys, MultikeyPaths* multikeyPaths) const;
 
 private:
+    /**
+     * Generates the single key for a document whose indexed fields are all top-level non-array
+     * values. Only called when the key pattern has been classified as simple at construction.
+     * Returns false without modifying 'keys' if any indexed field holds an array, in which case
+     * the caller falls back to the generic array-expanding machinery.
+     */
+    bool _tryGetKeysSimple(const BSONObj& obj, BSONObjSet* keys, MultikeyPaths* multikeyPaths) const;
+
     // These are used by getKeys below.
     std::vector<const char*> _fieldNames;
     bool _isIdIndex;
+    // True when every field in the key pattern is a top-level path (no dotted or positional
+    // components), classified once at construction so that getKeys() can take a non-recursive
+    // fast path for documents without indexed arrays.
+    bool _isSimplePattern;
     bool _isSparse;
     BSONObj _nullKey;  // A full key with all fields null.
     BSONSizeTracker _sizeTracker;
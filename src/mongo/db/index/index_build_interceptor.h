@@ -97,6 +97,15 @@ public:
      */
     bool areAllWritesApplied(OperationContext* opCtx) const;
 
+    /**
+     * Returns the approximate number of side writes that have been recorded but not yet applied
+     * to the index. Only stable when called on the builder's thread between calls to
+     * drainWritesIntoIndex; concurrent writers may still be adding records.
+     */
+    int64_t numSideWritesRemaining() const {
+        return _sideWritesCounter.load() - _numApplied;
+    }
+
     /**
       * When an index builder wants to commit, use this to retrieve any recorded multikey paths
       * that were tracked during the build.
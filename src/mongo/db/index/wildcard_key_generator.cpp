@@ -32,6 +32,9 @@
 
 #include "mongo/db/index/wildcard_key_generator.h"
 
+#include <algorithm>
+
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/query/collation/collation_index_key.h"
 
@@ -103,13 +106,39 @@ void WildcardKeyGenerator::generateKeys(BSONObj inputDoc,
                                         BSONObjSet* keys,
                                         BSONObjSet* multikeyPaths) const {
     FieldRef rootPath;
-    _traverseWildcard(_projExec->applyProjection(inputDoc), false, &rootPath, keys, multikeyPaths);
+    KeyArena arena;
+    _traverseWildcard(
+        _projExec->applyProjection(inputDoc), false, &rootPath, &arena, multikeyPaths);
+
+    // Materialize unowned views into the arena, then sort so that duplicate keys (produced by
+    // arrays with repeated values) become adjacent. Sorting a flat vector of views is cheaper than
+    // the per-key tree insertions of inserting into 'keys' directly, and it lets every unique key
+    // be added with an end hint so the set is built in linear time.
+    std::vector<BSONObj> candidates;
+    candidates.reserve(arena.offsets.size());
+    for (int offset : arena.offsets) {
+        candidates.emplace_back(arena.buf.buf() + offset);
+    }
+    const auto lessThan = SimpleBSONObjComparator::kInstance.makeLessThan();
+    std::sort(candidates.begin(), candidates.end(), lessThan);
+
+    const BSONObj* prev = nullptr;
+    for (const auto& candidate : candidates) {
+        // After sorting, equal keys are adjacent; anything not greater than its predecessor is a
+        // duplicate. Note that keys which are not binary-equal may still compare equal, e.g. the
+        // same numeric value stored as an int and as a double.
+        if (prev && !lessThan(*prev, candidate)) {
+            continue;
+        }
+        keys->insert(keys->end(), candidate.getOwned());
+        prev = &candidate;
+    }
 }
 
 void WildcardKeyGenerator::_traverseWildcard(BSONObj obj,
                                              bool objIsArray,
                                              FieldRef* path,
-                                             BSONObjSet* keys,
+                                             KeyArena* keys,
                                              BSONObjSet* multikeyPaths) const {
     for (const auto elem : obj) {
         // If the element's fieldName contains a ".", fast-path skip it because it's not queryable.
@@ -148,7 +177,7 @@ void WildcardKeyGenerator::_traverseWildcard(BSONObj obj,
 bool WildcardKeyGenerator::_addKeyForNestedArray(BSONElement elem,
                                                  const FieldRef& fullPath,
                                                  bool enclosingObjIsArray,
-                                                 BSONObjSet* keys) const {
+                                                 KeyArena* keys) const {
     // If this element is an array whose parent is also an array, index it as a value.
     if (enclosingObjIsArray && elem.type() == BSONType::Array) {
         _addKey(elem, fullPath, keys);
@@ -159,7 +188,7 @@ bool WildcardKeyGenerator::_addKeyForNestedArray(BSONElement elem,
 
 bool WildcardKeyGenerator::_addKeyForEmptyLeaf(BSONElement elem,
                                                const FieldRef& fullPath,
-                                               BSONObjSet* keys) const {
+                                               KeyArena* keys) const {
     invariant(elem.isABSONObj());
     if (elem.embeddedObject().isEmpty()) {
         // In keeping with the behaviour of regular indexes, an empty object is indexed as-is while
@@ -172,16 +201,19 @@ bool WildcardKeyGenerator::_addKeyForEmptyLeaf(BSONElement elem,
 
 void WildcardKeyGenerator::_addKey(BSONElement elem,
                                    const FieldRef& fullPath,
-                                   BSONObjSet* keys) const {
-    // Wildcard keys are of the form { "": "path.to.field", "": <collation-aware value> }.
-    BSONObjBuilder bob;
+                                   KeyArena* keys) const {
+    // Wildcard keys are of the form { "": "path.to.field", "": <collation-aware value> }. The key
+    // is built directly into the shared arena; generateKeys() deduplicates once the traversal has
+    // completed.
+    keys->offsets.push_back(keys->buf.len());
+    BSONObjBuilder bob(keys->buf);
     bob.append("", fullPath.dottedField());
     if (elem) {
         CollationIndexKey::collationAwareIndexKeyAppend(elem, _collator, &bob);
     } else {
         bob.appendUndefined("");
     }
-    keys->insert(bob.obj());
+    bob.done();
 }
 
 void WildcardKeyGenerator::_addMultiKey(const FieldRef& fullPath, BSONObjSet* multikeyPaths) const {
@@ -75,23 +75,32 @@ public:
     void generateKeys(BSONObj inputDoc, BSONObjSet* keys, BSONObjSet* multikeyPaths) const;
 
 private:
-    // Traverses every path of the post-projection document, adding keys to the set as it goes.
+    // Candidate keys are built back-to-back into a single shared buffer during the document
+    // traversal and deduplicated in one sort pass afterwards, rather than paying a separate
+    // allocation and a red-black tree insertion per leaf. 'offsets' locates each candidate key
+    // within 'buf'.
+    struct KeyArena {
+        BufBuilder buf;
+        std::vector<int> offsets;
+    };
+
+    // Traverses every path of the post-projection document, adding keys to the arena as it goes.
     void _traverseWildcard(BSONObj obj,
                            bool objIsArray,
                            FieldRef* path,
-                           BSONObjSet* keys,
+                           KeyArena* keys,
                            BSONObjSet* multikeyPaths) const;
 
     // Helper functions to format the entry appropriately before adding it to the key/path tracker.
     void _addMultiKey(const FieldRef& fullPath, BSONObjSet* multikeyPaths) const;
-    void _addKey(BSONElement elem, const FieldRef& fullPath, BSONObjSet* keys) const;
+    void _addKey(BSONElement elem, const FieldRef& fullPath, KeyArena* keys) const;
 
     // Helper to check whether the element is a nested array, and conditionally add it to 'keys'.
     bool _addKeyForNestedArray(BSONElement elem,
                                const FieldRef& fullPath,
                                bool enclosingObjIsArray,
-                               BSONObjSet* keys) const;
-    bool _addKeyForEmptyLeaf(BSONElement elem, const FieldRef& fullPath, BSONObjSet* keys) const;
+                               KeyArena* keys) const;
+    bool _addKeyForEmptyLeaf(BSONElement elem, const FieldRef& fullPath, KeyArena* keys) const;
 
     std::unique_ptr<ProjectionExecAgg> _projExec;
     const CollatorInterface* _collator;
@@ -285,6 +285,22 @@ Status IndexBuilder::_build(OperationContext* opCtx,
         return _failIndexBuild(opCtx, indexer, dbLock, status, allowBackgroundBuilding);
     }
 
+    // Keep draining under intent locks until the side-writes tables are nearly empty, so the
+    // drains below that stop writes have a bounded amount of work left. The pass limit guards
+    // against a writer that outpaces the drain indefinitely.
+    static constexpr int64_t kDrainRemainingThreshold = 100;
+    static constexpr int kMaxIntentLockDrainPasses = 10;
+    for (int pass = 0; pass < kMaxIntentLockDrainPasses &&
+         indexer.numSideWritesRemaining() > kDrainRemainingThreshold;
+         pass++) {
+        opCtx->recoveryUnit()->abandonSnapshot();
+        Lock::CollectionLock collLock(opCtx->lockState(), ns.ns(), MODE_IS);
+        status = indexer.drainBackgroundWritesIfNeeded();
+        if (!status.isOK()) {
+            return _failIndexBuild(opCtx, indexer, dbLock, status, allowBackgroundBuilding);
+        }
+    }
+
     // Perform the second drain while stopping inserts into the collection.
     {
         Lock::CollectionLock colLock(opCtx->lockState(), ns.ns(), MODE_S);
@@ -54,6 +54,7 @@
 #include "mongo/db/auth/security_key.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/logger/async_rotatable_file_appender.h"
 #include "mongo/logger/console_appender.h"
 #include "mongo/logger/logger.h"
 #include "mongo/logger/message_event.h"
@@ -213,6 +214,10 @@ void forkServerOrDie() {
 }
 
 MONGO_EXPORT_SERVER_PARAMETER(maxLogSizeKB, int, logger::LogContext::kDefaultMaxLogSizeKB);
+
+// When true, log lines destined for the log file are queued to a dedicated writer thread
+// instead of being written synchronously, so operation threads never block on log disk I/O.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(logAsyncAppend, bool, false);
 // On POSIX platforms we need to set our umask before opening any log files, so this
 // should depend on MungeUmask above, but not on Windows.
 MONGO_INITIALIZER_GENERAL(
@@ -303,9 +308,15 @@ MONGO_INITIALIZER_GENERAL(
 
         LogManager* manager = logger::globalLogManager();
         manager->getGlobalDomain()->clearAppenders();
-        manager->getGlobalDomain()->attachAppender(
-            std::make_unique<RotatableFileAppender<MessageEventEphemeral>>(
-                std::make_unique<MessageEventDetailsEncoder>(), writer.getValue()));
+        if (logAsyncAppend) {
+            manager->getGlobalDomain()->attachAppender(
+                std::make_unique<logger::AsyncRotatableFileAppender<MessageEventEphemeral>>(
+                    std::make_unique<MessageEventDetailsEncoder>(), writer.getValue()));
+        } else {
+            manager->getGlobalDomain()->attachAppender(
+                std::make_unique<RotatableFileAppender<MessageEventEphemeral>>(
+                    std::make_unique<MessageEventDetailsEncoder>(), writer.getValue()));
+        }
         manager->getNamedDomain("javascriptOutput")
             ->attachAppender(std::make_unique<RotatableFileAppender<MessageEventEphemeral>>(
                 std::make_unique<MessageEventDetailsEncoder>(), writer.getValue()));
@@ -385,7 +385,8 @@ bool ExistsMatchExpression::equivalent(const MatchExpression* other) const {
 InMatchExpression::InMatchExpression(StringData path)
     : LeafMatchExpression(MATCH_IN, path),
       _eltCmp(BSONElementComparator::FieldNamesMode::kIgnore, _collator),
-      _equalitySet(_eltCmp.makeBSONEltFlatSet(_originalEqualityVector)) {}
+      _equalitySet(_eltCmp.makeBSONEltFlatSet(_originalEqualityVector)),
+      _equalityHashSet(_eltCmp.makeBSONEltUnorderedSet()) {}
 
 std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     auto next = stdx::make_unique<InMatchExpression>(path());
@@ -397,6 +398,11 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     next->_hasEmptyArray = _hasEmptyArray;
     next->_equalitySet = _equalitySet;
     next->_originalEqualityVector = _originalEqualityVector;
+    // Rebuild the hash set against the clone's own comparator rather than copying it, so its
+    // hasher does not point back into this expression.
+    next->_equalityHashSet = next->_eltCmp.makeBSONEltUnorderedSet();
+    next->_equalityHashSet.insert(next->_originalEqualityVector.begin(),
+                                  next->_originalEqualityVector.end());
     for (auto&& regex : _regexes) {
         std::unique_ptr<RegexMatchExpression> clonedRegex(
             static_cast<RegexMatchExpression*>(regex->shallowClone().release()));
@@ -409,7 +415,7 @@ bool InMatchExpression::matchesSingleElement(const BSONElement& e, MatchDetails*
     if (_hasNull && e.eoo()) {
         return true;
     }
-    if (_equalitySet.find(e) != _equalitySet.end()) {
+    if (_equalityHashSet.find(e) != _equalityHashSet.end()) {
         return true;
     }
     for (auto&& regex : _regexes) {
@@ -508,8 +514,11 @@ void InMatchExpression::_doSetCollator(const CollatorInterface* collator) {
             _originalEqualityVector.begin(), _originalEqualityVector.end(), _eltCmp.makeLessThan());
     }
 
-    // We need to re-compute '_equalitySet', since our set comparator has changed.
+    // We need to re-compute '_equalitySet' and '_equalityHashSet', since our set comparator has
+    // changed.
     _equalitySet = _eltCmp.makeBSONEltFlatSet(_originalEqualityVector);
+    _equalityHashSet = _eltCmp.makeBSONEltUnorderedSet();
+    _equalityHashSet.insert(_originalEqualityVector.begin(), _originalEqualityVector.end());
 }
 
 Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
@@ -539,6 +548,8 @@ Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
     }
 
     _equalitySet = _eltCmp.makeBSONEltFlatSet(_originalEqualityVector);
+    _equalityHashSet = _eltCmp.makeBSONEltUnorderedSet();
+    _equalityHashSet.insert(_originalEqualityVector.begin(), _originalEqualityVector.end());
 
     return Status::OK();
 }
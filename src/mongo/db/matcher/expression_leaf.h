@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "mongo/bson/bsonelement_comparator.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
@@ -319,6 +321,26 @@ public:
         return _flags;
     }
 
+    /**
+     * The output of the planner's prefix analysis of this regex (see
+     * IndexBoundsBuilder::simpleRegex()). It depends only on the pattern and flags, so the
+     * planner computes it once and caches it here, then reuses it for every other candidate
+     * plan that indexes this predicate. Like an index tag, this is planner state stashed on
+     * the node; it is not copied by shallowClone().
+     */
+    struct BoundsAnalysis {
+        std::string prefix;
+        bool prefixIsExact;
+    };
+
+    const boost::optional<BoundsAnalysis>& getBoundsAnalysis() const {
+        return _boundsAnalysis;
+    }
+
+    void setBoundsAnalysis(BoundsAnalysis analysis) const {
+        _boundsAnalysis = std::move(analysis);
+    }
+
 private:
     ExpressionOptimizerFunc getOptimizer() const final {
         return [](std::unique_ptr<MatchExpression> expression) { return expression; };
@@ -329,6 +351,10 @@ private:
     std::string _regex;
     std::string _flags;
     std::unique_ptr<pcrecpp::RE> _re;
+
+    // Lazily populated by the planner via setBoundsAnalysis(). Mutable because bounds building
+    // only sees the expression tree through const pointers.
+    mutable boost::optional<BoundsAnalysis> _boundsAnalysis;
 };
 
 class ModMatchExpression : public LeafMatchExpression {
@@ -469,6 +495,12 @@ private:
     // for this set.
     BSONEltFlatSet _equalitySet;
 
+    // Hashed copy of '_equalitySet'. Answers the per-document equality probe with one hash of the
+    // probe element instead of a BSONElement comparison per binary search step, which matters for
+    // large $in lists. Kept in sync with '_equalitySet' whenever the equalities or the collator
+    // change; '_equalitySet' remains the sorted form handed to the planner via getEqualities().
+    BSONEltUnorderedSet _equalityHashSet;
+
     // Container of regex elements this object owns.
     std::vector<std::unique_ptr<RegexMatchExpression>> _regexes;
 };
@@ -324,7 +324,35 @@ StatusWithMatchExpression parse(const BSONObj& obj,
                                 const ExtensionsCallback* extensionsCallback,
                                 MatchExpressionParser::AllowedFeatureSet allowedFeatures,
                                 DocumentParseLevel currentLevel) {
-    auto root = stdx::make_unique<AndMatchExpression>();
+    // The top-level $and node is allocated lazily. In the common case of a single simple
+    // predicate (e.g. {a: 1}) we would otherwise allocate an AndMatchExpression only to unwrap
+    // it and throw it away at the bottom of this function.
+    std::unique_ptr<AndMatchExpression> root;
+    std::unique_ptr<MatchExpression> first;
+
+    auto addToRoot = [&root, &first](std::unique_ptr<MatchExpression> expr) {
+        if (!root && !first) {
+            first = std::move(expr);
+            return;
+        }
+        if (!root) {
+            root = stdx::make_unique<AndMatchExpression>();
+            root->add(first.release());
+        }
+        root->add(expr.release());
+    };
+
+    // Parsers that may produce several predicates (an expression document such as
+    // {$gt: 5, $lt: 8}) append directly to the $and node, so it must exist up front.
+    auto materializeRoot = [&root, &first]() {
+        if (!root) {
+            root = stdx::make_unique<AndMatchExpression>();
+            if (first) {
+                root->add(first.release());
+            }
+        }
+        return root.get();
+    };
 
     const DocumentParseLevel nextLevel = (currentLevel == DocumentParseLevel::kPredicateTopLevel)
         ? DocumentParseLevel::kUserDocumentTopLevel
@@ -353,7 +381,7 @@ StatusWithMatchExpression parse(const BSONObj& obj,
             // library. The following operators currently follow this convention:
             //    - $comment  has no action associated with the operator.
             if (parsedExpression.getValue().get()) {
-                root->add(parsedExpression.getValue().release());
+                addToRoot(std::move(parsedExpression.getValue()));
             }
 
             continue;
@@ -362,7 +390,7 @@ StatusWithMatchExpression parse(const BSONObj& obj,
         if (isExpressionDocument(e, false)) {
             auto s = parseSub(e.fieldNameStringData(),
                               e.Obj(),
-                              root.get(),
+                              materializeRoot(),
                               expCtx,
                               extensionsCallback,
                               allowedFeatures,
@@ -376,7 +404,7 @@ StatusWithMatchExpression parse(const BSONObj& obj,
             auto result = parseRegexElement(e.fieldNameStringData(), e);
             if (!result.isOK())
                 return result;
-            root->add(result.getValue().release());
+            addToRoot(std::move(result.getValue()));
             continue;
         }
 
@@ -389,7 +417,15 @@ StatusWithMatchExpression parse(const BSONObj& obj,
         if (!eq.isOK())
             return eq;
 
-        root->add(eq.getValue().release());
+        addToRoot(std::move(eq.getValue()));
+    }
+
+    if (!root) {
+        if (first) {
+            return {std::move(first)};
+        }
+        // An empty query matches everything; it is represented by an empty $and.
+        return {stdx::make_unique<AndMatchExpression>()};
     }
 
     if (root->numChildren() == 1) {
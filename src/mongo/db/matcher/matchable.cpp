@@ -36,9 +36,7 @@
 
 namespace mongo {
 
-BSONMatchableDocument::BSONMatchableDocument(const BSONObj& obj) : _obj(obj) {
-    _iteratorUsed = false;
-}
+BSONMatchableDocument::BSONMatchableDocument(const BSONObj& obj) : _obj(obj) {}
 
 BSONMatchableDocument::~BSONMatchableDocument() {}
 }
@@ -87,25 +87,31 @@ public:
     }
 
     virtual ElementIterator* allocateIterator(const ElementPath* path) const {
-        if (_iteratorUsed)
+        if (_iteratorsUsed == kNumInlineIterators)
             return new BSONElementIterator(path, _obj);
-        _iteratorUsed = true;
-        _iterator.reset(path, _obj);
-        return &_iterator;
+        auto* iterator = &_iterators[_iteratorsUsed++];
+        iterator->reset(path, _obj);
+        return iterator;
     }
 
     virtual void releaseIterator(ElementIterator* iterator) const {
-        if (iterator == &_iterator) {
-            _iteratorUsed = false;
+        // Iterator lifetimes nest (IteratorHolder is scoped), so inline iterators are always
+        // released in LIFO order.
+        if (_iteratorsUsed && iterator == &_iterators[_iteratorsUsed - 1]) {
+            --_iteratorsUsed;
         } else {
             delete iterator;
         }
     }
 
 private:
+    // The number of iterators stored inline. Only filters with deeply nested path expressions
+    // over the same document need more at once; those overflow to the heap.
+    static constexpr size_t kNumInlineIterators = 4;
+
     BSONObj _obj;
-    mutable BSONElementIterator _iterator;
-    mutable bool _iteratorUsed;
+    mutable BSONElementIterator _iterators[kNumInlineIterators];
+    mutable size_t _iteratorsUsed = 0;
 };
 
 /**
@@ -116,7 +122,7 @@ private:
  */
 class BSONElementViewMatchableDocument : public MatchableDocument {
 public:
-    BSONElementViewMatchableDocument(BSONElement elem) : _elem(elem), _iteratorUsed(false) {}
+    BSONElementViewMatchableDocument(BSONElement elem) : _elem(elem) {}
 
     BSONObj toBSON() const override {
         return BSON("" << _elem);
@@ -130,25 +136,29 @@ public:
         // Skip the first field in the path when traversing the document.
         const size_t suffixIndex = 1;
 
-        if (_iteratorUsed) {
+        if (_iteratorsUsed == kNumInlineIterators) {
             return new BSONElementIterator(path, suffixIndex, _elem);
         }
-        _iteratorUsed = true;
-        _iterator.reset(path, suffixIndex, _elem);
-        return &_iterator;
+        auto* iterator = &_iterators[_iteratorsUsed++];
+        iterator->reset(path, suffixIndex, _elem);
+        return iterator;
     }
 
     void releaseIterator(ElementIterator* iterator) const override {
-        if (iterator == &_iterator) {
-            _iteratorUsed = false;
+        // Iterator lifetimes nest (IteratorHolder is scoped), so inline iterators are always
+        // released in LIFO order.
+        if (_iteratorsUsed && iterator == &_iterators[_iteratorsUsed - 1]) {
+            --_iteratorsUsed;
         } else {
             delete iterator;
         }
     }
 
 private:
+    static constexpr size_t kNumInlineIterators = 4;
+
     BSONElement _elem;
-    mutable BSONElementIterator _iterator;
-    mutable bool _iteratorUsed;
+    mutable BSONElementIterator _iterators[kNumInlineIterators];
+    mutable size_t _iteratorsUsed = 0;
 };
 }
@@ -109,8 +109,11 @@ void BSONElementIterator::reset(const ElementPath* path,
     _state = BEGIN;
     _next.reset();
 
-    _subCursor.reset();
-    _subCursorPath.reset();
+    if (_subCursor) {
+        _spareSubCursor = std::move(_subCursor);
+    }
+    _subCursorPathRest.reset();
+    _subCursorPathBeyondOffset.reset();
 }
 
 void BSONElementIterator::reset(const ElementPath* path, const BSONObj& objectToIterate) {
@@ -121,8 +124,11 @@ void BSONElementIterator::reset(const ElementPath* path, const BSONObj& objectTo
     _state = BEGIN;
     _next.reset();
 
-    _subCursor.reset();
-    _subCursorPath.reset();
+    if (_subCursor) {
+        _spareSubCursor = std::move(_subCursor);
+    }
+    _subCursorPathRest.reset();
+    _subCursorPathBeyondOffset.reset();
 }
 
 void BSONElementIterator::_setTraversalStart(size_t suffixIndex, BSONElement elementToIterate) {
@@ -140,8 +146,40 @@ void BSONElementIterator::_setTraversalStart(size_t suffixIndex, BSONElement ele
     }
 }
 
+BSONElementIterator* BSONElementIterator::_startSubCursor(const ElementPath* path,
+                                                          const BSONObj& objectToIterate) {
+    if (_spareSubCursor) {
+        // Reuse the last exhausted sub-cursor's allocation (and, recursively, those of its own
+        // sub-cursors) rather than allocating anew for every array element.
+        _spareSubCursor->reset(path, objectToIterate);
+        _subCursor = std::move(_spareSubCursor);
+    } else {
+        _subCursor.reset(new BSONElementIterator(path, objectToIterate));
+    }
+    return _subCursor.get();
+}
+
+const ElementPath* BSONElementIterator::_subPathForRest() {
+    if (!_subCursorPathRest) {
+        _subCursorPathRest.reset(new ElementPath());
+        _subCursorPathRest->init(_arrayIterationState.restOfPath);
+        _subCursorPathRest->setLeafArrayBehavior(_path->leafArrayBehavior());
+    }
+    return _subCursorPathRest.get();
+}
+
+const ElementPath* BSONElementIterator::_subPathBeyondArrayOffset() {
+    if (!_subCursorPathBeyondOffset) {
+        _subCursorPathBeyondOffset.reset(new ElementPath());
+        _subCursorPathBeyondOffset->init(_arrayIterationState.restOfPath.substr(
+            _arrayIterationState.nextPieceOfPath.size() + 1));
+        _subCursorPathBeyondOffset->setLeafArrayBehavior(_path->leafArrayBehavior());
+    }
+    return _subCursorPathBeyondOffset.get();
+}
+
 void BSONElementIterator::ArrayIterationState::reset(const FieldRef& ref, int start) {
-    restOfPath = ref.dottedField(start).toString();
+    restOfPath = ref.dottedField(start);
     hasMore = restOfPath.size() > 0;
     if (hasMore) {
         nextPieceOfPath = ref.getPart(start);
@@ -179,7 +217,7 @@ bool BSONElementIterator::subCursorHasMore() {
         if (_subCursor->more()) {
             return true;
         }
-        _subCursor.reset();
+        _spareSubCursor = std::move(_subCursor);
 
         // If the subcursor doesn't have more, see if the current element is an array offset
         // match (see comment in BSONElementIterator::more() for an example).  If it is indeed
@@ -194,18 +232,14 @@ bool BSONElementIterator::subCursorHasMore() {
                 return true;
             }
 
-            _subCursorPath.reset(new ElementPath());
-            _subCursorPath->init(_arrayIterationState.restOfPath.substr(
-                _arrayIterationState.nextPieceOfPath.size() + 1));
-            _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
+            const ElementPath* subPath = _subPathBeyondArrayOffset();
 
             // If we're here, we must be able to traverse nonleaf arrays.
             dassert(_path->nonLeafArrayBehavior() == ElementPath::NonLeafArrayBehavior::kTraverse);
-            dassert(_subCursorPath->nonLeafArrayBehavior() ==
+            dassert(subPath->nonLeafArrayBehavior() ==
                     ElementPath::NonLeafArrayBehavior::kTraverse);
 
-            _subCursor.reset(
-                new BSONElementIterator(_subCursorPath.get(), _arrayIterationState._current.Obj()));
+            _startSubCursor(subPath, _arrayIterationState._current.Obj());
 
             // Set _arrayIterationState._current to EOO. This is not an implicit array traversal, so
             // we should not override the array offset of the subcursor with the current array
@@ -284,11 +318,7 @@ bool BSONElementIterator::more() {
             if (eltInArray.type() == Object) {
                 // The current array element is a subdocument.  See if the subdocument generates
                 // any elements matching the remaining subpath.
-                _subCursorPath.reset(new ElementPath());
-                _subCursorPath->init(_arrayIterationState.restOfPath);
-                _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
-
-                _subCursor.reset(new BSONElementIterator(_subCursorPath.get(), eltInArray.Obj()));
+                _startSubCursor(_subPathForRest(), eltInArray.Obj());
                 if (subCursorHasMore()) {
                     return true;
                 }
@@ -310,14 +340,10 @@ bool BSONElementIterator::more() {
                 if (eltInArray.type() == Array) {
                     // The current array element is itself an array.  See if the nested array
                     // has any elements matching the remainihng.
-                    _subCursorPath.reset(new ElementPath());
-                    _subCursorPath->init(_arrayIterationState.restOfPath.substr(
-                        _arrayIterationState.nextPieceOfPath.size() + 1));
-                    _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
-                    BSONElementIterator* real = new BSONElementIterator(
-                        _subCursorPath.get(), _arrayIterationState._current.Obj());
-                    _subCursor.reset(real);
-                    real->_arrayIterationState.reset(_subCursorPath->fieldRef(), 0);
+                    const ElementPath* subPath = _subPathBeyondArrayOffset();
+                    BSONElementIterator* real =
+                        _startSubCursor(subPath, _arrayIterationState._current.Obj());
+                    real->_arrayIterationState.reset(subPath->fieldRef(), 0);
                     real->_arrayIterationState.startIterator(eltInArray);
                     real->_state = IN_ARRAY;
 
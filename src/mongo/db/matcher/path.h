@@ -222,6 +222,24 @@ private:
      */
     void _setTraversalStart(size_t suffixIndex, BSONElement elementToIterate);
 
+    /**
+     * Makes _subCursor iterate 'objectToIterate' at the end of 'path', recycling the most recently
+     * exhausted sub-cursor's allocation when one is available.
+     */
+    BSONElementIterator* _startSubCursor(const ElementPath* path, const BSONObj& objectToIterate);
+
+    /**
+     * Returns the lazily-parsed path for the remainder of '_path' beyond the array being
+     * traversed.
+     */
+    const ElementPath* _subPathForRest();
+
+    /**
+     * Returns the lazily-parsed path for the remainder of '_path' beyond the array offset
+     * component following the array being traversed.
+     */
+    const ElementPath* _subPathBeyondArrayOffset();
+
     const ElementPath* _path;
 
     // The element where we begin our iteration. This is either:
@@ -248,7 +266,9 @@ private:
             return nextPieceOfPath.size() == restOfPath.size();
         }
 
-        std::string restOfPath;
+        // The remainder of the path (beyond 'start') being traversed through the array. Views the
+        // FieldRef passed to reset(), which must outlive this state.
+        StringData restOfPath;
         bool hasMore;
         StringData nextPieceOfPath;
         bool nextPieceOfPathIsNumber;
@@ -260,7 +280,16 @@ private:
 
     ArrayIterationState _arrayIterationState;
 
-    std::unique_ptr<ElementIterator> _subCursor;
-    std::unique_ptr<ElementPath> _subCursorPath;
+    std::unique_ptr<BSONElementIterator> _subCursor;
+
+    // The most recently exhausted sub-cursor, kept so _startSubCursor() can recycle its allocation
+    // (and, recursively, those of its own sub-cursors) for the next array element.
+    std::unique_ptr<BSONElementIterator> _spareSubCursor;
+
+    // Lazily-parsed paths for the remainder of '_path' beyond the array being traversed. The
+    // remainder is fixed once _arrayIterationState has been reset, so each variant is parsed at
+    // most once per reset() no matter how many array elements spawn sub-cursors.
+    std::unique_ptr<ElementPath> _subCursorPathRest;
+    std::unique_ptr<ElementPath> _subCursorPathBeyondOffset;
 };
 }
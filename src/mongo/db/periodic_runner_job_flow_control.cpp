@@ -0,0 +1,206 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kStorage
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/periodic_runner_job_flow_control.h"
+
+#include <algorithm>
+
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/locker.h"
+#include "mongo/db/jsobj.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/log.h"
+#include "mongo/util/periodic_runner.h"
+
+namespace mongo {
+
+// Whether flow control adjusts the write ticket pool at all. Off by default; when off, any
+// reduction the job has made is undone on its next pass.
+MONGO_EXPORT_SERVER_PARAMETER(flowControlEnabled, bool, false);
+
+// The majority commit lag, in seconds, that flow control tries to keep a primary under.
+MONGO_EXPORT_SERVER_PARAMETER(flowControlTargetLagSeconds, int, 10);
+
+namespace {
+
+// TicketHolder::resize refuses anything lower, so this is the throttling floor.
+const int kMinWriteTickets = 5;
+
+// Last lag sample taken by the job, and the ticket count to restore when the lag clears. A zero
+// 'restoreTickets' means the job is not currently throttling. Both are read by the serverStatus
+// section below.
+AtomicInt64 lastSampledLagSecs{0};
+AtomicInt32 restoreTickets{0};
+
+void restoreWriteTickets(TicketHolder* holder) {
+    int baseline = restoreTickets.swap(0);
+    if (baseline == 0)
+        return;
+
+    // An operator may have raised the pool via the wiredTigerConcurrentWriteTransactions
+    // parameter while we were throttling; never shrink it back down here.
+    if (baseline <= holder->outof())
+        return;
+
+    auto status = holder->resize(baseline);
+    if (!status.isOK()) {
+        restoreTickets.store(baseline);
+        LOG(1) << "flow control could not restore the write ticket pool to " << baseline << ": "
+               << status;
+        return;
+    }
+
+    log() << "flow control restored the write ticket pool to " << baseline;
+}
+
+class FlowControlServerStatusSection : public ServerStatusSection {
+public:
+    FlowControlServerStatusSection() : ServerStatusSection("flowControl") {}
+
+    virtual bool includeByDefault() const {
+        return true;
+    }
+
+    virtual BSONObj generateSection(OperationContext* opCtx,
+                                    const BSONElement& configElement) const {
+        BSONObjBuilder bob;
+        bob.append("enabled", flowControlEnabled.load());
+        bob.append("targetLagSeconds", flowControlTargetLagSeconds.load());
+        bob.append("lagSeconds", lastSampledLagSecs.load());
+        if (auto holder = Locker::getGlobalThrottlingTicketHolder(MODE_IX)) {
+            bob.append("writeTicketsOut", holder->outof());
+        }
+        const int baseline = restoreTickets.load();
+        bob.append("isThrottling", baseline != 0);
+        if (baseline != 0) {
+            bob.append("writeTicketsRestoreTarget", baseline);
+        }
+        return bob.obj();
+    }
+
+} flowControlServerStatusSection;
+
+}  // namespace
+
+void startPeriodicThreadToAdjustWriteTicketsForReplicationLag(ServiceContext* serviceContext) {
+    // Enforce calling this function once, and only once.
+    static bool firstCall = true;
+    invariant(firstCall);
+    firstCall = false;
+
+    auto periodicRunner = serviceContext->getPeriodicRunner();
+    invariant(periodicRunner);
+
+    PeriodicRunner::PeriodicJob job(
+        "startPeriodicThreadToAdjustWriteTicketsForReplicationLag",
+        [](Client* client) {
+            try {
+                auto holder = Locker::getGlobalThrottlingTicketHolder(MODE_IX);
+                if (!holder)
+                    return;
+
+                if (!flowControlEnabled.load()) {
+                    restoreWriteTickets(holder);
+                    lastSampledLagSecs.store(0);
+                    return;
+                }
+
+                auto replCoord = repl::ReplicationCoordinator::get(client->getServiceContext());
+                if (!replCoord ||
+                    replCoord->getReplicationMode() !=
+                        repl::ReplicationCoordinator::modeReplSet ||
+                    !replCoord->getMemberState().primary()) {
+                    restoreWriteTickets(holder);
+                    lastSampledLagSecs.store(0);
+                    return;
+                }
+
+                // Approximate the majority commit lag from the optime wall-clock components.
+                // This is coarse, but flow control only needs to know whether the lag is well
+                // past the target and by roughly what factor.
+                const auto appliedSecs =
+                    replCoord->getMyLastAppliedOpTime().getTimestamp().getSecs();
+                const auto committedSecs =
+                    replCoord->getLastCommittedOpTime().getTimestamp().getSecs();
+                const long long lag = (appliedSecs > committedSecs)
+                    ? static_cast<long long>(appliedSecs - committedSecs)
+                    : 0;
+                lastSampledLagSecs.store(lag);
+
+                const int targetLag = std::max(1, flowControlTargetLagSeconds.load());
+                if (lag <= targetLag) {
+                    restoreWriteTickets(holder);
+                    return;
+                }
+
+                // Shrink the pool in proportion to how far past the target we are, so a small
+                // overshoot costs little concurrency while a runaway primary is cut back hard.
+                const int current = holder->outof();
+                const int newSize = std::max(
+                    kMinWriteTickets, static_cast<int>(current * targetLag / lag));
+                if (newSize >= current)
+                    return;
+
+                if (restoreTickets.load() == 0) {
+                    restoreTickets.store(current);
+                }
+
+                auto status = holder->resize(newSize);
+                if (!status.isOK()) {
+                    LOG(1) << "flow control could not shrink the write ticket pool to " << newSize
+                           << ": " << status;
+                    return;
+                }
+
+                log() << "flow control shrank the write ticket pool from " << current << " to "
+                      << newSize << "; majority commit lag is " << lag << "s (target " << targetLag
+                      << "s)";
+            } catch (const DBException& ex) {
+                if (!ErrorCodes::isShutdownError(ex.toStatus().code())) {
+                    warning() << "Periodic task to adjust write tickets for replication lag "
+                                 "failed! Caused by: "
+                              << ex.toStatus();
+                }
+            }
+        },
+        Seconds(1));
+
+    periodicRunner->scheduleJob(std::move(job));
+}
+
+}  // namespace mongo
@@ -66,6 +66,14 @@ StatusWith<Value> extractElementAlongNonArrayPath(const Document& doc, const Fie
  */
 BSONObj documentToBsonWithPaths(const Document&, const std::set<std::string>& paths);
 
+/**
+ * Like the above, but appends the extracted paths to 'outputBuilder' rather than returning a new
+ * object. This allows callers on a per-document hot path to reuse one builder's buffer.
+ */
+void documentToBsonWithPaths(const Document& input,
+                             const std::set<std::string>& paths,
+                             BSONObjBuilder* outputBuilder);
+
 /**
  * Extracts 'paths' from the input document to a flat document.
  *
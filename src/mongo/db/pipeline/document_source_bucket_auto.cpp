@@ -136,18 +136,28 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::populateSorter() {
             opts.tempDir = pExpCtx->tempDir;
         }
         const auto& valueCmp = pExpCtx->getValueComparator();
-        auto comparator = [valueCmp](const Sorter<Value, Document>::Data& lhs,
-                                     const Sorter<Value, Document>::Data& rhs) {
+        auto comparator = [valueCmp](const Sorter<Value, Value>::Data& lhs,
+                                     const Sorter<Value, Value>::Data& rhs) {
             return valueCmp.compare(lhs.first, rhs.first);
         };
 
-        _sorter.reset(Sorter<Value, Document>::make(opts, comparator));
+        _sorter.reset(Sorter<Value, Value>::make(opts, comparator));
     }
 
+    const size_t numAccumulators = _accumulatedFields.size();
     auto next = pSource->getNext();
     for (; next.isAdvanced(); next = pSource->getNext()) {
         auto nextDoc = next.releaseDocument();
-        _sorter->add(extractKey(nextDoc), nextDoc);
+
+        // Only the accumulated fields' input expressions are needed to populate the buckets, so
+        // evaluate them now and sort those values rather than the whole document.
+        vector<Value> accumulatorInputs;
+        accumulatorInputs.reserve(numAccumulators);
+        for (auto&& accumulatedField : _accumulatedFields) {
+            accumulatorInputs.push_back(accumulatedField.expression->evaluate(nextDoc));
+        }
+
+        _sorter->add(extractKey(nextDoc), Value(std::move(accumulatorInputs)));
         _nDocuments++;
     }
     return next;
@@ -184,14 +194,15 @@ Value DocumentSourceBucketAuto::extractKey(const Document& doc) {
     return key.missing() ? Value(BSONNULL) : std::move(key);
 }
 
-void DocumentSourceBucketAuto::addDocumentToBucket(const pair<Value, Document>& entry,
+void DocumentSourceBucketAuto::addDocumentToBucket(const pair<Value, Value>& entry,
                                                    Bucket& bucket) {
     invariant(pExpCtx->getValueComparator().evaluate(entry.first >= bucket._max));
     bucket._max = entry.first;
 
+    const vector<Value>& accumulatorInputs = entry.second.getArray();
     const size_t numAccumulators = _accumulatedFields.size();
     for (size_t k = 0; k < numAccumulators; k++) {
-        bucket._accums[k]->process(_accumulatedFields[k].expression->evaluate(entry.second), false);
+        bucket._accums[k]->process(accumulatorInputs[k], false);
     }
 }
 
@@ -215,14 +226,14 @@ void DocumentSourceBucketAuto::populateBuckets() {
         approxBucketSize = 1;
     }
 
-    boost::optional<pair<Value, Document>> firstEntryInNextBucket;
+    boost::optional<pair<Value, Value>> firstEntryInNextBucket;
 
     // Start creating and populating the buckets.
     for (int i = 0; i < _nBuckets; i++) {
         bool isLastBucket = (i == _nBuckets - 1);
 
         // Get the first value to place in this bucket.
-        pair<Value, Document> currentValue;
+        pair<Value, Value> currentValue;
         if (firstEntryInNextBucket) {
             currentValue = *firstEntryInNextBucket;
             firstEntryInNextBucket = boost::none;
@@ -257,8 +268,8 @@ void DocumentSourceBucketAuto::populateBuckets() {
                 }
             }
 
-            boost::optional<pair<Value, Document>> nextValue = _sortedInput->more()
-                ? boost::optional<pair<Value, Document>>(_sortedInput->next())
+            boost::optional<pair<Value, Value>> nextValue = _sortedInput->more()
+                ? boost::optional<pair<Value, Value>>(_sortedInput->next())
                 : boost::none;
 
             if (_granularityRounder) {
@@ -269,7 +280,7 @@ void DocumentSourceBucketAuto::populateBuckets() {
                        pExpCtx->getValueComparator().evaluate(boundaryValue > nextValue->first)) {
                     addDocumentToBucket(*nextValue, currentBucket);
                     nextValue = _sortedInput->more()
-                        ? boost::optional<pair<Value, Document>>(_sortedInput->next())
+                        ? boost::optional<pair<Value, Value>>(_sortedInput->next())
                         : boost::none;
                 }
                 if (nextValue) {
@@ -283,7 +294,7 @@ void DocumentSourceBucketAuto::populateBuckets() {
                                                               nextValue->first)) {
                     addDocumentToBucket(*nextValue, currentBucket);
                     nextValue = _sortedInput->more()
-                        ? boost::optional<pair<Value, Document>>(_sortedInput->next())
+                        ? boost::optional<pair<Value, Value>>(_sortedInput->next())
                         : boost::none;
                 }
             }
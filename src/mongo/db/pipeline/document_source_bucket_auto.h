@@ -132,9 +132,10 @@ private:
     void populateBuckets();
 
     /**
-     * Adds the document in 'entry' to 'bucket' by updating the accumulators in 'bucket'.
+     * Adds the entry to 'bucket' by feeding its pre-computed accumulator input values to the
+     * accumulators in 'bucket'.
      */
-    void addDocumentToBucket(const std::pair<Value, Document>& entry, Bucket& bucket);
+    void addDocumentToBucket(const std::pair<Value, Value>& entry, Bucket& bucket);
 
     /**
      * Adds 'newBucket' to _buckets and updates any boundaries if necessary.
@@ -147,8 +148,12 @@ private:
      */
     Document makeDocument(const Bucket& bucket);
 
-    std::unique_ptr<Sorter<Value, Document>> _sorter;
-    std::unique_ptr<Sorter<Value, Document>::Iterator> _sortedInput;
+    // The sorter is keyed by the 'groupBy' value. Rather than carrying whole input documents
+    // through the sort (and through any spill to disk), the sorted value is an array holding the
+    // evaluated input expression of each accumulated field, which is all that bucket population
+    // needs.
+    std::unique_ptr<Sorter<Value, Value>> _sorter;
+    std::unique_ptr<Sorter<Value, Value>::Iterator> _sortedInput;
 
     std::vector<AccumulationStatement> _accumulatedFields;
 
@@ -32,6 +32,13 @@
 
 #include "mongo/db/pipeline/document_source_change_stream_close_cursor.h"
 
+#include <algorithm>
+#include <iterator>
+#include <set>
+
+#include "mongo/db/pipeline/document_source_change_stream_transform.h"
+#include "mongo/db/pipeline/document_source_match.h"
+
 namespace mongo {
 
 namespace {
@@ -51,8 +58,123 @@ bool isInvalidatingCommand(const boost::intrusive_ptr<ExpressionContext>& pExpCt
     }
 };
 
+// Returns the set of 'operationType' values which the given $match query can accept, based on its
+// top-level predicates on that field. Returns boost::none if the query has no predicate on
+// 'operationType', or if its predicates are too complex to reason about here (anything other than
+// a string equality or a $in of strings).
+boost::optional<std::set<std::string>> extractRequestedOperationTypes(const BSONObj& query) {
+    boost::optional<std::set<std::string>> types;
+
+    for (auto&& elem : query) {
+        if (elem.fieldNameStringData() != DocumentSourceChangeStream::kOperationTypeField) {
+            continue;
+        }
+
+        std::set<std::string> current;
+        if (elem.type() == BSONType::String) {
+            current.insert(elem.str());
+        } else if (elem.type() == BSONType::Object && elem.embeddedObject().nFields() == 1) {
+            auto pred = elem.embeddedObject().firstElement();
+            if (pred.fieldNameStringData() == "$eq" && pred.type() == BSONType::String) {
+                current.insert(pred.str());
+            } else if (pred.fieldNameStringData() == "$in" && pred.type() == BSONType::Array) {
+                for (auto&& opType : pred.Array()) {
+                    if (opType.type() != BSONType::String) {
+                        return boost::none;
+                    }
+                    current.insert(opType.str());
+                }
+            } else {
+                return boost::none;
+            }
+        } else {
+            return boost::none;
+        }
+
+        if (!types) {
+            types = std::move(current);
+        } else {
+            // Multiple top-level predicates on 'operationType' are implicitly ANDed together.
+            std::set<std::string> intersection;
+            std::set_intersection(types->begin(),
+                                  types->end(),
+                                  current.begin(),
+                                  current.end(),
+                                  std::inserter(intersection, intersection.begin()));
+            types = std::move(intersection);
+        }
+    }
+
+    return types;
+}
+
 }  // namespace
 
+Pipeline::SourceContainer::iterator DocumentSourceCloseCursor::doOptimizeAt(
+    Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
+    invariant(*itr == this);
+
+    if (_rewroteOperationTypeFilter || std::next(itr) == container->end()) {
+        return std::next(itr);
+    }
+
+    auto nextMatch = dynamic_cast<DocumentSourceMatch*>(std::next(itr)->get());
+    if (!nextMatch || nextMatch->isTextQuery()) {
+        return std::next(itr);
+    }
+
+    auto requestedTypes = extractRequestedOperationTypes(nextMatch->getQuery());
+    if (!requestedTypes) {
+        return std::next(itr);
+    }
+
+    // Determine which CRUD oplog entries could produce one of the requested event types. Command
+    // and noop entries are never filtered out, since the invalidation machinery between the oplog
+    // scan and the user's $match must see them.
+    std::set<std::string> allowedCrudOps;
+    for (auto&& opType : *requestedTypes) {
+        if (opType == DocumentSourceChangeStream::kInsertOpType) {
+            allowedCrudOps.insert("i");
+        } else if (opType == DocumentSourceChangeStream::kUpdateOpType ||
+                   opType == DocumentSourceChangeStream::kReplaceOpType) {
+            // Both event types come from 'u' entries; they are distinguished only after the
+            // transformation.
+            allowedCrudOps.insert("u");
+        } else if (opType == DocumentSourceChangeStream::kDeleteOpType) {
+            allowedCrudOps.insert("d");
+        }
+        // All other event types are produced by command or noop entries, which always pass.
+    }
+
+    BSONArrayBuilder excludedCrudOps;
+    for (auto&& op : {"i", "u", "d"}) {
+        if (!allowedCrudOps.count(op)) {
+            excludedCrudOps.append(op);
+        }
+    }
+    if (excludedCrudOps.arrSize() == 0) {
+        // The $match accepts every CRUD event type; there is nothing to push down.
+        _rewroteOperationTypeFilter = true;
+        return std::next(itr);
+    }
+
+    // Insert the oplog-level filter just ahead of the transformation stage, so that rejected
+    // entries never pay the transformation cost.
+    auto transformItr = std::find_if(container->begin(), itr, [](const auto& stage) {
+        return nullptr != dynamic_cast<DocumentSourceChangeStreamTransform*>(stage.get());
+    });
+    if (transformItr == itr) {
+        return std::next(itr);
+    }
+
+    container->insert(
+        transformItr,
+        DocumentSourceMatch::create(BSON("op" << BSON("$nin" << excludedCrudOps.arr())), pExpCtx));
+    _rewroteOperationTypeFilter = true;
+
+    return std::next(itr);
+}
+
 DocumentSource::GetNextResult DocumentSourceCloseCursor::getNext() {
     pExpCtx->checkForInterrupt();
 
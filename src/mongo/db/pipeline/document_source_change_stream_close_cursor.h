@@ -76,6 +76,17 @@ public:
         return new DocumentSourceCloseCursor(expCtx);
     }
 
+    /**
+     * When immediately followed by a user $match with simple predicates on 'operationType',
+     * inserts a corresponding filter over raw oplog entries ahead of the change stream
+     * transformation stage, so that entries which cannot produce a requested event type are
+     * rejected before paying the transformation cost. The user's $match is left in place; the
+     * inserted filter only ever accepts a superset of the entries the $match would, and never
+     * rejects command or noop entries, which later internal stages need for invalidation.
+     */
+    Pipeline::SourceContainer::iterator doOptimizeAt(Pipeline::SourceContainer::iterator itr,
+                                                     Pipeline::SourceContainer* container) final;
+
     boost::intrusive_ptr<DocumentSource> getShardSource() final {
         return nullptr;
     }
@@ -94,6 +105,10 @@ private:
         : DocumentSource(expCtx) {}
 
     bool _shouldCloseCursor = false;
+
+    // Set once doOptimizeAt() has pushed an operation type filter down to the oplog scan, so that
+    // repeated optimization passes do not insert duplicate filters.
+    bool _rewroteOperationTypeFilter = false;
 };
 
 }  // namespace mongo
@@ -244,7 +244,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStreaming() {
 
 void DocumentSourceGroup::doDispose() {
     // Free our resources.
-    _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+    _groups = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
     _sorterIterator.reset();
 
     // Make us look done.
@@ -299,6 +299,16 @@ Value DocumentSourceGroup::serialize(boost::optional<ExplainOptions::Verbosity>
         insides["$doingMerge"] = Value(true);
     }
 
+    if (explain && *explain >= ExplainOptions::Verbosity::kExecStats) {
+        // A single merge pass over all spilled runs suffices, since the Sorter's merge iterator
+        // is multi-way.
+        insides["spills"] = Value(DOC("usedDisk" << _usedDisk << "spilledRuns" << _spilledRuns
+                                                 << "spilledBytes"
+                                                 << _spilledBytes
+                                                 << "mergePasses"
+                                                 << (_usedDisk ? 1LL : 0LL)));
+    }
+
     if (explain && findRelevantInputSort()) {
         return Value(DOC("$streamingGroup" << insides.freeze()));
     }
@@ -364,7 +374,7 @@ DocumentSourceGroup::DocumentSourceGroup(const intrusive_ptr<ExpressionContext>&
       _inputSort(BSONObj()),
       _streaming(false),
       _initialized(false),
-      _groups(pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()),
+      _groups(pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>()),
       _spilled(false),
       _allowDiskUse(pExpCtx->allowDiskUse && !pExpCtx->inMongos) {
     if (!pExpCtx->inMongos && (pExpCtx->allowDiskUse || kDebugBuild)) {
@@ -666,7 +676,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
                 }
 
                 // We won't be using groups again so free its memory.
-                _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+                _groups = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
 
                 _sorterIterator.reset(Sorter<Value, Value>::Iterator::merge(
                     _sortedFiles,
@@ -741,6 +751,8 @@ shared_ptr<Sorter<Value, Value>::Iterator> DocumentSourceGroup::spill() {
     _groups->clear();
 
     Sorter<Value, Value>::Iterator* iteratorPtr = writer.done();
+    ++_spilledRuns;
+    _spilledBytes += writer.getFileEndOffset() - _nextSortedFileWriterOffset;
     _nextSortedFileWriterOffset = writer.getFileEndOffset();
     return shared_ptr<Sorter<Value, Value>::Iterator>(iteratorPtr);
 }
@@ -90,7 +90,11 @@ private:
 class DocumentSourceGroup final : public DocumentSource, public NeedsMergerDocumentSource {
 public:
     using Accumulators = std::vector<boost::intrusive_ptr<Accumulator>>;
-    using GroupsMap = ValueUnorderedMap<Accumulators>;
+
+    // An open-addressing table is used here so that group rows (key and accumulator vector) live
+    // inline in the table's slots rather than in per-group heap nodes. No references into the map
+    // may be held across insertions.
+    using GroupsMap = ValueFlatUnorderedMap<Accumulators>;
 
     static constexpr StringData kStageName = "$group"_sd;
 
@@ -244,6 +248,8 @@ private:
     std::vector<AccumulationStatement> _accumulatedFields;
 
     bool _usedDisk;  // Keeps track of whether this $group spilled to disk.
+    long long _spilledRuns = 0;   // Number of sorted runs written to the spill file.
+    long long _spilledBytes = 0;  // Compressed bytes written to the spill file across all runs.
     bool _doingMerge;
     size_t _memoryUsageBytes = 0;
     size_t _maxMemoryUsageBytes;
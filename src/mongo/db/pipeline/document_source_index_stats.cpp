@@ -58,12 +58,18 @@ DocumentSource::GetNextResult DocumentSourceIndexStats::getNext() {
 
     if (_indexStatsIter != _indexStatsMap.end()) {
         const auto& stats = _indexStatsIter->second;
+        const auto now = Date_t::now();
         MutableDocument doc;
         doc["name"] = Value(_indexStatsIter->first);
         doc["key"] = Value(stats.indexKey);
         doc["host"] = Value(_processName);
-        doc["accesses"]["ops"] = Value(stats.accesses.loadRelaxed());
+        doc["accesses"]["ops"] = Value(stats.accesses.load());
         doc["accesses"]["since"] = Value(stats.trackerStartTime);
+        doc["accesses"]["opsLastHour"] = Value(stats.accessesInWindow(now, 1));
+        doc["accesses"]["opsLastDay"] = Value(stats.accessesInWindow(
+            now, CollectionIndexUsageTracker::IndexUsageStats::kNumHourlyBuckets));
+        doc["accesses"]["keysExamined"] = Value(stats.keysExamined.load());
+        doc["accesses"]["docsExamined"] = Value(stats.docsExamined.load());
         ++_indexStatsIter;
         return doc.freeze();
     }
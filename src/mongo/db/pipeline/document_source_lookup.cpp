@@ -65,6 +65,26 @@ std::string pipelineToString(const vector<BSONObj>& pipeline) {
     sb << "]";
     return sb.str();
 }
+
+/**
+ * Returns a Value identifying the foreign result set for 'input', for use as a key into the cache
+ * of previously computed foreign matches. Extracts the values of 'localFieldPath' exactly as
+ * makeMatchStageFromInput() does when constructing the foreign query, so two inputs map to the
+ * same key if and only if they produce the same foreign $match stage.
+ */
+Value extractJoinKey(const Document& input, const FieldPath& localFieldPath) {
+    std::vector<Value> localFieldList;
+    document_path_support::visitAllValuesAtPath(input, localFieldPath, [&](const Value& nextValue) {
+        localFieldList.push_back(nextValue);
+    });
+
+    if (localFieldList.empty()) {
+        // Missing values are treated as null.
+        localFieldList.push_back(Value(BSONNULL));
+    }
+
+    return Value(std::move(localFieldList));
+}
 }  // namespace
 
 constexpr size_t DocumentSourceLookUp::kMaxSubPipelineDepth;
@@ -248,7 +268,27 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
+    // When joining on localField/foreignField, the foreign matches are determined entirely by the
+    // values of the local field, so repeated join keys can be served from a cache of previously
+    // computed result sets rather than by re-executing the foreign sub-pipeline.
+    boost::optional<Value> joinKey;
     if (!wasConstructedWithPipelineSyntax()) {
+        joinKey.emplace(extractJoinKey(inputDoc, *_localField));
+
+        if (!_matchedDocumentCache) {
+            _matchedDocumentCache.emplace(pExpCtx->getValueComparator());
+        }
+        if (const auto* cachedMatches = (*_matchedDocumentCache)[*joinKey]) {
+            std::vector<Value> results;
+            results.reserve(cachedMatches->size());
+            for (auto&& doc : *cachedMatches) {
+                results.emplace_back(doc);
+            }
+            MutableDocument output(std::move(inputDoc));
+            output.setNestedField(_as, Value(std::move(results)));
+            return output.freeze();
+        }
+
         auto matchStage =
             makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
         // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
@@ -274,6 +314,18 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
             _usedDisk = true;
     }
 
+    if (joinKey) {
+        // Cache the complete result set (possibly empty) for this join key.
+        std::vector<Document> matchedDocs;
+        matchedDocs.reserve(results.size());
+        for (auto&& result : results) {
+            matchedDocs.push_back(result.getDocument());
+        }
+        _matchedDocumentCache->insertResultSet(std::move(*joinKey), std::move(matchedDocs));
+        _matchedDocumentCache->evictDownTo(
+            static_cast<size_t>(internalDocumentSourceLookupCacheSizeBytes.load()));
+    }
+
     MutableDocument output(std::move(inputDoc));
     output.setNestedField(_as, Value(std::move(results)));
     return output.freeze();
@@ -303,6 +303,12 @@ private:
     // from a cursor source.
     boost::optional<SequentialDocumentCache> _cache;
 
+    // For use when $lookup is specified with localField/foreignField syntax and has not absorbed a
+    // $unwind. Caches the complete set of foreign matches for recently seen join keys, so that
+    // repeated keys in the local collection are served without re-executing the foreign
+    // sub-pipeline. Evicted in LRU order down to 'internalDocumentSourceLookupCacheSizeBytes'.
+    boost::optional<LookupSetCache> _matchedDocumentCache;
+
     // The ExpressionContext used when performing aggregation pipelines against the '_resolvedNs'
     // namespace.
     boost::intrusive_ptr<ExpressionContext> _fromExpCtx;
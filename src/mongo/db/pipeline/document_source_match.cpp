@@ -87,13 +87,21 @@ DocumentSource::GetNextResult DocumentSourceMatch::getNext() {
     massert(17309, "Should never call getNext on a $match stage with $text clause", !_isTextQuery);
 
     auto nextInput = pSource->getNext();
+    BufBuilder matchBuffer;
     for (; nextInput.isAdvanced(); nextInput = pSource->getNext()) {
         // MatchExpression only takes BSON documents, so we have to make one. As an optimization,
-        // only serialize the fields we need to do the match.
-        BSONObj toMatch = _dependencies.needWholeDocument
-            ? nextInput.getDocument().toBson()
-            : document_path_support::documentToBsonWithPaths(nextInput.getDocument(),
-                                                             _dependencies.fields);
+        // only serialize the fields we need to do the match, and reuse one buffer across input
+        // documents rather than allocating a fresh BSONObj per document. The resulting object is
+        // only used within this loop iteration.
+        matchBuffer.reset();
+        BSONObjBuilder matchBuilder(matchBuffer);
+        if (_dependencies.needWholeDocument) {
+            nextInput.getDocument().toBson(&matchBuilder);
+        } else {
+            document_path_support::documentToBsonWithPaths(
+                nextInput.getDocument(), _dependencies.fields, &matchBuilder);
+        }
+        BSONObj toMatch = matchBuilder.done();
 
         if (_expression->matchesBSON(toMatch)) {
             return nextInput;
@@ -0,0 +1,98 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_query_shape_stats.h"
+
+#include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/server_options.h"
+#include "mongo/util/hex.h"
+#include "mongo/util/net/socket_utils.h"
+
+namespace mongo {
+
+using boost::intrusive_ptr;
+
+REGISTER_DOCUMENT_SOURCE(queryShapeStats,
+                         DocumentSourceQueryShapeStats::LiteParsed::parse,
+                         DocumentSourceQueryShapeStats::createFromBson);
+
+const char* DocumentSourceQueryShapeStats::getSourceName() const {
+    return "$queryShapeStats";
+}
+
+DocumentSource::GetNextResult DocumentSourceQueryShapeStats::getNext() {
+    pExpCtx->checkForInterrupt();
+
+    if (!_statsRetrieved) {
+        _shapeStats =
+            pExpCtx->mongoProcessInterface->getQueryShapeStats(pExpCtx->opCtx, pExpCtx->ns);
+        _shapeStatsIter = _shapeStats.begin();
+        _statsRetrieved = true;
+    }
+
+    if (_shapeStatsIter != _shapeStats.end()) {
+        const auto& stats = *_shapeStatsIter;
+        MutableDocument doc;
+        doc["queryHash"] = Value(unsignedIntToFixedLengthHex(stats.queryHash));
+        doc["representativeQuery"] = Value(stats.representativeQuery);
+        doc["host"] = Value(_processName);
+        doc["execStats"]["ops"] = Value(stats.ops);
+        doc["execStats"]["keysExamined"] = Value(stats.keysExamined);
+        doc["execStats"]["docsExamined"] = Value(stats.docsExamined);
+        doc["execStats"]["returned"] = Value(stats.returned);
+        doc["execStats"]["totalMicros"] = Value(stats.totalMicros);
+        doc["execStats"]["maxMicros"] = Value(stats.maxMicros);
+        doc["execStats"]["since"] = Value(stats.firstSeen);
+        ++_shapeStatsIter;
+        return doc.freeze();
+    }
+
+    return GetNextResult::makeEOF();
+}
+
+DocumentSourceQueryShapeStats::DocumentSourceQueryShapeStats(
+    const intrusive_ptr<ExpressionContext>& pExpCtx)
+    : DocumentSource(pExpCtx), _processName(getHostNameCachedAndPort()) {}
+
+intrusive_ptr<DocumentSource> DocumentSourceQueryShapeStats::createFromBson(
+    BSONElement elem, const intrusive_ptr<ExpressionContext>& pExpCtx) {
+    uassert(51770,
+            "The $queryShapeStats stage specification must be an empty object",
+            elem.type() == Object && elem.Obj().isEmpty());
+    return new DocumentSourceQueryShapeStats(pExpCtx);
+}
+
+Value DocumentSourceQueryShapeStats::serialize(
+    boost::optional<ExplainOptions::Verbosity> explain) const {
+    return Value(DOC(getSourceName() << Document()));
+}
+}  // namespace mongo
@@ -669,6 +669,21 @@ public:
     }
 };
 
+/** Strings spanning the inline short-string boundary of ValueStorage. */
+class StringAroundShortStringBoundary {
+public:
+    void run() {
+        // The maximum inline size is 14 bytes; exercise both sides of the boundary.
+        for (size_t len = 12; len <= 16; ++len) {
+            const string str(len, 'x');
+            Value value = Value(StringData(str));
+            ASSERT_EQUALS(str, value.getString());
+            ASSERT_EQUALS(mongo::String, value.getType());
+            assertRoundTrips(value);
+        }
+    }
+};
+
 /** String with a null character. */
 class StringWithNull {
 public:
@@ -1807,6 +1822,7 @@ public:
         add<Value::Long>();
         add<Value::Double>();
         add<Value::String>();
+        add<Value::StringAroundShortStringBoundary>();
         add<Value::StringWithNull>();
         add<Value::Date>();
         add<Value::JSTimestamp>();
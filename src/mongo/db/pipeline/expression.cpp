@@ -1156,6 +1156,13 @@ intrusive_ptr<Expression> ExpressionDateFromParts::optimize() {
         _timeZone = _timeZone->optimize();
     }
 
+    if (ExpressionConstant::isNullOrConstant(_timeZone)) {
+        // The timezone argument is constant, so we can parse it once here rather than once per
+        // document.
+        _parsedTimeZone =
+            makeTimeZone(getExpressionContext()->timeZoneDatabase, Document{}, _timeZone.get());
+    }
+
     if (ExpressionConstant::allNullOrConstant({_year,
                                                _month,
                                                _day,
@@ -1229,7 +1236,9 @@ Value ExpressionDateFromParts::evaluate(const Document& root) const {
         return Value(BSONNULL);
     }
 
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
 
     if (!timeZone) {
         return Value(BSONNULL);
@@ -1388,6 +1397,13 @@ intrusive_ptr<Expression> ExpressionDateFromString::optimize() {
         _onError = _onError->optimize();
     }
 
+    if (ExpressionConstant::isNullOrConstant(_timeZone)) {
+        // The timezone argument is constant, so we can parse it once here rather than once per
+        // document.
+        _parsedTimeZone =
+            makeTimeZone(getExpressionContext()->timeZoneDatabase, Document{}, _timeZone.get());
+    }
+
     if (ExpressionConstant::allNullOrConstant(
             {_dateString, _timeZone, _format, _onNull, _onError})) {
         // Everything is a constant, so we can turn into a constant.
@@ -1428,7 +1444,9 @@ Value ExpressionDateFromString::evaluate(const Document& root) const {
 
     // Evaluate the timezone parameter before checking for nullish input, as this will throw an
     // exception for an invalid timezone string.
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
 
     // Behavior for nullish input takes precedence over other nullish elements.
     if (dateString.nullish()) {
@@ -1547,6 +1565,13 @@ intrusive_ptr<Expression> ExpressionDateToParts::optimize() {
         _iso8601 = _iso8601->optimize();
     }
 
+    if (ExpressionConstant::isNullOrConstant(_timeZone)) {
+        // The timezone argument is constant, so we can parse it once here rather than once per
+        // document.
+        _parsedTimeZone =
+            makeTimeZone(getExpressionContext()->timeZoneDatabase, Document{}, _timeZone.get());
+    }
+
     if (ExpressionConstant::allNullOrConstant({_date, _iso8601, _timeZone})) {
         // Everything is a constant, so we can turn into a constant.
         return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
@@ -1585,7 +1610,9 @@ boost::optional<int> ExpressionDateToParts::evaluateIso8601Flag(const Document&
 Value ExpressionDateToParts::evaluate(const Document& root) const {
     const Value date = _date->evaluate(root);
 
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
     if (!timeZone) {
         return Value(BSONNULL);
     }
@@ -1701,6 +1728,13 @@ intrusive_ptr<Expression> ExpressionDateToString::optimize() {
         _format = _format->optimize();
     }
 
+    if (ExpressionConstant::isNullOrConstant(_timeZone)) {
+        // The timezone argument is constant, so we can parse it once here rather than once per
+        // document.
+        _parsedTimeZone =
+            makeTimeZone(getExpressionContext()->timeZoneDatabase, Document{}, _timeZone.get());
+    }
+
     if (ExpressionConstant::allNullOrConstant({_date, _format, _timeZone, _onNull})) {
         // Everything is a constant, so we can turn into a constant.
         return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
@@ -1740,7 +1774,9 @@ Value ExpressionDateToString::evaluate(const Document& root) const {
 
     // Evaluate the timezone parameter before checking for nullish input, as this will throw an
     // exception for an invalid timezone string.
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
 
     if (date.nullish()) {
         return _onNull ? _onNull->evaluate(root) : Value(BSONNULL);
@@ -1888,7 +1924,7 @@ void ExpressionObject::_doAddDependencies(DepsTracker* deps) const {
 }
 
 Value ExpressionObject::evaluate(const Document& root) const {
-    MutableDocument outputDoc;
+    MutableDocument outputDoc(_expressions.size());
     for (auto&& pair : _expressions) {
         outputDoc.addField(pair.first, pair.second->evaluate(root));
     }
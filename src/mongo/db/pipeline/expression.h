@@ -526,6 +526,9 @@ public:
         }
         auto date = dateVal.coerceToDate();
 
+        if (_parsedTimeZone) {
+            return evaluateDate(date, *_parsedTimeZone);
+        }
         if (!_timeZone) {
             return evaluateDate(date, TimeZoneDatabase::utcZone());
         }
@@ -565,6 +568,16 @@ public:
         if (_timeZone) {
             _timeZone = _timeZone->optimize();
         }
+        if (_timeZone && ExpressionConstant::isNullOrConstant(_timeZone)) {
+            // The timezone argument is constant, so we can look it up in the timezone database
+            // once here rather than once per document.
+            auto timeZoneId = _timeZone->evaluate(Document{});
+            if (timeZoneId.getType() == BSONType::String) {
+                invariant(getExpressionContext()->timeZoneDatabase);
+                _parsedTimeZone =
+                    getExpressionContext()->timeZoneDatabase->getTimeZone(timeZoneId.getString());
+            }
+        }
         if (ExpressionConstant::allNullOrConstant({_date, _timeZone})) {
             // Everything is a constant, so we can turn into a constant.
             return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
@@ -654,6 +667,8 @@ private:
     boost::intrusive_ptr<Expression> _date;
     // The expression representing the timezone argument, nullptr if not specified.
     boost::intrusive_ptr<Expression> _timeZone = nullptr;
+    // Pre-parsed timezone, if the above expression is a string constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionAbs final : public ExpressionSingleNumericArg<ExpressionAbs> {
@@ -907,6 +922,9 @@ private:
     boost::intrusive_ptr<Expression> _format;
     boost::intrusive_ptr<Expression> _onNull;
     boost::intrusive_ptr<Expression> _onError;
+
+    // Pre-parsed timezone, if the '_timeZone' expression is a constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateFromParts final : public Expression {
@@ -966,6 +984,9 @@ private:
     boost::intrusive_ptr<Expression> _isoWeek;
     boost::intrusive_ptr<Expression> _isoDayOfWeek;
     boost::intrusive_ptr<Expression> _timeZone;
+
+    // Pre-parsed timezone, if the '_timeZone' expression is a constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateToParts final : public Expression {
@@ -996,6 +1017,9 @@ private:
     boost::intrusive_ptr<Expression> _date;
     boost::intrusive_ptr<Expression> _timeZone;
     boost::intrusive_ptr<Expression> _iso8601;
+
+    // Pre-parsed timezone, if the '_timeZone' expression is a constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateToString final : public Expression {
@@ -1023,6 +1047,9 @@ private:
     boost::intrusive_ptr<Expression> _date;
     boost::intrusive_ptr<Expression> _timeZone;
     boost::intrusive_ptr<Expression> _onNull;
+
+    // Pre-parsed timezone, if the '_timeZone' expression is a constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDayOfMonth final : public DateExpressionAcceptingTimeZone<ExpressionDayOfMonth> {
@@ -123,6 +123,38 @@ public:
         _memoryUsage += docSize;
     }
 
+    /**
+     * Cache 'docs' (which may be empty) as the complete result set for "key", replacing any
+     * previously cached documents for that key. As with insert(), the entry is placed in the
+     * middle of the cache.
+     */
+    void insertResultSet(Value key, std::vector<Document> docs) {
+        size_t middle = size() / 2;
+        auto it = _container.begin();
+        std::advance(it, middle);
+        const auto keySize = key.getApproximateSize();
+
+        auto insertionResult = _container.insert(it, {std::move(key), {}});
+        if (insertionResult.second) {
+            _memoryUsage += keySize;
+        } else {
+            for (auto&& doc : insertionResult.first->second) {
+                const size_t docSize = doc.getApproximateSize();
+                invariant(docSize <= _memoryUsage);
+                _memoryUsage -= docSize;
+            }
+            _container.relocate(it, insertionResult.first);
+        }
+
+        for (auto&& doc : docs) {
+            _memoryUsage += doc.getApproximateSize();
+        }
+        _container.modify(insertionResult.first,
+                          [&docs](std::pair<Value, std::vector<Document>>& entry) {
+                              entry.second = std::move(docs);
+                          });
+    }
+
     /**
      * Evict the least-recently-used item.
      */
@@ -74,6 +74,27 @@ TEST(LookupSetCacheTest, InsertAndRetrieveWorksCorrectly) {
     ASSERT_FALSE(vectorContains(cache[Value(0)], intToDoc(5)));
 }
 
+TEST(LookupSetCacheTest, InsertResultSetWorksCorrectly) {
+    LookupSetCache cache(defaultComparator);
+    cache.insertResultSet(Value(0), {intToDoc(1), intToDoc(2)});
+    cache.insertResultSet(Value(1), {});
+
+    ASSERT(cache[Value(0)]);
+    ASSERT_TRUE(vectorContains(cache[Value(0)], intToDoc(1)));
+    ASSERT_TRUE(vectorContains(cache[Value(0)], intToDoc(2)));
+
+    // An empty result set is still a cache hit for its key.
+    ASSERT(cache[Value(1)]);
+    ASSERT_EQ(cache[Value(1)]->size(), 0U);
+
+    // Re-inserting a result set for a key replaces the previously cached documents.
+    cache.insertResultSet(Value(0), {intToDoc(3)});
+    ASSERT(cache[Value(0)]);
+    ASSERT_EQ(cache[Value(0)]->size(), 1U);
+    ASSERT_FALSE(vectorContains(cache[Value(0)], intToDoc(1)));
+    ASSERT_TRUE(vectorContains(cache[Value(0)], intToDoc(3)));
+}
+
 TEST(LookupSetCacheTest, CacheDoesEvictInExpectedOrder) {
     LookupSetCache cache(defaultComparator);
 
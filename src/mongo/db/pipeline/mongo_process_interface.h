@@ -40,6 +40,7 @@
 #include "mongo/base/shim.h"
 #include "mongo/client/dbclient_base.h"
 #include "mongo/db/collection_index_usage_tracker.h"
+#include "mongo/db/collection_query_shape_stats_tracker.h"
 #include "mongo/db/generic_cursor.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/namespace_string.h"
@@ -136,6 +137,9 @@ public:
     virtual CollectionIndexUsageMap getIndexStats(OperationContext* opCtx,
                                                   const NamespaceString& ns) = 0;
 
+    virtual CollectionQueryShapeStatsList getQueryShapeStats(OperationContext* opCtx,
+                                                             const NamespaceString& ns) = 0;
+
     /**
      * Appends operation latency statistics for collection "nss" to "builder"
      */
@@ -87,6 +87,11 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    CollectionQueryShapeStatsList getQueryShapeStats(OperationContext* opCtx,
+                                                     const NamespaceString& ns) final {
+        MONGO_UNREACHABLE;
+    }
+
     void appendLatencyStats(OperationContext* opCtx,
                             const NamespaceString& nss,
                             bool includeHistograms,
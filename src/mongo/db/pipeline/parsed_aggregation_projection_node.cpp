@@ -98,7 +98,9 @@ void ProjectionNode::applyProjections(const Document& inputDoc, MutableDocument*
     auto it = inputDoc.fieldIterator();
     while (it.more()) {
         auto fieldPair = it.next();
-        auto fieldName = fieldPair.first.toString();
+        // Look up the field by StringData to avoid copying the field name for every field of every
+        // input document; both containers support heterogeneous lookup.
+        auto fieldName = fieldPair.first;
         if (_projectedFields.count(fieldName)) {
             outputProjectedField(
                 fieldName, applyLeafProjectionToValue(fieldPair.second), outputDoc);
@@ -216,6 +216,19 @@ CollectionIndexUsageMap MongoInterfaceStandalone::getIndexStats(OperationContext
     return collection->infoCache()->getIndexUsageStats();
 }
 
+CollectionQueryShapeStatsList MongoInterfaceStandalone::getQueryShapeStats(
+    OperationContext* opCtx, const NamespaceString& ns) {
+    AutoGetCollectionForReadCommand autoColl(opCtx, ns);
+
+    Collection* collection = autoColl.getCollection();
+    if (!collection) {
+        LOG(2) << "Collection not found on query shape stats retrieval: " << ns.ns();
+        return CollectionQueryShapeStatsList();
+    }
+
+    return collection->infoCache()->getQueryShapeStats();
+}
+
 void MongoInterfaceStandalone::appendLatencyStats(OperationContext* opCtx,
                                                   const NamespaceString& nss,
                                                   bool includeHistograms,
@@ -70,6 +70,8 @@ public:
                 bool multi,
                 boost::optional<OID> targetEpoch) override;
     CollectionIndexUsageMap getIndexStats(OperationContext* opCtx, const NamespaceString& ns) final;
+    CollectionQueryShapeStatsList getQueryShapeStats(OperationContext* opCtx,
+                                                     const NamespaceString& ns) final;
     void appendLatencyStats(OperationContext* opCtx,
                             const NamespaceString& nss,
                             bool includeHistograms,
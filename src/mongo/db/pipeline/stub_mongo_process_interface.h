@@ -83,6 +83,11 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    CollectionQueryShapeStatsList getQueryShapeStats(OperationContext* opCtx,
+                                                     const NamespaceString& ns) override {
+        MONGO_UNREACHABLE;
+    }
+
     void appendLatencyStats(OperationContext* opCtx,
                             const NamespaceString& nss,
                             bool includeHistograms,
@@ -112,10 +112,9 @@ void ValueStorage::putString(StringData s) {
         shortStrSize = s.size();
         s.copyTo(shortStrStorage, false);  // no NUL
 
-        // All memory is zeroed before this is called, so we know that
-        // the nulTerminator field will definitely contain a NUL byte.
-        dassert(((sizeNoNUL < sizeof(shortStrStorage)) && (shortStrStorage[sizeNoNUL] == '\0')) ||
-                (((shortStrStorage + sizeNoNUL) == &nulTerminator) && (nulTerminator == '\0')));
+        // All memory is zeroed before this is called, so any unused tail of the storage
+        // (including the byte after a string shorter than the maximum) is already NUL.
+        dassert((sizeNoNUL == sizeof(shortStrStorage)) || (shortStrStorage[sizeNoNUL] == '\0'));
     } else {
         putRefCountable(RCString::create(s));
     }
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
 #include <map>
 #include <set>
 
@@ -184,6 +185,20 @@ public:
         return stdx::unordered_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
     }
 
+    /**
+     * Construct an empty open-addressing hash map from Value to type T whose equivalence classes
+     * are given by this comparator. This comparator must outlive the returned map.
+     *
+     * Unlike makeUnorderedValueMap(), entries are stored inline in the table rather than in
+     * individually allocated nodes, so no per-entry allocation is performed and iteration is
+     * cache-friendly. In exchange, references and iterators into the map are invalidated by any
+     * insertion. Prefer this map for large build-then-read workloads such as hash aggregation.
+     */
+    template <typename T>
+    absl::flat_hash_map<Value, T, Hasher, EqualTo> makeFlatUnorderedValueMap() const {
+        return absl::flat_hash_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
+    }
+
 private:
     const StringData::ComparatorInterface* _stringComparator = nullptr;
 };
@@ -204,4 +219,8 @@ template <typename T>
 using ValueUnorderedMap =
     stdx::unordered_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
 
+template <typename T>
+using ValueFlatUnorderedMap =
+    absl::flat_hash_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
+
 }  // namespace mongo
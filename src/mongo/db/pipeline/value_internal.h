@@ -318,22 +318,20 @@ public:
 
             // byte 2
             struct {
-                bool refCounter : 1;  // true if we need to refCount
-                bool shortStr : 1;    // true if we are using short strings
-                // reservedFlags: 6;
+                bool refCounter : 1;             // true if we need to refCount
+                bool shortStr : 1;               // true if we are using short strings
+                unsigned char shortStrSize : 4;  // only valid if shortStr; max is 14
+                // reservedFlags: 2;
             };
 
             // bytes 3-16;
             union {
                 unsigned char oid[12];
 
-                struct {
-                    char shortStrSize;  // TODO Consider moving into flags union (4 bits)
-                    char shortStrStorage[16 /*total bytes*/ - 3 /*offset*/ - 1 /*NUL byte*/];
-                    union {
-                        char nulTerminator;
-                    };
-                };
+                // Not necessarily NUL terminated: a string of the maximum inline size uses
+                // the full 14 bytes. Consumers go through getString(), which carries the
+                // length, so no terminator is needed.
+                char shortStrStorage[16 /*total bytes*/ - 2 /*offset*/];
 
                 struct {
                     union {
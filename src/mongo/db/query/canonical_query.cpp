@@ -257,6 +257,9 @@ void CanonicalQuery::setCollator(std::unique_ptr<CollatorInterface> collator) {
     // the object owned by '_collator'. We must associate the match expression tree with the new
     // value of '_collator'.
     _root->setCollator(_collator.get());
+
+    // The collation participates in the shape encoding, so any memoized key is now stale.
+    _cachedShapeString = boost::none;
 }
 
 // static
@@ -480,7 +483,10 @@ std::string CanonicalQuery::toStringShort() const {
 }
 
 CanonicalQuery::QueryShapeString CanonicalQuery::encodeKey() const {
-    return canonical_query_encoder::encode(*this);
+    if (!_cachedShapeString) {
+        _cachedShapeString = canonical_query_encoder::encode(*this);
+    }
+    return *_cachedShapeString;
 }
 
 }  // namespace mongo
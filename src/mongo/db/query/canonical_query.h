@@ -31,6 +31,8 @@
 #pragma once
 
 
+#include <boost/optional.hpp>
+
 #include "mongo/base/status.h"
 #include "mongo/db/dbmessage.h"
 #include "mongo/db/jsobj.h"
@@ -131,6 +133,11 @@ public:
     /**
      * Compute the "shape" of this query by encoding the match, projection and sort, and stripping
      * out the appropriate values.
+     *
+     * The encoding is memoized: the shape cannot change after canonicalization (setCollator()
+     * invalidates the memo, since the collation participates in the encoding), and the key is
+     * needed several times over a query's life -- index filter lookup, plan cache lookup, and
+     * plan cache feedback all recompute it today.
      */
     QueryShapeString encodeKey() const;
 
@@ -201,6 +208,10 @@ private:
 
     std::unique_ptr<CollatorInterface> _collator;
 
+    // Memoized result of encodeKey(). Computed lazily on first use and cleared by
+    // setCollator().
+    mutable boost::optional<QueryShapeString> _cachedShapeString;
+
     bool _canHaveNoopMatchNodes = false;
 };
 
@@ -33,7 +33,6 @@
 #include "mongo/db/query/collation/collator_interface_icu.h"
 
 #include <unicode/coll.h>
-#include <unicode/sortkey.h>
 
 #include "mongo/stdx/memory.h"
 #include "mongo/util/assert_util.h"
@@ -77,26 +76,36 @@ CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     StringData stringData) const {
     // A StringPiece is ICU's StringData. They are logically the same abstraction.
     const icu::StringPiece stringPiece(stringData.rawData(), stringData.size());
+    const icu::UnicodeString unicodeString = icu::UnicodeString::fromUTF8(stringPiece);
 
-    UErrorCode status = U_ZERO_ERROR;
-    icu::CollationKey icuKey;
-    _collator->getCollationKey(icu::UnicodeString::fromUTF8(stringPiece), icuKey, status);
+    // Generate the sort key directly into a stack buffer rather than through an icu::CollationKey
+    // object, which heap-allocates its byte array. The buffer is large enough for the keys of the
+    // short strings that dominate index and sort key generation; longer keys retry below with an
+    // exactly-sized heap buffer. The returned length includes the trailing null byte.
+    constexpr int32_t kStackBufferSize = 256;
+    uint8_t stackBuffer[kStackBufferSize];
+    const int32_t keyLength = _collator->getSortKey(unicodeString, stackBuffer, kStackBufferSize);
 
     // Any sequence of bytes, even invalid UTF-8, has defined comparison behavior in ICU (invalid
-    // subsequences are weighted as the replacement character, U+FFFD). A non-ok error code is only
-    // expected when a memory allocation fails inside ICU, which we consider fatal to the process.
-    fassert(34439, U_SUCCESS(status));
-
-    int32_t keyLength;
-    const uint8_t* keyBuffer = icuKey.getByteArray(keyLength);
-    invariant(keyLength > 0);
-    invariant(keyBuffer);
-
-    // The last byte of the sort key should always be null. When we construct the comparison key, we
-    // omit the trailing null byte.
-    invariant(keyBuffer[keyLength - 1u] == '\0');
-    const char* charBuffer = reinterpret_cast<const char*>(keyBuffer);
-    return makeComparisonKey(std::string(charBuffer, keyLength - 1u));
+    // subsequences are weighted as the replacement character, U+FFFD). A non-positive length is
+    // only expected when a memory allocation fails inside ICU, which we consider fatal to the
+    // process.
+    fassert(34439, keyLength > 0);
+
+    if (keyLength <= kStackBufferSize) {
+        // The last byte of the sort key should always be null. When we construct the comparison
+        // key, we omit the trailing null byte.
+        invariant(stackBuffer[keyLength - 1] == '\0');
+        return makeComparisonKey(
+            std::string(reinterpret_cast<const char*>(stackBuffer), keyLength - 1));
+    }
+
+    // The key did not fit in the stack buffer; regenerate it into a buffer of the required size.
+    auto heapBuffer = stdx::make_unique<uint8_t[]>(keyLength);
+    invariant(_collator->getSortKey(unicodeString, heapBuffer.get(), keyLength) == keyLength);
+    invariant(heapBuffer[keyLength - 1] == '\0');
+    return makeComparisonKey(
+        std::string(reinterpret_cast<const char*>(heapBuffer.get()), keyLength - 1));
 }
 
 }  // namespace mongo
@@ -35,6 +35,7 @@
 #include "mongo/db/query/cursor_response.h"
 
 #include "mongo/bson/bsontypes.h"
+#include "mongo/db/query/find_common.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 
 namespace mongo {
@@ -248,6 +249,16 @@ StatusWith<CursorResponse> CursorResponse::parseFromBSON(const BSONObj& cmdRespo
 
 void CursorResponse::addToBSON(CursorResponse::ResponseType responseType,
                                BSONObjBuilder* builder) const {
+    // The batch is serialized with one memcpy per document. Growing the buffer as the documents
+    // are appended can require several realloc+memcpy cycles for responses approaching the 16MB
+    // limit, so pre-grow it to the batch's total size, which is known up front.
+    int bytesToReserve = 0;
+    for (const BSONObj& obj : _batch) {
+        bytesToReserve += obj.objsize() + FindCommon::kPerDocumentOverheadBytesUpperBound;
+    }
+    builder->bb().reserveBytes(bytesToReserve);
+    builder->bb().claimReservedBytes(bytesToReserve);
+
     BSONObjBuilder cursorBuilder(builder->subobjStart(kCursorField));
 
     cursorBuilder.append(kIdField, _cursorId);
@@ -89,6 +89,22 @@ public:
         _numDocs++;
     }
 
+    /**
+     * Pre-grows the reply buffer so that 'bytesToReserve' more bytes may be appended without
+     * reallocating. Callers that buffer an entire batch before serializing it, as the mongos query
+     * paths do, know the batch's total size up front; reserving it once avoids the repeated
+     * realloc+memcpy cycles incurred by growing the buffer a document at a time.
+     */
+    void reserveReplyBuffer(int bytesToReserve) {
+        invariant(_active);
+        if (_options.useDocumentSequences) {
+            _docSeqBuilder->reserveBytes(bytesToReserve);
+        } else {
+            _batch->bb().reserveBytes(bytesToReserve);
+            _batch->bb().claimReservedBytes(bytesToReserve);
+        }
+    }
+
     void setLatestOplogTimestamp(Timestamp ts) {
         _latestOplogTimestamp = ts;
     }
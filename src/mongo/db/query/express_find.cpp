@@ -0,0 +1,120 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/query/express_find.h"
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/exec/idhack.h"
+#include "mongo/db/index/index_access_method.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/s/collection_sharding_state.h"
+
+namespace mongo {
+namespace express_find {
+
+const IndexDescriptor* getEligibleIdIndex(OperationContext* opCtx,
+                                          Collection* collection,
+                                          const CanonicalQuery& query) {
+    if (!collection) {
+        return nullptr;
+    }
+
+    // Everything the IDHACK plan itself requires: an _id equality with no hint, skip,
+    // showRecordId or tailability, under the collection's default collation.
+    if (!IDHackStage::supportsQuery(collection, query)) {
+        return nullptr;
+    }
+
+    // The express path serializes the full document straight into the reply, so any projection
+    // (including returnKey) needs the stage tree.
+    const QueryRequest& qr = query.getQueryRequest();
+    if (query.getProj() || qr.returnKey()) {
+        return nullptr;
+    }
+
+    if (!qr.getSort().isEmpty() || !qr.getMin().isEmpty() || !qr.getMax().isEmpty() ||
+        qr.isOplogReplay()) {
+        return nullptr;
+    }
+
+    // A batchSize of zero asks for an empty first batch and a cursor to iterate; the express
+    // path never leaves a cursor behind.
+    if (qr.getBatchSize() && *qr.getBatchSize() == 0) {
+        return nullptr;
+    }
+
+    // Sharded collections need the shard filtering stage to drop orphaned documents.
+    if (CollectionShardingState::get(opCtx, query.nss())
+            ->getMetadataForOperation(opCtx)
+            ->isSharded()) {
+        return nullptr;
+    }
+
+    // Profiling reports the winning plan's execution stats, which only a stage tree provides.
+    if (CurOp::get(opCtx)->shouldDBProfile()) {
+        return nullptr;
+    }
+
+    return collection->getIndexCatalog()->findIdIndex(opCtx);
+}
+
+boost::optional<BSONObj> findById(OperationContext* opCtx,
+                                  Collection* collection,
+                                  const IndexDescriptor* descriptor,
+                                  const CanonicalQuery& query) {
+    invariant(descriptor);
+    const IndexAccessMethod* accessMethod =
+        collection->getIndexCatalog()->getEntry(descriptor)->accessMethod();
+    const BSONObj key = query.getQueryObj()["_id"].wrap();
+
+    return writeConflictRetry(
+        opCtx, "express find", query.ns(), [&]() -> boost::optional<BSONObj> {
+            RecordId recordId = accessMethod->findSingle(opCtx, key);
+            if (recordId.isNull()) {
+                return boost::none;
+            }
+
+            Snapshotted<BSONObj> doc;
+            if (!collection->findDoc(opCtx, recordId, &doc)) {
+                // The index pointed at a record that no longer exists.
+                return boost::none;
+            }
+
+            return doc.value();
+        });
+}
+
+}  // namespace express_find
+}  // namespace mongo
@@ -0,0 +1,75 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+class CanonicalQuery;
+class Collection;
+class IndexDescriptor;
+class OperationContext;
+
+/**
+ * The express find path answers an equality point read on _id with a single seek of the default
+ * _id index and a single record store fetch, without building a PlanStage tree, WorkingSet, or
+ * PlanExecutor. Callers are expected to fall back to the regular executor machinery whenever a
+ * query isn't express-eligible.
+ */
+namespace express_find {
+
+/**
+ * Returns the _id index descriptor if 'query' against 'collection' can be answered by the
+ * express path, or nullptr if it needs the regular executor machinery. A query is eligible when
+ * it is an IDHACK-compatible _id equality with no projection, sort, or other options that
+ * require a stage tree, the collection is unsharded, and profiling doesn't need execution
+ * stats from a stage tree.
+ */
+const IndexDescriptor* getEligibleIdIndex(OperationContext* opCtx,
+                                          Collection* collection,
+                                          const CanonicalQuery& query);
+
+/**
+ * Performs the point read for an express-eligible query: one index seek through 'descriptor'
+ * and one record store fetch, retrying on write conflict. Returns the matching document, or
+ * boost::none if there is no match. Must be called while holding the locks and snapshot under
+ * which eligibility was determined.
+ */
+boost::optional<BSONObj> findById(OperationContext* opCtx,
+                                  Collection* collection,
+                                  const IndexDescriptor* descriptor,
+                                  const CanonicalQuery& query);
+
+}  // namespace express_find
+}  // namespace mongo
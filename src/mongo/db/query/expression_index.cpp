@@ -211,7 +211,12 @@ void ExpressionMapping::S2CellIdsToIntervalsWithParents(const std::vector<S2Cell
             // coarsestIndexedLevel - this can result in S2 failures when level < 0.
 
             coveredCell = coveredCell.parent();
-            exactSet.insert(coveredCell);
+            if (!exactSet.insert(coveredCell).second) {
+                // The parent is already present, so all of its ancestors are too. Cells in the
+                // covering share ancestors as soon as they are siblings, so this cuts the walk
+                // from O(cells * depth) insertions to one shared chain per subtree.
+                break;
+            }
         }
     }
 
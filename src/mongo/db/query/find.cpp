@@ -150,7 +150,18 @@ void endQueryOp(OperationContext* opCtx,
     curOp->debug().setPlanSummaryMetrics(summaryStats);
 
     if (collection) {
-        collection->infoCache()->notifyOfQuery(opCtx, summaryStats.indexesUsed);
+        collection->infoCache()->notifyOfQuery(opCtx, summaryStats);
+
+        // Record per-shape execution statistics when the planner computed a query hash.
+        if (auto queryHash = curOp->debug().queryHash) {
+            collection->infoCache()->notifyOfQueryShape(
+                *queryHash,
+                curOp->opDescription(),
+                summaryStats.totalKeysExamined,
+                summaryStats.totalDocsExamined,
+                numResults,
+                durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()));
+        }
     }
 
     if (curOp->shouldDBProfile()) {
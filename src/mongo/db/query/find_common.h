@@ -88,6 +88,13 @@ public:
     // The initial size of the query response buffer.
     static const int kInitReplyBufferSize = 32768;
 
+    // We must allow some amount of overhead per result document, since when we make a cursor
+    // response the documents are elements of a BSONArray. The overhead is 1 byte/doc for the type
+    // + 1 byte/doc for the field name's null terminator + 1 byte per digit in the array index. The
+    // index can be no more than 8 decimal digits since the response is at most 16MB, and
+    // 16 * 1024 * 1024 < 1 * 10^8.
+    static const int kPerDocumentOverheadBytesUpperBound = 10;
+
     /**
      * Returns true if the batchSize for the initial find has been satisfied.
      *
@@ -435,6 +435,7 @@ StatusWith<PrepareExecutionResult> prepareExecution(OperationContext* opCtx,
                                                     canonicalQuery.get(),
                                                     plannerParams,
                                                     cs->decisionWorks,
+                                                    cs->plannerData,
                                                     rawRoot);
                 return PrepareExecutionResult(
                     std::move(canonicalQuery), std::move(querySolution), std::move(root));
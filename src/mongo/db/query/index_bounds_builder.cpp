@@ -919,10 +919,23 @@ void IndexBoundsBuilder::translateRegex(const RegexMatchExpression* rme,
                                         const IndexEntry& index,
                                         OrderedIntervalList* oilOut,
                                         BoundsTightness* tightnessOut) {
-    const string start =
-        simpleRegex(rme->getString().c_str(), rme->getFlags().c_str(), index, tightnessOut);
+    string start;
+    if (index.collator) {
+        // simpleRegex() can never produce a prefix over a collated index, so there is no
+        // analysis worth caching.
+        start = simpleRegex(rme->getString().c_str(), rme->getFlags().c_str(), index, tightnessOut);
+    } else if (const auto& analysis = rme->getBoundsAnalysis()) {
+        // The prefix analysis depends only on the pattern and flags, both fixed for the
+        // lifetime of the node, so reuse the result computed for an earlier candidate plan.
+        start = analysis->prefix;
+        *tightnessOut = analysis->prefixIsExact ? IndexBoundsBuilder::EXACT
+                                                : IndexBoundsBuilder::INEXACT_COVERED;
+    } else {
+        start = simpleRegex(rme->getString().c_str(), rme->getFlags().c_str(), index, tightnessOut);
+        rme->setBoundsAnalysis({start, IndexBoundsBuilder::EXACT == *tightnessOut});
+    }
 
-    // Note that 'tightnessOut' is set by simpleRegex above.
+    // Note that 'tightnessOut' is set above.
     if (!start.empty()) {
         string end = start;
         end[end.size() - 1]++;
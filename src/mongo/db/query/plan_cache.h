@@ -31,6 +31,7 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <set>
 
 #include "mongo/db/exec/plan_stats.h"
@@ -40,6 +41,7 @@
 #include "mongo/db/query/plan_cache_indexability.h"
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/adaptive_mutex.h"
 #include "mongo/stdx/mutex.h"
 
 namespace mongo {
@@ -248,8 +250,10 @@ public:
     CachedSolution(const PlanCacheKey& key, const PlanCacheEntry& entry);
     ~CachedSolution();
 
-    // Owned here.
-    std::vector<SolutionCacheData*> plannerData;
+    // Shared immutably with the cache entry this solution was created from (and any other
+    // CachedSolutions for the same entry), so handing out a cached solution doesn't deep-copy
+    // the solution trees.
+    std::vector<std::shared_ptr<const SolutionCacheData>> plannerData;
 
     // Key used to provide feedback on the entry.
     PlanCacheKey key;
@@ -304,9 +308,10 @@ public:
     //
 
     // Data provided to the planner to allow it to recreate the solutions this entry
-    // represents. Each SolutionCacheData is fully owned here, so in order to return
-    // it from the cache a deep copy is made and returned inside CachedSolution.
-    std::vector<SolutionCacheData*> plannerData;
+    // represents. Immutable once the entry is constructed, and shared with every
+    // CachedSolution returned from the cache, so get() doesn't clone the solution trees
+    // while holding the cache mutex.
+    std::vector<std::shared_ptr<const SolutionCacheData>> plannerData;
 
     // TODO: Do we really want to just hold a copy of the CanonicalQuery?  For now we just
     // extract the data we need.
@@ -547,7 +552,7 @@ private:
     LRUKeyValue<PlanCacheKey, PlanCacheEntry, PlanCacheKeyHasher> _cache;
 
     // Protects _cache.
-    mutable stdx::mutex _cacheMutex;
+    mutable AdaptiveMutex _cacheMutex;
 
     // Full namespace of collection.
     std::string _ns;
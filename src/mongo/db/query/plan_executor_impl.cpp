@@ -54,6 +54,7 @@
 #include "mongo/db/query/plan_yield_policy.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/stats/operation_trace.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
@@ -399,6 +400,7 @@ void PlanExecutorImpl::reattachToOperationContext(OperationContext* opCtx) {
 }
 
 PlanExecutor::ExecState PlanExecutorImpl::getNext(BSONObj* objOut, RecordId* dlOut) {
+    OPERATION_TRACE_SPAN("PlanExecutorImpl::getNext");
     Snapshotted<BSONObj> snapshotted;
     ExecState state = _getNextImpl(objOut ? &snapshotted : NULL, dlOut);
 
@@ -56,6 +56,8 @@ PlanYieldPolicy::PlanYieldPolicy(PlanExecutor* exec, PlanExecutor::YieldPolicy p
       _elapsedTracker(exec->getOpCtx()->getServiceContext()->getFastClockSource(),
                       internalQueryExecYieldIterations.load(),
                       Milliseconds(internalQueryExecYieldPeriodMS.load())),
+      _fastClock(exec->getOpCtx()->getServiceContext()->getFastClockSource()),
+      _yieldFreeCyclesRemaining(internalQueryExecYieldFreeIterations.load()),
       _planYielding(exec) {}
 
 
@@ -65,6 +67,8 @@ PlanYieldPolicy::PlanYieldPolicy(PlanExecutor::YieldPolicy policy, ClockSource*
       _elapsedTracker(cs,
                       internalQueryExecYieldIterations.load(),
                       Milliseconds(internalQueryExecYieldPeriodMS.load())),
+      _fastClock(cs),
+      _yieldFreeCyclesRemaining(internalQueryExecYieldFreeIterations.load()),
       _planYielding(nullptr) {}
 
 bool PlanYieldPolicy::shouldYieldOrInterrupt() {
@@ -80,6 +84,23 @@ bool PlanYieldPolicy::shouldYield() {
     invariant(!_planYielding->getOpCtx()->lockState()->inAWriteUnitOfWork());
     if (_forceYield)
         return true;
+
+    // During the yield-free startup phase we don't pay for a save/restore cycle on iteration
+    // count alone; only the elapsed-time escape hatch applies. A plan that finishes within one
+    // yield period never yields at all.
+    if (_policy == PlanExecutor::YIELD_AUTO && _yieldFreeCyclesRemaining > 0) {
+        if (_yieldFreeStart == Date_t()) {
+            _yieldFreeStart = _fastClock->now();
+        }
+        --_yieldFreeCyclesRemaining;
+        if (_fastClock->now() - _yieldFreeStart <=
+            Milliseconds(internalQueryExecYieldPeriodMS.load())) {
+            return false;
+        }
+        // The plan is long-running after all. Switch to the yielding regime for good.
+        _yieldFreeCyclesRemaining = 0;
+    }
+
     return _elapsedTracker.intervalHasElapsed();
 }
 
@@ -141,6 +141,18 @@ private:
     bool _forceYield;
     ElapsedTracker _elapsedTracker;
 
+    // Used to check the elapsed-time escape hatch during the yield-free startup phase.
+    ClockSource* const _fastClock;
+
+    // While positive, a YIELD_AUTO plan doesn't yield on iteration count alone; only the
+    // elapsed-time trigger applies. Once the budget is spent or the time trigger fires, the
+    // plan is considered long-running and follows the normal yielding regime for the rest of
+    // its life.
+    int32_t _yieldFreeCyclesRemaining;
+
+    // When the yield-free startup phase began. Set lazily on the first "should yield?" check.
+    Date_t _yieldFreeStart;
+
     // The plan executor which this yield policy is responsible for yielding. Must
     // not outlive the plan executor.
     PlanExecutor* const _planYielding;
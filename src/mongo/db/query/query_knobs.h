@@ -50,6 +50,16 @@ extern AtomicDouble internalQueryPlanEvaluationCollFraction;
 // Stop working plans once a plan returns this many results.
 extern AtomicInt32 internalQueryPlanEvaluationMaxResults;
 
+// Number of consecutive work() calls given to each candidate plan per round-robin round during
+// multi-planning. Larger values reduce per-work overhead (yield checks, candidate switching) at
+// the cost of comparing candidates at a coarser granularity.
+extern AtomicInt32 internalQueryPlanEvaluationWorksPerRound;
+
+// When positive, the planner statically scores the index assignments produced by plan
+// enumeration and only builds query solutions for this many of the most promising ones, rather
+// than trialing every enumerated candidate. 0 (the default) disables static pruning.
+extern AtomicInt32 internalQueryPlannerMaxRankedCandidates;
+
 // Do we give a big ranking bonus to intersection plans?
 extern AtomicBool internalQueryForceIntersectionPlans;
 
@@ -122,6 +132,15 @@ extern AtomicInt32 internalQueryExecYieldIterations;
 // Yield if it's been at least this many milliseconds since we last yielded.
 extern AtomicInt32 internalQueryExecYieldPeriodMS;
 
+// Auto-yielding plans suppress the iteration-count yield trigger for this many initial work
+// cycles; only the elapsed-time trigger applies until the plan proves to be long-running. 0
+// disables the yield-free startup phase.
+extern AtomicInt32 internalQueryExecYieldFreeIterations;
+
+// Number of child results a FETCH stage buffers so it can perform the outstanding record
+// lookups in RecordId order.  1 (the default) fetches one document per work cycle.
+extern AtomicInt32 internalQueryFetchBatchSize;
+
 // Limit the size that we write without yielding to 16MB / 64 (max expected number of indexes)
 const int64_t insertVectorMaxBytes = 256 * 1024;
 
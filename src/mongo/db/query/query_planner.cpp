@@ -34,7 +34,9 @@
 
 #include "mongo/db/query/query_planner.h"
 
+#include <algorithm>
 #include <boost/optional.hpp>
+#include <utility>
 #include <vector>
 
 #include "mongo/base/string_data.h"
@@ -44,12 +46,14 @@
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/matcher/expression_geo.h"
+#include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/matcher/expression_text.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/collation/collation_index_key.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/plan_enumerator.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/db/query/planner_access.h"
 #include "mongo/db/query/planner_analysis.h"
 #include "mongo/db/query/planner_ixselect.h"
@@ -87,6 +91,44 @@ static bool is2DIndex(const BSONObj& pattern) {
     return false;
 }
 
+/**
+ * Returns a cheap static "promise" score for an enumerated index assignment. The score is only
+ * meaningful relative to scores of other assignments for the same query: it rewards predicates
+ * that use an index at all, predicates on the leading index field (prefix coverage), and
+ * equality-like predicates, which produce point bounds. This is not a cost model; it is only
+ * used to decide which enumerated candidates to keep when static pruning is enabled via
+ * 'internalQueryPlannerMaxRankedCandidates'.
+ */
+static double scoreTaggedTree(const MatchExpression* node) {
+    const MatchExpression::TagData* tag = node->getTag();
+    const IndexTag* itag = nullptr;
+    if (tag && MatchExpression::TagData::Type::IndexTag == tag->getType()) {
+        itag = static_cast<const IndexTag*>(tag);
+    } else if (tag && MatchExpression::TagData::Type::OrPushdownTag == tag->getType()) {
+        const OrPushdownTag* orPushdownTag = static_cast<const OrPushdownTag*>(tag);
+        if (orPushdownTag->getIndexTag()) {
+            itag = static_cast<const IndexTag*>(orPushdownTag->getIndexTag());
+        }
+    }
+
+    double score = 0;
+    if (itag && IndexTag::kNoIndex != itag->index) {
+        score += 1;
+        if (0 == itag->pos) {
+            score += 1;
+        }
+        if (ComparisonMatchExpressionBase::isEquality(node->matchType()) ||
+            MatchExpression::MATCH_IN == node->matchType()) {
+            score += 1;
+        }
+    }
+
+    for (size_t i = 0; i < node->numChildren(); ++i) {
+        score += scoreTaggedTree(node->getChild(i));
+    }
+    return score;
+}
+
 string optionString(size_t options) {
     mongoutils::str::stream ss;
 
@@ -443,23 +485,28 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCache(
     const CachedSolution& cachedSoln) {
     invariant(!cachedSoln.plannerData.empty());
 
+    // Look up winning solution in cached solution's array.
+    return planFromCacheData(query, params, *cachedSoln.plannerData[0]);
+}
+
+StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCacheData(
+    const CanonicalQuery& query,
+    const QueryPlannerParams& params,
+    const SolutionCacheData& solnCacheData) {
     // A query not suitable for caching should not have made its way into the cache.
     invariant(PlanCache::shouldCacheQuery(query));
 
-    // Look up winning solution in cached solution's array.
-    const SolutionCacheData& winnerCacheData = *cachedSoln.plannerData[0];
-
-    if (SolutionCacheData::WHOLE_IXSCAN_SOLN == winnerCacheData.solnType) {
+    if (SolutionCacheData::WHOLE_IXSCAN_SOLN == solnCacheData.solnType) {
         // The solution can be constructed by a scan over the entire index.
         auto soln = buildWholeIXSoln(
-            *winnerCacheData.tree->entry, query, params, winnerCacheData.wholeIXSolnDir);
+            *solnCacheData.tree->entry, query, params, solnCacheData.wholeIXSolnDir);
         if (!soln) {
             return Status(ErrorCodes::BadValue,
                           "plan cache error: soln that uses index to provide sort");
         } else {
             return {std::move(soln)};
         }
-    } else if (SolutionCacheData::COLLSCAN_SOLN == winnerCacheData.solnType) {
+    } else if (SolutionCacheData::COLLSCAN_SOLN == solnCacheData.solnType) {
         // The cached solution is a collection scan. We don't cache collscans
         // with tailable==true, hence the false below.
         auto soln = buildCollscanSoln(query, false, params);
@@ -474,13 +521,14 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCache(
     // If we're here then this is neither the whole index scan or collection scan
     // cases, and we proceed by using the PlanCacheIndexTree to tag the query tree.
 
-    // Create a copy of the expression tree.  We use cachedSoln to annotate this with indices.
+    // Create a copy of the expression tree.  We use the cached data to annotate this with
+    // indices.
     unique_ptr<MatchExpression> clone = query.root()->shallowClone();
 
     LOG(5) << "Tagging the match expression according to cache data: " << endl
            << "Filter:" << endl
            << redact(clone->toString()) << "Cache data:" << endl
-           << redact(winnerCacheData.toString());
+           << redact(solnCacheData.toString());
 
     stdx::unordered_set<string> fields;
     QueryPlannerIXSelect::getFields(query.root(), &fields);
@@ -497,7 +545,7 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCache(
         LOG(5) << "Index " << i << ": " << ie.identifier;
     }
 
-    Status s = tagAccordingToCache(clone.get(), winnerCacheData.tree.get(), indexMap);
+    Status s = tagAccordingToCache(clone.get(), solnCacheData.tree.get(), indexMap);
     if (!s.isOK()) {
         return s;
     }
@@ -791,15 +839,14 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
         PlanEnumerator isp(enumParams);
         isp.init().transitional_ignore();
 
-        unique_ptr<MatchExpression> nextTaggedTree;
-        while ((nextTaggedTree = isp.getNext()) && (out.size() < params.maxIndexedSolutions)) {
+        auto buildSolutionFromTaggedTree = [&](unique_ptr<MatchExpression> taggedTree) {
             LOG(5) << "About to build solntree from tagged tree:" << endl
-                   << redact(nextTaggedTree->toString());
+                   << redact(taggedTree->toString());
 
             // Store the plan cache index tree before calling prepareForAccessingPlanning(), so that
             // the PlanCacheIndexTree has the same sort as the MatchExpression used to generate the
             // plan cache key.
-            std::unique_ptr<MatchExpression> clone(nextTaggedTree->shallowClone());
+            std::unique_ptr<MatchExpression> clone(taggedTree->shallowClone());
             std::unique_ptr<PlanCacheIndexTree> cacheData;
             auto statusWithCacheData = cacheDataFromTaggedTree(clone.get(), relevantIndices);
             if (!statusWithCacheData.isOK()) {
@@ -811,14 +858,14 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
 
             // We have already cached the tree in canonical order, so now we can order the nodes for
             // access planning.
-            prepareForAccessPlanning(nextTaggedTree.get());
+            prepareForAccessPlanning(taggedTree.get());
 
             // This can fail if enumeration makes a mistake.
             std::unique_ptr<QuerySolutionNode> solnRoot(QueryPlannerAccess::buildIndexedDataAccess(
-                query, std::move(nextTaggedTree), relevantIndices, params));
+                query, std::move(taggedTree), relevantIndices, params));
 
             if (!solnRoot) {
-                continue;
+                return;
             }
 
             auto soln = QueryPlannerAnalysis::analyzeDataAccess(query, params, std::move(solnRoot));
@@ -831,6 +878,51 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
                 }
                 out.push_back(std::move(soln));
             }
+        };
+
+        unique_ptr<MatchExpression> nextTaggedTree;
+        const size_t maxRankedCandidates =
+            static_cast<size_t>(internalQueryPlannerMaxRankedCandidates.load());
+        if (0 == maxRankedCandidates) {
+            while ((nextTaggedTree = isp.getNext()) && (out.size() < params.maxIndexedSolutions)) {
+                buildSolutionFromTaggedTree(std::move(nextTaggedTree));
+            }
+        } else {
+            // Static pruning: gather the enumerated assignments first, then build solutions
+            // only for the most promising ones so that multi-planning trials a smaller set.
+            std::vector<unique_ptr<MatchExpression>> taggedTrees;
+            while ((nextTaggedTree = isp.getNext()) &&
+                   (taggedTrees.size() < params.maxIndexedSolutions)) {
+                taggedTrees.push_back(std::move(nextTaggedTree));
+            }
+
+            if (taggedTrees.size() > maxRankedCandidates) {
+                std::vector<std::pair<double, unique_ptr<MatchExpression>>> scoredTrees;
+                scoredTrees.reserve(taggedTrees.size());
+                for (auto& taggedTree : taggedTrees) {
+                    scoredTrees.emplace_back(scoreTaggedTree(taggedTree.get()),
+                                             std::move(taggedTree));
+                }
+                // Stable so that equally scored candidates keep their enumeration order.
+                std::stable_sort(scoredTrees.begin(),
+                                 scoredTrees.end(),
+                                 [](const std::pair<double, unique_ptr<MatchExpression>>& lhs,
+                                    const std::pair<double, unique_ptr<MatchExpression>>& rhs) {
+                                     return lhs.first > rhs.first;
+                                 });
+
+                LOG(5) << "Planner: static pruning kept " << maxRankedCandidates << " of "
+                       << scoredTrees.size() << " enumerated candidates";
+
+                taggedTrees.clear();
+                for (size_t ix = 0; ix < maxRankedCandidates; ++ix) {
+                    taggedTrees.push_back(std::move(scoredTrees[ix].second));
+                }
+            }
+
+            for (auto& taggedTree : taggedTrees) {
+                buildSolutionFromTaggedTree(std::move(taggedTree));
+            }
         }
     }
 
@@ -39,6 +39,7 @@ namespace mongo {
 
 class CachedSolution;
 class Collection;
+struct SolutionCacheData;
 
 /**
  * QueryPlanner's job is to provide an entry point to the query planning and optimization
@@ -68,6 +69,20 @@ public:
         const QueryPlannerParams& params,
         const CachedSolution& cachedSoln);
 
+    /**
+     * Generates and returns a query solution from the cached data for a single plan. Used by
+     * planFromCache() for a cache entry's winning plan, and by the CachedPlanStage to rebuild
+     * a cached runner-up plan without re-enumerating the plan space.
+     *
+     * @param query -- query for which we are generating a plan
+     * @param params -- planning parameters
+     * @param solnCacheData -- the cached data for one plan, as stored in a PlanCacheEntry.
+     */
+    static StatusWith<std::unique_ptr<QuerySolution>> planFromCacheData(
+        const CanonicalQuery& query,
+        const QueryPlannerParams& params,
+        const SolutionCacheData& solnCacheData);
+
     /**
      * Generates and returns the index tag tree that will be inserted into the plan cache. This data
      * gets stashed inside a QuerySolution until it can be inserted into the cache proper.
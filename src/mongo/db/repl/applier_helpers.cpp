@@ -38,9 +38,15 @@
 #include <iterator>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/db_raii.h"
 #include "mongo/db/query/query_knobs.h"
+#include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/oplog_entry.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/sync_tail.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 
@@ -55,8 +61,20 @@ const auto kInsertGroupMaxBatchSize = insertVectorMaxBytes;
 // Limit number of ops in a single group.
 constexpr auto kInsertGroupMaxBatchCount = 64;
 
+// Limits on the number of ops and the total oplog entry bytes covered by a single grouped storage
+// transaction when applying updates and deletes.
+constexpr auto kCrudGroupMaxBatchCount = 64;
+constexpr auto kCrudGroupMaxBatchSize = 256 * 1024;
+
+bool isGroupableCrudOpType(OpTypeEnum opType) {
+    return opType == OpTypeEnum::kUpdate || opType == OpTypeEnum::kDelete;
+}
+
 }  // namespace
 
+// Allows grouped application of updates and deletes to be disabled at runtime.
+MONGO_EXPORT_SERVER_PARAMETER(oplogApplicationGroupCrudOps, bool, true);
+
 // static
 void ApplierHelpers::stableSortByNamespace(MultiApplier::OperationPtrs* oplogEntryPointers) {
     if (oplogEntryPointers->size() < 1U) {
@@ -217,5 +235,132 @@ StatusWith<InsertGroup::ConstIterator> InsertGroup::groupAndApplyInserts(ConstIt
     MONGO_UNREACHABLE;
 }
 
+using CrudGroup = ApplierHelpers::CrudGroup;
+
+CrudGroup::CrudGroup(OperationPtrs* ops,
+                     OperationContext* opCtx,
+                     CrudGroup::Mode mode,
+                     IncrementOpsAppliedStatsFn incrementOpsAppliedStats)
+    : _doNotGroupBeforePoint(ops->cbegin()),
+      _end(ops->cend()),
+      _opCtx(opCtx),
+      _mode(mode),
+      _incrementOpsAppliedStats(std::move(incrementOpsAppliedStats)) {}
+
+StatusWith<CrudGroup::ConstIterator> CrudGroup::groupAndApplyOps(ConstIterator it) {
+    const auto& entry = **it;
+
+    // The following conditions must be met before attempting to group the oplog entries starting
+    // at 'oplogEntriesIterator':
+    // 1) Grouping has not been disabled at runtime;
+    // 2) The operation must be an update or a delete. Inserts are left to InsertGroup, which can
+    //    combine their documents into a single vectored insert;
+    // 3) We have not attempted to group this operation during a previous call to this function.
+    if (!oplogApplicationGroupCrudOps.load()) {
+        return Status(ErrorCodes::InvalidOptions,
+                      "Grouping of update and delete operations is disabled.");
+    }
+    if (!isGroupableCrudOpType(entry.getOpType())) {
+        return Status(ErrorCodes::TypeMismatch, "Can only group update and delete operations.");
+    }
+    if (it <= _doNotGroupBeforePoint) {
+        return Status(ErrorCodes::InvalidPath,
+                      "Cannot group an operation that we previously attempted to group.");
+    }
+
+    // Make sure to include the first op in the batch size.
+    auto batchSize = entry.raw.objsize();
+    auto batchCount = OperationPtrs::size_type(1);
+    const auto batchNamespace = entry.getNss();
+
+    // Search for the op that delimits this group: the first op that is not an update or delete on
+    // the same namespace, or that would push the group over its count or size limits.
+    auto endOfGroupableOpsIterator =
+        std::find_if(it + 1, _end, [&](const OplogEntry* nextEntry) -> bool {
+            batchSize += nextEntry->raw.objsize();
+            batchCount += 1;
+            return !isGroupableCrudOpType(nextEntry->getOpType())  // Must be an update or delete.
+                || nextEntry->getNss() != batchNamespace  // Must be in the same namespace.
+                || batchSize > kCrudGroupMaxBatchSize     // Must not be too large a transaction.
+                || batchCount > kCrudGroupMaxBatchCount;  // Limit number of ops in a single group.
+        });
+
+    const auto groupedOpCount = std::distance(it, endOfGroupableOpsIterator);
+
+    // See if we were able to create a group that contains more than a single op.
+    if (groupedOpCount == 1) {
+        return Status(ErrorCodes::NoSuchKey,
+                      "Not able to create a group with more than a single operation");
+    }
+
+    // Timestamps are normally assigned to each write inside applyOperation_inlock, but that is
+    // suppressed when the operation runs under a wrapping WriteUnitOfWork, so this path has to
+    // timestamp each operation itself.
+    const bool assignOperationTimestamps = [&] {
+        if (_opCtx->writesAreReplicated()) {
+            return false;
+        }
+        if (ReplicationCoordinator::get(_opCtx)->getReplicationMode() ==
+            ReplicationCoordinator::modeReplSet) {
+            return true;
+        }
+        // Standalones only timestamp writes while replaying the oplog during recovery.
+        return Mode::kRecovering == _mode;
+    }();
+
+    try {
+        // For non-initial-sync, we convert updates to upserts to suppress errors when replaying
+        // oplog entries.
+        const bool shouldAlwaysUpsert = Mode::kInitialSync != _mode;
+
+        const auto& uuid = entry.getUuid();
+        const NamespaceStringOrUUID nssOrUUID = uuid
+            ? NamespaceStringOrUUID(batchNamespace.db().toString(), *uuid)
+            : NamespaceStringOrUUID(batchNamespace);
+
+        AutoGetCollection autoColl(_opCtx, nssOrUUID, MODE_IX);
+        auto db = autoColl.getDb();
+        uassert(ErrorCodes::NamespaceNotFound,
+                str::stream() << "missing database (" << batchNamespace.db() << ")",
+                db);
+        OldClientContext ctx(_opCtx, autoColl.getNss().ns(), db);
+
+        // Apply the whole group in one storage transaction.
+        WriteUnitOfWork wuow(_opCtx);
+        for (auto groupingIt = it; groupingIt != endOfGroupableOpsIterator; ++groupingIt) {
+            const auto& groupedEntry = **groupingIt;
+            if (assignOperationTimestamps) {
+                uassertStatusOK(_opCtx->recoveryUnit()->setTimestamp(groupedEntry.getTimestamp()));
+            }
+            uassertStatusOK(applyOperation_inlock(
+                _opCtx, ctx.db(), groupedEntry.raw, shouldAlwaysUpsert, _mode));
+        }
+        wuow.commit();
+
+        if (_incrementOpsAppliedStats) {
+            for (auto i = groupedOpCount; i > 0; --i) {
+                _incrementOpsAppliedStats();
+            }
+        }
+
+        // It succeeded, advance the oplogEntriesIterator to the end of the group.
+        return endOfGroupableOpsIterator - 1;
+    } catch (...) {
+        // The storage transaction has been aborted by the WriteUnitOfWork going out of scope. Let
+        // the caller fall back to individual application, which reports real errors and retries
+        // write conflicts. Avoid quadratic run time from a failed group by not retrying until we
+        // are beyond this group of ops.
+        auto status = exceptionToStatus();
+        LOG(2) << "Error applying " << groupedOpCount << " grouped ops on " << batchNamespace
+               << ": " << redact(status) << ". Applying ops individually.";
+
+        _doNotGroupBeforePoint = endOfGroupableOpsIterator - 1;
+
+        return status;
+    }
+
+    MONGO_UNREACHABLE;
+}
+
 }  // namespace repl
 }  // namespace mongo
@@ -53,6 +53,7 @@ public:
     static void stableSortByNamespace(OperationPtrs* oplogEntryPointers);
 
     class InsertGroup;
+    class CrudGroup;
 };
 
 /**
@@ -90,5 +91,49 @@ private:
     Mode _mode;
 };
 
+/**
+ * Groups consecutive update and delete operations on the same namespace and applies them inside a
+ * single WriteUnitOfWork, so that a writer thread pays one storage transaction per group instead
+ * of one per operation. Inserts are not grouped here: InsertGroup combines them into a more
+ * efficient vectored insert, and applying an insert under a wrapping WriteUnitOfWork degrades it
+ * to an upsert.
+ * Advances the the MultiApplier::OperationPtrs iterator if the group is applied successfully.
+ */
+class ApplierHelpers::CrudGroup {
+    MONGO_DISALLOW_COPYING(CrudGroup);
+
+public:
+    using ConstIterator = OperationPtrs::const_iterator;
+    using Mode = OplogApplication::Mode;
+
+    CrudGroup(OperationPtrs* ops,
+              OperationContext* opCtx,
+              Mode mode,
+              IncrementOpsAppliedStatsFn incrementOpsAppliedStats);
+
+    /**
+     * Attempts to group update and delete operations starting at 'iter' and apply them in a
+     * single storage transaction.
+     * If the group is applied successfully, returns the iterator to the last operation included
+     * in the group. On failure - including a write conflict - the storage transaction is aborted
+     * and a non-OK status is returned so that the caller falls back to applying the operations
+     * individually.
+     */
+    StatusWith<ConstIterator> groupAndApplyOps(ConstIterator oplogEntriesIterator);
+
+private:
+    // _doNotGroupBeforePoint is used to prevent retrying bad groups by marking the final op of a
+    // failed group and not allowing further groups until that op has been processed.
+    ConstIterator _doNotGroupBeforePoint;
+
+    // Used for constructing search bounds when grouping.
+    ConstIterator _end;
+
+    // Passed to applyOperation_inlock when applying the group.
+    OperationContext* _opCtx;
+    Mode _mode;
+    IncrementOpsAppliedStatsFn _incrementOpsAppliedStats;
+};
+
 }  // namespace repl
 }  // namespace mongo
@@ -110,16 +110,19 @@ Status CollectionBulkLoaderImpl::init(const std::vector<BSONObj>& secondaryIndex
 
 Status CollectionBulkLoaderImpl::insertDocuments(const std::vector<BSONObj>::const_iterator begin,
                                                  const std::vector<BSONObj>::const_iterator end) {
-    int count = 0;
     return _runTaskReleaseResourcesOnFailure([&]() -> Status {
         UnreplicatedWritesBlock uwb(_opCtx.get());
 
-        for (auto iter = begin; iter != end; ++iter) {
-            Status status = writeConflictRetry(
+        if (_idIndexBlock || _secondaryIndexesBlock) {
+            // Insert the whole batch inside a single storage transaction instead of paying a
+            // WriteUnitOfWork begin/commit per document. A cloned batch is bounded by the 16MB
+            // response size, which is a reasonable transaction size. Any failure fails the whole
+            // load, the same as it did when each document committed separately.
+            return writeConflictRetry(
                 _opCtx.get(), "CollectionBulkLoaderImpl::insertDocuments", _nss.ns(), [&] {
                     WriteUnitOfWork wunit(_opCtx.get());
-                    const auto& doc = *iter;
-                    if (_idIndexBlock || _secondaryIndexesBlock) {
+                    for (auto iter = begin; iter != end; ++iter) {
+                        const auto& doc = *iter;
                         // This flavor of insertDocument will not update any pre-existing indexes,
                         // only the indexers passed in.
                         auto onRecordInserted = [&](const RecordId& loc) {
@@ -130,14 +133,25 @@ Status CollectionBulkLoaderImpl::insertDocuments(const std::vector<BSONObj>::con
                         if (!status.isOK()) {
                             return status;
                         }
-                    } else {
-                        // For capped collections, we use regular insertDocument, which will update
-                        // pre-existing indexes.
-                        const auto status = _autoColl->getCollection()->insertDocument(
-                            _opCtx.get(), InsertStatement(doc), nullptr);
-                        if (!status.isOK()) {
-                            return status;
-                        }
+                    }
+
+                    wunit.commit();
+
+                    return Status::OK();
+                });
+        }
+
+        // For capped collections, we use regular insertDocument, which will update pre-existing
+        // indexes. Each document commits on its own, since inserting into a full capped
+        // collection also deletes the oldest document.
+        for (auto iter = begin; iter != end; ++iter) {
+            Status status = writeConflictRetry(
+                _opCtx.get(), "CollectionBulkLoaderImpl::insertDocuments", _nss.ns(), [&] {
+                    WriteUnitOfWork wunit(_opCtx.get());
+                    const auto status = _autoColl->getCollection()->insertDocument(
+                        _opCtx.get(), InsertStatement(*iter), nullptr);
+                    if (!status.isOK()) {
+                        return status;
                     }
 
                     wunit.commit();
@@ -148,8 +162,6 @@ Status CollectionBulkLoaderImpl::insertDocuments(const std::vector<BSONObj>::con
             if (!status.isOK()) {
                 return status;
             }
-
-            ++count;
         }
         return Status::OK();
     });
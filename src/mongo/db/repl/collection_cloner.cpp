@@ -709,7 +709,14 @@ void CollectionCloner::_insertDocumentsCallback(
     ++_stats.fetchedBatches;
     _progressMeter.hit(int(docs.size()));
     invariant(_collLoader);
+
+    // Release the mutex during the bulk load so that the network thread can buffer the next batch
+    // from the sync source concurrently with record store insertion and index key generation.
+    // '_collLoader' is safe to use without the mutex: it is only destroyed by _finishCallback,
+    // which cannot run while this callback holds a reference to the completion guard.
+    lk.unlock();
     const auto status = _collLoader->insertDocuments(docs.cbegin(), docs.cend());
+    lk.lock();
     if (!status.isOK()) {
         onCompletionGuard->setResultAndCancelRemainingWork_inlock(lk, status);
         return;
@@ -83,8 +83,6 @@ private:
     void run(Seconds waitTime, NoopWriteFn noopWrite) {
         Client::initThread("NoopWriter");
         while (true) {
-            const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
-            OperationContext& opCtx = *opCtxPtr;
             {
                 stdx::unique_lock<stdx::mutex> lk(_mutex);
                 MONGO_IDLE_THREAD_BLOCK;
@@ -93,7 +91,10 @@ private:
                 if (_inShutdown)
                     return;
             }
-            noopWrite(&opCtx);
+            // Create the operation context only after waking so that this thread does not hold
+            // a live operation context for the entire wait period.
+            const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
+            noopWrite(opCtxPtr.get());
         }
     }
 
@@ -143,6 +144,16 @@ void NoopWriter::stopWritingPeriodicNoops() {
 }
 
 void NoopWriter::_writeNoop(OperationContext* opCtx) {
+    auto replCoord = ReplicationCoordinator::get(opCtx);
+
+    // Check whether we look like a primary before taking any locks, so that idle secondaries do
+    // not acquire the global lock on every period. This check is advisory only; it is repeated
+    // below while holding the global lock.
+    if (!replCoord->canAcceptWritesForDatabase_UNSAFE(opCtx, "admin")) {
+        LOG(1) << "Not a primary, skipping the noop write";
+        return;
+    }
+
     // Use GlobalLock instead of DBLock to allow return when the lock is not available. It may
     // happen when the primary steps down and a shared global lock is acquired.
     Lock::GlobalLock lock(
@@ -152,7 +163,6 @@ void NoopWriter::_writeNoop(OperationContext* opCtx) {
         return;
     }
 
-    auto replCoord = ReplicationCoordinator::get(opCtx);
     // Its a proxy for being a primary
     if (!replCoord->canAcceptWritesForDatabase(opCtx, "admin")) {
         LOG(1) << "Not a primary, skipping the noop write";
@@ -34,6 +34,7 @@
 
 #include "mongo/db/repl/oplog.h"
 
+#include <algorithm>
 #include <deque>
 #include <set>
 #include <vector>
@@ -554,11 +555,23 @@ std::vector<OpTime> logInsertOps(OperationContext* opCtx,
         oplogLink.prevOpTime = txnParticipant->getLastWriteOpTime(*opCtx->getTxnNumber());
     }
 
+    // When no statement carries a pre-reserved slot, reserve optimes for the whole batch with a
+    // single call; each _getNextOpTimes call pays a snapshot preallocation and the
+    // optime-generation mutex, so reserving per document serializes large insert batches.
+    std::unique_ptr<OplogSlot[]> batchSlots;
+    const bool allSlotsUnset = std::all_of(begin, end, [](const InsertStatement& statement) {
+        return statement.oplogSlot.opTime.isNull();
+    });
+    if (allSlotsUnset) {
+        batchSlots = stdx::make_unique<OplogSlot[]>(count);
+        _getNextOpTimes(opCtx, oplog, count, batchSlots.get());
+    }
+
     auto timestamps = stdx::make_unique<Timestamp[]>(count);
     std::vector<OpTime> opTimes;
     for (size_t i = 0; i < count; i++) {
         // Make a mutable copy.
-        auto insertStatementOplogSlot = begin[i].oplogSlot;
+        auto insertStatementOplogSlot = batchSlots ? batchSlots[i] : begin[i].oplogSlot;
         // Fetch optime now, if not already fetched.
         if (insertStatementOplogSlot.opTime.isNull()) {
             _getNextOpTimes(opCtx, oplog, 1, &insertStatementOplogSlot);
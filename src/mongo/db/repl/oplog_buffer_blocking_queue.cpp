@@ -32,6 +32,8 @@
 
 #include "mongo/db/repl/oplog_buffer_blocking_queue.h"
 
+#include "mongo/stdx/chrono.h"
+
 namespace mongo {
 namespace repl {
 
@@ -48,8 +50,7 @@ size_t getDocumentSize(const BSONObj& o) {
 }  // namespace
 
 OplogBufferBlockingQueue::OplogBufferBlockingQueue() : OplogBufferBlockingQueue(nullptr) {}
-OplogBufferBlockingQueue::OplogBufferBlockingQueue(Counters* counters)
-    : _counters(counters), _queue(kOplogBufferSize, &getDocumentSize) {}
+OplogBufferBlockingQueue::OplogBufferBlockingQueue(Counters* counters) : _counters(counters) {}
 
 void OplogBufferBlockingQueue::startup(OperationContext*) {
     // Update server status metric to reflect the current oplog buffer's max size.
@@ -63,14 +64,23 @@ void OplogBufferBlockingQueue::shutdown(OperationContext* opCtx) {
 }
 
 void OplogBufferBlockingQueue::pushEvenIfFull(OperationContext*, const Value& value) {
-    _queue.pushEvenIfFull(value);
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _push_inlock(value, getDocumentSize(value));
+    }
     if (_counters) {
         _counters->increment(value);
     }
 }
 
 void OplogBufferBlockingQueue::push(OperationContext*, const Value& value) {
-    _queue.push(value);
+    {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _clearing = false;
+        const auto size = getDocumentSize(value);
+        _waitForSpace_inlock(size, lk);
+        _push_inlock(value, size);
+    }
     if (_counters) {
         _counters->increment(value);
     }
@@ -79,7 +89,29 @@ void OplogBufferBlockingQueue::push(OperationContext*, const Value& value) {
 void OplogBufferBlockingQueue::pushAllNonBlocking(OperationContext*,
                                                   Batch::const_iterator begin,
                                                   Batch::const_iterator end) {
-    _queue.pushAllNonBlocking(begin, end);
+    if (begin == end) {
+        return;
+    }
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _clearing = false;
+
+        std::size_t totalSize = 0;
+        std::size_t totalCount = 0;
+        for (auto i = begin; i != end; ++i) {
+            _producerQueue.push_back(*i);
+            totalSize += getDocumentSize(*i);
+            totalCount++;
+        }
+        _size.addAndFetch(totalSize);
+        _count.addAndFetch(totalCount);
+
+        if (_consumerWaiting) {
+            _consumerWaiting = false;
+            _notEmptyCV.notify_one();
+        }
+    }
     if (_counters) {
         for (auto i = begin; i != end; ++i) {
             _counters->increment(*i);
@@ -88,11 +120,12 @@ void OplogBufferBlockingQueue::pushAllNonBlocking(OperationContext*,
 }
 
 void OplogBufferBlockingQueue::waitForSpace(OperationContext*, std::size_t size) {
-    _queue.waitForSpace(size);
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    _waitForSpace_inlock(size, lk);
 }
 
 bool OplogBufferBlockingQueue::isEmpty() const {
-    return _queue.empty();
+    return 0 == _count.load();
 }
 
 std::size_t OplogBufferBlockingQueue::getMaxSize() const {
@@ -100,24 +133,49 @@ std::size_t OplogBufferBlockingQueue::getMaxSize() const {
 }
 
 std::size_t OplogBufferBlockingQueue::getSize() const {
-    return _queue.size();
+    return static_cast<std::size_t>(_size.load());
 }
 
 std::size_t OplogBufferBlockingQueue::getCount() const {
-    return _queue.count();
+    return static_cast<std::size_t>(_count.load());
 }
 
 void OplogBufferBlockingQueue::clear(OperationContext*) {
-    _queue.clear();
+    stdx::lock_guard<stdx::mutex> consumerLock(_consumerMutex);
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _clearing = true;
+        _producerQueue.clear();
+        _consumerQueue.clear();
+        _size.store(0);
+        _count.store(0);
+        _notFullCV.notify_one();
+        _notEmptyCV.notify_one();
+    }
     if (_counters) {
         _counters->clear();
     }
 }
 
 bool OplogBufferBlockingQueue::tryPop(OperationContext*, Value* value) {
-    if (!_queue.tryPop(*value)) {
-        return false;
+    {
+        stdx::lock_guard<stdx::mutex> consumerLock(_consumerMutex);
+        if (!_ensureConsumerQueue_inlock()) {
+            return false;
+        }
+        *value = std::move(_consumerQueue.front());
+        _consumerQueue.pop_front();
+        _size.subtractAndFetch(getDocumentSize(*value));
+        _count.subtractAndFetch(1);
+    }
+
+    // Only take the producer-side mutex when a producer is actually blocked on space. Producers
+    // unregister themselves once they stop waiting, so at worst we signal a few extra times.
+    if (_waitingProducers.load() > 0) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _notFullCV.notify_one();
     }
+
     if (_counters) {
         _counters->decrement(*value);
     }
@@ -125,17 +183,91 @@ bool OplogBufferBlockingQueue::tryPop(OperationContext*, Value* value) {
 }
 
 bool OplogBufferBlockingQueue::waitForData(Seconds waitDuration) {
-    Value ignored;
-    return _queue.blockingPeek(ignored, static_cast<int>(durationCount<Seconds>(waitDuration)));
+    {
+        stdx::lock_guard<stdx::mutex> consumerLock(_consumerMutex);
+        if (_ensureConsumerQueue_inlock()) {
+            return true;
+        }
+    }
+
+    // Wait without holding "_consumerMutex" so that clear() can interrupt us.
+    using namespace stdx::chrono;
+    const auto deadline = system_clock::now() + seconds(durationCount<Seconds>(waitDuration));
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    _clearing = false;
+    while (_producerQueue.empty() && !_clearing) {
+        _consumerWaiting = true;
+        if (stdx::cv_status::timeout == _notEmptyCV.wait_until(lk, deadline)) {
+            _consumerWaiting = false;
+            return false;
+        }
+    }
+    _consumerWaiting = false;
+    return !_clearing;
 }
 
 bool OplogBufferBlockingQueue::peek(OperationContext*, Value* value) {
-    return _queue.peek(*value);
+    stdx::lock_guard<stdx::mutex> consumerLock(_consumerMutex);
+    if (!_ensureConsumerQueue_inlock()) {
+        return false;
+    }
+    *value = _consumerQueue.front();
+    return true;
 }
 
 boost::optional<OplogBuffer::Value> OplogBufferBlockingQueue::lastObjectPushed(
     OperationContext*) const {
-    return _queue.lastObjectPushed();
+    stdx::lock_guard<stdx::mutex> consumerLock(_consumerMutex);
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (!_producerQueue.empty()) {
+        return {_producerQueue.back()};
+    }
+    if (!_consumerQueue.empty()) {
+        return {_consumerQueue.back()};
+    }
+    return {};
+}
+
+void OplogBufferBlockingQueue::_push_inlock(const Value& value, std::size_t size) {
+    _clearing = false;
+    _producerQueue.push_back(value);
+    _size.addAndFetch(size);
+    _count.addAndFetch(1);
+    if (_consumerWaiting) {
+        _consumerWaiting = false;
+        _notEmptyCV.notify_one();
+    }
+}
+
+void OplogBufferBlockingQueue::_waitForSpace_inlock(std::size_t size,
+                                                    stdx::unique_lock<stdx::mutex>& lk) {
+    while (_size.load() + size > kOplogBufferSize) {
+        _waitingProducers.addAndFetch(1);
+        // Re-check for space after registering as a waiter. The consumer decrements "_size" and
+        // reads "_waitingProducers" without holding "_mutex", so a pop that lands between the
+        // loop condition above and the registration would not have seen us and would skip its
+        // notify; going to sleep on that stale check would lose the wakeup for good.
+        if (_size.load() + size <= kOplogBufferSize) {
+            _waitingProducers.subtractAndFetch(1);
+            break;
+        }
+        _notFullCV.wait(lk);
+        _waitingProducers.subtractAndFetch(1);
+    }
+}
+
+bool OplogBufferBlockingQueue::_ensureConsumerQueue_inlock() {
+    if (!_consumerQueue.empty()) {
+        return true;
+    }
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_producerQueue.empty()) {
+        return false;
+    }
+    // Take the whole producer segment in one crossing; a fetcher batch pushed together is drained
+    // together.
+    _consumerQueue.swap(_producerQueue);
+    return true;
 }
 
 }  // namespace repl
@@ -30,14 +30,25 @@
 
 #pragma once
 
+#include <deque>
+
 #include "mongo/db/repl/oplog_buffer.h"
-#include "mongo/util/queue.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
 
 namespace mongo {
 namespace repl {
 
 /**
- * Oplog buffer backed by in memory blocking queue of BSONObj.
+ * Oplog buffer backed by an in memory queue of BSONObj.
+ *
+ * The queue is split into a producer segment and a consumer segment so that the producer (oplog
+ * fetcher) and consumer (batcher) do not contend on a shared mutex for every entry. Pushes append
+ * whole fetcher batches to the producer segment under one mutex acquisition; the consumer pops
+ * from its own segment and refills it by swapping in the entire producer segment only when its
+ * segment runs dry. Condition variables are signaled only when the other side is known to be
+ * waiting.
  */
 class OplogBufferBlockingQueue final : public OplogBuffer {
 public:
@@ -63,8 +74,48 @@ public:
     boost::optional<Value> lastObjectPushed(OperationContext* opCtx) const override;
 
 private:
+    /**
+     * Appends "value" to the producer segment and wakes the consumer if it is waiting for data.
+     * Must be called while holding "_mutex".
+     */
+    void _push_inlock(const Value& value, std::size_t size);
+
+    /**
+     * Blocks until the buffer's total size plus "size" fits within the maximum. Must be called
+     * while holding "_mutex".
+     */
+    void _waitForSpace_inlock(std::size_t size, stdx::unique_lock<stdx::mutex>& lk);
+
+    /**
+     * Ensures the consumer segment is non-empty by swapping in the producer segment if necessary.
+     * Returns false if both segments are empty. Must be called while holding "_consumerMutex".
+     */
+    bool _ensureConsumerQueue_inlock();
+
     Counters* const _counters;
-    BlockingQueue<BSONObj> _queue;
+
+    // Guards the producer segment, "_clearing" and "_consumerWaiting". Crossed once per pushed
+    // batch by the producer and once per consumer segment refill by the consumer.
+    mutable stdx::mutex _mutex;
+    stdx::condition_variable _notEmptyCV;
+    stdx::condition_variable _notFullCV;
+    std::deque<Value> _producerQueue;
+    bool _clearing = false;
+    bool _consumerWaiting = false;
+
+    // Guards the consumer segment. Only contended when clear() races the consumer.
+    mutable stdx::mutex _consumerMutex;
+    std::deque<Value> _consumerQueue;
+
+    // Number of producers blocked on "_notFullCV", so the consumer knows to signal it after
+    // popping. Atomic because the consumer reads it without holding "_mutex". A counter rather
+    // than a flag so that one woken producer clearing its own registration cannot strand another
+    // producer still waiting.
+    AtomicInt32 _waitingProducers{0};
+
+    // Totals across both segments, maintained atomically so size queries take no locks.
+    AtomicUInt64 _size{0};
+    AtomicUInt64 _count{0};
 };
 
 }  // namespace repl
@@ -0,0 +1,174 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <boost/optional/optional_io.hpp>
+
+#include "mongo/db/jsobj.h"
+#include "mongo/db/repl/oplog_buffer_blocking_queue.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/barrier.h"
+#include "mongo/unittest/unittest.h"
+
+namespace {
+
+using namespace mongo;
+using namespace mongo::repl;
+
+class OplogBufferBlockingQueueTest : public unittest::Test {
+protected:
+    OplogBufferBlockingQueue _buffer;
+    OperationContext* _opCtx = nullptr;  // Not dereferenced.
+};
+
+TEST_F(OplogBufferBlockingQueueTest, PopReturnsDocumentsInPushOrderAcrossBatches) {
+    OplogBuffer::Batch firstBatch = {BSON("x" << 1), BSON("x" << 2), BSON("x" << 3)};
+    _buffer.pushAllNonBlocking(_opCtx, firstBatch.cbegin(), firstBatch.cend());
+
+    // Start draining the first batch so the second batch lands in the producer segment while the
+    // consumer segment is still non-empty.
+    OplogBuffer::Value value;
+    ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_BSONOBJ_EQ(firstBatch[0], value);
+
+    OplogBuffer::Batch secondBatch = {BSON("x" << 4), BSON("x" << 5)};
+    _buffer.pushAllNonBlocking(_opCtx, secondBatch.cbegin(), secondBatch.cend());
+    _buffer.push(_opCtx, BSON("x" << 6));
+
+    for (int i = 2; i <= 6; i++) {
+        ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+        ASSERT_BSONOBJ_EQ(BSON("x" << i), value);
+    }
+    ASSERT_FALSE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_TRUE(_buffer.isEmpty());
+}
+
+TEST_F(OplogBufferBlockingQueueTest, PeekReturnsNextDocumentWithoutRemovingIt) {
+    auto pushValue = BSON("x" << 1);
+    _buffer.pushEvenIfFull(_opCtx, pushValue);
+
+    OplogBuffer::Value peekValue;
+    ASSERT_TRUE(_buffer.peek(_opCtx, &peekValue));
+    ASSERT_BSONOBJ_EQ(pushValue, peekValue);
+    ASSERT_EQUALS(1U, _buffer.getCount());
+
+    OplogBuffer::Value popValue;
+    ASSERT_TRUE(_buffer.tryPop(_opCtx, &popValue));
+    ASSERT_BSONOBJ_EQ(pushValue, popValue);
+    ASSERT_FALSE(_buffer.peek(_opCtx, &peekValue));
+}
+
+TEST_F(OplogBufferBlockingQueueTest, SizeAndCountTrackPushesAndPops) {
+    OplogBuffer::Batch batch = {BSON("x" << 1), BSON("x" << 2)};
+    _buffer.pushAllNonBlocking(_opCtx, batch.cbegin(), batch.cend());
+
+    std::size_t expectedSize = static_cast<std::size_t>(batch[0].objsize() + batch[1].objsize());
+    ASSERT_EQUALS(expectedSize, _buffer.getSize());
+    ASSERT_EQUALS(2U, _buffer.getCount());
+    ASSERT_FALSE(_buffer.isEmpty());
+
+    OplogBuffer::Value value;
+    ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_EQUALS(expectedSize - static_cast<std::size_t>(value.objsize()), _buffer.getSize());
+    ASSERT_EQUALS(1U, _buffer.getCount());
+}
+
+TEST_F(OplogBufferBlockingQueueTest, ClearEmptiesBothSegments) {
+    OplogBuffer::Batch batch = {BSON("x" << 1), BSON("x" << 2)};
+    _buffer.pushAllNonBlocking(_opCtx, batch.cbegin(), batch.cend());
+
+    // Peeking moves the batch into the consumer segment; push one more document so both segments
+    // are populated when we clear.
+    OplogBuffer::Value value;
+    ASSERT_TRUE(_buffer.peek(_opCtx, &value));
+    _buffer.pushEvenIfFull(_opCtx, BSON("x" << 3));
+
+    _buffer.clear(_opCtx);
+    ASSERT_TRUE(_buffer.isEmpty());
+    ASSERT_EQUALS(0U, _buffer.getSize());
+    ASSERT_EQUALS(0U, _buffer.getCount());
+    ASSERT_FALSE(_buffer.tryPop(_opCtx, &value));
+}
+
+TEST_F(OplogBufferBlockingQueueTest, LastObjectPushedReturnsNewestDocument) {
+    ASSERT_EQUALS(boost::none, _buffer.lastObjectPushed(_opCtx));
+
+    OplogBuffer::Batch batch = {BSON("x" << 1), BSON("x" << 2)};
+    _buffer.pushAllNonBlocking(_opCtx, batch.cbegin(), batch.cend());
+    ASSERT_BSONOBJ_EQ(batch[1], *_buffer.lastObjectPushed(_opCtx));
+
+    // After popping the first document the remainder lives in the consumer segment; the newest
+    // document must still be reported.
+    OplogBuffer::Value value;
+    ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_BSONOBJ_EQ(batch[1], *_buffer.lastObjectPushed(_opCtx));
+
+    auto pushValue = BSON("x" << 3);
+    _buffer.pushEvenIfFull(_opCtx, pushValue);
+    ASSERT_BSONOBJ_EQ(pushValue, *_buffer.lastObjectPushed(_opCtx));
+}
+
+TEST_F(OplogBufferBlockingQueueTest, WaitForDataReturnsImmediatelyWhenBufferIsNotEmpty) {
+    _buffer.pushEvenIfFull(_opCtx, BSON("x" << 1));
+    ASSERT_TRUE(_buffer.waitForData(Seconds(30)));
+}
+
+TEST_F(OplogBufferBlockingQueueTest, WaitForDataTimesOutWhenBufferIsEmpty) {
+    ASSERT_FALSE(_buffer.waitForData(Seconds(0)));
+}
+
+TEST_F(OplogBufferBlockingQueueTest, PushWakesBlockedWaitForData) {
+    unittest::Barrier barrier(2U);
+    bool gotData = false;
+    stdx::thread waiter([&]() {
+        barrier.countDownAndWait();
+        gotData = _buffer.waitForData(Seconds(30));
+    });
+    barrier.countDownAndWait();
+    _buffer.pushEvenIfFull(_opCtx, BSON("x" << 1));
+    waiter.join();
+    ASSERT_TRUE(gotData);
+}
+
+TEST_F(OplogBufferBlockingQueueTest, ClearInterruptsBlockedWaitForData) {
+    unittest::Barrier barrier(2U);
+    bool gotData = true;
+    stdx::thread waiter([&]() {
+        barrier.countDownAndWait();
+        gotData = _buffer.waitForData(Seconds(2));
+    });
+    barrier.countDownAndWait();
+    _buffer.clear(_opCtx);
+    waiter.join();
+    ASSERT_FALSE(gotData);
+}
+
+}  // namespace
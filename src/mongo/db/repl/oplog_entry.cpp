@@ -310,6 +310,41 @@ std::string OplogEntry::toString() const {
     return raw.toString();
 }
 
+int OplogEntryView::getVersion() const {
+    auto versionElement = _raw[OplogEntryBase::kVersionFieldName];
+    // Mirrors the IDL default for the 'v' field.
+    return versionElement.eoo() ? 1 : versionElement.numberInt();
+}
+
+Timestamp OplogEntryView::getTimestamp() const {
+    return _raw[OplogEntryBase::kTimestampFieldName].timestamp();
+}
+
+OpTypeEnum OplogEntryView::getOpType() const {
+    return OpType_parse(IDLParserErrorContext("OplogEntryView"),
+                        _raw[OplogEntryBase::kOpTypeFieldName].valuestrsafe());
+}
+
+NamespaceString OplogEntryView::getNss() const {
+    return NamespaceString(_raw[OplogEntryBase::kNssFieldName].valuestrsafe());
+}
+
+BSONObj OplogEntryView::getObject() const {
+    return _raw[OplogEntryBase::kObjectFieldName].Obj();
+}
+
+bool OplogEntryView::isCommand() const {
+    return getOpType() == OpTypeEnum::kCommand;
+}
+
+OplogEntry::CommandType OplogEntryView::getCommandType() const {
+    return parseCommandType(getObject());
+}
+
+bool OplogEntryView::shouldPrepare() const {
+    return _raw[OplogEntryBase::kPrepareFieldName].booleanSafe();
+}
+
 std::ostream& operator<<(std::ostream& s, const OplogEntry& o) {
     return s << o.toString();
 }
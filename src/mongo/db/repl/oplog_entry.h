@@ -163,6 +163,50 @@ private:
     CommandType _commandType = CommandType::kNotCommand;
 };
 
+/**
+ * A lightweight, read-only view of an oplog entry's raw BSON that decodes individual fields on
+ * demand. Unlike OplogEntry, constructing a view does not copy the document or materialize any
+ * fields, so it is suitable for code paths that inspect a handful of fields to make a decision
+ * (e.g. batching) and may never apply the entry. The underlying BSONObj must remain valid for
+ * the lifetime of the view.
+ */
+class OplogEntryView {
+public:
+    explicit OplogEntryView(const BSONObj& raw) : _raw(raw) {}
+
+    /**
+     * Returns the oplog version of the entry, defaulting like OplogEntryBase when absent.
+     */
+    int getVersion() const;
+
+    Timestamp getTimestamp() const;
+
+    OpTypeEnum getOpType() const;
+
+    NamespaceString getNss() const;
+
+    /**
+     * Returns the 'o' field without copying it. Only valid while the raw document is.
+     */
+    BSONObj getObject() const;
+
+    bool isCommand() const;
+
+    /**
+     * Returns the type of command of the oplog entry. Must be called on a command op.
+     */
+    OplogEntry::CommandType getCommandType() const;
+
+    /**
+     * Returns if the operation should be prepared. Must be called on an 'applyOps' entry.
+     */
+    bool shouldPrepare() const;
+
+private:
+    // Shares the caller's buffer; the view never takes ownership of a copy.
+    BSONObj _raw;
+};
+
 std::ostream& operator<<(std::ostream& s, const OplogEntry& o);
 
 inline bool operator==(const OplogEntry& lhs, const OplogEntry& rhs) {
@@ -35,9 +35,11 @@
 #include "mongo/db/repl/oplog_fetcher.h"
 
 #include "mongo/base/counter.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/stats/timer_stats.h"
 #include "mongo/rpc/metadata/oplog_query_metadata.h"
 #include "mongo/util/assert_util.h"
@@ -67,6 +69,14 @@ ServerStatusMetricField<Counter64> displayBytesRead("repl.network.bytes", &netwo
 
 const Milliseconds maximumAwaitDataTimeoutMS(30 * 1000);
 
+// Overlap the network round trip for the next batch with draining the current batch into the
+// oplog buffer. Serves as a kill switch should the pipelining need to be disabled in production.
+MONGO_EXPORT_SERVER_PARAMETER(oplogFetcherPipelineEnqueue, bool, true);
+
+// Batches smaller than this are enqueued inline rather than drained on the side; pipeline
+// overlap only pays off when there is enough data in flight to rival the link's round-trip time.
+const size_t kPipelineEnqueueMinBatchBytes = 64 * 1024;
+
 /**
  * Calculates await data timeout based on the current replica set configuration.
  */
@@ -346,7 +356,12 @@ OplogFetcher::OplogFetcher(executor::TaskExecutor* executor,
                            source,
                            nss,
                            maxFetcherRestarts,
-                           onShutdownCallbackFn,
+                           // Consumers must not learn the fetcher has finished until every batch
+                           // handed to the executor has drained into the oplog buffer.
+                           [this, onShutdownCallbackFn](const Status& status) {
+                               auto enqueueStatus = _waitForEnqueueDocuments();
+                               onShutdownCallbackFn(status.isOK() ? enqueueStatus : status);
+                           },
                            "oplog fetcher"),
       _metadataObject(makeMetadataObject()),
       _requiredRBID(requiredRBID),
@@ -363,6 +378,33 @@ OplogFetcher::OplogFetcher(executor::TaskExecutor* executor,
 OplogFetcher::~OplogFetcher() {
     shutdown();
     join();
+
+    // The enqueue thread is normally collected by the shutdown callback; this covers the case
+    // where the fetcher never ran it.
+    if (_enqueueThread.joinable()) {
+        _enqueueThread.join();
+    }
+}
+
+void OplogFetcher::_scheduleEnqueueDocuments(Fetcher::Documents::const_iterator begin,
+                                             Fetcher::Documents::const_iterator end,
+                                             const DocumentsInfo& info) {
+    invariant(!_enqueueThread.joinable());
+
+    // The BSONObj copies share ownership of the response buffer; the documents themselves are not
+    // copied.
+    Fetcher::Documents documents(begin, end);
+    _enqueueThread = stdx::thread([ this, documents = std::move(documents), info ] {
+        Client::initThread("replOplogEnqueue");
+        _lastEnqueueStatus = _enqueueDocumentsFn(documents.cbegin(), documents.cend(), info);
+    });
+}
+
+Status OplogFetcher::_waitForEnqueueDocuments() {
+    if (_enqueueThread.joinable()) {
+        _enqueueThread.join();
+    }
+    return _lastEnqueueStatus;
 }
 
 BSONObj OplogFetcher::_makeFindCommandObject(const NamespaceString& nss,
@@ -416,6 +458,14 @@ StatusWith<BSONObj> OplogFetcher::_onSuccessfulBatch(const Fetcher::QueryRespons
         return Status(ErrorCodes::FailPointEnabled, "stopReplProducer fail point is enabled");
     }
 
+    // The previous batch may still be draining into the oplog buffer on the side; collect it
+    // before processing this one so that documents stay ordered and enqueue failures stop the
+    // fetcher.
+    auto previousEnqueueStatus = _waitForEnqueueDocuments();
+    if (!previousEnqueueStatus.isOK()) {
+        return previousEnqueueStatus;
+    }
+
     const auto& documents = queryResponse.documents;
     auto firstDocToApply = documents.cbegin();
 
@@ -501,9 +551,20 @@ StatusWith<BSONObj> OplogFetcher::_onSuccessfulBatch(const Fetcher::QueryRespons
     getmoreReplStats.recordMillis(durationCount<Milliseconds>(queryResponse.elapsedMillis));
 
     // TODO: back pressure handling will be added in SERVER-23499.
-    auto status = _enqueueDocumentsFn(firstDocToApply, documents.cend(), info);
-    if (!status.isOK()) {
-        return status;
+    //
+    // Substantial batches are drained into the oplog buffer on the side so the next getMore goes
+    // out immediately; the network round trip then overlaps buffer insertion instead of following
+    // it, which matters when the link's round-trip time rivals the time it takes to drain a
+    // batch. Small batches are enqueued inline: they occur when tailing an idle sync source,
+    // where the pacing applied by the enqueue function should keep delaying the next getMore.
+    if (oplogFetcherPipelineEnqueue.load() &&
+        info.networkDocumentBytes >= kPipelineEnqueueMinBatchBytes) {
+        _scheduleEnqueueDocuments(firstDocToApply, documents.cend(), info);
+    } else {
+        auto status = _enqueueDocumentsFn(firstDocToApply, documents.cend(), info);
+        if (!status.isOK()) {
+            return status;
+        }
     }
 
     if (_dataReplicatorExternalState->shouldStopFetching(
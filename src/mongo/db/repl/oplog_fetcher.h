@@ -41,6 +41,7 @@
 #include "mongo/db/repl/data_replicator_external_state.h"
 #include "mongo/db/repl/repl_set_config.h"
 #include "mongo/stdx/functional.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point_service.h"
 
 namespace mongo {
@@ -160,6 +161,22 @@ private:
      */
     StatusWith<BSONObj> _onSuccessfulBatch(const Fetcher::QueryResponse& queryResponse) override;
 
+    /**
+     * Hands the operations in [begin, end) to a side thread to be drained into the oplog buffer,
+     * so that the next getMore can be issued while the batch is still being enqueued. At most one
+     * batch may be draining at a time; callers must have collected the previous batch via
+     * _waitForEnqueueDocuments() first.
+     */
+    void _scheduleEnqueueDocuments(Fetcher::Documents::const_iterator begin,
+                                   Fetcher::Documents::const_iterator end,
+                                   const DocumentsInfo& info);
+
+    /**
+     * Blocks until the batch handed to _scheduleEnqueueDocuments(), if any, has been fully
+     * enqueued, and returns the status of that enqueue.
+     */
+    Status _waitForEnqueueDocuments();
+
     // The metadata object sent with the Fetcher queries.
     const BSONObj _metadataObject;
 
@@ -176,6 +193,14 @@ private:
     const EnqueueDocumentsFn _enqueueDocumentsFn;
     const Milliseconds _awaitDataTimeout;
     const int _batchSize;
+
+    // Drains at most one fetched batch into the oplog buffer on the side. Only touched from the
+    // fetcher callback thread and the shutdown callback, which are sequenced with respect to each
+    // other, so no synchronization beyond the join is needed. The next batch joins this thread
+    // before being handed over, which keeps documents ordered and preserves the buffer's
+    // backpressure.
+    stdx::thread _enqueueThread;
+    Status _lastEnqueueStatus = Status::OK();
 };
 
 }  // namespace repl
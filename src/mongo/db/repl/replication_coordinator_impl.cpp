@@ -1153,11 +1153,34 @@ void ReplicationCoordinatorImpl::_reportUpstream_inlock(stdx::unique_lock<stdx::
     _externalState->forwardSlaveProgress();  // Must do this outside _mutex
 }
 
+OpTime ReplicationCoordinatorImpl::OpTimeSnapshot::get() const {
+    while (true) {
+        const auto versionBefore = _version.load();
+        if (versionBefore % 2 == 1) {
+            // A write is in progress; retry.
+            continue;
+        }
+        const Timestamp timestamp(_timestamp.load());
+        const long long term = _term.load();
+        if (_version.load() == versionBefore) {
+            return OpTime(timestamp, term);
+        }
+    }
+}
+
+void ReplicationCoordinatorImpl::OpTimeSnapshot::set(const OpTime& opTime) {
+    _version.fetchAndAdd(1);
+    _timestamp.store(opTime.getTimestamp().asULL());
+    _term.store(opTime.getTerm());
+    _version.fetchAndAdd(1);
+}
+
 void ReplicationCoordinatorImpl::_setMyLastAppliedOpTime(WithLock lk,
                                                          const OpTime& opTime,
                                                          bool isRollbackAllowed,
                                                          DataConsistency consistency) {
     _topCoord->setMyLastAppliedOpTime(opTime, _replExecutor->now(), isRollbackAllowed);
+    _lastAppliedOpTimeSnapshot.set(opTime);
     // If we are using applied times to calculate the commit level, update it now.
     if (!_rsConfig.getWriteConcernMajorityShouldJournal()) {
         _updateLastCommittedOpTime(lk);
@@ -1206,6 +1229,7 @@ void ReplicationCoordinatorImpl::_setMyLastDurableOpTime(WithLock lk,
                                                          const OpTime& opTime,
                                                          bool isRollbackAllowed) {
     _topCoord->setMyLastDurableOpTime(opTime, _replExecutor->now(), isRollbackAllowed);
+    _lastDurableOpTimeSnapshot.set(opTime);
     // If we are using durable times to calculate the commit level, update it now.
     if (_rsConfig.getWriteConcernMajorityShouldJournal()) {
         _updateLastCommittedOpTime(lk);
@@ -1213,13 +1237,11 @@ void ReplicationCoordinatorImpl::_setMyLastDurableOpTime(WithLock lk,
 }
 
 OpTime ReplicationCoordinatorImpl::getMyLastAppliedOpTime() const {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    return _getMyLastAppliedOpTime_inlock();
+    return _lastAppliedOpTimeSnapshot.get();
 }
 
 OpTime ReplicationCoordinatorImpl::getMyLastDurableOpTime() const {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    return _getMyLastDurableOpTime_inlock();
+    return _lastDurableOpTimeSnapshot.get();
 }
 
 Status ReplicationCoordinatorImpl::_validateReadConcern(OperationContext* opCtx,
@@ -1442,7 +1464,8 @@ Status ReplicationCoordinatorImpl::setLastDurableOptime_forTest(long long cfgVer
 
     const UpdatePositionArgs::UpdateInfo update(OpTime(), opTime, cfgVer, memberId);
     long long configVersion;
-    const auto status = _setLastOptime(lock, update, &configVersion);
+    bool advancedOpTime = false;
+    const auto status = _setLastOptime(lock, update, &configVersion, &advancedOpTime);
     _updateLastCommittedOpTime(lock);
     return status;
 }
@@ -1455,21 +1478,21 @@ Status ReplicationCoordinatorImpl::setLastAppliedOptime_forTest(long long cfgVer
 
     const UpdatePositionArgs::UpdateInfo update(opTime, OpTime(), cfgVer, memberId);
     long long configVersion;
-    const auto status = _setLastOptime(lock, update, &configVersion);
+    bool advancedOpTime = false;
+    const auto status = _setLastOptime(lock, update, &configVersion, &advancedOpTime);
     _updateLastCommittedOpTime(lock);
     return status;
 }
 
 Status ReplicationCoordinatorImpl::_setLastOptime(WithLock lk,
                                                   const UpdatePositionArgs::UpdateInfo& args,
-                                                  long long* configVersion) {
+                                                  long long* configVersion,
+                                                  bool* advancedOpTime) {
     auto result = _topCoord->setLastOptime(args, _replExecutor->now(), configVersion);
     if (!result.isOK())
         return result.getStatus();
-    const bool advancedOpTime = result.getValue();
-    // Only update committed optime if the remote optimes increased.
-    if (advancedOpTime) {
-        _updateLastCommittedOpTime(lk);
+    if (result.getValue()) {
+        *advancedOpTime = true;
     }
 
     _cancelAndRescheduleLivenessUpdate_inlock(args.memberId);
@@ -2905,16 +2928,24 @@ Status ReplicationCoordinatorImpl::processReplSetUpdatePosition(const UpdatePosi
     stdx::unique_lock<stdx::mutex> lock(_mutex);
     Status status = Status::OK();
     bool somethingChanged = false;
+    bool advancedOpTime = false;
     for (UpdatePositionArgs::UpdateIterator update = updates.updatesBegin();
          update != updates.updatesEnd();
          ++update) {
-        status = _setLastOptime(lock, *update, configVersion);
+        status = _setLastOptime(lock, *update, configVersion, &advancedOpTime);
         if (!status.isOK()) {
             break;
         }
         somethingChanged = true;
     }
 
+    // Recompute the last committed optime once for the whole update set. Doing it per member
+    // entry made the work under _mutex quadratic in the number of members for updates forwarded
+    // by nodes with large fan-in.
+    if (advancedOpTime) {
+        _updateLastCommittedOpTime(lock);
+    }
+
     if (somethingChanged && !_getMemberState_inlock().primary()) {
         lock.unlock();
         // Must do this outside _mutex
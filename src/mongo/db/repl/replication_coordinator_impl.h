@@ -520,6 +520,20 @@ private:
         std::vector<WaiterType> _list;
     };
 
+    // A lock-free, versioned snapshot of an OpTime. Writers must be serialized externally (all
+    // updates to the snapshots below happen under _mutex); readers retry until they observe an
+    // unchanged even version, so they never see a torn OpTime.
+    class OpTimeSnapshot {
+    public:
+        OpTime get() const;
+        void set(const OpTime& opTime);
+
+    private:
+        AtomicUInt64 _version{0};
+        AtomicUInt64 _timestamp{0};
+        AtomicInt64 _term{OpTime::kUninitializedTerm};
+    };
+
     typedef std::vector<executor::TaskExecutor::CallbackHandle> HeartbeatHandles;
 
     // The state and logic of primary catchup.
@@ -691,10 +705,14 @@ private:
      * This is only valid to call on replica sets.
      * "configVersion" will be populated with our config version if it and the configVersion
      * of "args" differ.
+     * Sets "*advancedOpTime" to true if the remote optimes increased; the caller is responsible
+     * for recomputing the last committed optime. This lets a caller processing a batch of
+     * updates recompute it once for the whole batch instead of once per member.
      */
     Status _setLastOptime(WithLock lk,
                           const UpdatePositionArgs::UpdateInfo& args,
-                          long long* configVersion);
+                          long long* configVersion,
+                          bool* advancedOpTime);
 
     /**
      * This function will report our position externally (like upstream) if necessary.
@@ -1271,6 +1289,12 @@ private:
     // May only be written to while holding _mutex.
     AtomicUInt64 _uncommittedSnapshotsSize;  // (I)
 
+    // Caches of my last applied and last durable optimes that can be read without any locking.
+    // The authoritative values live in the topology coordinator's member data; these may only be
+    // written to while holding _mutex, immediately after the authoritative values change.
+    OpTimeSnapshot _lastAppliedOpTimeSnapshot;  // (I)
+    OpTimeSnapshot _lastDurableOpTimeSnapshot;  // (I)
+
     // The non-null OpTime and SnapshotName of the current snapshot used for committed reads, if
     // there is one.
     // When engaged, this must be <= _lastCommittedOpTime and < _uncommittedSnapshots.front().
@@ -36,6 +36,7 @@
 
 #include "mongo/bson/util/bson_extract.h"
 #include "mongo/db/repl/update_position_args.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/destructor_guard.h"
@@ -44,6 +45,12 @@
 namespace mongo {
 namespace repl {
 
+// Minimum time between replSetUpdatePosition commands sent to the sync source. When positive,
+// triggered sends that arrive within this window of the previous send are deferred to the end of
+// the window so that progress from several apply batches coalesces into a single command. Zero
+// (the default) sends on every trigger, as before.
+MONGO_EXPORT_SERVER_PARAMETER(replSetUpdatePositionCoalesceWindowMillis, int, 0);
+
 namespace {
 
 const char kConfigVersionFieldName[] = "configVersion";
@@ -235,6 +242,7 @@ void Reporter::_sendCommand_inlock(BSONObj commandRequest, Milliseconds netTimeo
     }
 
     _remoteCommandCallbackHandle = scheduleResult.getValue();
+    _lastSendTime = _executor->now();
 }
 
 void Reporter::_processResponseCallback(
@@ -337,6 +345,27 @@ void Reporter::_prepareAndSendCommandCallback(const executor::TaskExecutor::Call
             _onShutdown_inlock();
             return;
         }
+
+        // If a coalescing window is configured and we reported to the sync source recently,
+        // defer this send to the end of the window. The command is prepared when the deferred
+        // callback runs, so it carries the progress from every trigger that arrived in the
+        // meantime.
+        const Milliseconds coalesceWindow(replSetUpdatePositionCoalesceWindowMillis.load());
+        const auto earliestSendTime = _lastSendTime + coalesceWindow;
+        if (coalesceWindow > Milliseconds(0) && _executor->now() < earliestSendTime) {
+            auto scheduleResult = _executor->scheduleWorkAt(
+                earliestSendTime, [=](const executor::TaskExecutor::CallbackArgs& args) {
+                    _prepareAndSendCommandCallback(args, true);
+                });
+            _status = scheduleResult.getStatus();
+            if (!_status.isOK()) {
+                _onShutdown_inlock();
+                return;
+            }
+
+            _prepareAndSendCommandCallbackHandle = scheduleResult.getValue();
+            return;
+        }
     }
 
     // Must call without holding the lock.
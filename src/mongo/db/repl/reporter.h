@@ -208,6 +208,10 @@ private:
     // If this date is Date_t(), the callback is either unscheduled or canceled.
     // Used for testing only.
     Date_t _keepAliveTimeoutWhen;
+
+    // Time the most recent update command was scheduled to be sent. Used to defer triggered
+    // sends until the coalescing window since the last send has elapsed.
+    Date_t _lastSendTime;
 };
 
 }  // namespace repl
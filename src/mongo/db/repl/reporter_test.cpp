@@ -34,9 +34,20 @@
 #include "mongo/db/repl/update_position_args.h"
 #include "mongo/executor/network_interface_mock.h"
 #include "mongo/executor/thread_pool_task_executor_test_fixture.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/unittest/task_executor_proxy.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace repl {
+
+// Defined in reporter.cpp.
+extern AtomicWord<int> replSetUpdatePositionCoalesceWindowMillis;
+
+}  // namespace repl
+}  // namespace mongo
 
 namespace {
 
@@ -697,6 +708,41 @@ TEST_F(ReporterTest,
     assertReporterDone();
 }
 
+TEST_F(ReporterTest, TriggerWithinCoalescingWindowDefersUpdateUntilWindowExpires) {
+    auto oldWindow = replSetUpdatePositionCoalesceWindowMillis.load();
+    replSetUpdatePositionCoalesceWindowMillis.store(2000);
+    ON_BLOCK_EXIT([oldWindow] { replSetUpdatePositionCoalesceWindowMillis.store(oldWindow); });
+
+    auto sendTime = getExecutor().now();
+    processNetworkResponse(BSON("ok" << 1));
+
+    auto keepAliveTimeoutWhen = getExecutor().now() + reporter->getKeepAliveInterval();
+    ASSERT_EQUALS(keepAliveTimeoutWhen, reporter->getKeepAliveTimeoutWhen_forTest());
+    ASSERT_TRUE(reporter->isActive());
+
+    runUntil(keepAliveTimeoutWhen - reporter->getKeepAliveInterval() / 2);
+
+    ASSERT_OK(reporter->trigger());
+
+    // The canceled keep alive callback should defer the send to the end of the coalescing window
+    // instead of sending immediately.
+    auto net = getNet();
+    net->enterNetwork();
+    ASSERT_FALSE(net->hasReadyRequests());
+    net->exitNetwork();
+    ASSERT_TRUE(reporter->isActive());
+
+    runUntil(sendTime + Milliseconds(2000), true);
+
+    processNetworkResponse(BSON("ok" << 1));
+    ASSERT_TRUE(reporter->isActive());
+
+    reporter->shutdown();
+
+    ASSERT_EQUALS(ErrorCodes::CallbackCanceled, reporter->join());
+    assertReporterDone();
+}
+
 TEST_F(ReporterTest, ShutdownImmediatelyAfterTriggerWhileKeepAliveTimeoutIsScheduledShouldSucceed) {
     processNetworkResponse(BSON("ok" << 1));
 
@@ -70,6 +70,7 @@
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/replication_state_transition_lock_guard.h"
 #include "mongo/db/repl/session_update_tracker.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/session.h"
 #include "mongo/db/session_txn_record_gen.h"
@@ -91,10 +92,21 @@ namespace {
 MONGO_FAIL_POINT_DEFINE(pauseBatchApplicationBeforeCompletion);
 MONGO_FAIL_POINT_DEFINE(hangAfterRecordingOpApplicationStartTime);
 
+// Coalesce runs of operations on the same document down to their net effect when distributing a
+// batch across the writer threads. Serves as a kill switch should a workload surface an
+// application difference.
+MONGO_EXPORT_SERVER_PARAMETER(oplogApplicationCoalesceOps, bool, true);
+
 // The oplog entries applied
 Counter64 opsAppliedStats;
 ServerStatusMetricField<Counter64> displayOpsApplied("repl.apply.ops", &opsAppliedStats);
 
+// The oplog entries skipped during parallel application because a later entry in the same batch
+// overwrote their entire effect on the document.
+Counter64 opsCoalescedStats;
+ServerStatusMetricField<Counter64> displayOpsCoalesced("repl.apply.opsCoalesced",
+                                                       &opsCoalescedStats);
+
 // Number of times we tried to go live as a secondary.
 Counter64 attemptsToBecomeSecondary;
 ServerStatusMetricField<Counter64> displayAttemptsToBecomeSecondary(
@@ -537,6 +549,56 @@ private:
     StringMap<CollectionProperties> _cache;
 };
 
+/**
+ * Returns true if 'op' is an update that replaces the whole document rather than applying
+ * modifier operators to it.
+ */
+bool isReplacementUpdate(const OplogEntry& op) {
+    if (op.getOpType() != OpTypeEnum::kUpdate) {
+        return false;
+    }
+    auto firstElement = op.getObject().firstElement();
+    return !firstElement.eoo() && firstElement.fieldNameStringData()[0] != '$';
+}
+
+}  // namespace
+
+bool canCoalesceOps(const OplogEntry& earlierOp,
+                    const OplogEntry& laterOp,
+                    const CollatorInterface* collator) {
+    if (!earlierOp.isCrudOpType() || !laterOp.isCrudOpType()) {
+        return false;
+    }
+    if (earlierOp.getSessionId() || laterOp.getSessionId()) {
+        return false;
+    }
+    if (earlierOp.getNss() != laterOp.getNss()) {
+        return false;
+    }
+
+    const BSONElement earlierId = earlierOp.getIdElement();
+    const BSONElement laterId = laterOp.getIdElement();
+    if (earlierId.eoo() || laterId.eoo()) {
+        return false;
+    }
+    BSONElementComparator elementComparator(BSONElementComparator::FieldNamesMode::kIgnore,
+                                            collator);
+    if (elementComparator.evaluate(earlierId != laterId)) {
+        return false;
+    }
+
+    switch (laterOp.getOpType()) {
+        case OpTypeEnum::kDelete:
+            return true;
+        case OpTypeEnum::kUpdate:
+            return isReplacementUpdate(laterOp) && isReplacementUpdate(earlierOp);
+        default:
+            return false;
+    }
+}
+
+namespace {
+
 /**
  * ops - This only modifies the isForCappedCollection field on each op. It does not alter the ops
  *      vector in any other way.
@@ -574,8 +636,9 @@ void fillWriterVectors(OperationContext* opCtx,
             }
         }
 
+        CachedCollectionProperties::CollectionProperties collProperties;
         if (op.isCrudOpType()) {
-            auto collProperties = collPropertiesCache.getCollectionProperties(opCtx, hashedNs);
+            collProperties = collPropertiesCache.getCollectionProperties(opCtx, hashedNs);
 
             // For doc locking engines, include the _id of the document in the hash so we get
             // parallelism even if all writes are to a single collection.
@@ -619,6 +682,19 @@ void fillWriterVectors(OperationContext* opCtx,
         if (writer.empty()) {
             writer.reserve(8);  // Skip a few growth rounds
         }
+
+        // When the hash above includes the document _id, every operation on one document lands in
+        // this writer in batch order, so a run of operations whose net effect is captured by 'op'
+        // can be collapsed down to 'op' alone. The skipped entries are still written to the oplog;
+        // they are only dropped from this round of parallel application.
+        if (oplogApplicationCoalesceOps.load() && supportsDocLocking && op.isCrudOpType() &&
+            !collProperties.isCapped) {
+            while (!writer.empty() &&
+                   canCoalesceOps(*writer.back(), op, collProperties.collator)) {
+                writer.pop_back();
+                opsCoalescedStats.increment();
+            }
+        }
         writer.push_back(&op);
     }
 }
@@ -973,52 +1049,55 @@ bool SyncTail::tryPopAndWaitForMore(OperationContext* opCtx,
             return true;
         }
 
-        ops->emplace_back(std::move(op));  // Parses the op in-place.
-    }
-
-    auto& entry = ops->back();
-
-    // check for oplog version change
-    int curVersion = entry.getVersion();
-    if (curVersion != OplogEntry::kOplogVersion) {
-        severe() << "expected oplog version " << OplogEntry::kOplogVersion << " but found version "
-                 << curVersion << " in oplog entry: " << redact(entry.toBSON());
-        fassertFailedNoTrace(18820);
-    }
+        // Make the remaining batch-boundary decisions on a lazy view of the raw document, so
+        // that ops we do not consume are never parsed into an OplogEntry and ops we defer
+        // (slave delay, ops that must be applied alone) are not re-parsed on every retry.
+        OplogEntryView entryView(op);
+
+        // check for oplog version change
+        int curVersion = entryView.getVersion();
+        if (curVersion != OplogEntry::kOplogVersion) {
+            severe() << "expected oplog version " << OplogEntry::kOplogVersion
+                     << " but found version " << curVersion << " in oplog entry: " << redact(op);
+            fassertFailedNoTrace(18820);
+        }
 
-    auto entryTime = Date_t::fromDurationSinceEpoch(Seconds(entry.getTimestamp().getSecs()));
-    if (limits.slaveDelayLatestTimestamp && entryTime > *limits.slaveDelayLatestTimestamp) {
+        auto entryTime = Date_t::fromDurationSinceEpoch(Seconds(entryView.getTimestamp().getSecs()));
+        if (limits.slaveDelayLatestTimestamp && entryTime > *limits.slaveDelayLatestTimestamp) {
 
-        ops->pop_back();  // Don't do this op yet.
-        if (ops->empty()) {
-            // Sleep if we've got nothing to do. Only sleep for 1 second at a time to allow
-            // reconfigs and shutdown to occur.
-            sleepsecs(1);
+            // Don't do this op yet.
+            if (ops->empty()) {
+                // Sleep if we've got nothing to do. Only sleep for 1 second at a time to allow
+                // reconfigs and shutdown to occur.
+                sleepsecs(1);
+            }
+            return true;
         }
-        return true;
-    }
 
-    // Commands must be processed one at a time. The only exception to this is applyOps because
-    // applyOps oplog entries are effectively containers for CRUD operations. Therefore, it is safe
-    // to batch applyOps commands with CRUD operations when reading from the oplog buffer.
-    // Oplog entries on 'system.views' should also be processed one at a time. View catalog
-    // immediately reflects changes for each oplog entry so we can see inconsistent view catalog if
-    // multiple oplog entries on 'system.views' are being applied out of the original order.
-    if ((entry.isCommand() &&
-         (entry.getCommandType() != OplogEntry::CommandType::kApplyOps || entry.shouldPrepare())) ||
-        entry.getNss().isSystemDotViews()) {
-        if (ops->getCount() == 1) {
-            // apply commands one-at-a-time
-            _consume(opCtx, oplogBuffer);
-        } else {
-            // This op must be processed alone, but we already had ops in the queue so we can't
-            // include it in this batch. Since we didn't call consume(), we'll see this again next
-            // time and process it alone.
-            ops->pop_back();
+        // Commands must be processed one at a time. The only exception to this is applyOps because
+        // applyOps oplog entries are effectively containers for CRUD operations. Therefore, it is
+        // safe to batch applyOps commands with CRUD operations when reading from the oplog buffer.
+        // Oplog entries on 'system.views' should also be processed one at a time. View catalog
+        // immediately reflects changes for each oplog entry so we can see inconsistent view catalog
+        // if multiple oplog entries on 'system.views' are being applied out of the original order.
+        if ((entryView.isCommand() &&
+             (entryView.getCommandType() != OplogEntry::CommandType::kApplyOps ||
+              entryView.shouldPrepare())) ||
+            entryView.getNss().isSystemDotViews()) {
+            if (ops->empty()) {
+                // apply commands one-at-a-time
+                ops->emplace_back(std::move(op));  // Parses the op in-place.
+                _consume(opCtx, oplogBuffer);
+            }
+            // Otherwise this op must be processed alone, but we already had ops in the queue so we
+            // can't include it in this batch. Since we didn't call _consume(), we'll see it again
+            // next time and process it alone.
+
+            // Apply what we have so far.
+            return true;
         }
 
-        // Apply what we have so far.
-        return true;
+        ops->emplace_back(std::move(op));  // Parses the op in-place.
     }
 
     // We are going to apply this Op.
@@ -1225,6 +1304,8 @@ Status multiSyncApply(OperationContext* opCtx,
                : OplogApplication::Mode::kSecondary);
 
     ApplierHelpers::InsertGroup insertGroup(ops, opCtx, oplogApplicationMode);
+    ApplierHelpers::CrudGroup crudGroup(
+        ops, opCtx, oplogApplicationMode, [] { opsAppliedStats.increment(1); });
 
     {  // Ensure that the MultikeyPathTracker stops tracking paths.
         ON_BLOCK_EXIT([opCtx] { MultikeyPathTracker::get(opCtx).stopTrackingMultikeyPathInfo(); });
@@ -1241,6 +1322,14 @@ Status multiSyncApply(OperationContext* opCtx,
                 continue;
             }
 
+            // Similarly, apply runs of updates and deletes on the same namespace in a single
+            // storage transaction to avoid paying a transaction begin/commit per entry.
+            auto crudGroupResult = crudGroup.groupAndApplyOps(it);
+            if (crudGroupResult.isOK()) {
+                it = crudGroupResult.getValue();
+                continue;
+            }
+
             // If we didn't create a group, try to apply the op individually.
             try {
                 const Status status = SyncTail::syncApply(opCtx, entry.raw, oplogApplicationMode);
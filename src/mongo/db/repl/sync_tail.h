@@ -48,6 +48,7 @@
 
 namespace mongo {
 
+class CollatorInterface;
 class Database;
 class OperationContext;
 struct MultikeyPathInfo;
@@ -280,5 +281,15 @@ Status multiSyncApply(OperationContext* opCtx,
                       SyncTail* st,
                       WorkerMultikeyPathInfo* workerMultikeyPathInfo);
 
+// Returns true when applying 'earlierOp' is unnecessary because 'laterOp', which follows it in
+// the same writer vector and therefore in batch order, overwrites its entire effect on the
+// document: either 'laterOp' deletes the document, or both operations are whole-document
+// replacement updates. Operations from retryable writes or transactions never qualify, as their
+// history must be applied in full. 'collator' is the collection's default collation, used to
+// compare the target _id values. Exposed for testing.
+bool canCoalesceOps(const OplogEntry& earlierOp,
+                    const OplogEntry& laterOp,
+                    const CollatorInterface* collator);
+
 }  // namespace repl
 }  // namespace mongo
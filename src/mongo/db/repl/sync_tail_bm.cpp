@@ -0,0 +1,227 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/client.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/repl/drop_pending_collection_reaper.h"
+#include "mongo/db/repl/idempotency_test_fixture.h"
+#include "mongo/db/repl/oplog.h"
+#include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/replication_consistency_markers_mock.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/repl/storage_interface_impl.h"
+#include "mongo/db/repl/sync_tail.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context_d_test_fixture.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/functional.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/util/concurrency/thread_pool.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+const int kMaxCollections = 8;   // number of target collections batches are spread across
+const int kOpsPerBatch = 1024;   // operations handed to each multiApply() call
+
+// Monotonically increasing _ids and timestamp seconds, shared by every benchmark run so inserts
+// never collide and each batch's optimes stay ahead of the previous batch's.
+AtomicInt64 nextDocumentId(0);
+AtomicUInt32 nextTimestampSecs(1);
+
+/**
+ * Stands up the service-context, storage and replication plumbing that SyncTail::multiApply()
+ * needs, mirroring the setup in sync_tail_test_fixture.cpp but without the unit-test lifecycle,
+ * so synthetic oplog batches can be applied through the real parallel apply path.
+ */
+class SyncTailBmHarness : public ServiceContextMongoDTest {
+public:
+    SyncTailBmHarness() {
+        auto service = getServiceContext();
+        _opCtx = cc().makeOperationContext();
+
+        ReplicationCoordinator::set(service,
+                                    stdx::make_unique<ReplicationCoordinatorMock>(service));
+        invariant(ReplicationCoordinator::get(service)->setFollowerMode(MemberState::RS_PRIMARY));
+
+        _storageInterface = stdx::make_unique<StorageInterfaceImpl>();
+        DropPendingCollectionReaper::set(
+            service, stdx::make_unique<DropPendingCollectionReaper>(_storageInterface.get()));
+        setOplogCollectionName(service);
+        createOplog(_opCtx.get());
+
+        _consistencyMarkers = stdx::make_unique<ReplicationConsistencyMarkersMock>();
+
+        serverGlobalParams.featureCompatibility.setVersion(
+            ServerGlobalParams::FeatureCompatibility::Version::kFullyUpgradedTo42);
+
+        for (int i = 0; i < kMaxCollections; i++) {
+            invariant(_storageInterface->createCollection(
+                _opCtx.get(), collectionNss(i), CollectionOptions()));
+        }
+    }
+
+    ~SyncTailBmHarness() {
+        // The reaper holds a raw pointer into '_storageInterface'; drop it before our members.
+        DropPendingCollectionReaper::set(getServiceContext(), {});
+    }
+
+    static NamespaceString collectionNss(int i) {
+        return NamespaceString("sync_tail_bm", "coll" + std::to_string(i));
+    }
+
+    OperationContext* opCtx() const {
+        return _opCtx.get();
+    }
+
+    ReplicationConsistencyMarkers* getConsistencyMarkers() const {
+        return _consistencyMarkers.get();
+    }
+
+    StorageInterface* getStorageInterface() const {
+        return _storageInterface.get();
+    }
+
+private:
+    std::unique_ptr<StorageInterfaceImpl> _storageInterface;
+    std::unique_ptr<ReplicationConsistencyMarkersMock> _consistencyMarkers;
+    ServiceContext::UniqueOperationContext _opCtx;
+};
+
+SyncTailBmHarness& getHarness() {
+    // Constructed on first use, after benchmark_main has run the global initializers, and shared
+    // by every benchmark run so each variant measures apply throughput, not startup.
+    static SyncTailBmHarness harness;
+    return harness;
+}
+
+/**
+ * Generates a batch of insert oplog entries carrying a payload of 'docBytes' bytes, spread
+ * round-robin across 'numCollections' collections.
+ */
+MultiApplier::Operations makeInsertBatch(int numCollections, int docBytes) {
+    const unsigned secs = nextTimestampSecs.fetchAndAdd(1);
+    const std::string payload(docBytes, 'x');
+    MultiApplier::Operations ops;
+    ops.reserve(kOpsPerBatch);
+    for (int i = 0; i < kOpsPerBatch; i++) {
+        ops.push_back(makeInsertDocumentOplogEntry(
+            {Timestamp(secs, i + 1), 1LL},
+            SyncTailBmHarness::collectionNss(i % numCollections),
+            BSON("_id" << nextDocumentId.fetchAndAdd(1) << "payload" << payload)));
+    }
+    return ops;
+}
+
+/**
+ * Generates a batch mixing inserts, updates and deletes in equal parts. Each document is
+ * inserted, then replaced, then deleted within the batch; multiApply() partitions operations by
+ * namespace, so the three operations land on the same writer in order and always have a target.
+ */
+MultiApplier::Operations makeCrudMixBatch(int numCollections) {
+    const unsigned secs = nextTimestampSecs.fetchAndAdd(1);
+    MultiApplier::Operations ops;
+    ops.reserve(kOpsPerBatch);
+    for (int i = 0; i < kOpsPerBatch / 3; i++) {
+        const auto id = nextDocumentId.fetchAndAdd(1);
+        const auto nss = SyncTailBmHarness::collectionNss(i % numCollections);
+        ops.push_back(makeInsertDocumentOplogEntry(
+            {Timestamp(secs, 3 * i + 1), 1LL}, nss, BSON("_id" << id << "x" << 0)));
+        ops.push_back(makeUpdateDocumentOplogEntry(
+            {Timestamp(secs, 3 * i + 2), 1LL}, nss, BSON("_id" << id), BSON("_id" << id << "x" << 1)));
+        ops.push_back(makeDeleteDocumentOplogEntry(
+            {Timestamp(secs, 3 * i + 3), 1LL}, nss, BSON("_id" << id)));
+    }
+    return ops;
+}
+
+void runBatches(benchmark::State& state,
+                int writerThreads,
+                stdx::function<MultiApplier::Operations()> makeBatch) {
+    auto& harness = getHarness();
+    auto writerPool = OplogApplier::makeWriterPool(writerThreads);
+    SyncTail syncTail(nullptr,
+                      harness.getConsistencyMarkers(),
+                      harness.getStorageInterface(),
+                      multiSyncApply,
+                      writerPool.get());
+
+    std::size_t opsApplied = 0;
+    for (auto keepRunning : state) {
+        state.PauseTiming();
+        auto ops = makeBatch();
+        state.ResumeTiming();
+        opsApplied += ops.size();
+        invariant(syncTail.multiApply(harness.opCtx(), std::move(ops)).getStatus());
+    }
+    state.SetItemsProcessed(opsApplied);
+}
+
+// Arguments are {writer pool size, document payload bytes}.
+void BM_SyncTailMultiApplyInserts(benchmark::State& state) {
+    const int docBytes = state.range(1);
+    runBatches(state, state.range(0), [docBytes] {
+        return makeInsertBatch(kMaxCollections, docBytes);
+    });
+}
+
+// Arguments are {writer pool size, number of target collections}.
+void BM_SyncTailMultiApplyCrudMix(benchmark::State& state) {
+    const int numCollections = state.range(1);
+    runBatches(state, state.range(0), [numCollections] {
+        return makeCrudMixBatch(numCollections);
+    });
+}
+
+BENCHMARK(BM_SyncTailMultiApplyInserts)
+    ->Args({1, 128})
+    ->Args({2, 128})
+    ->Args({4, 128})
+    ->Args({8, 128})
+    ->Args({16, 128})
+    ->Args({8, 16})
+    ->Args({8, 1024});
+
+BENCHMARK(BM_SyncTailMultiApplyCrudMix)
+    ->Args({1, 1})
+    ->Args({4, 1})
+    ->Args({4, 8})
+    ->Args({8, 8})
+    ->Args({16, 8});
+
+}  // namespace
+}  // namespace repl
+}  // namespace mongo
@@ -456,6 +456,64 @@ TEST_F(SyncTailTest,
                                                      createOplogCollectionOptions()));
 }
 
+TEST_F(SyncTailTest, CanCoalesceOpsCollapsesRedundantWritesToTheSameDocument) {
+    NamespaceString nss("test.coalesce");
+    auto insertOp = makeInsertDocumentOplogEntry(
+        {Timestamp(Seconds(1), 0), 1LL}, nss, BSON("_id" << 0 << "x" << 1));
+    auto replaceOp1 = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(2), 0), 1LL}, nss, BSON("_id" << 0), BSON("_id" << 0 << "x" << 2));
+    auto replaceOp2 = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(3), 0), 1LL}, nss, BSON("_id" << 0), BSON("_id" << 0 << "x" << 3));
+    auto modifierOp = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(4), 0), 1LL}, nss, BSON("_id" << 0), BSON("$set" << BSON("x" << 4)));
+    auto deleteOp =
+        makeDeleteDocumentOplogEntry({Timestamp(Seconds(5), 0), 1LL}, nss, BSON("_id" << 0));
+
+    // A delete makes any earlier write to the same document redundant.
+    ASSERT_TRUE(canCoalesceOps(insertOp, deleteOp, nullptr));
+    ASSERT_TRUE(canCoalesceOps(replaceOp1, deleteOp, nullptr));
+    ASSERT_TRUE(canCoalesceOps(modifierOp, deleteOp, nullptr));
+
+    // A whole-document replacement only subsumes another whole-document replacement.
+    ASSERT_TRUE(canCoalesceOps(replaceOp1, replaceOp2, nullptr));
+    ASSERT_FALSE(canCoalesceOps(insertOp, replaceOp1, nullptr));
+    ASSERT_FALSE(canCoalesceOps(modifierOp, replaceOp1, nullptr));
+    ASSERT_FALSE(canCoalesceOps(replaceOp1, modifierOp, nullptr));
+
+    // An insert never supersedes an earlier operation.
+    ASSERT_FALSE(canCoalesceOps(deleteOp, insertOp, nullptr));
+}
+
+TEST_F(SyncTailTest, CanCoalesceOpsRequiresSameDocumentAndPlainWrites) {
+    NamespaceString nss("test.coalesce");
+    NamespaceString otherNss("test.other");
+    auto replaceOp = makeUpdateDocumentOplogEntry(
+        {Timestamp(Seconds(1), 0), 1LL}, nss, BSON("_id" << 0), BSON("_id" << 0 << "x" << 1));
+    auto deleteOp =
+        makeDeleteDocumentOplogEntry({Timestamp(Seconds(2), 0), 1LL}, nss, BSON("_id" << 0));
+
+    // Different document or different namespace.
+    auto deleteOtherId =
+        makeDeleteDocumentOplogEntry({Timestamp(Seconds(3), 0), 1LL}, nss, BSON("_id" << 1));
+    ASSERT_FALSE(canCoalesceOps(replaceOp, deleteOtherId, nullptr));
+    auto deleteOtherNss =
+        makeDeleteDocumentOplogEntry({Timestamp(Seconds(4), 0), 1LL}, otherNss, BSON("_id" << 0));
+    ASSERT_FALSE(canCoalesceOps(replaceOp, deleteOtherNss, nullptr));
+
+    // Non-CRUD operations never participate.
+    auto commandOp = makeCommandOplogEntry(
+        {Timestamp(Seconds(5), 0), 1LL}, nss, BSON("drop" << nss.coll()));
+    ASSERT_FALSE(canCoalesceOps(commandOp, deleteOp, nullptr));
+
+    // Writes carrying session information must be applied in full.
+    OperationSessionInfo sessionInfo;
+    sessionInfo.setSessionId(makeLogicalSessionIdForTest());
+    sessionInfo.setTxnNumber(1);
+    auto sessionInsertOp = makeInsertDocumentOplogEntryWithSessionInfo(
+        {Timestamp(Seconds(6), 0), 1LL}, nss, BSON("_id" << 0), sessionInfo);
+    ASSERT_FALSE(canCoalesceOps(sessionInsertOp, deleteOp, nullptr));
+}
+
 TEST_F(SyncTailTest, MultiSyncApplyUsesSyncApplyToApplyOperation) {
     NamespaceString nss("local." + _agent.getSuiteName() + "_" + _agent.getTestName());
     auto op = makeCreateCollectionOplogEntry({Timestamp(Seconds(1), 0), 1LL}, nss);
@@ -805,6 +863,29 @@ TEST_F(SyncTailTest, MultiSyncApplyLimitsBatchSizeWhenGroupingInsertOperations)
     ASSERT_BSONOBJ_EQ(insertOps[3].getObject(), singleInsertDocumentGroup[0]);
 }
 
+TEST_F(SyncTailTest, MultiSyncApplyAppliesGroupedUpdateAndDeleteOperations) {
+    int seconds = 1;
+    auto nextOpTime = [&seconds]() { return OpTime(Timestamp(Seconds(seconds++), 0), 1LL); };
+    NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
+    auto createOp = makeCreateCollectionOplogEntry(nextOpTime(), nss);
+    auto insertOp1 = makeInsertDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << 0 << "x" << 0));
+    auto insertOp2 = makeInsertDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << 1 << "x" << 0));
+
+    // A run of updates and deletes on the same namespace is applied as a single group.
+    auto updateOp1 = makeUpdateDocumentOplogEntry(
+        nextOpTime(), nss, BSON("_id" << 0), BSON("$set" << BSON("x" << 1)));
+    auto updateOp2 = makeUpdateDocumentOplogEntry(
+        nextOpTime(), nss, BSON("_id" << 1), BSON("$set" << BSON("x" << 2)));
+    auto deleteOp = makeDeleteDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << 0));
+
+    ASSERT_OK(
+        runOpsSteadyState({createOp, insertOp1, insertOp2, updateOp1, updateOp2, deleteOp}));
+
+    DBDirectClient client(_opCtx.get());
+    ASSERT_TRUE(client.findOne(nss.ns(), {BSON("_id" << 0)}).isEmpty());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1 << "x" << 2), client.findOne(nss.ns(), {BSON("_id" << 1)}));
+}
+
 TEST_F(SyncTailTest, MultiSyncApplyAppliesOpIndividuallyWhenOpIndividuallyExceedsBatchSize) {
     int seconds = 1;
     NamespaceString nss("test." + _agent.getSuiteName() + "_" + _agent.getTestName());
@@ -49,6 +49,7 @@
 #include "mongo/s/catalog/type_shard_database.h"
 #include "mongo/s/catalog_cache_loader.h"
 #include "mongo/s/grid.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/log.h"
 
 namespace mongo {
@@ -143,10 +144,68 @@ void onConfigDeleteInvalidateCachedCollectionMetadataAndNotify(OperationContext*
     opCtx->recoveryUnit()->registerChange(new CollectionVersionLogOpHandler(opCtx, deletedNss));
 }
 
+// The number of bytes a thread may accumulate for a single chunk before publishing them to the
+// chunk's shared writes tracker.
+const uint64_t kChunkWriteBufferDrainThresholdBytes = 32 * 1024;
+
+// The maximum number of chunks a thread buffers bytes for before publishing everything it holds,
+// which bounds both the buffer's memory footprint and how long an idle chunk's bytes can remain
+// unreported.
+const size_t kMaxLocallyBufferedChunks = 64;
+
+/**
+ * Per-thread buffer of bytes written to chunks. Concurrent writers to a hot chunk would otherwise
+ * all contend on the cache line holding the chunk's shared byte counter; accumulating a thread's
+ * writes locally and publishing them in batches amortizes that traffic, and lets the caller run
+ * the split-candidate check only when a batch is published rather than for every document.
+ */
+class ChunkWriteBuffer {
+public:
+    ~ChunkWriteBuffer() {
+        publishAll();
+    }
+
+    /**
+     * Credits 'bytes' to 'tracker'. Returns the number of bytes published to the shared tracker by
+     * this call, which is zero until the locally buffered total crosses the drain threshold.
+     */
+    uint64_t add(const std::shared_ptr<ChunkWritesTracker>& tracker, uint64_t bytes) {
+        auto& buffered = _bufferedBytes[tracker];
+        buffered += bytes;
+        if (buffered < kChunkWriteBufferDrainThresholdBytes) {
+            return 0;
+        }
+
+        const auto toPublish = buffered;
+        _bufferedBytes.erase(tracker);
+        tracker->addBytesWritten(toPublish);
+
+        if (_bufferedBytes.size() > kMaxLocallyBufferedChunks) {
+            publishAll();
+        }
+
+        return toPublish;
+    }
+
+    void publishAll() {
+        for (auto&& entry : _bufferedBytes) {
+            entry.first->addBytesWritten(entry.second);
+        }
+        _bufferedBytes.clear();
+    }
+
+private:
+    // Holding the tracker by shared_ptr keeps it valid even if the routing table entry that owns
+    // the chunk is replaced before this thread drains its buffered bytes.
+    stdx::unordered_map<std::shared_ptr<ChunkWritesTracker>, uint64_t> _bufferedBytes;
+};
+
+thread_local ChunkWriteBuffer chunkWriteBuffer;
+
 /**
- * If the collection is sharded, finds the chunk that contains the specified document and increments
- * the size tracked for that chunk by the specified amount of data written, in bytes. Returns the
- * number of total bytes on that chunk after the data is written.
+ * If the collection is sharded, finds the chunk that contains the specified document and credits
+ * the size tracked for that chunk with the specified amount of data written, in bytes. The bytes
+ * are buffered per thread and only folded into the chunk's shared tracker periodically.
  */
 void incrementChunkOnInsertOrUpdate(OperationContext* opCtx,
                                     const NamespaceString& nss,
@@ -173,10 +232,12 @@ void incrementChunkOnInsertOrUpdate(OperationContext* opCtx,
     // collations.
     auto chunk = chunkManager.findIntersectingChunkWithSimpleCollation(shardKey);
     auto chunkWritesTracker = chunk.getWritesTracker();
-    chunkWritesTracker->addBytesWritten(dataWritten);
-    // Don't trigger chunk splits from inserts happening due to migration since
-    // we don't necessarily own that chunk yet
-    if (!fromMigrate) {
+    const auto publishedBytes = chunkWriteBuffer.add(chunkWritesTracker, dataWritten);
+
+    // The split candidate check only runs when this thread publishes a batch of buffered bytes.
+    // Don't trigger chunk splits from inserts happening due to migration since we don't
+    // necessarily own that chunk yet.
+    if (publishedBytes > 0 && !fromMigrate) {
         const auto balancerConfig = Grid::get(opCtx)->getBalancerConfiguration();
 
         if (balancerConfig->getShouldAutoSplit() &&
@@ -188,7 +249,7 @@ void incrementChunkOnInsertOrUpdate(OperationContext* opCtx,
                                                        nss,
                                                        chunk.getMin(),
                                                        chunk.getMax(),
-                                                       dataWritten);
+                                                       publishedBytes);
             }
         }
     }
@@ -49,6 +49,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/system_clock_source.h"
 #include "mongo/util/system_tick_source.h"
 
@@ -87,18 +88,44 @@ bool supportsDocLocking() {
     return _supportsDocLocking;
 }
 
+namespace {
+
+// One client registry bucket per core, rounded up to a power of two with a floor of 16, spreads
+// client creation and destruction across enough mutexes that connection churn rarely contends.
+size_t numClientBuckets() {
+    size_t buckets = 16;
+    const auto cores = ProcessInfo::getNumAvailableCores();
+    while (buckets < cores) {
+        buckets *= 2;
+    }
+    return buckets;
+}
+
+}  // namespace
+
 ServiceContext::ServiceContext()
-    : _tickSource(stdx::make_unique<SystemTickSource>()),
+    : _clientBuckets(numClientBuckets()),
+      _tickSource(stdx::make_unique<SystemTickSource>()),
       _fastClockSource(stdx::make_unique<SystemClockSource>()),
       _preciseClockSource(stdx::make_unique<SystemClockSource>()) {}
 
 ServiceContext::~ServiceContext() {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-    for (const auto& client : _clients) {
-        severe() << "Client " << client->desc() << " still exists while destroying ServiceContext@"
-                 << static_cast<void*>(this);
+    for (auto& bucket : _clientBuckets) {
+        stdx::lock_guard<stdx::mutex> lk(bucket.mutex);
+        for (const auto& client : bucket.clients) {
+            severe() << "Client " << client->desc()
+                     << " still exists while destroying ServiceContext@"
+                     << static_cast<void*>(this);
+        }
+        invariant(bucket.clients.empty());
     }
-    invariant(_clients.empty());
+}
+
+ServiceContext::ClientBucket& ServiceContext::_bucketForClient(Client* client) {
+    // Heap pointers share their low bits due to allocator alignment, so shift those out before
+    // taking the bucket index.
+    return _clientBuckets[(reinterpret_cast<uintptr_t>(client) >> 4) &
+                          (_clientBuckets.size() - 1)];
 }
 
 namespace {
@@ -159,8 +186,9 @@ ServiceContext::UniqueClient ServiceContext::makeClient(std::string desc,
     std::unique_ptr<Client> client(new Client(std::move(desc), this, std::move(session)));
     onCreate(client.get(), _clientObservers);
     {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
-        invariant(_clients.insert(client.get()).second);
+        auto& bucket = _bucketForClient(client.get());
+        stdx::lock_guard<stdx::mutex> lk(bucket.mutex);
+        invariant(bucket.clients.insert(client.get()).second);
     }
     return UniqueClient(client.release());
 }
@@ -223,8 +251,9 @@ void ServiceContext::setServiceExecutor(std::unique_ptr<transport::ServiceExecut
 void ServiceContext::ClientDeleter::operator()(Client* client) const {
     ServiceContext* const service = client->getServiceContext();
     {
-        stdx::lock_guard<stdx::mutex> lk(service->_mutex);
-        invariant(service->_clients.erase(client));
+        auto& bucket = service->_bucketForClient(client);
+        stdx::lock_guard<stdx::mutex> lk(bucket.mutex);
+        invariant(bucket.clients.erase(client));
     }
     onDestroy(client, service->_clientObservers);
     delete client;
@@ -240,6 +269,10 @@ ServiceContext::UniqueOperationContext ServiceContext::makeOperationContext(Clie
         opCtx->setRecoveryUnit(std::make_unique<RecoveryUnitNoop>(),
                                WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
     }
+    {
+        stdx::lock_guard<stdx::mutex> regLk(_opIdRegistryMutex);
+        invariant(_clientByOperationId.emplace(opCtx->getOpID(), client).second);
+    }
     {
         stdx::lock_guard<Client> lk(*client);
         client->setOperationContext(opCtx.get());
@@ -250,6 +283,13 @@ ServiceContext::UniqueOperationContext ServiceContext::makeOperationContext(Clie
 void ServiceContext::OperationContextDeleter::operator()(OperationContext* opCtx) const {
     auto client = opCtx->getClient();
     auto service = client->getServiceContext();
+    {
+        // Delist from the operation id registry before resetting the operation on the Client, so
+        // that findOperationContext() can never observe a registered id whose operation has
+        // already been detached.
+        stdx::lock_guard<stdx::mutex> regLk(service->_opIdRegistryMutex);
+        invariant(service->_clientByOperationId.erase(opCtx->getOpID()) == 1);
+    }
     {
         stdx::lock_guard<Client> lk(*client);
         client->resetOperationContext();
@@ -263,24 +303,37 @@ void ServiceContext::registerClientObserver(std::unique_ptr<ClientObserver> obse
 }
 
 ServiceContext::LockedClientsCursor::LockedClientsCursor(ServiceContext* service)
-    : _lock(service->_mutex), _curr(service->_clients.cbegin()), _end(service->_clients.cend()) {}
+    : _service(service) {
+    // Lock every bucket, in declaration order, so the enumeration blocks client creation and
+    // destruction for its whole lifetime just as the old single registry mutex did.
+    _locks.reserve(_service->_clientBuckets.size());
+    for (auto& bucket : _service->_clientBuckets) {
+        _locks.emplace_back(bucket.mutex);
+    }
+    _curr = _service->_clientBuckets[0].clients.cbegin();
+    _end = _service->_clientBuckets[0].clients.cend();
+}
 
 Client* ServiceContext::LockedClientsCursor::next() {
-    if (_curr == _end)
-        return nullptr;
+    while (_curr == _end) {
+        if (++_bucketIndex >= _service->_clientBuckets.size())
+            return nullptr;
+        _curr = _service->_clientBuckets[_bucketIndex].clients.cbegin();
+        _end = _service->_clientBuckets[_bucketIndex].clients.cend();
+    }
     Client* result = *_curr;
     ++_curr;
     return result;
 }
 
 void ServiceContext::setKillAllOperations() {
-    stdx::lock_guard<stdx::mutex> clientLock(_mutex);
-
-    // Ensure that all newly created operation contexts will immediately be in the interrupted state
+    // Ensure that all newly created operation contexts will immediately be in the interrupted
+    // state. Clients registered after the cursor below takes its locks will check this flag when
+    // they create an operation context.
     _globalKill.store(true);
 
     // Interrupt all active operations
-    for (auto&& client : _clients) {
+    for (LockedClientsCursor cursor(this); Client* client = cursor.next();) {
         stdx::lock_guard<Client> lk(*client);
         auto opCtxToKill = client->getOperationContext();
         if (opCtxToKill) {
@@ -289,6 +342,7 @@ void ServiceContext::setKillAllOperations() {
     }
 
     // Notify any listeners who need to reach to the server shutting down
+    stdx::lock_guard<stdx::mutex> clientLock(_mutex);
     for (const auto listener : _killOpListeners) {
         try {
             listener->interruptAll();
@@ -310,6 +364,31 @@ void ServiceContext::killOperation(OperationContext* opCtx, ErrorCodes::Error ki
     }
 }
 
+boost::optional<std::tuple<stdx::unique_lock<Client>, OperationContext*>>
+ServiceContext::findOperationContext(unsigned int opId) {
+    stdx::lock_guard<stdx::mutex> regLk(_opIdRegistryMutex);
+
+    auto it = _clientByOperationId.find(opId);
+    if (it == _clientByOperationId.end()) {
+        return boost::none;
+    }
+
+    // Holding the registry mutex keeps the entry - and therefore the operation and its Client -
+    // alive, because the OperationContext deleter delists the id before tearing anything down.
+    // Taking the Client lock here cannot deadlock since neither registration nor delisting holds
+    // the Client lock while acquiring the registry mutex.
+    stdx::unique_lock<Client> lk(*it->second);
+
+    OperationContext* opCtx = it->second->getOperationContext();
+    if (!opCtx || opCtx->getOpID() != opId) {
+        // The operation is registered but not yet attached to, or already detached from, its
+        // Client.
+        return boost::none;
+    }
+
+    return {std::make_tuple(std::move(lk), opCtx)};
+}
+
 void ServiceContext::killAllUserOperations(const OperationContext* opCtx,
                                            ErrorCodes::Error killCode) {
     for (LockedClientsCursor cursor(this); Client* client = cursor.next();) {
@@ -32,6 +32,7 @@
 
 #include <boost/optional.hpp>
 #include <functional>
+#include <tuple>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
@@ -43,6 +44,7 @@
 #include "mongo/stdx/list.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/session.h"
@@ -162,7 +164,9 @@ public:
         Client* next();
 
     private:
-        stdx::unique_lock<stdx::mutex> _lock;
+        ServiceContext* _service;
+        std::vector<stdx::unique_lock<stdx::mutex>> _locks;
+        size_t _bucketIndex = 0;
         ClientSet::const_iterator _curr;
         ClientSet::const_iterator _end;
     };
@@ -361,6 +365,14 @@ public:
     void killOperation(OperationContext* opCtx,
                        ErrorCodes::Error killCode = ErrorCodes::Interrupted);
 
+    /**
+     * Returns the active operation with id "opId", together with a lock on its owning Client, or
+     * boost::none if no such operation exists. Resolved through the operation id registry, so the
+     * lookup is O(1) rather than a scan of all clients.
+     */
+    boost::optional<std::tuple<stdx::unique_lock<Client>, OperationContext*>> findOperationContext(
+        unsigned int opId);
+
     /**
      * Kills all operations that have a Client that is associated with an incoming user
      * connection, except for the one associated with opCtx.
@@ -552,11 +564,24 @@ private:
      */
     std::unique_ptr<transport::ServiceExecutor> _serviceExecutor;
 
+    /**
+     * A bucket of the sharded client registry. Clients are spread across buckets by pointer hash
+     * so that connection open and close do not all serialize on one registry mutex; a Client lives
+     * in exactly one bucket for its whole lifetime. LockedClientsCursor locks every bucket for the
+     * duration of an enumeration, preserving the old single-mutex semantics for scans.
+     */
+    struct ClientBucket {
+        stdx::mutex mutex;
+        ClientSet clients;
+    };
+
+    ClientBucket& _bucketForClient(Client* client);
+
     /**
      * Vector of registered observers.
      */
     std::vector<ClientObserverHolder> _clientObservers;
-    ClientSet _clients;
+    std::vector<ClientBucket> _clientBuckets;
 
     /**
      * The registered OpObserver.
@@ -585,6 +610,14 @@ private:
     // Counter for assigning operation ids.
     AtomicUInt32 _nextOpId{1};
 
+    // Maps the id of every active operation to the Client that owns it, so that kill and currentOp
+    // targeting by operation id is a hash lookup instead of a scan of all clients. Entries are
+    // added when an OperationContext is created and removed when it is destroyed, in both cases
+    // while not holding the Client lock; findOperationContext() relies on that ordering to lock
+    // the Client under '_opIdRegistryMutex' without risking a lock cycle.
+    stdx::mutex _opIdRegistryMutex;
+    stdx::unordered_map<unsigned int, Client*> _clientByOperationId;
+
     bool _startupComplete = false;
     stdx::condition_variable _startupCompleteCondVar;
 };
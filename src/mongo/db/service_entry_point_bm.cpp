@@ -0,0 +1,163 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+#include <boost/optional.hpp>
+
+#include "mongo/db/client.h"
+#include "mongo/db/dbmessage.h"
+#include "mongo/db/jsobj.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/service_context_d_test_fixture.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/rpc/op_msg.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/transport/service_entry_point.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+namespace {
+
+const int kMaxPerfThreads = 16;  // max number of threads to drive requests with
+
+const char kCollName[] = "coll";
+const char kDbName[] = "service_entry_point_bm";
+
+// _ids below kMaxPerfThreads are seeded at startup so the find and update benchmarks always have
+// a document to hit; the insert benchmark allocates fresh _ids above them.
+AtomicInt64 nextInsertId(kMaxPerfThreads);
+
+/**
+ * Stands up a mongod-like ServiceContext around the "ephemeralForTest" storage engine so OP_MSG
+ * requests can be driven through the real ServiceEntryPointMongod dispatch path without a network.
+ * Reuses the unit-test fixture for the storage engine and service-context plumbing, plus a mock
+ * replication coordinator in the primary state so writes are accepted.
+ */
+class ServiceEntryPointBmHarness : public ServiceContextMongoDTest {
+public:
+    ServiceEntryPointBmHarness() {
+        auto service = getServiceContext();
+        auto replCoord = stdx::make_unique<repl::ReplicationCoordinatorMock>(service);
+        invariant(replCoord->setFollowerMode(repl::MemberState::RS_PRIMARY));
+        repl::ReplicationCoordinator::set(service, std::move(replCoord));
+
+        for (int id = 0; id < kMaxPerfThreads; id++) {
+            runCommand(BSON("insert" << kCollName << "documents"
+                                     << BSON_ARRAY(BSON("_id" << id << "counter" << 0))));
+        }
+    }
+
+    /**
+     * Serializes 'body' as an OP_MSG command against kDbName, runs it through the service entry
+     * point on a fresh operation context and the current thread's Client, and uasserts that the
+     * command succeeded.
+     */
+    void runCommand(const BSONObj& body) {
+        auto opCtx = Client::getCurrent()->makeOperationContext();
+        auto request = OpMsgRequest::fromDBAndBody(kDbName, body).serialize();
+        auto dbResponse =
+            getServiceContext()->getServiceEntryPoint()->handleRequest(opCtx.get(), request);
+        auto reply = OpMsg::parse(dbResponse.response).body;
+        uassert(51028,
+                str::stream() << "benchmark command failed: " << reply.toString(),
+                reply["ok"].trueValue());
+    }
+};
+
+ServiceEntryPointBmHarness& getHarness() {
+    // Constructed on first use, after benchmark_main has run the global initializers, and torn
+    // down at process exit. The benchmarks below share one harness so each variant measures
+    // request dispatch rather than storage engine startup.
+    static ServiceEntryPointBmHarness harness;
+    return harness;
+}
+
+void BM_ServiceEntryPointInsert(benchmark::State& state) {
+    auto& harness = getHarness();
+
+    // The thread that built the harness already has a Client; every other worker needs its own.
+    boost::optional<ThreadClient> threadClient;
+    if (!haveClient()) {
+        threadClient.emplace("serviceEntryPointBmInsert", getGlobalServiceContext());
+    }
+
+    for (auto keepRunning : state) {
+        harness.runCommand(
+            BSON("insert" << kCollName << "documents"
+                          << BSON_ARRAY(BSON("_id" << nextInsertId.fetchAndAdd(1)))));
+    }
+}
+
+void BM_ServiceEntryPointFind(benchmark::State& state) {
+    auto& harness = getHarness();
+
+    boost::optional<ThreadClient> threadClient;
+    if (!haveClient()) {
+        threadClient.emplace("serviceEntryPointBmFind", getGlobalServiceContext());
+    }
+
+    for (auto keepRunning : state) {
+        harness.runCommand(BSON("find" << kCollName << "filter" << BSON("_id" << state.thread_index)
+                                       << "limit"
+                                       << 1
+                                       << "singleBatch"
+                                       << true));
+    }
+}
+
+void BM_ServiceEntryPointUpdate(benchmark::State& state) {
+    auto& harness = getHarness();
+
+    boost::optional<ThreadClient> threadClient;
+    if (!haveClient()) {
+        threadClient.emplace("serviceEntryPointBmUpdate", getGlobalServiceContext());
+    }
+
+    // Each thread updates its own seeded document so the benchmark scales with dispatch overhead
+    // rather than document-level contention.
+    for (auto keepRunning : state) {
+        harness.runCommand(
+            BSON("update" << kCollName << "updates"
+                          << BSON_ARRAY(BSON("q" << BSON("_id" << state.thread_index) << "u"
+                                                 << BSON("$inc" << BSON("counter" << 1))))));
+    }
+}
+
+BENCHMARK(BM_ServiceEntryPointInsert)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK(BM_ServiceEntryPointFind)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK(BM_ServiceEntryPointUpdate)->ThreadRange(1, kMaxPerfThreads);
+
+}  // namespace
+}  // namespace mongo
@@ -72,6 +72,7 @@
 #include "mongo/db/session_catalog_mongod.h"
 #include "mongo/db/snapshot_window_util.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/db/stats/operation_trace.h"
 #include "mongo/db/stats/top.h"
 #include "mongo/db/transaction_coordinator_factory.h"
 #include "mongo/db/transaction_participant.h"
@@ -86,6 +87,7 @@
 #include "mongo/rpc/metadata/tracking_metadata.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/rpc/reply_builder_interface.h"
+#include "mongo/transport/session.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
@@ -99,6 +101,40 @@ MONGO_FAIL_POINT_DEFINE(skipCheckingForNotMasterInCommandDispatch);
 namespace {
 using logger::LogComponent;
 
+// Replies larger than this are not retained for reuse, so one outsized reply does not pin a large
+// buffer to its connection for the connection's lifetime.
+const size_t kMaxRetainedReplyBufferBytes = 32 * 1024;
+
+// Holds the buffer of the last OP_MSG reply sent on a session so that the next reply on that
+// session can be built into it instead of allocating a fresh buffer chain. The slot keeps a
+// reference alongside the in-flight response; by the time the next request arrives the transport
+// layer has released its reference and the buffer is reusable.
+const auto retainedReplyBuffer = transport::Session::declareDecoration<SharedBuffer>();
+
+SharedBuffer takeReusableReplyBuffer(OperationContext* opCtx) {
+    const auto& session = opCtx->getClient()->session();
+    if (!session) {
+        return {};
+    }
+    auto& retained = retainedReplyBuffer(session.get());
+    if (!retained || retained.isShared()) {
+        return {};
+    }
+    return std::move(retained);
+}
+
+void retainReplyBufferForReuse(OperationContext* opCtx, DbResponse& dbresponse) {
+    if (dbresponse.response.empty() || dbresponse.response.operation() != dbMsg ||
+        dbresponse.response.sharedBuffer().capacity() > kMaxRetainedReplyBufferBytes) {
+        return;
+    }
+    const auto& session = opCtx->getClient()->session();
+    if (!session) {
+        return;
+    }
+    retainedReplyBuffer(session.get()) = dbresponse.response.sharedBuffer();
+}
+
 void generateLegacyQueryErrorResponse(const AssertionException& exception,
                                       const QueryMessage& queryMessage,
                                       CurOp* curop,
@@ -853,7 +889,10 @@ void curOpCommandSetup(OperationContext* opCtx, const OpMsgRequest& request) {
 DbResponse receivedCommands(OperationContext* opCtx,
                             const Message& message,
                             const ServiceEntryPointCommon::Hooks& behaviors) {
-    auto replyBuilder = rpc::makeReplyBuilder(rpc::protocolForMessage(message));
+    const auto protocol = rpc::protocolForMessage(message);
+    auto replyBuilder = rpc::makeReplyBuilder(
+        protocol,
+        protocol == rpc::Protocol::kOpMsg ? takeReusableReplyBuffer(opCtx) : SharedBuffer());
     [&] {
         OpMsgRequest request;
         try {  // Parse.
@@ -1144,6 +1183,9 @@ DbResponse ServiceEntryPointCommon::handleRequest(OperationContext* opCtx,
     NetworkOp op = m.operation();
     bool isCommand = false;
 
+    OperationTrace::OpGuard operationTraceGuard(networkOpToString(op));
+    OPERATION_TRACE_SPAN("handleRequest");
+
     DbMessage dbmsg(m);
 
     Client& c = *opCtx->getClient();
@@ -1267,6 +1309,7 @@ DbResponse ServiceEntryPointCommon::handleRequest(OperationContext* opCtx,
     }
 
     recordCurOpMetrics(opCtx);
+    retainReplyBufferForReuse(opCtx, dbresponse);
     return dbresponse;
 }
 
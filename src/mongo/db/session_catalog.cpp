@@ -50,17 +50,21 @@ const auto operationSessionDecoration =
 }  // namespace
 
 SessionCatalog::~SessionCatalog() {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
-    for (const auto& entry : _sessions) {
-        auto& sri = entry.second;
-        invariant(!sri->session.currentOperation());
-        invariant(!sri->session.killed());
+    for (auto& shard : _shards) {
+        stdx::lock_guard<stdx::mutex> lg(shard.mutex);
+        for (const auto& entry : shard.sessions) {
+            auto& sri = entry.second;
+            invariant(!sri->session.currentOperation());
+            invariant(!sri->session.killed());
+        }
     }
 }
 
 void SessionCatalog::reset_forTest() {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
-    _sessions.clear();
+    for (auto& shard : _shards) {
+        stdx::lock_guard<stdx::mutex> lg(shard.mutex);
+        shard.sessions.clear();
+    }
 }
 
 SessionCatalog* SessionCatalog::get(OperationContext* opCtx) {
@@ -85,8 +89,9 @@ ScopedCheckedOutSession SessionCatalog::checkOutSession(OperationContext* opCtx,
     invariant(!opCtx->lockState()->inAWriteUnitOfWork());
     invariant(!opCtx->lockState()->isLocked());
 
-    stdx::unique_lock<stdx::mutex> ul(_mutex);
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, opCtx, lsid);
+    auto& shard = _shardFor(lsid);
+    stdx::unique_lock<stdx::mutex> ul(shard.mutex);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, shard, lsid);
 
     // Wait until the session is no longer checked out and until the previously scheduled kill has
     // completed
@@ -109,8 +114,9 @@ ScopedCheckedOutSession SessionCatalog::checkOutSessionForKill(OperationContext*
 
     const auto lsid = killToken.lsidToKill;
 
-    stdx::unique_lock<stdx::mutex> ul(_mutex);
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, opCtx, lsid);
+    auto& shard = _shardFor(lsid);
+    stdx::unique_lock<stdx::mutex> ul(shard.mutex);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, shard, lsid);
     invariant(sri->session.killed());
 
     // Wait until the session is no longer checked out
@@ -126,31 +132,41 @@ ScopedCheckedOutSession SessionCatalog::checkOutSessionForKill(OperationContext*
 
 void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                                   const ScanSessionsCallbackFn& workerFn) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
+    size_t scannedCount = 0;
 
-    LOG(2) << "Beginning scanSessions. Scanning " << _sessions.size() << " sessions.";
+    for (auto& shard : _shards) {
+        stdx::lock_guard<stdx::mutex> lg(shard.mutex);
+        scannedCount += shard.sessions.size();
 
-    for (auto& sessionEntry : _sessions) {
-        if (matcher.match(sessionEntry.first)) {
-            workerFn(lg, &sessionEntry.second->session);
+        for (auto& sessionEntry : shard.sessions) {
+            if (matcher.match(sessionEntry.first)) {
+                workerFn(lg, &sessionEntry.second->session);
+            }
         }
     }
+
+    LOG(2) << "Completed scanSessions. Scanned " << scannedCount << " sessions.";
 }
 
 Session::KillToken SessionCatalog::killSession(const LogicalSessionId& lsid) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
-    auto it = _sessions.find(lsid);
-    uassert(ErrorCodes::NoSuchSession, "Session not found", it != _sessions.end());
+    auto& shard = _shardFor(lsid);
+    stdx::lock_guard<stdx::mutex> lg(shard.mutex);
+    auto it = shard.sessions.find(lsid);
+    uassert(ErrorCodes::NoSuchSession, "Session not found", it != shard.sessions.end());
 
     auto& sri = it->second;
     return sri->session.kill(lg);
 }
 
+SessionCatalog::Shard& SessionCatalog::_shardFor(const LogicalSessionId& lsid) {
+    return _shards[LogicalSessionIdHash{}(lsid) & (kNumShards - 1)];
+}
+
 std::shared_ptr<SessionCatalog::SessionRuntimeInfo> SessionCatalog::_getOrCreateSessionRuntimeInfo(
-    WithLock, OperationContext* opCtx, const LogicalSessionId& lsid) {
-    auto it = _sessions.find(lsid);
-    if (it == _sessions.end()) {
-        it = _sessions.emplace(lsid, std::make_shared<SessionRuntimeInfo>(lsid)).first;
+    WithLock, Shard& shard, const LogicalSessionId& lsid) {
+    auto it = shard.sessions.find(lsid);
+    if (it == shard.sessions.end()) {
+        it = shard.sessions.emplace(lsid, std::make_shared<SessionRuntimeInfo>(lsid)).first;
     }
 
     return it->second;
@@ -158,11 +174,12 @@ std::shared_ptr<SessionCatalog::SessionRuntimeInfo> SessionCatalog::_getOrCreate
 
 void SessionCatalog::_releaseSession(std::shared_ptr<SessionCatalog::SessionRuntimeInfo> sri,
                                      boost::optional<Session::KillToken> killToken) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
+    auto& shard = _shardFor(sri->session.getSessionId());
+    stdx::lock_guard<stdx::mutex> lg(shard.mutex);
 
     // Make sure we have exactly the same session on the map and that it is still associated with an
     // operation context (meaning checked-out)
-    invariant(_sessions[sri->session.getSessionId()] == sri);
+    invariant(shard.sessions[sri->session.getSessionId()] == sri);
     invariant(sri->session.currentOperation());
 
     sri->session._markCheckedIn(lg);
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/optional.hpp>
 #include <vector>
 
@@ -102,8 +103,10 @@ public:
      * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
      * each Session which matches the specified 'matcher'.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
-     * not allowed to block, perform I/O or acquire any lock manager locks.
+     * NOTE: Since this method runs with a catalog shard's mutex held, the work done by 'workerFn'
+     * is not allowed to block, perform I/O or acquire any lock manager locks. The scan covers the
+     * shards one at a time, so it is not an atomic snapshot of the whole catalog with respect to
+     * concurrently created sessions.
      * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
      * SessionCatalog.
      *
@@ -114,7 +117,7 @@ public:
                       const ScanSessionsCallbackFn& workerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under its shard's mutex. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     Session::KillToken killSession(const LogicalSessionId& lsid);
@@ -127,18 +130,32 @@ private:
         // currently has it checked out
         Session session;
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the owning shard's mutex to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
     };
 
     /**
-     * May release and re-acquire it zero or more times before returning. The returned
-     * 'SessionRuntimeInfo' is guaranteed to be linked on the catalog's _txnTable as long as the
-     * lock is held.
+     * The catalog is partitioned by the hash of the logical session id so that sessions with
+     * different ids do not contend on a single mutex during checkout. A given session's runtime
+     * state is only ever mutated under its shard's mutex, which is the lock passed as the
+     * WithLock token to the Session state transition methods.
+     */
+    struct Shard {
+        stdx::mutex mutex;
+
+        // Owns the Session objects for all current Sessions mapping to this shard.
+        LogicalSessionIdMap<std::shared_ptr<SessionRuntimeInfo>> sessions;
+    };
+
+    Shard& _shardFor(const LogicalSessionId& lsid);
+
+    /**
+     * Must be called under the shard's mutex. The returned 'SessionRuntimeInfo' is guaranteed
+     * to be linked on the shard's sessions map as long as the lock is held.
      */
     std::shared_ptr<SessionRuntimeInfo> _getOrCreateSessionRuntimeInfo(
-        WithLock, OperationContext* opCtx, const LogicalSessionId& lsid);
+        WithLock, Shard& shard, const LogicalSessionId& lsid);
 
     /**
      * Makes a session, previously checked out through 'checkoutSession', available again.
@@ -146,10 +163,10 @@ private:
     void _releaseSession(std::shared_ptr<SessionRuntimeInfo> sri,
                          boost::optional<Session::KillToken> killToken);
 
-    stdx::mutex _mutex;
+    // Must be a power of two
+    static constexpr size_t kNumShards = 16;
 
-    // Owns the Session objects for all current Sessions.
-    LogicalSessionIdMap<std::shared_ptr<SessionRuntimeInfo>> _sessions;
+    std::array<Shard, kNumShards> _shards;
 };
 
 /**
@@ -32,6 +32,7 @@
 
 #include "mongo/db/sessions_collection.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -41,13 +42,22 @@
 #include "mongo/db/logical_session_id.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/refresh_sessions_gen.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/write_ops/batched_command_response.h"
 #include "mongo/stdx/functional.h"
 #include "mongo/stdx/memory.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
+// How long to pause between consecutive batches of a multi-batch session refresh. Refresh rounds
+// on deployments with hundreds of thousands of active sessions would otherwise hit the sessions
+// collection with one solid burst of upserts; the pause spreads that write load over the refresh
+// interval. Single-batch refreshes, including those driven by the refreshSessions command, never
+// pause.
+MONGO_EXPORT_SERVER_PARAMETER(sessionsRefreshPauseBetweenBatchesMillis, int, 100);
+
 constexpr StringData SessionsCollection::kSessionsTTLIndex;
 
 namespace {
@@ -222,12 +232,38 @@ Status SessionsCollection::doRefresh(const NamespaceString& ns,
         batch->append(WriteConcernOptions::kWriteConcernField, kMajorityWriteConcern);
     };
 
-    auto add = [](BSONArrayBuilder* entries, const LogicalSessionRecord& record) {
+    auto add = [](BSONArrayBuilder* entries, const LogicalSessionRecord* record) {
         entries->append(
-            BSON("q" << lsidQuery(record) << "u" << updateQuery(record) << "upsert" << true));
+            BSON("q" << lsidQuery(*record) << "u" << updateQuery(*record) << "upsert" << true));
+    };
+
+    // Order the records by session id. The sessions collection is sharded on the session id, so
+    // a sorted refresh forms batches of contiguous key runs and each batch targets as few shards
+    // as possible.
+    std::vector<const LogicalSessionRecord*> orderedSessions;
+    orderedSessions.reserve(sessions.size());
+    for (const auto& record : sessions) {
+        orderedSessions.push_back(&record);
+    }
+    std::sort(orderedSessions.begin(),
+              orderedSessions.end(),
+              [](const LogicalSessionRecord* a, const LogicalSessionRecord* b) {
+                  return a->getId().getId() < b->getId().getId();
+              });
+
+    bool firstBatch = true;
+    auto pacedSend = [&](BSONObj batch) {
+        if (!firstBatch) {
+            const auto pause = sessionsRefreshPauseBetweenBatchesMillis.load();
+            if (pause > 0) {
+                sleepFor(Milliseconds(pause));
+            }
+        }
+        firstBatch = false;
+        return send(batch);
     };
 
-    return runBulkCmd("updates", init, add, send, sessions);
+    return runBulkCmd("updates", init, add, pacedSend, orderedSessions);
 }
 
 Status SessionsCollection::doRemove(const NamespaceString& ns,
@@ -238,25 +238,26 @@ private:
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
-        _buffer.reset(new char[blockSize]);
+        _ensureCapacity(&_buffer, &_bufferCapacity, blockSize);
         read(_buffer.get(), blockSize);
         uassert(16816, "file too short?", !_done);
 
         auto encryptionHooks = EncryptionHooks::get(getGlobalServiceContext());
         if (encryptionHooks->enabled()) {
-            std::unique_ptr<char[]> out(new char[blockSize]);
+            _ensureCapacity(&_scratch, &_scratchCapacity, blockSize);
             size_t outLen;
             Status status =
                 encryptionHooks->unprotectTmpData(reinterpret_cast<uint8_t*>(_buffer.get()),
                                                   blockSize,
-                                                  reinterpret_cast<uint8_t*>(out.get()),
+                                                  reinterpret_cast<uint8_t*>(_scratch.get()),
                                                   blockSize,
                                                   &outLen);
             uassert(28841,
                     str::stream() << "Failed to unprotect data: " << status.toString(),
                     status.isOK());
             blockSize = outLen;
-            _buffer.swap(out);
+            _buffer.swap(_scratch);
+            std::swap(_bufferCapacity, _scratchCapacity);
         }
 
         if (!compressed) {
@@ -271,16 +272,29 @@ private:
                 "couldn't get uncompressed length",
                 snappy::GetUncompressedLength(_buffer.get(), blockSize, &uncompressedSize));
 
-        std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
+        _ensureCapacity(&_scratch, &_scratchCapacity, uncompressedSize);
         uassert(17062,
                 "decompression failed",
-                snappy::RawUncompress(_buffer.get(), blockSize, decompressionBuffer.get()));
+                snappy::RawUncompress(_buffer.get(), blockSize, _scratch.get()));
 
-        // hold on to decompressed data and throw out compressed data at block exit
-        _buffer.swap(decompressionBuffer);
+        // Hold on to the decompressed data; the compressed block stays behind as scratch space for
+        // the next fill.
+        _buffer.swap(_scratch);
+        std::swap(_bufferCapacity, _scratchCapacity);
         _bufferReader.reset(new BufReader(_buffer.get(), uncompressedSize));
     }
 
+    /**
+     * Ensures 'buf' can hold at least 'size' bytes, growing it if needed. Does not preserve the
+     * buffer's contents.
+     */
+    static void _ensureCapacity(std::unique_ptr<char[]>* buf, size_t* capacity, size_t size) {
+        if (*capacity < size) {
+            buf->reset(new char[size]);
+            *capacity = size;
+        }
+    }
+
     /**
      * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
      *
@@ -305,7 +319,15 @@ private:
 
     const Settings _settings;
     bool _done;
+
+    // The current block of data being iterated, plus a scratch buffer the next block is read or
+    // decompressed into. Both are grown as needed and reused across blocks rather than reallocated
+    // for each one.
     std::unique_ptr<char[]> _buffer;
+    size_t _bufferCapacity = 0;
+    std::unique_ptr<char[]> _scratch;
+    size_t _scratchCapacity = 0;
+
     std::unique_ptr<BufReader> _bufferReader;
     std::string _fileName;          // File containing the sorted data range.
     unsigned int _fileStartOffset;  // File offset at which the sorted data range starts.
@@ -947,14 +969,13 @@ void SortedFileWriter<Key, Value>::spill() {
     if (size == 0)
         return;
 
-    std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
-    verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
+    snappy::Compress(outBuffer, size, &_compressed);
+    verify(_compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
-    const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
+    const bool shouldCompress = _compressed.size() < size_t(_buffer.len() / 10 * 9);
     if (shouldCompress) {
-        size = compressed.size();
-        outBuffer = const_cast<char*>(compressed.data());
+        size = _compressed.size();
+        outBuffer = const_cast<char*>(_compressed.data());
     }
 
     std::unique_ptr<char[]> out;
@@ -259,6 +259,10 @@ private:
     std::ofstream _file;
     BufBuilder _buffer;
 
+    // Scratch space for block compression. Reused across spill() calls so that compressing each
+    // ~64KB block does not allocate a fresh buffer.
+    std::string _compressed;
+
     // Tracks where in the file we started and finished writing the sorted data range so that the
     // information can be given to the Iterator in done(), and to the user via getFileEndOffset()
     // for the next SortedFileWriter instance using the same file.
@@ -268,7 +268,10 @@ void logMongodStartupWarnings(const StorageGlobalParams& storageParams,
             log() << startupWarningsLog;
             log() << "** WARNING: " << kTransparentHugePagesDirectory << "/enabled is 'always'."
                   << startupWarningsLog;
-            log() << "**        We suggest setting it to 'never'" << startupWarningsLog;
+            log() << "**        We suggest setting it to 'never', or to 'madvise' so that only"
+                  << startupWarningsLog;
+            log() << "**        regions the server explicitly requests are backed by huge pages"
+                  << startupWarningsLog;
             warned = true;
         }
     } else if (transparentHugePagesEnabledResult.getStatus().code() !=
@@ -68,93 +68,73 @@ void OpCounters::gotOp(int op, bool isCommand) {
     }
 }
 
-void OpCounters::_checkWrap(CacheAligned<AtomicInt64> OpCounters::*counter, int n) {
-    static constexpr auto maxCount = AtomicInt64::WordType{1} << 60;
-    auto oldValue = (this->*counter).fetchAndAddRelaxed(n);
-    if (oldValue > maxCount) {
-        _insert.store(0);
-        _query.store(0);
-        _update.store(0);
-        _delete.store(0);
-        _getmore.store(0);
-        _command.store(0);
+void OpCounters::_checkWrap(StripedCounter64 OpCounters::*counter, int n) {
+    // Bounding each stripe by 2^54 keeps the summed totals below 2^60, so they stay safely
+    // representable as doubles.
+    static constexpr int64_t maxStripeCount = int64_t(1) << 54;
+    auto stripeValue = (this->*counter).increment(n);
+    if (stripeValue > maxStripeCount) {
+        _insert.reset();
+        _query.reset();
+        _update.reset();
+        _delete.reset();
+        _getmore.reset();
+        _command.reset();
     }
 }
 
 BSONObj OpCounters::getObj() const {
     BSONObjBuilder b;
-    b.append("insert", _insert.loadRelaxed());
-    b.append("query", _query.loadRelaxed());
-    b.append("update", _update.loadRelaxed());
-    b.append("delete", _delete.loadRelaxed());
-    b.append("getmore", _getmore.loadRelaxed());
-    b.append("command", _command.loadRelaxed());
+    b.append("insert", _insert.get());
+    b.append("query", _query.get());
+    b.append("update", _update.get());
+    b.append("delete", _delete.get());
+    b.append("getmore", _getmore.get());
+    b.append("command", _command.get());
     return b.obj();
 }
 
-void NetworkCounter::hitPhysicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
+namespace {
+// Bounding each stripe by MAX / kNumStripes keeps the summed totals below MAX (2^60).
+const int64_t kMaxStripeValue = (int64_t(1) << 60) / StripedCounter64::kNumStripes;
+}  // namespace
 
+void NetworkCounter::hitPhysicalIn(long long bytes) {
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesIn.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesIn.store(bytes);
-    } else {
-        _physicalBytesIn.fetchAndAdd(bytes);
+    if (_physicalBytesIn.increment(bytes) > kMaxStripeValue) {
+        _physicalBytesIn.reset();
     }
 }
 
 void NetworkCounter::hitPhysicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesOut.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesOut.store(bytes);
-    } else {
-        _physicalBytesOut.fetchAndAdd(bytes);
+    if (_physicalBytesOut.increment(bytes) > kMaxStripeValue) {
+        _physicalBytesOut.reset();
     }
 }
 
 void NetworkCounter::hitLogicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _together.logicalBytesIn.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _together.logicalBytesIn.store(bytes);
-        // The requests field only gets incremented here (and not in hitPhysical) because the
-        // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
-        // functions would double-count the number of operations.
-        _together.requests.store(1);
-    } else {
-        _together.logicalBytesIn.fetchAndAdd(bytes);
-        _together.requests.fetchAndAdd(1);
+    if (_logicalBytesIn.increment(bytes) > kMaxStripeValue) {
+        _logicalBytesIn.reset();
+        _requests.reset();
     }
+    _requests.increment(1);
 }
 
 void NetworkCounter::hitLogicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _logicalBytesOut.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _logicalBytesOut.store(bytes);
-    } else {
-        _logicalBytesOut.fetchAndAdd(bytes);
+    if (_logicalBytesOut.increment(bytes) > kMaxStripeValue) {
+        _logicalBytesOut.reset();
     }
 }
 
 void NetworkCounter::append(BSONObjBuilder& b) {
-    b.append("bytesIn", static_cast<long long>(_together.logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_logicalBytesOut.loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_physicalBytesIn.loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_physicalBytesOut.loadRelaxed()));
-    b.append("numRequests", static_cast<long long>(_together.requests.loadRelaxed()));
+    b.append("bytesIn", _logicalBytesIn.get());
+    b.append("bytesOut", _logicalBytesOut.get());
+    b.append("physicalBytesIn", _physicalBytesIn.get());
+    b.append("physicalBytesOut", _physicalBytesOut.get());
+    b.append("numRequests", _requests.get());
 }
 
 
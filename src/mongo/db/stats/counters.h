@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include "mongo/base/counter.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/basic.h"
@@ -76,35 +77,36 @@ public:
     BSONObj getObj() const;
 
     // thse are used by snmp, and other things, do not remove
-    const AtomicInt64* getInsert() const {
+    const StripedCounter64* getInsert() const {
         return &_insert;
     }
-    const AtomicInt64* getQuery() const {
+    const StripedCounter64* getQuery() const {
         return &_query;
     }
-    const AtomicInt64* getUpdate() const {
+    const StripedCounter64* getUpdate() const {
         return &_update;
     }
-    const AtomicInt64* getDelete() const {
+    const StripedCounter64* getDelete() const {
         return &_delete;
     }
-    const AtomicInt64* getGetMore() const {
+    const StripedCounter64* getGetMore() const {
         return &_getmore;
     }
-    const AtomicInt64* getCommand() const {
+    const StripedCounter64* getCommand() const {
         return &_command;
     }
 
 private:
-    // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheAligned<AtomicInt64> OpCounters::*counter, int n);
-
-    CacheAligned<AtomicInt64> _insert;
-    CacheAligned<AtomicInt64> _query;
-    CacheAligned<AtomicInt64> _update;
-    CacheAligned<AtomicInt64> _delete;
-    CacheAligned<AtomicInt64> _getmore;
-    CacheAligned<AtomicInt64> _command;
+    // Increment member `counter` by `n`, resetting all counters if its stripe was > 2^54 (so the
+    // summed totals stay below 2^60).
+    void _checkWrap(StripedCounter64 OpCounters::*counter, int n);
+
+    StripedCounter64 _insert;
+    StripedCounter64 _query;
+    StripedCounter64 _update;
+    StripedCounter64 _delete;
+    StripedCounter64 _getmore;
+    StripedCounter64 _command;
 };
 
 extern OpCounters globalOpCounters;
@@ -124,20 +126,16 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheAligned<AtomicInt64> _physicalBytesIn{0};
-    CacheAligned<AtomicInt64> _physicalBytesOut{0};
-
-    // These two counters are always incremented at the same time, so
-    // we place them on the same cache line.
-    struct Together {
-        AtomicInt64 logicalBytesIn{0};
-        AtomicInt64 requests{0};
-    };
-    CacheAligned<Together> _together{};
-    static_assert(sizeof(decltype(_together)) <= stdx::hardware_constructive_interference_size,
-                  "cache line spill");
-
-    CacheAligned<AtomicInt64> _logicalBytesOut{0};
+    StripedCounter64 _physicalBytesIn;
+    StripedCounter64 _physicalBytesOut;
+
+    StripedCounter64 _logicalBytesIn;
+    StripedCounter64 _logicalBytesOut;
+
+    // Only incremented along with '_logicalBytesIn' (and not in hitPhysical) because hitLogical
+    // and hitPhysical are each called once per operation; incrementing in both would
+    // double-count.
+    StripedCounter64 _requests;
 };
 
 extern NetworkCounter networkCounter;
@@ -176,4 +176,19 @@ void OperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteTy
     }
 }
 
+void OperationLatencyHistogram::_addData(const HistogramData& from, HistogramData* into) {
+    for (int i = 0; i < kMaxBuckets; i++) {
+        into->buckets[i] += from.buckets[i];
+    }
+    into->entryCount += from.entryCount;
+    into->sum += from.sum;
+}
+
+void OperationLatencyHistogram::add(const OperationLatencyHistogram& other) {
+    _addData(other._reads, &_reads);
+    _addData(other._writes, &_writes);
+    _addData(other._commands, &_commands);
+    _addData(other._transactions, &_transactions);
+}
+
 }  // namespace mongo
@@ -60,6 +60,12 @@ public:
      */
     void append(bool includeHistograms, BSONObjBuilder* builder) const;
 
+    /**
+     * Adds the counts from 'other' into this histogram. Used to merge independently maintained
+     * histograms for reporting.
+     */
+    void add(const OperationLatencyHistogram& other);
+
 private:
     struct HistogramData {
         std::array<uint64_t, kMaxBuckets> buckets{};
@@ -78,6 +84,8 @@ private:
 
     void _incrementData(uint64_t latency, int bucket, HistogramData* data);
 
+    static void _addData(const HistogramData& from, HistogramData* into);
+
     HistogramData _reads, _writes, _commands, _transactions;
 };
 }  // namespace mongo
@@ -93,4 +93,21 @@ TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatency) {
         ASSERT_EQUALS(bucket["count"].Long(), (i < kMaxBuckets - 1) ? 3 : 2);
     }
 }
+
+TEST(OperationLatencyHistogram, AddMergesCounts) {
+    OperationLatencyHistogram histA, histB;
+    histA.increment(100, Command::ReadWriteType::kRead);
+    histA.increment(100, Command::ReadWriteType::kWrite);
+    histB.increment(200, Command::ReadWriteType::kRead);
+    histB.increment(200, Command::ReadWriteType::kTransaction);
+
+    histA.add(histB);
+    BSONObjBuilder outBuilder;
+    histA.append(false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), 2);
+    ASSERT_EQUALS(out["reads"]["latency"].Long(), 300);
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), 1);
+    ASSERT_EQUALS(out["transactions"]["ops"].Long(), 1);
+}
 }  // namespace mongo
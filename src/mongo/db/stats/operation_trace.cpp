@@ -0,0 +1,161 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/operation_trace.h"
+
+#include <deque>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/system_tick_source.h"
+
+namespace mongo {
+
+namespace {
+
+// 0 disables tracing entirely; N > 0 samples one in N operations entering the service entry
+// point.
+MONGO_EXPORT_SERVER_PARAMETER(operationTraceSampleRate, int, 0);
+
+const size_t kMaxSpansPerTrace = 512;
+const size_t kMaxRecentTraces = 32;
+
+struct ThreadTraceState {
+    bool active = false;
+    int depth = 0;
+    Date_t when;
+    std::string description;
+    std::vector<OperationTrace::Span> spans;
+};
+
+thread_local ThreadTraceState threadTraceState;
+
+// Round-robin counter implementing the 1-in-N sampling decision across all threads.
+AtomicInt64 sampleCounter(0);
+
+stdx::mutex recentTracesMutex;
+std::deque<OperationTrace::Trace> recentTraces;  // guarded by recentTracesMutex
+
+}  // namespace
+
+bool OperationTrace::isActive() {
+    return threadTraceState.active;
+}
+
+OperationTrace::OpGuard::OpGuard(StringData description) : _active(false) {
+    const auto rate = operationTraceSampleRate.load();
+    if (rate <= 0 || threadTraceState.active) {
+        return;
+    }
+    if (sampleCounter.fetchAndAdd(1) % rate != 0) {
+        return;
+    }
+
+    auto& state = threadTraceState;
+    state.active = true;
+    state.depth = 0;
+    state.when = Date_t::now();
+    state.description = description.toString();
+    state.spans.clear();
+    _active = true;
+}
+
+OperationTrace::OpGuard::~OpGuard() {
+    if (!_active) {
+        return;
+    }
+
+    auto& state = threadTraceState;
+    state.active = false;
+
+    Trace trace;
+    trace.when = state.when;
+    trace.description = std::move(state.description);
+    trace.spans = std::move(state.spans);
+    state.description = {};
+    state.spans = {};
+
+    stdx::lock_guard<stdx::mutex> lk(recentTracesMutex);
+    recentTraces.push_back(std::move(trace));
+    if (recentTraces.size() > kMaxRecentTraces) {
+        recentTraces.pop_front();
+    }
+}
+
+OperationTrace::SpanGuard::SpanGuard(const char* name) : _index(-1) {
+    auto& state = threadTraceState;
+    if (!state.active || state.spans.size() >= kMaxSpansPerTrace) {
+        return;
+    }
+
+    _index = state.spans.size();
+    state.spans.push_back({name, state.depth++, SystemTickSource::get()->getTicks(), 0});
+}
+
+OperationTrace::SpanGuard::~SpanGuard() {
+    if (_index < 0) {
+        return;
+    }
+
+    auto& state = threadTraceState;
+    state.depth--;
+    auto& span = state.spans[_index];
+    span.durationTicks = SystemTickSource::get()->getTicks() - span.startTicks;
+}
+
+void OperationTrace::appendRecentTraces(BSONObjBuilder* builder) {
+    const auto ticksPerSecond = SystemTickSource::get()->getTicksPerSecond();
+    auto ticksToMicros = [ticksPerSecond](int64_t ticks) {
+        return static_cast<long long>(ticks * 1000 * 1000 / ticksPerSecond);
+    };
+
+    stdx::lock_guard<stdx::mutex> lk(recentTracesMutex);
+    BSONArrayBuilder traceArray(builder->subarrayStart("traces"));
+    for (const auto& trace : recentTraces) {
+        BSONObjBuilder traceBuilder(traceArray.subobjStart());
+        traceBuilder.appendDate("when", trace.when);
+        traceBuilder.append("desc", trace.description);
+        const int64_t baseTicks = trace.spans.empty() ? 0 : trace.spans.front().startTicks;
+        BSONArrayBuilder spanArray(traceBuilder.subarrayStart("spans"));
+        for (const auto& span : trace.spans) {
+            BSONObjBuilder spanBuilder(spanArray.subobjStart());
+            spanBuilder.append("name", span.name);
+            spanBuilder.append("depth", span.depth);
+            spanBuilder.append("startMicros", ticksToMicros(span.startTicks - baseTicks));
+            spanBuilder.append("durationMicros", ticksToMicros(span.durationTicks));
+        }
+    }
+}
+
+}  // namespace mongo
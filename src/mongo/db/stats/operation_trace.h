@@ -0,0 +1,123 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/string_data.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+/**
+ * Opt-in sampled tracing of where individual operations spend their time. When the
+ * 'operationTraceSampleRate' server parameter is set to N > 0, one in N operations entering the
+ * service entry point records nested, tick-stamped spans from instrumentation points placed on
+ * hot paths (command dispatch, plan execution, storage transactions, write concern waits). The
+ * most recently completed traces are reported by the "operationTraces" serverStatus section.
+ *
+ * Spans land in a per-thread buffer, so the facility assumes an operation stays on one thread for
+ * its lifetime, which holds for the synchronous dispatch path. With sampling disabled (the
+ * default) each instrumentation point reduces to a thread-local flag check.
+ */
+class OperationTrace {
+public:
+    struct Span {
+        const char* name;      // Static string naming the instrumented section.
+        int depth;             // Nesting depth within the operation, starting at 0.
+        int64_t startTicks;    // Tick-source reading when the span began.
+        int64_t durationTicks; // Span length, in tick-source ticks.
+    };
+
+    struct Trace {
+        Date_t when;
+        std::string description;
+        std::vector<Span> spans;
+    };
+
+    /**
+     * Returns true if the current thread is recording spans for a sampled operation.
+     */
+    static bool isActive();
+
+    /**
+     * Decides at construction whether the operation beginning on this thread is sampled, and on
+     * destruction publishes the recorded spans to the recent-traces buffer. Placed once per
+     * operation, at the service entry point.
+     */
+    class OpGuard {
+        MONGO_DISALLOW_COPYING(OpGuard);
+
+    public:
+        explicit OpGuard(StringData description);
+        ~OpGuard();
+
+    private:
+        bool _active;
+    };
+
+    /**
+     * Records one span. 'name' must point at storage that outlives the operation, in practice a
+     * string literal.
+     */
+    class SpanGuard {
+        MONGO_DISALLOW_COPYING(SpanGuard);
+
+    public:
+        explicit SpanGuard(const char* name);
+        ~SpanGuard();
+
+    private:
+        int _index;  // Index of our span in the thread's buffer, or -1 when not tracing.
+    };
+
+    /**
+     * Appends the most recently completed traces to 'builder', with tick values converted to
+     * microseconds relative to the start of each trace.
+     */
+    static void appendRecentTraces(BSONObjBuilder* builder);
+
+private:
+    OperationTrace() = delete;
+};
+
+}  // namespace mongo
+
+#define OPERATION_TRACE_SPAN_CONCAT_(a, b) a##b
+#define OPERATION_TRACE_SPAN_CONCAT(a, b) OPERATION_TRACE_SPAN_CONCAT_(a, b)
+
+#define OPERATION_TRACE_SPAN(name)                                  \
+    ::mongo::OperationTrace::SpanGuard OPERATION_TRACE_SPAN_CONCAT( \
+        operationTraceSpan, __LINE__)(name)
@@ -0,0 +1,107 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/slow_op_ring.h"
+
+#include <algorithm>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+
+namespace {
+
+// Number of slow-operation reports retained per ServiceContext. 0 (the default) disables capture.
+MONGO_EXPORT_SERVER_PARAMETER(slowOpRingSize, int, 0);
+
+const size_t kMaxRingSize = 4096;
+
+size_t ringCapacity() {
+    const auto size = slowOpRingSize.load();
+    if (size <= 0) {
+        return 0;
+    }
+    return std::min(static_cast<size_t>(size), kMaxRingSize);
+}
+
+const auto getSlowOpRing = ServiceContext::declareDecoration<SlowOpRing>();
+
+}  // namespace
+
+SlowOpRing& SlowOpRing::get(ServiceContext* service) {
+    return getSlowOpRing(service);
+}
+
+bool SlowOpRing::enabled() {
+    return slowOpRingSize.load() > 0;
+}
+
+void SlowOpRing::record(const BSONObj& entry) {
+    const auto capacity = ringCapacity();
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_entries.size() > capacity) {
+        // The parameter was lowered; restart with an empty ring rather than deciding which
+        // entries to keep.
+        _entries.clear();
+        _next = 0;
+    }
+    if (capacity == 0) {
+        return;
+    }
+
+    if (_entries.size() < capacity) {
+        _entries.push_back(entry.getOwned());
+        _next = _entries.size() % capacity;
+    } else {
+        _entries[_next] = entry.getOwned();
+        _next = (_next + 1) % capacity;
+    }
+}
+
+void SlowOpRing::append(BSONObjBuilder* builder) const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    BSONArrayBuilder ops(builder->subarrayStart("ops"));
+    if (_entries.empty()) {
+        return;
+    }
+    // Once the ring has wrapped, '_next' points at the oldest entry; before that it points one
+    // past the newest, which modulo the size is slot 0.
+    const size_t start = _next % _entries.size();
+    for (size_t i = 0; i < _entries.size(); i++) {
+        ops.append(_entries[(start + i) % _entries.size()]);
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,85 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+class ServiceContext;
+
+/**
+ * A fixed-size in-memory ring of recent slow-operation reports. Recording an entry copies an
+ * already-built report under the ring's mutex; unlike the database profiler it takes no
+ * collection locks and performs no storage writes, so it stays usable while the server is
+ * overloaded, which is when profiling data is hardest to get.
+ *
+ * Disabled by default. The 'slowOpRingSize' server parameter sets the number of entries
+ * retained; setting it to 0 disables capture and drops any retained entries. Entries are read
+ * back through the "slowOpRing" serverStatus section.
+ */
+class SlowOpRing {
+    MONGO_DISALLOW_COPYING(SlowOpRing);
+
+public:
+    SlowOpRing() = default;
+
+    static SlowOpRing& get(ServiceContext* service);
+
+    /**
+     * Returns true if the ring is capturing, i.e. slowOpRingSize > 0. Callers use this to skip
+     * building a report entirely when capture is off.
+     */
+    static bool enabled();
+
+    /**
+     * Stores 'entry' in the ring, overwriting the oldest entry once the ring is full. A no-op
+     * when capture is disabled.
+     */
+    void record(const BSONObj& entry);
+
+    /**
+     * Appends the retained entries to 'builder', oldest first.
+     */
+    void append(BSONObjBuilder* builder) const;
+
+private:
+    mutable stdx::mutex _mutex;
+    std::vector<BSONObj> _entries;  // ring storage, guarded by _mutex
+    size_t _next = 0;               // slot the next entry lands in, guarded by _mutex
+};
+
+}  // namespace mongo
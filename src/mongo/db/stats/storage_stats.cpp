@@ -83,6 +83,8 @@ Status appendCollectionStorageStats(OperationContext* opCtx,
     result->appendNumber(
         "storageSize",
         static_cast<long long>(recordStore->storageSize(opCtx, result, verbose ? 1 : 0)) / scale);
+    result->appendNumber("freeStorageSize",
+                         static_cast<long long>(recordStore->freeStorageSize(opCtx)) / scale);
 
     recordStore->appendCustomStats(opCtx, result, scale);
 
@@ -35,9 +35,13 @@
 
 #include "mongo/db/stats/top.h"
 
+#include <functional>
+
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/log.h"
+#include "mongo/util/processinfo.h"
 
 namespace mongo {
 
@@ -50,6 +54,17 @@ namespace {
 
 const auto getTop = ServiceContext::declareDecoration<Top>();
 
+// One stripe per core, rounded up to a power of two with a floor of 16, spreads operation
+// completion recording across enough mutexes that recorders rarely collide.
+size_t numTopStripes() {
+    size_t stripes = 16;
+    const auto cores = ProcessInfo::getNumAvailableCores();
+    while (stripes < cores) {
+        stripes *= 2;
+    }
+    return stripes;
+}
+
 }  // namespace
 
 Top::UsageData::UsageData(const UsageData& older, const UsageData& newer) {
@@ -74,6 +89,16 @@ Top& Top::get(ServiceContext* service) {
     return getTop(service);
 }
 
+Top::Top() : _stripes(numTopStripes()) {}
+
+Top::Stripe& Top::_stripeForHash(size_t hash) {
+    return _stripes[hash & (_stripes.size() - 1)];
+}
+
+Top::Stripe& Top::_stripeForCurrentThread() {
+    return _stripeForHash(std::hash<stdx::thread::id>()(stdx::this_thread::get_id()));
+}
+
 void Top::record(OperationContext* opCtx,
                  StringData ns,
                  LogicalOp logicalOp,
@@ -85,15 +110,16 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& stripe = _stripeForHash(hashedNs.hash());
+    stdx::lock_guard<AdaptiveMutex> lk(stripe.lock);
 
-    if ((command || logicalOp == LogicalOp::opQuery) &&
-        _collDropNs.find(ns.toString()) != _collDropNs.end()) {
-        _collDropNs.erase(ns.toString());
+    auto collDropIt = stripe.collDropNs.find(ns);
+    if ((command || logicalOp == LogicalOp::opQuery) && collDropIt != stripe.collDropNs.end()) {
+        stripe.collDropNs.erase(collDropIt);
         return;
     }
 
-    CollectionData& coll = _usage[hashedNs];
+    CollectionData& coll = stripe.usage[hashedNs];
     _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -143,24 +169,31 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(StringData ns, bool databaseDropped) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _usage.erase(ns);
+    auto& stripe = _stripeForHash(UsageMap::hasher()(ns));
+    stdx::lock_guard<AdaptiveMutex> lk(stripe.lock);
+    stripe.usage.erase(ns);
 
     if (!databaseDropped) {
         // If a collection drop occurred, there will be a subsequent call to record for this
         // collection namespace which must be ignored. This does not apply to a database drop.
-        _collDropNs.insert(ns.toString());
+        stripe.collDropNs.insert(ns.toString());
     }
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out.clear();
+    for (auto&& stripe : _stripes) {
+        stdx::lock_guard<AdaptiveMutex> lk(stripe.lock);
+        for (auto&& entry : stripe.usage) {
+            out[entry.first] = entry.second;
+        }
+    }
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    UsageMap merged;
+    cloneMap(merged);
+    _appendToUsageMap(b, merged);
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -203,9 +236,10 @@ void Top::_appendStatsEntry(BSONObjBuilder& b, const char* statsName, const Usag
 
 void Top::appendLatencyStats(StringData ns, bool includeHistograms, BSONObjBuilder* builder) {
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& stripe = _stripeForHash(hashedNs.hash());
+    stdx::lock_guard<AdaptiveMutex> lk(stripe.lock);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, &latencyStatsBuilder);
+    stripe.usage[hashedNs].opLatencyHistogram.append(includeHistograms, &latencyStatsBuilder);
     builder->append("ns", ns);
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -213,18 +247,24 @@ void Top::appendLatencyStats(StringData ns, bool includeHistograms, BSONObjBuild
 void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
                                       uint64_t latency,
                                       Command::ReadWriteType readWriteType) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    auto& stripe = _stripeForCurrentThread();
+    stdx::lock_guard<AdaptiveMutex> guard(stripe.lock);
+    _incrementHistogram(opCtx, latency, &stripe.globalHistogramStats, readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms, BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.append(includeHistograms, builder);
+    OperationLatencyHistogram merged;
+    for (auto&& stripe : _stripes) {
+        stdx::lock_guard<AdaptiveMutex> guard(stripe.lock);
+        merged.add(stripe.globalHistogramStats);
+    }
+    merged.append(includeHistograms, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
+    auto& stripe = _stripeForCurrentThread();
+    stdx::lock_guard<AdaptiveMutex> guard(stripe.lock);
+    stripe.globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
 void Top::_incrementHistogram(OperationContext* opCtx,
@@ -33,11 +33,12 @@
 #pragma once
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <vector>
 
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
-#include "mongo/util/concurrency/mutex.h"
+#include "mongo/platform/adaptive_mutex.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
@@ -51,7 +52,7 @@ class Top {
 public:
     static Top& get(ServiceContext* service);
 
-    Top() = default;
+    Top();
 
     struct UsageData {
         UsageData() : time(0), count(0) {}
@@ -132,6 +133,22 @@ public:
     void appendGlobalLatencyStats(bool includeHistograms, BSONObjBuilder* builder);
 
 private:
+    // Usage is sharded by namespace across independently locked stripes, sized to the number of
+    // cores, so concurrent operation completions do not all serialize on one mutex. A namespace
+    // always maps to the same stripe, so the stripe maps are disjoint and read paths merge them
+    // without reconciling duplicate entries. The global histograms are striped by thread and
+    // summed on read.
+    struct Stripe {
+        mutable AdaptiveMutex lock;
+        UsageMap usage;
+        OperationLatencyHistogram globalHistogramStats;
+        std::set<std::string, std::less<>> collDropNs;
+    };
+
+    Stripe& _stripeForHash(size_t hash);
+
+    Stripe& _stripeForCurrentThread();
+
     void _appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const;
 
     void _appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const;
@@ -148,10 +165,7 @@ private:
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
-    std::set<std::string> _collDropNs;
+    std::vector<Stripe> _stripes;
 };
 
 }  // namespace mongo
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <limits>
+#include <vector>
 
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/bsonmisc.h"
@@ -482,4 +483,79 @@ inline std::ostream& operator<<(std::ostream& stream, const KeyString& value) {
     return stream << value.toString();
 }
 
+/**
+ * Encodes a batch of keys that share one Ordering, as when generating the keys of a single index
+ * for a batch of documents. The per-key encoding is identical to constructing a KeyString, but the
+ * batch shares one grow-once arena for the key bytes and type bits instead of allocating per key,
+ * amortizing buffer growth and avoiding any per-key heap allocation once the arena is warm.
+ *
+ * The views returned by operator[] point into the arena and are invalidated by append() and
+ * reset().
+ */
+class KeyStringBatchBuilder {
+public:
+    struct View {
+        StringData key;       // Bytes as produced by KeyString::getBuffer()/getSize().
+        StringData typeBits;  // Bytes as produced by TypeBits::getBuffer()/getSize().
+    };
+
+    KeyStringBatchBuilder(KeyString::Version version, Ordering ord)
+        : _ord(ord), _scratch(version) {}
+
+    /**
+     * Appends the encoding of 'obj' with 'recordId' to the batch and returns its index.
+     */
+    size_t append(const BSONObj& obj, RecordId recordId) {
+        _scratch.resetToKey(obj, _ord, recordId);
+        return _copyScratchToArena();
+    }
+
+    size_t append(const BSONObj& obj,
+                  KeyString::Discriminator discriminator = KeyString::kInclusive) {
+        _scratch.resetToKey(obj, _ord, discriminator);
+        return _copyScratchToArena();
+    }
+
+    size_t size() const {
+        return _entries.size();
+    }
+
+    View operator[](size_t i) const {
+        const Entry& entry = _entries[i];
+        return {StringData(_arena.buf() + entry.keyOffset, entry.keyLen),
+                StringData(_arena.buf() + entry.keyOffset + entry.keyLen, entry.typeBitsLen)};
+    }
+
+    /**
+     * Clears the batch for reuse, keeping the arena's allocation.
+     */
+    void reset() {
+        _arena.reset();
+        _entries.clear();
+    }
+
+private:
+    struct Entry {
+        size_t keyOffset;
+        size_t keyLen;
+        size_t typeBitsLen;
+    };
+
+    size_t _copyScratchToArena() {
+        Entry entry;
+        entry.keyOffset = _arena.len();
+        entry.keyLen = _scratch.getSize();
+        entry.typeBitsLen = _scratch.getTypeBits().getSize();
+        _arena.appendBuf(_scratch.getBuffer(), entry.keyLen);
+        _arena.appendBuf(_scratch.getTypeBits().getBuffer(), entry.typeBitsLen);
+        _entries.push_back(entry);
+        return _entries.size() - 1;
+    }
+
+    const Ordering _ord;
+    KeyString _scratch;
+    BufBuilder _arena;
+    std::vector<Entry> _entries;
+};
+
 }  // namespace mongo
@@ -135,6 +135,22 @@ void BM_BSONToKeyString(benchmark::State& state,
     state.SetItemsProcessed(state.iterations() * kSampleSize);
 }
 
+void BM_BSONToKeyStringBatch(benchmark::State& state,
+                             const KeyString::Version version,
+                             BsonValueType bsonType) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings = generateBsonsAndKeyStrings(bsonType, version);
+    KeyStringBatchBuilder batch(version, ALL_ASCENDING);
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        batch.reset();
+        for (auto bson : bsonsAndKeyStrings.bsons) {
+            benchmark::DoNotOptimize(batch.append(bson));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bsonsAndKeyStrings.bsonSize);
+    state.SetItemsProcessed(state.iterations() * kSampleSize);
+}
+
 void BM_KeyStringToBSON(benchmark::State& state,
                         const KeyString::Version version,
                         BsonValueType bsonType) {
@@ -164,6 +180,11 @@ BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_String, KeyString::Version::V1, STRING)
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V0_Array, KeyString::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_Array, KeyString::Version::V1, ARRAY);
 
+BENCHMARK_CAPTURE(BM_BSONToKeyStringBatch, V1_Int, KeyString::Version::V1, INT);
+BENCHMARK_CAPTURE(BM_BSONToKeyStringBatch, V1_Double, KeyString::Version::V1, DOUBLE);
+BENCHMARK_CAPTURE(BM_BSONToKeyStringBatch, V1_String, KeyString::Version::V1, STRING);
+BENCHMARK_CAPTURE(BM_BSONToKeyStringBatch, V1_Array, KeyString::Version::V1, ARRAY);
+
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Int, KeyString::Version::V0, INT);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Int, KeyString::Version::V1, INT);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Double, KeyString::Version::V0, DOUBLE);
@@ -215,6 +215,37 @@ TEST_F(KeyStringTest, Simple1) {
                      KeyString(version, b, ALL_ASCENDING, RecordId()));
 }
 
+TEST_F(KeyStringTest, BatchBuilderMatchesSingleKeyEncoding) {
+    std::vector<BSONObj> objs = {BSON("" << 5),
+                                 BSON("" << 5.5),
+                                 BSON(""
+                                      << "hello"),
+                                 BSON("" << BSON_ARRAY(1 << 2 << 3)),
+                                 BSON("" << BSONNULL)};
+
+    KeyStringBatchBuilder batch(version, ONE_DESCENDING);
+    for (size_t i = 0; i < objs.size(); i++) {
+        ASSERT_EQUALS(i, batch.append(objs[i], RecordId(i + 1)));
+    }
+    ASSERT_EQUALS(objs.size(), batch.size());
+
+    for (size_t i = 0; i < objs.size(); i++) {
+        const KeyString single(version, objs[i], ONE_DESCENDING, RecordId(i + 1));
+        auto view = batch[i];
+        ASSERT_EQUALS(StringData(single.getBuffer(), single.getSize()), view.key);
+        ASSERT_EQUALS(
+            StringData(single.getTypeBits().getBuffer(), single.getTypeBits().getSize()),
+            view.typeBits);
+    }
+
+    // The arena survives a reset and encodes correctly when reused.
+    batch.reset();
+    ASSERT_EQUALS(0u, batch.size());
+    batch.append(objs[0], RecordId(42));
+    const KeyString single(version, objs[0], ONE_DESCENDING, RecordId(42));
+    ASSERT_EQUALS(StringData(single.getBuffer(), single.getSize()), batch[0].key);
+}
+
 #define ROUNDTRIP_ORDER(version, x, order)                            \
     do {                                                              \
         const BSONObj _orig = x;                                      \
@@ -271,7 +271,8 @@ Status KVDatabaseCatalogEntryBase::createCollection(OperationContext* opCtx,
 
 void KVDatabaseCatalogEntryBase::initCollection(OperationContext* opCtx,
                                                 const std::string& ns,
-                                                bool forRepair) {
+                                                bool forRepair,
+                                                std::unique_ptr<RecordStore> preOpenedRecordStore) {
     invariant(!_collections.count(ns));
 
     const std::string ident = _engine->getCatalog()->getCollectionIdent(ns);
@@ -281,6 +282,8 @@ void KVDatabaseCatalogEntryBase::initCollection(OperationContext* opCtx,
         // Using a NULL rs since we don't want to open this record store before it has been
         // repaired. This also ensures that if we try to use it, it will blow up.
         rs = nullptr;
+    } else if (preOpenedRecordStore) {
+        rs = std::move(preOpenedRecordStore);
     } else {
         BSONCollectionCatalogEntry::MetaData md = _engine->getCatalog()->getMetaData(opCtx, ns);
         rs = _engine->getEngine()->getGroupedRecordStore(opCtx, ns, ident, md.options, md.prefix);
@@ -82,7 +82,15 @@ public:
 
     // --------------
 
-    void initCollection(OperationContext* opCtx, const std::string& ns, bool forRepair);
+    /**
+     * Registers the catalog entry for 'ns'. If 'preOpenedRecordStore' is non-null it is adopted
+     * instead of opening the record store here, allowing callers to open record stores for many
+     * collections in parallel before populating the catalog.
+     */
+    void initCollection(OperationContext* opCtx,
+                        const std::string& ns,
+                        bool forRepair,
+                        std::unique_ptr<RecordStore> preOpenedRecordStore = nullptr);
 
     void reinitCollectionAfterRepair(OperationContext* opCtx, const std::string& ns);
 
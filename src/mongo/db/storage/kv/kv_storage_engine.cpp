@@ -35,6 +35,7 @@
 #include "mongo/db/storage/kv/kv_storage_engine.h"
 
 #include <algorithm>
+#include <map>
 
 #include "mongo/db/catalog/catalog_control.h"
 #include "mongo/db/logical_clock.h"
@@ -46,7 +47,9 @@
 #include "mongo/db/storage/storage_repair_observer.h"
 #include "mongo/db/unclean_shutdown.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/log.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/mongoutils/str.h"
 #include "mongo/util/scopeguard.h"
 
@@ -199,6 +202,46 @@ void KVStorageEngine::loadCatalog(OperationContext* opCtx) {
         }
     }
 
+    // With many collections, opening each record store one at a time dominates startup: every open
+    // reads table metadata and size information from the storage engine. On a clean startup all
+    // collections in the catalog are known to have tables, so we can open their record stores on a
+    // thread pool up front, each worker using its own recovery unit. Unclean shutdown and repair
+    // stay serial because the orphan-recovery logic below mutates the catalog as it goes. Workers
+    // that fail leave no entry behind and the collection is opened serially on this thread, so any
+    // error surfaces in the usual place.
+    std::map<std::string, std::unique_ptr<RecordStore>> preOpenedRecordStores;
+    if (!loadingFromUncleanShutdownOrRepair && collectionsKnownToCatalog.size() > 1) {
+        ThreadPool::Options poolOptions;
+        poolOptions.poolName = "loadCatalog";
+        poolOptions.threadNamePrefix = "loadCatalog-";
+        poolOptions.maxThreads = std::min<size_t>(ProcessInfo::getNumAvailableCores(),
+                                                  collectionsKnownToCatalog.size());
+        ThreadPool pool(poolOptions);
+        pool.startup();
+        stdx::mutex resultsMutex;
+        for (const auto& coll : collectionsKnownToCatalog) {
+            uassertStatusOK(pool.schedule([&, coll] {
+                try {
+                    OperationContextNoop workerOpCtx(_engine->newRecoveryUnit());
+                    auto metaData = _catalog->getMetaData(&workerOpCtx, coll);
+                    auto rs = _engine->getGroupedRecordStore(&workerOpCtx,
+                                                             coll,
+                                                             _catalog->getCollectionIdent(coll),
+                                                             metaData.options,
+                                                             metaData.prefix);
+                    stdx::lock_guard<stdx::mutex> lk(resultsMutex);
+                    preOpenedRecordStores[coll] = std::move(rs);
+                } catch (const DBException& ex) {
+                    warning() << "Parallel open of record store for collection '" << coll
+                              << "' failed: " << redact(ex.toStatus())
+                              << ". Will retry serially.";
+                }
+            }));
+        }
+        pool.shutdown();
+        pool.join();
+    }
+
     KVPrefix maxSeenPrefix = KVPrefix::kNotPrefixed;
     for (const auto& coll : collectionsKnownToCatalog) {
         NamespaceString nss(coll);
@@ -241,7 +284,12 @@ void KVStorageEngine::loadCatalog(OperationContext* opCtx) {
             db = _databaseCatalogEntryFactory(dbName, this).release();
         }
 
-        db->initCollection(opCtx, coll, _options.forRepair);
+        std::unique_ptr<RecordStore> preOpenedRecordStore;
+        auto preOpenedIt = preOpenedRecordStores.find(coll);
+        if (preOpenedIt != preOpenedRecordStores.end()) {
+            preOpenedRecordStore = std::move(preOpenedIt->second);
+        }
+        db->initCollection(opCtx, coll, _options.forRepair, std::move(preOpenedRecordStore));
         auto maxPrefixForCollection = _catalog->getMetaData(opCtx, coll).getMaxPrefix();
         maxSeenPrefix = std::max(maxSeenPrefix, maxPrefixForCollection);
 
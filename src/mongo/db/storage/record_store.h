@@ -300,6 +300,15 @@ public:
                                 BSONObjBuilder* extraInfo = NULL,
                                 int infoLevel = 0) const = 0;
 
+    /**
+     * Returns an estimate of the number of bytes in the record store that could be reclaimed by
+     * compaction, so that orchestration can choose compaction targets. Storage engines that do
+     * not track reusable space return 0.
+     */
+    virtual int64_t freeStorageSize(OperationContext* opCtx) const {
+        return 0;
+    }
+
     // CRUD related
 
     /**
@@ -31,6 +31,7 @@
 #include <boost/optional/optional.hpp>
 #include <boost/optional/optional_io.hpp>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
@@ -300,6 +301,25 @@ public:
             return {};
         }
 
+        /**
+         * Seeks to each key in 'keys' with a hint that only exact matches are wanted, and fills
+         * in 'results' so that (*results)[i] holds the match for keys[i], or boost::none if
+         * keys[i] has no exact match. Any previous contents of 'results' are discarded.
+         *
+         * Implementations are free to probe the keys in any order (e.g. sorted, to descend the
+         * tree monotonically), but results always correspond positionally to 'keys'. The
+         * resulting position of the cursor is unspecified.
+         */
+        virtual void seekExactMany(const std::vector<BSONObj>& keys,
+                                   std::vector<boost::optional<IndexKeyEntry>>* results,
+                                   RequestedInfo parts = kKeyAndLoc) {
+            results->clear();
+            results->reserve(keys.size());
+            for (const auto& key : keys) {
+                results->push_back(seekExact(key, parts));
+            }
+        }
+
         //
         // Saving and restoring state
         //
@@ -31,6 +31,7 @@
 #include "mongo/db/storage/sorted_data_interface_test_harness.h"
 
 #include <memory>
+#include <vector>
 
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/unittest/unittest.h"
@@ -103,6 +104,48 @@ TEST(SortedDataInterface, SeekExact_Miss_Standard_Reverse) {
     testSeekExact_Miss(false, false);
 }
 
+// Tests seekExactMany with a mix of hits and misses probed out of index order.
+void testSeekExactMany(bool unique, bool forward) {
+    const auto harnessHelper = newSortedDataInterfaceHarnessHelper();
+    auto opCtx = harnessHelper->newOperationContext();
+    auto sorted =
+        harnessHelper->newSortedDataInterface(unique,
+                                              /*partial=*/false,
+                                              {
+                                                  {key1, loc1}, {key3, loc1}, {key4, loc1},
+                                              });
+
+    auto cursor = sorted->newCursor(opCtx.get(), forward);
+
+    // Keys deliberately not in index order; results must line up with the probe order
+    // regardless of the order the implementation visits the keys in.
+    std::vector<BSONObj> keys = {key3, key1, key2, key4};
+    std::vector<boost::optional<IndexKeyEntry>> results;
+    cursor->seekExactMany(keys, &results);
+
+    ASSERT_EQ(results.size(), keys.size());
+    ASSERT_EQ(results[0], IndexKeyEntry(key3, loc1));
+    ASSERT_EQ(results[1], IndexKeyEntry(key1, loc1));
+    ASSERT_EQ(results[2], boost::none);
+    ASSERT_EQ(results[3], IndexKeyEntry(key4, loc1));
+
+    // Not testing iteration since the cursor's position following seekExactMany is undefined.
+    // However, you must be able to seek somewhere else.
+    ASSERT_EQ(cursor->seekExact(key1), IndexKeyEntry(key1, loc1));
+}
+TEST(SortedDataInterface, SeekExactMany_Unique_Forward) {
+    testSeekExactMany(true, true);
+}
+TEST(SortedDataInterface, SeekExactMany_Unique_Reverse) {
+    testSeekExactMany(true, false);
+}
+TEST(SortedDataInterface, SeekExactMany_Standard_Forward) {
+    testSeekExactMany(false, true);
+}
+TEST(SortedDataInterface, SeekExactMany_Standard_Reverse) {
+    testSeekExactMany(false, false);
+}
+
 // Tests seekExact on forward cursor when it hits something with dup keys. Doesn't make sense
 // for unique indexes.
 TEST(SortedDataInterface, SeekExact_HitWithDups_Forward) {
@@ -38,7 +38,9 @@
 
 #include "mongo/base/init.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/client.h"
 #include "mongo/db/concurrency/lock_state.h"
+#include "mongo/db/concurrency/locker_noop.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/storage_engine_lock_file.h"
 #include "mongo/db/storage/storage_engine_metadata.h"
@@ -331,6 +333,10 @@ void appendStorageEngineList(ServiceContext* service, BSONObjBuilder* result) {
 
 namespace {
 
+// Caches the Locker of the Client's most recently destroyed OperationContext, so that the next
+// operation on the same Client reuses it rather than allocating a fresh one.
+const auto getCachedLocker = Client::declareDecoration<std::unique_ptr<Locker>>();
+
 class StorageClientObserver final : public ServiceContext::ClientObserver {
 public:
     void onCreateClient(Client* client) override{};
@@ -348,11 +354,29 @@ public:
         if (!storageEngine) {
             return;
         }
-        opCtx->setLockState(stdx::make_unique<LockerImpl>());
+        auto& cachedLocker = getCachedLocker(opCtx->getClient());
+        if (cachedLocker) {
+            cachedLocker->updateThreadIdToCurrentThread();
+            opCtx->setLockState(std::move(cachedLocker));
+        } else {
+            opCtx->setLockState(stdx::make_unique<LockerImpl>());
+        }
         opCtx->setRecoveryUnit(std::unique_ptr<RecoveryUnit>(storageEngine->newRecoveryUnit()),
                                WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
     }
-    void onDestroyOperationContext(OperationContext* opCtx) {}
+    void onDestroyOperationContext(OperationContext* opCtx) {
+        // Recycle the Locker for the next operation on this Client if it is in a clean,
+        // uncustomized state. Lockers which fail the check are destroyed with the
+        // OperationContext as before.
+        auto locker = opCtx->lockState();
+        if (!locker || !locker->prepareForReuse()) {
+            return;
+        }
+        auto& cachedLocker = getCachedLocker(opCtx->getClient());
+        if (!cachedLocker) {
+            cachedLocker = opCtx->swapLockState(stdx::make_unique<LockerNoop>());
+        }
+    }
 };
 
 ServiceContext::ConstructorActionRegisterer registerStorageClientObserverConstructor{
@@ -0,0 +1,453 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kStorage
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/operation_context_noop.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/storage/ephemeral_for_test/ephemeral_for_test_record_store.h"
+#include "mongo/db/storage/ephemeral_for_test/ephemeral_for_test_recovery_unit.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/sorted_data_interface.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_index.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/unittest/temp_dir.h"
+
+namespace mongo {
+namespace {
+
+const int kMaxPerfThreads = 16;  // max number of threads to use for storage perf
+
+// Number of records/keys each read benchmark operates over. Small enough to stay resident in
+// cache: these benchmarks measure the session cache, recovery unit and cursor layers, not disk.
+const int kPrepopulatedEntries = 10000;
+
+BSONObj makeDocument(size_t approximateSize) {
+    BSONObjBuilder builder;
+    builder.append("_id", OID::gen());
+    builder.append("padding", std::string(approximateSize, 'x'));
+    return builder.obj();
+}
+
+/**
+ * Sets up a WiredTiger connection over a temporary directory, mirroring the harness in
+ * wiredtiger_standard_index_test.cpp but without the unit test framework so it can back
+ * multi-threaded benchmark fixtures.
+ */
+class WiredTigerConnection {
+public:
+    WiredTigerConnection() : _dbpath("storage_bm") {
+        int ret =
+            wiredtiger_open(_dbpath.path().c_str(), nullptr, "create,cache_size=1G,", &_conn);
+        invariantWTOK(ret);
+
+        _sessionCache = stdx::make_unique<WiredTigerSessionCache>(_conn);
+    }
+
+    ~WiredTigerConnection() {
+        _sessionCache.reset();
+        _conn->close(_conn, nullptr);
+    }
+
+    std::unique_ptr<RecoveryUnit> newRecoveryUnit() {
+        return stdx::make_unique<WiredTigerRecoveryUnit>(_sessionCache.get(), &_oplogManager);
+    }
+
+    std::unique_ptr<RecordStore> newRecordStore(const std::string& ns) {
+        OperationContextNoop opCtx(newRecoveryUnit().release());
+        std::string uri = WiredTigerKVEngine::kTableUriPrefix + ns;
+
+        StatusWith<std::string> config = WiredTigerRecordStore::generateCreateString(
+            kWiredTigerEngineName, ns, CollectionOptions(), "", false /* prefixed */);
+        invariant(config.isOK());
+
+        {
+            WriteUnitOfWork uow(&opCtx);
+            WT_SESSION* s = WiredTigerRecoveryUnit::get(&opCtx)->getSession()->getSession();
+            invariantWTOK(s->create(s, uri.c_str(), config.getValue().c_str()));
+            uow.commit();
+        }
+
+        WiredTigerRecordStore::Params params;
+        params.ns = ns;
+        params.ident = ns;
+        params.engineName = kWiredTigerEngineName;
+        params.isCapped = false;
+        params.isEphemeral = false;
+        params.cappedMaxSize = -1;
+        params.cappedMaxDocs = -1;
+        params.cappedCallback = nullptr;
+        params.sizeStorer = nullptr;
+        params.isReadOnly = false;
+
+        auto rs = stdx::make_unique<StandardWiredTigerRecordStore>(nullptr, &opCtx, params);
+        rs->postConstructorInit(&opCtx);
+        return std::move(rs);
+    }
+
+    std::unique_ptr<SortedDataInterface> newSortedDataInterface(const std::string& ns,
+                                                                bool unique) {
+        OperationContextNoop opCtx(newRecoveryUnit().release());
+
+        BSONObj spec = BSON("key" << BSON("a" << 1) << "name"
+                                  << "bmIndex"
+                                  << "v"
+                                  << static_cast<int>(IndexDescriptor::kLatestIndexVersion)
+                                  << "ns"
+                                  << ns
+                                  << "unique"
+                                  << unique);
+        IndexDescriptor desc(nullptr, "", spec);
+
+        KVPrefix prefix = KVPrefix::kNotPrefixed;
+        StatusWith<std::string> config = WiredTigerIndex::generateCreateString(
+            kWiredTigerEngineName, "", "", desc, prefix.isPrefixed());
+        invariant(config.isOK());
+
+        std::string uri = WiredTigerKVEngine::kTableUriPrefix + ns;
+        invariantWTOK(WiredTigerIndex::Create(&opCtx, uri, config.getValue()));
+
+        if (unique)
+            return stdx::make_unique<WiredTigerIndexUnique>(&opCtx, uri, &desc, prefix);
+        return stdx::make_unique<WiredTigerIndexStandard>(&opCtx, uri, &desc, prefix);
+    }
+
+private:
+    unittest::TempDir _dbpath;
+    WT_CONNECTION* _conn;
+    std::unique_ptr<WiredTigerSessionCache> _sessionCache;
+    WiredTigerOplogManager _oplogManager;
+};
+
+class StorageBenchmark : public benchmark::Fixture {
+protected:
+    void populateRecords(RecordStore* rs) {
+        OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+        const BSONObj doc = makeDocument(128);
+        WriteUnitOfWork uow(&opCtx);
+        for (int i = 0; i < kPrepopulatedEntries; i++) {
+            auto res = rs->insertRecord(&opCtx, doc.objdata(), doc.objsize(), Timestamp());
+            invariant(res.isOK());
+            _recordIds.push_back(res.getValue());
+        }
+        uow.commit();
+    }
+
+    void populateIndex(SortedDataInterface* index) {
+        OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+        WriteUnitOfWork uow(&opCtx);
+        for (int i = 0; i < kPrepopulatedEntries; i++) {
+            _keys.push_back(BSON("" << i));
+            invariant(
+                index->insert(&opCtx, _keys.back(), RecordId(i + 1), true /* dupsAllowed */)
+                    .isOK());
+        }
+        uow.commit();
+    }
+
+    std::unique_ptr<WiredTigerConnection> _wt;
+    std::unique_ptr<RecordStore> _rs;
+    std::unique_ptr<SortedDataInterface> _index;
+    std::vector<RecordId> _recordIds;
+    std::vector<BSONObj> _keys;
+};
+
+BENCHMARK_DEFINE_F(StorageBenchmark, BM_WiredTigerInsertRecords)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        _wt = stdx::make_unique<WiredTigerConnection>();
+        _rs = _wt->newRecordStore("test.bm");
+    }
+
+    const BSONObj doc = makeDocument(state.range(0));
+    OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+
+    for (auto keepRunning : state) {
+        WriteUnitOfWork uow(&opCtx);
+        auto res = _rs->insertRecord(&opCtx, doc.objdata(), doc.objsize(), Timestamp());
+        invariant(res.isOK());
+        uow.commit();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * doc.objsize());
+
+    if (state.thread_index == 0) {
+        _rs.reset();
+        _wt.reset();
+    }
+}
+
+BENCHMARK_DEFINE_F(StorageBenchmark, BM_WiredTigerDataFor)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        _wt = stdx::make_unique<WiredTigerConnection>();
+        _rs = _wt->newRecordStore("test.bm");
+        populateRecords(_rs.get());
+    }
+
+    OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(_rs->dataFor(&opCtx, _recordIds[i]));
+        if (++i == _recordIds.size()) {
+            i = 0;
+            // Don't let one snapshot span the whole benchmark.
+            opCtx.recoveryUnit()->abandonSnapshot();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        _recordIds.clear();
+        _rs.reset();
+        _wt.reset();
+    }
+}
+
+BENCHMARK_DEFINE_F(StorageBenchmark, BM_WiredTigerCursorNext)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        _wt = stdx::make_unique<WiredTigerConnection>();
+        _rs = _wt->newRecordStore("test.bm");
+        populateRecords(_rs.get());
+    }
+
+    OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+
+    auto cursor = _rs->getCursor(&opCtx);
+    for (auto keepRunning : state) {
+        auto record = cursor->next();
+        if (!record) {
+            cursor.reset();
+            opCtx.recoveryUnit()->abandonSnapshot();
+            cursor = _rs->getCursor(&opCtx);
+            continue;
+        }
+        benchmark::DoNotOptimize(record);
+    }
+    cursor.reset();
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        _recordIds.clear();
+        _rs.reset();
+        _wt.reset();
+    }
+}
+
+BENCHMARK_DEFINE_F(StorageBenchmark, BM_WiredTigerSeekExact)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        _wt = stdx::make_unique<WiredTigerConnection>();
+        _rs = _wt->newRecordStore("test.bm");
+        populateRecords(_rs.get());
+    }
+
+    OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+
+    auto cursor = _rs->getCursor(&opCtx);
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(cursor->seekExact(_recordIds[i]));
+        if (++i == _recordIds.size()) {
+            i = 0;
+            cursor.reset();
+            opCtx.recoveryUnit()->abandonSnapshot();
+            cursor = _rs->getCursor(&opCtx);
+        }
+    }
+    cursor.reset();
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        _recordIds.clear();
+        _rs.reset();
+        _wt.reset();
+    }
+}
+
+BENCHMARK_DEFINE_F(StorageBenchmark, BM_WiredTigerIndexInsert)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        _wt = stdx::make_unique<WiredTigerConnection>();
+        _index = _wt->newSortedDataInterface("test.bm", false /* unique */);
+    }
+
+    OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+
+    // Give each thread a disjoint key range so unique-checking paths see no duplicates.
+    long long n = static_cast<long long>(state.thread_index) << 32;
+    for (auto keepRunning : state) {
+        WriteUnitOfWork uow(&opCtx);
+        invariant(
+            _index->insert(&opCtx, BSON("" << n), RecordId(++n), true /* dupsAllowed */).isOK());
+        uow.commit();
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        _index.reset();
+        _wt.reset();
+    }
+}
+
+BENCHMARK_DEFINE_F(StorageBenchmark, BM_WiredTigerIndexSeek)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        _wt = stdx::make_unique<WiredTigerConnection>();
+        _index = _wt->newSortedDataInterface("test.bm", false /* unique */);
+        populateIndex(_index.get());
+    }
+
+    OperationContextNoop opCtx(_wt->newRecoveryUnit().release());
+
+    auto cursor = _index->newCursor(&opCtx);
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(cursor->seek(_keys[i], true /* inclusive */));
+        if (++i == _keys.size()) {
+            i = 0;
+            cursor.reset();
+            opCtx.recoveryUnit()->abandonSnapshot();
+            cursor = _index->newCursor(&opCtx);
+        }
+    }
+    cursor.reset();
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        _keys.clear();
+        _index.reset();
+        _wt.reset();
+    }
+}
+
+// The ephemeral benchmarks below isolate the RecordStore interface overhead from WiredTiger
+// itself. They are single-threaded: the ephemeral engine relies on database-level locking for
+// thread safety, which these fixtures do not provide.
+
+void BM_EphemeralInsertRecords(benchmark::State& state) {
+    std::shared_ptr<void> data;
+    EphemeralForTestRecordStore rs("test.bm", &data);
+    OperationContextNoop opCtx(new EphemeralForTestRecoveryUnit());
+
+    const BSONObj doc = makeDocument(state.range(0));
+    for (auto keepRunning : state) {
+        WriteUnitOfWork uow(&opCtx);
+        auto res = rs.insertRecord(&opCtx, doc.objdata(), doc.objsize(), Timestamp());
+        invariant(res.isOK());
+        uow.commit();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * doc.objsize());
+}
+
+void BM_EphemeralDataFor(benchmark::State& state) {
+    std::shared_ptr<void> data;
+    EphemeralForTestRecordStore rs("test.bm", &data);
+    OperationContextNoop opCtx(new EphemeralForTestRecoveryUnit());
+
+    const BSONObj doc = makeDocument(128);
+    std::vector<RecordId> recordIds;
+    {
+        WriteUnitOfWork uow(&opCtx);
+        for (int i = 0; i < kPrepopulatedEntries; i++) {
+            auto res = rs.insertRecord(&opCtx, doc.objdata(), doc.objsize(), Timestamp());
+            invariant(res.isOK());
+            recordIds.push_back(res.getValue());
+        }
+        uow.commit();
+    }
+
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(rs.dataFor(&opCtx, recordIds[i]));
+        if (++i == recordIds.size())
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_EphemeralCursorNext(benchmark::State& state) {
+    std::shared_ptr<void> data;
+    EphemeralForTestRecordStore rs("test.bm", &data);
+    OperationContextNoop opCtx(new EphemeralForTestRecoveryUnit());
+
+    const BSONObj doc = makeDocument(128);
+    {
+        WriteUnitOfWork uow(&opCtx);
+        for (int i = 0; i < kPrepopulatedEntries; i++) {
+            auto res = rs.insertRecord(&opCtx, doc.objdata(), doc.objsize(), Timestamp());
+            invariant(res.isOK());
+        }
+        uow.commit();
+    }
+
+    auto cursor = rs.getCursor(&opCtx);
+    for (auto keepRunning : state) {
+        auto record = cursor->next();
+        if (!record) {
+            cursor = rs.getCursor(&opCtx);
+            continue;
+        }
+        benchmark::DoNotOptimize(record);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(StorageBenchmark, BM_WiredTigerInsertRecords)
+    ->Arg(128)
+    ->Arg(1024)
+    ->Arg(16 * 1024)
+    ->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(StorageBenchmark, BM_WiredTigerDataFor)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(StorageBenchmark, BM_WiredTigerCursorNext)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(StorageBenchmark, BM_WiredTigerSeekExact)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(StorageBenchmark, BM_WiredTigerIndexInsert)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(StorageBenchmark, BM_WiredTigerIndexSeek)->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_EphemeralInsertRecords)->Arg(128)->Arg(1024)->Arg(16 * 1024);
+BENCHMARK(BM_EphemeralDataFor);
+BENCHMARK(BM_EphemeralCursorNext);
+
+}  // namespace
+}  // namespace mongo
@@ -40,6 +40,7 @@ WiredTigerCursor::WiredTigerCursor(const std::string& uri,
                                    bool allowOverwrite,
                                    OperationContext* opCtx) {
     _tableID = tableID;
+    _allowOverwrite = allowOverwrite;
     _ru = WiredTigerRecoveryUnit::get(opCtx);
     _session = _ru->getSession();
     _readOnce = _ru->getReadOnce();
@@ -59,7 +60,7 @@ WiredTigerCursor::~WiredTigerCursor() {
     if (_readOnce) {
         _session->closeCursor(_cursor);
     } else {
-        _session->releaseCursor(_tableID, _cursor);
+        _session->releaseCursor(_tableID, _cursor, _allowOverwrite);
     }
 }
 
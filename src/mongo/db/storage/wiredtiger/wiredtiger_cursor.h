@@ -72,6 +72,7 @@ public:
 
 protected:
     uint64_t _tableID;
+    bool _allowOverwrite;
     WiredTigerRecoveryUnit* _ru;
     WiredTigerSession* _session;
     bool _readOnce;
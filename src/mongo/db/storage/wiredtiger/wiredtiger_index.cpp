@@ -36,6 +36,8 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_index.h"
 
+#include <algorithm>
+#include <numeric>
 #include <set>
 
 #include "mongo/base/checked_cast.h"
@@ -495,7 +497,20 @@ long long WiredTigerIndex::getSpaceUsedBytes(OperationContext* opCtx) const {
         return numEntries * bytesPerEntry;
     }
 
-    return static_cast<long long>(WiredTigerUtil::getIdentSize(session->getSession(), _uri));
+    // The on-disk size only changes as blocks are allocated or freed, so a slightly stale value is
+    // as meaningful as a fresh one. Serving repeat callers from the cache keeps frequently polled
+    // stats paths (e.g. collStats-driven monitoring) from opening a statistics cursor per call.
+    static constexpr int64_t kSpaceUsedCacheWindowMillis = 1000;
+    const int64_t now = Date_t::now().toMillisSinceEpoch();
+    if (now - _cachedSpaceUsedTimestampMillis.load() < kSpaceUsedCacheWindowMillis) {
+        return _cachedSpaceUsedBytes.load();
+    }
+
+    const auto size =
+        static_cast<long long>(WiredTigerUtil::getIdentSize(session->getSession(), _uri));
+    _cachedSpaceUsedBytes.store(size);
+    _cachedSpaceUsedTimestampMillis.store(now);
+    return size;
 }
 
 bool WiredTigerIndex::isDup(OperationContext* opCtx,
@@ -874,6 +889,48 @@ public:
         return curr(parts);
     }
 
+    void seekExactMany(const std::vector<BSONObj>& keys,
+                       std::vector<boost::optional<IndexKeyEntry>>* results,
+                       RequestedInfo parts) override {
+        dassert(_opCtx->lockState()->isReadLocked());
+        results->clear();
+        results->resize(keys.size());
+        if (keys.empty())
+            return;
+
+        // Encode all probes up front so they can be issued in index key order, which descends the
+        // B-tree monotonically and keeps interior pages hot across probes. Each result is still
+        // reported at the position of the key that produced it.
+        const auto discriminator =
+            _forward ? KeyString::kExclusiveBefore : KeyString::kExclusiveAfter;
+        KeyStringBatchBuilder batch(_idx.keyStringVersion(), _idx.ordering());
+        std::vector<BSONObj> finalKeys;
+        finalKeys.reserve(keys.size());
+        for (const auto& key : keys) {
+            finalKeys.push_back(stripFieldNames(key));
+            batch.append(finalKeys.back(), discriminator);
+        }
+
+        std::vector<size_t> order(keys.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&batch](size_t lhs, size_t rhs) {
+            return batch[lhs].key.compare(batch[rhs].key) < 0;
+        });
+        if (!_forward)
+            std::reverse(order.begin(), order.end());
+
+        for (size_t i : order) {
+            const auto query = batch[i].key;
+            seekWTCursor(query.rawData(), query.size());
+            updatePosition();
+            auto kv = curr(kKeyAndLoc);
+            if (kv &&
+                kv->key.woCompare(finalKeys[i], BSONObj(), /*considerFieldNames*/ false) == 0) {
+                (*results)[i] = std::move(kv);
+            }
+        }
+    }
+
     void save() override {
         try {
             if (_cursor)
@@ -1027,10 +1084,14 @@ protected:
 
     // Seeks to query. Returns true on exact match.
     bool seekWTCursor(const KeyString& query) {
+        return seekWTCursor(query.getBuffer(), query.getSize());
+    }
+
+    bool seekWTCursor(const char* queryBuffer, size_t querySize) {
         WT_CURSOR* c = _cursor->get();
 
         int cmp = -1;
-        const WiredTigerItem keyItem(query.getBuffer(), query.getSize());
+        const WiredTigerItem keyItem(queryBuffer, querySize);
         setKey(c, keyItem.Get());
 
         int ret = wiredTigerPrepareConflictRetry(_opCtx, [&] { return c->search_near(c, &cmp); });
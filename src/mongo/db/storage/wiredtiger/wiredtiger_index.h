@@ -39,6 +39,7 @@
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 
@@ -193,6 +194,12 @@ protected:
     const BSONObj _keyPattern;
     KVPrefix _prefix;
     bool _isIdIndex;
+
+    // Cached result of the on-disk size statistic, along with the time it was sampled. Frequently
+    // polled stats paths (e.g. collStats-driven monitoring) are served from this cache with
+    // bounded staleness rather than opening a statistics cursor per call.
+    mutable AtomicInt64 _cachedSpaceUsedBytes;
+    mutable AtomicInt64 _cachedSpaceUsedTimestampMillis;
 };
 
 class WiredTigerIndexUnique : public WiredTigerIndex {
@@ -394,8 +394,10 @@ class TicketServerParameter : public ServerParameter {
     MONGO_DISALLOW_COPYING(TicketServerParameter);
 
 public:
-    TicketServerParameter(TicketHolder* holder, const std::string& name)
-        : ServerParameter(ServerParameterSet::getGlobal(), name, true, true), _holder(holder) {}
+    TicketServerParameter(TicketHolder* holder, const std::string& name, AtomicInt32* base = nullptr)
+        : ServerParameter(ServerParameterSet::getGlobal(), name, true, true),
+          _holder(holder),
+          _base(base) {}
 
     virtual void append(OperationContext* opCtx, BSONObjBuilder& b, const std::string& name) {
         b.append(name, _holder->outof());
@@ -420,26 +422,160 @@ public:
             return Status(ErrorCodes::BadValue, str::stream() << name() << " has to be > 0");
         }
 
-        return _holder->resize(newNum);
+        Status status = _holder->resize(newNum);
+        if (status.isOK() && _base) {
+            _base->store(newNum);
+        }
+        return status;
     }
 
 private:
     TicketHolder* _holder;
+    AtomicInt32* _base;  // if set, records the configured (unthrottled) size
 };
 
 TicketHolder openWriteTransaction(128);
+
+// The configured write ticket count. The dirty-cache throttle temporarily resizes
+// 'openWriteTransaction' below this; see WiredTigerCachePressureMonitor.
+AtomicInt32 desiredWriteTransactions(128);
+
 TicketServerParameter openWriteTransactionParam(&openWriteTransaction,
-                                                "wiredTigerConcurrentWriteTransactions");
+                                                "wiredTigerConcurrentWriteTransactions",
+                                                &desiredWriteTransactions);
 
 TicketHolder openReadTransaction(128);
 TicketServerParameter openReadTransactionParam(&openReadTransaction,
                                                "wiredTigerConcurrentReadTransactions");
 
+// Dirty-cache percentage above which write-ticket admission is progressively reduced, slowing
+// writers down before eviction starts stalling their threads outright. 0 (the default) leaves
+// admission alone; the pressure signals are still sampled and reported either way.
+MONGO_EXPORT_SERVER_PARAMETER(wiredTigerDirtyCacheThrottleThresholdPercent, int, 0);
+
+// Width, in percentage points of the cache, of the window above the threshold over which the
+// write ticket count ramps down from the configured value to its floor.
+const double kDirtyThrottleWindowPercent = 10.0;
+
+// TicketHolder::resize() rejects sizes below 5.
+const int kDirtyThrottleMinimumTickets = 5;
+
+// Signals sampled by the cache pressure monitor, surfaced through appendGlobalStats().
+AtomicInt64 trackedDirtyBytes(0);
+AtomicInt64 cacheMaxBytes(0);
+AtomicInt64 pagesEvictedByAppThreads(0);
+AtomicInt64 dirtyThrottleEpisodes(0);
+AtomicBool dirtyThrottleActive(false);
+
 stdx::function<bool(StringData)> initRsOplogBackgroundThreadCallback = [](StringData) -> bool {
     fassertFailed(40358);
 };
 }  // namespace
 
+class WiredTigerKVEngine::WiredTigerCachePressureMonitor : public BackgroundJob {
+public:
+    explicit WiredTigerCachePressureMonitor(WiredTigerSessionCache* sessionCache)
+        : BackgroundJob(false /* deleteSelf */), _sessionCache(sessionCache) {}
+
+    virtual string name() const {
+        return "WTCachePressureMonitor";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOG(1) << "starting " << name() << " thread";
+
+        while (!_shuttingDown.load()) {
+            try {
+                _sample();
+            } catch (const AssertionException& e) {
+                invariant(e.code() == ErrorCodes::ShutdownInProgress);
+            }
+
+            MONGO_IDLE_THREAD_BLOCK;
+            sleepmillis(kSamplePeriodMillis);
+        }
+        LOG(1) << "stopping " << name() << " thread";
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        wait();
+        // Leave the configured ticket count behind, not a throttled one.
+        _resizeWriteTickets(desiredWriteTransactions.load());
+        dirtyThrottleActive.store(false);
+    }
+
+private:
+    static const int kSamplePeriodMillis = 1000;
+
+    void _sample() {
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        WT_SESSION* s = session->getSession();
+
+        auto dirty = WiredTigerUtil::getStatisticsValueAs<int64_t>(
+            s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+        auto max = WiredTigerUtil::getStatisticsValueAs<int64_t>(
+            s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_MAX);
+        auto appEvictions = WiredTigerUtil::getStatisticsValueAs<int64_t>(
+            s, "statistics:", "", WT_STAT_CONN_CACHE_EVICTION_APP);
+        if (!dirty.isOK() || !max.isOK() || max.getValue() <= 0) {
+            return;
+        }
+        trackedDirtyBytes.store(dirty.getValue());
+        cacheMaxBytes.store(max.getValue());
+        if (appEvictions.isOK()) {
+            pagesEvictedByAppThreads.store(appEvictions.getValue());
+        }
+
+        const int thresholdPercent = wiredTigerDirtyCacheThrottleThresholdPercent.load();
+        const int base = desiredWriteTransactions.load();
+        const double dirtyPercent = 100.0 * dirty.getValue() / max.getValue();
+
+        // Scale the write ticket count down linearly as the dirty percentage climbs through the
+        // window above the threshold, bottoming out at a quarter of the configured count.
+        int target = base;
+        if (thresholdPercent > 0 && dirtyPercent > thresholdPercent) {
+            const int floor = std::max(base / 4, kDirtyThrottleMinimumTickets);
+            const double severity =
+                std::min((dirtyPercent - thresholdPercent) / kDirtyThrottleWindowPercent, 1.0);
+            target = std::max(base - static_cast<int>(severity * (base - floor)), floor);
+        }
+
+        const bool wasActive = dirtyThrottleActive.load();
+        const bool active = target < base;
+        if (active && !wasActive) {
+            dirtyThrottleEpisodes.fetchAndAdd(1);
+            log() << "WiredTiger dirty cache at " << dirtyPercent << "% of the cache, above the "
+                  << thresholdPercent << "% throttle threshold; reducing concurrent write "
+                  << "transactions to " << target;
+        } else if (!active && wasActive) {
+            log() << "WiredTiger dirty cache pressure subsided; restoring concurrent write "
+                  << "transactions to " << base;
+        }
+        dirtyThrottleActive.store(active);
+        _resizeWriteTickets(target);
+    }
+
+    void _resizeWriteTickets(int target) {
+        if (target != openWriteTransaction.outof()) {
+            // The Linux TicketHolder shrinks by briefly blocking this thread while the tickets
+            // being retired are released by the writers currently holding them. The condvar
+            // implementation instead refuses to shrink below the number of tickets currently
+            // out — which is the common case when the throttle engages under write load — so
+            // treat failure as transient and retry at the next sample.
+            Status status = openWriteTransaction.resize(target);
+            if (!status.isOK()) {
+                LOG(1) << "Deferring concurrent write transaction resize to " << target << ": "
+                       << status.reason();
+            }
+        }
+    }
+
+    WiredTigerSessionCache* _sessionCache;
+    AtomicBool _shuttingDown{false};
+};
+
 StringData WiredTigerKVEngine::kTableUriPrefix = "table:"_sd;
 
 WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
@@ -574,6 +710,10 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
         _checkpointThread =
             stdx::make_unique<WiredTigerCheckpointThread>(this, _sessionCache.get());
         _checkpointThread->go();
+
+        _cachePressureMonitor =
+            stdx::make_unique<WiredTigerCachePressureMonitor>(_sessionCache.get());
+        _cachePressureMonitor->go();
     }
 
     _sizeStorerUri = _uri("sizeStorer");
@@ -607,6 +747,9 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openWriteTransaction.used());
         bbb.append("available", openWriteTransaction.available());
         bbb.append("totalTickets", openWriteTransaction.outof());
+        bbb.append("queued", openWriteTransaction.queued());
+        bbb.append("totalWaits", openWriteTransaction.totalWaits());
+        bbb.append("totalTimeQueuedMicros", openWriteTransaction.totalTimeQueuedMicros());
         bbb.done();
     }
     {
@@ -614,9 +757,26 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openReadTransaction.used());
         bbb.append("available", openReadTransaction.available());
         bbb.append("totalTickets", openReadTransaction.outof());
+        bbb.append("queued", openReadTransaction.queued());
+        bbb.append("totalWaits", openReadTransaction.totalWaits());
+        bbb.append("totalTimeQueuedMicros", openReadTransaction.totalTimeQueuedMicros());
         bbb.done();
     }
     bb.done();
+
+    BSONObjBuilder pressure(b.subobjStart("cachePressure"));
+    pressure.append("trackedDirtyBytes", trackedDirtyBytes.load());
+    pressure.append("maxBytesConfigured", cacheMaxBytes.load());
+    if (cacheMaxBytes.load() > 0) {
+        pressure.append("trackedDirtyPercent",
+                        100.0 * trackedDirtyBytes.load() / cacheMaxBytes.load());
+    }
+    pressure.append("pagesEvictedByAppThreads", pagesEvictedByAppThreads.load());
+    pressure.append("dirtyThrottleThresholdPercent",
+                    wiredTigerDirtyCacheThrottleThresholdPercent.load());
+    pressure.append("dirtyThrottleActive", dirtyThrottleActive.load());
+    pressure.append("dirtyThrottleEpisodes", dirtyThrottleEpisodes.load());
+    pressure.done();
 }
 
 void WiredTigerKVEngine::_openWiredTiger(const std::string& path, const std::string& wtOpenConfig) {
@@ -690,6 +850,11 @@ void WiredTigerKVEngine::cleanShutdown() {
     }
 
     // these must be the last things we do before _conn->close();
+    if (_cachePressureMonitor) {
+        log() << "Shutting down cache pressure monitor thread";
+        _cachePressureMonitor->shutdown();
+        log() << "Finished shutting down cache pressure monitor thread";
+    }
     if (_journalFlusher) {
         log() << "Shutting down journal flusher thread";
         _journalFlusher->shutdown();
@@ -122,6 +122,13 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     // Close transaction before we wait.
     opCtx->recoveryUnit()->abandonSnapshot();
 
+    // Fast path: if everything up to the end of the oplog is already visible, finish without
+    // touching the visibility mutex. Tailing cursors re-establish visibility after every batch,
+    // so under change-stream-heavy workloads this is the common case.
+    if (RecordId(getOplogReadTimestamp()) >= waitingFor) {
+        return;
+    }
+
     stdx::unique_lock<stdx::mutex> lk(_oplogVisibilityStateMutex);
 
     // Prevent any scheduled journal flushes from being delayed and blocking this wait excessively.
@@ -129,6 +136,10 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     invariant(_opsWaitingForVisibility > 0);
     auto exitGuard = MakeGuard([&] { _opsWaitingForVisibility--; });
 
+    // Wake the journal thread right away instead of letting its delay loop notice the new waiter
+    // on its next poll.
+    _opsWaitingForJournalCV.notify_one();
+
     opCtx->waitForConditionOrInterrupt(_opsBecameVisibleCV, lk, [&] {
         auto newLatestVisibleTimestamp = getOplogReadTimestamp();
         if (newLatestVisibleTimestamp < currentLatestVisibleTimestamp) {
@@ -150,11 +161,16 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
 }
 
 void WiredTigerOplogManager::triggerJournalFlush() {
-    stdx::lock_guard<stdx::mutex> lk(_oplogVisibilityStateMutex);
-    if (!_opsWaitingForJournal) {
-        _opsWaitingForJournal = true;
-        _opsWaitingForJournalCV.notify_one();
+    if (_opsWaitingForJournal.swap(true)) {
+        // A flush request is already pending; the journal thread will observe the flag without
+        // another wakeup.
+        return;
     }
+
+    // Taking the mutex orders this notification with the journal thread's predicate check, so the
+    // wakeup cannot be lost between the check and the thread going to sleep.
+    stdx::lock_guard<stdx::mutex> lk(_oplogVisibilityStateMutex);
+    _opsWaitingForJournalCV.notify_one();
 }
 
 void WiredTigerOplogManager::_oplogJournalThreadLoop(WiredTigerSessionCache* sessionCache,
@@ -169,8 +185,8 @@ void WiredTigerOplogManager::_oplogJournalThreadLoop(WiredTigerSessionCache* ses
         stdx::unique_lock<stdx::mutex> lk(_oplogVisibilityStateMutex);
         {
             MONGO_IDLE_THREAD_BLOCK;
-            _opsWaitingForJournalCV.wait(lk,
-                                         [&] { return _shuttingDown || _opsWaitingForJournal; });
+            _opsWaitingForJournalCV.wait(
+                lk, [&] { return _shuttingDown || _opsWaitingForJournal.load(); });
 
             // If we're not shutting down and nobody is actively waiting for the oplog to become
             // durable, delay journaling a bit to reduce the sync rate.
@@ -210,8 +226,8 @@ void WiredTigerOplogManager::_oplogJournalThreadLoop(WiredTigerSessionCache* ses
             log() << "Oplog journal thread loop shutting down";
             return;
         }
-        invariant(_opsWaitingForJournal);
-        _opsWaitingForJournal = false;
+        invariant(_opsWaitingForJournal.load());
+        _opsWaitingForJournal.store(false);
         lk.unlock();
 
         const uint64_t newTimestamp = fetchAllCommittedValue(sessionCache->conn());
@@ -99,9 +99,13 @@ private:
     mutable stdx::condition_variable
         _opsBecameVisibleCV;  // Signaled when a journal flush is complete.
 
-    bool _isRunning = false;             // Guarded by oplogVisibilityStateMutex.
-    bool _shuttingDown = false;          // Guarded by oplogVisibilityStateMutex.
-    bool _opsWaitingForJournal = false;  // Guarded by oplogVisibilityStateMutex.
+    bool _isRunning = false;     // Guarded by oplogVisibilityStateMutex.
+    bool _shuttingDown = false;  // Guarded by oplogVisibilityStateMutex.
+
+    // Set when a journal flush has been requested and not yet picked up by the journal thread.
+    // Atomic so that triggerJournalFlush() can coalesce repeat requests without taking the
+    // visibility mutex; only the first request per flush round pays for a notification.
+    AtomicBool _opsWaitingForJournal{false};
 
     // When greater than 0, indicates that there are operations waiting for oplog visibility, and
     // journal flushing should not be delayed.
@@ -48,6 +48,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/repl_settings.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/server_recovery.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/oplog_hack.h"
@@ -107,6 +108,38 @@ const std::string kWiredTigerEngineName = "wiredTiger";
 // cursors will be available in the needed session caches.
 static int kCappedDocumentRemoveLimit = 3;
 
+// Size in megabytes of each oplog stone (truncation marker). When zero, the stone size is derived
+// from the configured oplog size, dividing it into between 10 and 100 stones. A small explicit
+// size makes oplog truncation more frequent and each truncation cheaper, at the cost of keeping
+// more markers in memory. Takes effect when the oplog stones are (re)computed, i.e. at startup or
+// when the oplog is resized.
+AtomicInt32 gWiredTigerOplogStoneSizeMB(0);
+
+ExportedServerParameter<std::int32_t, ServerParameterType::kStartupAndRuntime>
+    WiredTigerOplogStoneSizeMBSetting(ServerParameterSet::getGlobal(),
+                                      "wiredTigerOplogStoneSizeMB",
+                                      &gWiredTigerOplogStoneSizeMB);
+
+namespace {
+
+// Returns the minimum number of bytes for each oplog stone (truncation marker), given the
+// configured maximum oplog size.
+int64_t oplogStoneSize(unsigned long long maxSize) {
+    const int64_t stoneSizeMB = gWiredTigerOplogStoneSizeMB.load();
+    if (stoneSizeMB > 0) {
+        return stoneSizeMB * 1024 * 1024;
+    }
+
+    const unsigned long long kMinStonesToKeep = 10ULL;
+    const unsigned long long kMaxStonesToKeep = 100ULL;
+
+    unsigned long long numStones = maxSize / BSONObjMaxInternalSize;
+    size_t numStonesToKeep = std::min(kMaxStonesToKeep, std::max(kMinStonesToKeep, numStones));
+    return maxSize / numStonesToKeep;
+}
+
+}  // namespace
+
 class WiredTigerRecordStore::OplogStones::InsertChange final : public RecoveryUnit::Change {
 public:
     InsertChange(OplogStones* oplogStones,
@@ -164,14 +197,11 @@ WiredTigerRecordStore::OplogStones::OplogStones(OperationContext* opCtx, WiredTi
     invariant(rs->cappedMaxSize() > 0);
     unsigned long long maxSize = rs->cappedMaxSize();
 
-    const unsigned long long kMinStonesToKeep = 10ULL;
-    const unsigned long long kMaxStonesToKeep = 100ULL;
-
-    unsigned long long numStones = maxSize / BSONObjMaxInternalSize;
-    size_t numStonesToKeep = std::min(kMaxStonesToKeep, std::max(kMinStonesToKeep, numStones));
-    _minBytesPerStone = maxSize / numStonesToKeep;
+    _minBytesPerStone = oplogStoneSize(maxSize);
     invariant(_minBytesPerStone > 0);
 
+    size_t numStonesToKeep =
+        std::max(maxSize / static_cast<unsigned long long>(_minBytesPerStone), 1ULL);
     _calculateStones(opCtx, numStonesToKeep);
     _pokeReclaimThreadIfNeeded();  // Reclaim stones if over the limit.
 }
@@ -457,12 +487,7 @@ void WiredTigerRecordStore::OplogStones::_pokeReclaimThreadIfNeeded() {
 
 void WiredTigerRecordStore::OplogStones::adjust(int64_t maxSize) {
     stdx::lock_guard<stdx::mutex> lk(_mutex);
-    const unsigned long long kMinStonesToKeep = 10ULL;
-    const unsigned long long kMaxStonesToKeep = 100ULL;
-
-    unsigned long long numStones = maxSize / BSONObjMaxInternalSize;
-    size_t numStonesToKeep = std::min(kMaxStonesToKeep, std::max(kMinStonesToKeep, numStones));
-    _minBytesPerStone = maxSize / numStonesToKeep;
+    _minBytesPerStone = oplogStoneSize(maxSize);
     invariant(_minBytesPerStone > 0);
     _pokeReclaimThreadIfNeeded();
 }
@@ -814,6 +839,16 @@ int64_t WiredTigerRecordStore::storageSize(OperationContext* opCtx,
     if (_isEphemeral) {
         return dataSize(opCtx);
     }
+
+    // The on-disk size only changes as blocks are allocated or freed, so a slightly stale value is
+    // as meaningful as a fresh one. Serving repeat callers from the cache keeps frequently polled
+    // stats paths (e.g. collStats-driven monitoring) from opening a statistics cursor per call.
+    static constexpr int64_t kStorageSizeCacheWindowMillis = 1000;
+    const int64_t now = Date_t::now().toMillisSinceEpoch();
+    if (now - _cachedStorageSizeTimestampMillis.load() < kStorageSizeCacheWindowMillis) {
+        return _cachedStorageSize.load();
+    }
+
     WiredTigerSession* session = WiredTigerRecoveryUnit::get(opCtx)->getSessionNoTxn();
     StatusWith<int64_t> result =
         WiredTigerUtil::getStatisticsValueAs<int64_t>(session->getSession(),
@@ -826,11 +861,31 @@ int64_t WiredTigerRecordStore::storageSize(OperationContext* opCtx,
 
     if (size == 0 && _isCapped) {
         // Many things assume an empty capped collection still takes up space.
-        return 1;
+        size = 1;
     }
+
+    _cachedStorageSize.store(size);
+    _cachedStorageSizeTimestampMillis.store(now);
     return size;
 }
 
+int64_t WiredTigerRecordStore::freeStorageSize(OperationContext* opCtx) const {
+    dassert(opCtx->lockState()->isReadLocked());
+
+    if (_isEphemeral) {
+        return 0;
+    }
+
+    WiredTigerSession* session = WiredTigerRecoveryUnit::get(opCtx)->getSessionNoTxn();
+    StatusWith<int64_t> result =
+        WiredTigerUtil::getStatisticsValueAs<int64_t>(session->getSession(),
+                                                      "statistics:" + getURI(),
+                                                      "statistics=(fast)",
+                                                      WT_STAT_DSRC_BLOCK_REUSE_BYTES);
+    uassertStatusOK(result.getStatus());
+    return result.getValue();
+}
+
 // Retrieve the value from a positioned cursor.
 RecordData WiredTigerRecordStore::_getData(const WiredTigerCursor& cursor) const {
     WT_ITEM value;
@@ -1177,6 +1232,12 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx) {
 }
 
 void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayTruncateUpTo) {
+    // Bound the amount of work done under a single global lock acquisition. If there are still
+    // excess stones after this pass, the truncater thread drops its locks, lets waiting lockers
+    // through, and immediately comes back for another pass.
+    const int kMaxStonesPerReclaimPass = 10;
+    int stonesTruncated = 0;
+
     Timer timer;
     while (auto stone = _oplogStones->peekOldestStoneIfNeeded()) {
         invariant(stone->lastRecord.isValid());
@@ -1220,6 +1281,10 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayT
 
             // Stash the truncate point for next time to cleanly skip over tombstones, etc.
             _oplogStones->firstRecord = stone->lastRecord;
+
+            if (++stonesTruncated >= kMaxStonesPerReclaimPass) {
+                break;
+            }
         } catch (const WriteConflictException&) {
             LOG(1) << "Caught WriteConflictException while truncating oplog entries, retrying";
         }
@@ -1688,7 +1753,7 @@ public:
     virtual void commit(boost::optional<Timestamp>) {}
     virtual void rollback() {
         LOG(3) << "WiredTigerRecordStore: rolling back NumRecordsChange" << -_diff;
-        _rs->_sizeInfo->numRecords.fetchAndAdd(-_diff);
+        _rs->_sizeInfo->numRecords.add(-_diff);
     }
 
 private:
@@ -1702,8 +1767,9 @@ void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t d
     }
 
     opCtx->recoveryUnit()->registerChange(new NumRecordsChange(this, diff));
-    if (_sizeInfo->numRecords.fetchAndAdd(diff) < 0)
-        _sizeInfo->numRecords.store(std::max(diff, int64_t(0)));
+
+    // An aggregate that has gone negative is clamped at zero on read.
+    _sizeInfo->numRecords.add(diff);
 }
 
 class WiredTigerRecordStore::DataSizeChange : public RecoveryUnit::Change {
@@ -1727,8 +1793,8 @@ void WiredTigerRecordStore::_increaseDataSize(OperationContext* opCtx, int64_t a
     if (opCtx)
         opCtx->recoveryUnit()->registerChange(new DataSizeChange(this, amount));
 
-    if (_sizeInfo->dataSize.fetchAndAdd(amount) < 0)
-        _sizeInfo->dataSize.store(std::max(amount, int64_t(0)));
+    // An aggregate that has gone negative is clamped at zero on read.
+    _sizeInfo->dataSize.add(amount);
 
     if (_sizeStorer)
         _sizeStorer->store(_uri, _sizeInfo);
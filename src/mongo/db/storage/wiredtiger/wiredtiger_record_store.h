@@ -136,6 +136,8 @@ public:
                                 BSONObjBuilder* extraInfo = NULL,
                                 int infoLevel = 0) const;
 
+    virtual int64_t freeStorageSize(OperationContext* opCtx) const;
+
     // CRUD related
 
     virtual bool findRecord(OperationContext* opCtx, const RecordId& id, RecordData* out) const;
@@ -361,6 +363,12 @@ private:
 
     AtomicInt64 _nextIdNum;
 
+    // Cached result of the block manager size statistic, along with the time it was sampled.
+    // Frequently polled stats paths (e.g. collStats-driven monitoring) are served from this cache
+    // with bounded staleness rather than opening a statistics cursor per call.
+    mutable AtomicInt64 _cachedStorageSize;
+    mutable AtomicInt64 _cachedStorageSizeTimestampMillis;
+
     WiredTigerSizeStorer* _sizeStorer;  // not owned, can be NULL
     std::shared_ptr<WiredTigerSizeStorer::SizeInfo> _sizeInfo;
     WiredTigerKVEngine* _kvEngine;  // not owned.
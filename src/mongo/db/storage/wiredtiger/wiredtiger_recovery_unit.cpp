@@ -38,6 +38,7 @@
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/stats/operation_trace.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
@@ -266,6 +267,7 @@ void WiredTigerRecoveryUnit::preallocateSnapshot() {
 }
 
 void WiredTigerRecoveryUnit::_txnClose(bool commit) {
+    OPERATION_TRACE_SPAN("WiredTigerRecoveryUnit::_txnClose");
     invariant(_isActive(), toString(_state));
     WT_SESSION* s = _session->getSession();
     if (_timer) {
@@ -360,6 +362,7 @@ boost::optional<Timestamp> WiredTigerRecoveryUnit::getPointInTimeReadTimestamp()
 }
 
 void WiredTigerRecoveryUnit::_txnOpen() {
+    OPERATION_TRACE_SPAN("WiredTigerRecoveryUnit::_txnOpen");
     invariant(!_isActive(), toString(_state));
     invariant(!_isCommittingOrAborting(),
               str::stream() << "commit or rollback handler reopened transaction: "
@@ -549,8 +552,18 @@ Timestamp WiredTigerRecoveryUnit::getPrepareTimestamp() const {
 }
 
 void WiredTigerRecoveryUnit::setIgnorePrepared(bool value) {
-    _ignorePrepared = (value) ? WiredTigerBeginTxnBlock::IgnorePrepared::kIgnore
-                              : WiredTigerBeginTxnBlock::IgnorePrepared::kNoIgnore;
+    auto newValue = (value) ? WiredTigerBeginTxnBlock::IgnorePrepared::kIgnore
+                            : WiredTigerBeginTxnBlock::IgnorePrepared::kNoIgnore;
+    // The setting only applies when the WiredTiger transaction is opened; changing it once a
+    // snapshot is already active would silently leave the read either blocking on, or reading
+    // around, prepared transactions contrary to its read concern. Re-asserting the current value
+    // on an active transaction is a benign no-op, and happens legitimately: waitForReadConcern
+    // runs for every command, including DBDirectClient sub-commands already executing under a
+    // parent transaction's snapshot.
+    invariant(!_isActive() || _ignorePrepared == newValue,
+              str::stream() << "Current state: " << toString(_state)
+                            << ". Cannot change ignore_prepare setting on an active transaction");
+    _ignorePrepared = newValue;
 }
 
 void WiredTigerRecoveryUnit::setTimestampReadSource(ReadSource readSource,
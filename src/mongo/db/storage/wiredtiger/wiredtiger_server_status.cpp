@@ -55,6 +55,12 @@ bool WiredTigerServerStatusSection::includeByDefault() const {
     return true;
 }
 
+Milliseconds WiredTigerServerStatusSection::maxCacheStaleness() const {
+    // Walking the WT statistics cursor is the most expensive part of serverStatus; monitoring
+    // agents polling several times a second can share a recent copy.
+    return Milliseconds(500);
+}
+
 BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                                                        const BSONElement& configElement) const {
     Lock::GlobalLock lk(opCtx, LockMode::MODE_IS);
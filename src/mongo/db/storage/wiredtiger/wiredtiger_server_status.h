@@ -45,6 +45,7 @@ class WiredTigerServerStatusSection : public ServerStatusSection {
 public:
     WiredTigerServerStatusSection(WiredTigerKVEngine* engine);
     virtual bool includeByDefault() const;
+    virtual Milliseconds maxCacheStaleness() const;
     virtual BSONObj generateSection(OperationContext* opCtx,
                                     const BSONElement& configElement) const;
 
@@ -134,9 +134,18 @@ void _openCursor(WT_SESSION* session,
 
 
 WT_CURSOR* WiredTigerSession::getCursor(const std::string& uri, uint64_t id, bool allowOverwrite) {
-    // Find the most recently used cursor
+    // Fast path: hand back the cursor this operation just released, paying its deferred reset now.
+    if (_hotCursor && _hotCursorId == id && _hotCursorAllowOverwrite == allowOverwrite) {
+        WT_CURSOR* c = _hotCursor;
+        _hotCursor = nullptr;
+        invariantWTOK(c->reset(c));
+        _cursorsOut++;
+        return c;
+    }
+
+    // Find the most recently used cursor that was opened with a matching configuration
     for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
-        if (i->_id == id) {
+        if (i->_id == id && i->_allowOverwrite == allowOverwrite) {
             WT_CURSOR* c = i->_cursor;
             _cursors.erase(i);
             _cursorsOut++;
@@ -159,15 +168,18 @@ WT_CURSOR* WiredTigerSession::getReadOnceCursor(const std::string& uri, bool all
     return cursor;
 }
 
-void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
+void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor, bool allowOverwrite) {
     invariant(_session);
     invariant(cursor);
     _cursorsOut--;
 
-    invariantWTOK(cursor->reset(cursor));
-
-    // Cursors are pushed to the front of the list and removed from the back
-    _cursors.push_front(WiredTigerCachedCursor(id, _cursorGen++, cursor));
+    // Park the released cursor in the hot slot without resetting it; the reset is paid only if
+    // and when the cursor leaves the slot. Whatever previously occupied the slot moves into the
+    // ordinary cache.
+    _demoteHotCursor();
+    _hotCursor = cursor;
+    _hotCursorId = id;
+    _hotCursorAllowOverwrite = allowOverwrite;
 
     // A negative value for wiredTigercursorCacheSize means to use hybrid caching.
     std::uint32_t cacheSize = abs(kWiredTigerCursorCacheSize.load());
@@ -179,6 +191,20 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
     }
 }
 
+void WiredTigerSession::_demoteHotCursor() {
+    if (!_hotCursor)
+        return;
+
+    WT_CURSOR* cursor = _hotCursor;
+    _hotCursor = nullptr;
+
+    invariantWTOK(cursor->reset(cursor));
+
+    // Cursors are pushed to the front of the list and removed from the back
+    _cursors.push_front(
+        WiredTigerCachedCursor(_hotCursorId, _cursorGen++, cursor, _hotCursorAllowOverwrite));
+}
+
 void WiredTigerSession::closeCursor(WT_CURSOR* cursor) {
     invariant(_session);
     invariant(cursor);
@@ -190,6 +216,8 @@ void WiredTigerSession::closeCursor(WT_CURSOR* cursor) {
 void WiredTigerSession::closeAllCursors(const std::string& uri) {
     invariant(_session);
 
+    _demoteHotCursor();
+
     bool all = (uri == "");
     for (auto i = _cursors.begin(); i != _cursors.end();) {
         WT_CURSOR* cursor = i->_cursor;
@@ -204,6 +232,8 @@ void WiredTigerSession::closeAllCursors(const std::string& uri) {
 void WiredTigerSession::closeCursorsForQueuedDrops(WiredTigerKVEngine* engine) {
     invariant(_session);
 
+    _demoteHotCursor();
+
     _cursorEpoch = _cache->getCursorEpoch();
     auto toDrop = engine->filterCursorsWithQueuedDrops(&_cursors);
 
@@ -294,39 +324,48 @@ void WiredTigerSessionCache::waitUntilDurable(bool forceCheckpoint, bool stableC
         return;
     }
 
-    uint32_t start = _lastSyncTime.load();
-    // Do the remainder in a critical section that ensures only a single thread at a time
-    // will attempt to synchronize.
-    stdx::unique_lock<stdx::mutex> lk(_lastSyncMutex);
-    uint32_t current = _lastSyncTime.loadRelaxed();  // synchronized with writes through mutex
-    if (current != start) {
-        // Someone else synced already since we read lastSyncTime, so we're done!
-        return;
-    }
-    _lastSyncTime.store(current + 1);
-
-    // Nobody has synched yet, so we have to sync ourselves.
-
-    // This gets the token (OpTime) from the last write, before flushing (either the journal, or a
-    // checkpoint), and then reports that token (OpTime) as a durable write.
-    stdx::unique_lock<stdx::mutex> jlk(_journalListenerMutex);
-    JournalListener::Token token = _journalListener->getToken();
+    // Group commit: a single flush covers every write that committed before the flush started.
+    // Snapshot the started count before taking the mutex, so any flush that starts from here on
+    // is known to cover this writer.
+    const uint64_t start = _journalFlushesStarted.load();
+
+    stdx::unique_lock<stdx::mutex> lk(_journalFlushMutex);
+    while (_journalFlushesCompleted < start + 1) {
+        if (_journalFlushesStarted.loadRelaxed() == _journalFlushesCompleted) {
+            // No flush is running; lead the next one on behalf of every queued writer.
+            _journalFlushesStarted.store(_journalFlushesCompleted + 1);
+            lk.unlock();
+
+            // This gets the token (OpTime) from the last write, before flushing (either the
+            // journal, or a checkpoint), and then reports that token (OpTime) as a durable write.
+            stdx::unique_lock<stdx::mutex> jlk(_journalListenerMutex);
+            JournalListener::Token token = _journalListener->getToken();
 
-    // Initialize on first use.
-    if (!_waitUntilDurableSession) {
-        invariantWTOK(
-            _conn->open_session(_conn, NULL, "isolation=snapshot", &_waitUntilDurableSession));
-    }
+            // Initialize on first use.
+            if (!_waitUntilDurableSession) {
+                invariantWTOK(_conn->open_session(
+                    _conn, NULL, "isolation=snapshot", &_waitUntilDurableSession));
+            }
+
+            // Use the journal when available, or a checkpoint otherwise.
+            if (_engine && _engine->isDurable()) {
+                invariantWTOK(
+                    _waitUntilDurableSession->log_flush(_waitUntilDurableSession, "sync=on"));
+                LOG(4) << "flushed journal";
+            } else {
+                invariantWTOK(_waitUntilDurableSession->checkpoint(_waitUntilDurableSession, NULL));
+                LOG(4) << "created checkpoint";
+            }
+            _journalListener->onDurable(token);
+            jlk.unlock();
 
-    // Use the journal when available, or a checkpoint otherwise.
-    if (_engine && _engine->isDurable()) {
-        invariantWTOK(_waitUntilDurableSession->log_flush(_waitUntilDurableSession, "sync=on"));
-        LOG(4) << "flushed journal";
-    } else {
-        invariantWTOK(_waitUntilDurableSession->checkpoint(_waitUntilDurableSession, NULL));
-        LOG(4) << "created checkpoint";
+            lk.lock();
+            _journalFlushesCompleted++;
+            _journalFlushCond.notify_all();
+        } else {
+            _journalFlushCond.wait(lk);
+        }
     }
-    _journalListener->onDurable(token);
 }
 
 void WiredTigerSessionCache::waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx) {
@@ -348,10 +387,17 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 }
 
 
+WiredTigerSessionCache::SessionCacheShard& WiredTigerSessionCache::_homeShard() {
+    return _shards[std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) %
+                   kSessionCacheShards];
+}
+
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (size_t s = 0; s < kSessionCacheShards; s++) {
+        stdx::lock_guard<AdaptiveMutex> lock(_shards[s].lock);
+        for (auto session : _shards[s].sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -359,24 +405,30 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (size_t s = 0; s < kSessionCacheShards; s++) {
+        stdx::lock_guard<AdaptiveMutex> lock(_shards[s].lock);
+        for (auto session : _shards[s].sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
-
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
-    }
-
-    for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
-        delete (*i);
+    // Increment the epoch as we are now closing all sessions with this epoch. The bump must
+    // happen before any shard is swept so that a concurrent releaseSession either observes the
+    // new epoch and frees its session directly, or pushes the session onto a shard we have yet
+    // to sweep.
+    _epoch.fetchAndAdd(1);
+
+    for (size_t s = 0; s < kSessionCacheShards; s++) {
+        SessionCache swap;
+        {
+            stdx::lock_guard<AdaptiveMutex> lock(_shards[s].lock);
+            _shards[s].sessions.swap(swap);
+        }
+        for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
+            delete (*i);
+        }
     }
 }
 
@@ -389,13 +441,27 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
+    SessionCacheShard& home = _homeShard();
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (!_sessions.empty()) {
+        stdx::lock_guard<AdaptiveMutex> lock(home.lock);
+        if (!home.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = home.sessions.back();
+            home.sessions.pop_back();
+            return UniqueWiredTigerSession(cachedSession);
+        }
+    }
+
+    // The home shard is empty; steal from another shard before paying for a new WT session.
+    for (size_t s = 0; s < kSessionCacheShards; s++) {
+        SessionCacheShard& shard = _shards[s];
+        if (&shard == &home)
+            continue;
+        stdx::lock_guard<AdaptiveMutex> lock(shard.lock);
+        if (!shard.sessions.empty()) {
+            WiredTigerSession* cachedSession = shard.sessions.back();
+            shard.sessions.pop_back();
             return UniqueWiredTigerSession(cachedSession);
         }
     }
@@ -454,10 +520,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->dropQueuedIdentsAtSessionEndAllowed(true);
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+        SessionCacheShard& shard = _homeShard();
+        stdx::lock_guard<AdaptiveMutex> lock(shard.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            shard.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -41,7 +41,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_snapshot_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
-#include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/platform/adaptive_mutex.h"
 
 namespace mongo {
 
@@ -50,12 +50,13 @@ class WiredTigerSessionCache;
 
 class WiredTigerCachedCursor {
 public:
-    WiredTigerCachedCursor(uint64_t id, uint64_t gen, WT_CURSOR* cursor)
-        : _id(id), _gen(gen), _cursor(cursor) {}
+    WiredTigerCachedCursor(uint64_t id, uint64_t gen, WT_CURSOR* cursor, bool allowOverwrite)
+        : _id(id), _gen(gen), _cursor(cursor), _allowOverwrite(allowOverwrite) {}
 
     uint64_t _id;   // Source ID, assigned to each URI
     uint64_t _gen;  // Generation, used to age out old cursors
     WT_CURSOR* _cursor;
+    bool _allowOverwrite;  // Overwrite configuration the cursor was opened with
 };
 
 /**
@@ -99,7 +100,9 @@ public:
      * error if the record does not exist.
      *
      * This may return a cursor from the cursor cache and these cursors should *always* be released
-     * into the cache by calling releaseCursor().
+     * into the cache by calling releaseCursor(). Cached cursors are keyed by both the table id and
+     * the overwrite configuration, so a cursor is only ever reused with the configuration it was
+     * opened with.
      */
     WT_CURSOR* getCursor(const std::string& uri, uint64_t id, bool allowOverwrite);
 
@@ -116,9 +119,12 @@ public:
 
     /**
      * Release a cursor into the cursor cache and close old cursors if the number of cursors in the
-     * cache exceeds kWiredTigerCursorCacheSize.
+     * cache exceeds kWiredTigerCursorCacheSize. 'allowOverwrite' must be the configuration the
+     * cursor was obtained with. The reset of the released cursor is deferred until it leaves the
+     * hot slot, so single-use cursors are covered by the session-wide reset at checkin instead of
+     * paying an individual reset call.
      */
-    void releaseCursor(uint64_t id, WT_CURSOR* cursor);
+    void releaseCursor(uint64_t id, WT_CURSOR* cursor, bool allowOverwrite);
 
     /**
      * Close a cursor without releasing it into the cursor cache.
@@ -138,7 +144,7 @@ public:
     }
 
     int cachedCursors() const {
-        return _cursors.size();
+        return _cursors.size() + (_hotCursor ? 1 : 0);
     }
 
     bool isDropQueuedIdentsAtSessionEndAllowed() const {
@@ -172,6 +178,12 @@ private:
         return _cursorEpoch;
     }
 
+    /**
+     * Moves the most recently released cursor, if any, into the ordinary cursor cache, paying its
+     * deferred reset.
+     */
+    void _demoteHotCursor();
+
     const uint64_t _epoch;
     uint64_t _cursorEpoch;
     WiredTigerSessionCache* _cache;  // not owned
@@ -180,6 +192,13 @@ private:
     uint64_t _cursorGen;
     int _cursorsOut;
     bool _dropQueuedIdentsAtSessionEnd = true;
+
+    // The most recently released cursor, kept outside the cursor cache with its reset deferred.
+    // If it is never taken again before the session is checked in, the session-wide reset at
+    // checkin covers it and the individual reset call is skipped entirely.
+    WT_CURSOR* _hotCursor = nullptr;
+    uint64_t _hotCursorId = 0;
+    bool _hotCursorAllowOverwrite = false;
 };
 
 /**
@@ -296,9 +315,23 @@ private:
     AtomicUInt32 _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    stdx::mutex _cacheLock;
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The cache of idle sessions is sharded by thread id to reduce contention between checkouts
+    // and checkins on different threads. Each shard is guarded by its own adaptive mutex, and the
+    // critical sections only push or pop a raw pointer. A thread whose home shard is empty steals
+    // from the other shards before paying for a new WT session.
+    struct SessionCacheShard {
+        AdaptiveMutex lock;
+        SessionCache sessions;
+    };
+    static const size_t kSessionCacheShards = 8;
+    SessionCacheShard _shards[kSessionCacheShards];
+
+    /**
+     * Returns the shard that the calling thread checks sessions in and out of.
+     */
+    SessionCacheShard& _homeShard();
 
     // Bumped when all open sessions need to be closed
     AtomicUInt64 _epoch;  // atomic so we can check it outside of the lock
@@ -306,9 +339,15 @@ private:
     // Bumped when all open cursors need to be closed
     AtomicUInt64 _cursorEpoch;  // atomic so we can check it outside of the lock
 
-    // Counter and critical section mutex for waitUntilDurable
-    AtomicUInt32 _lastSyncTime;
-    stdx::mutex _lastSyncMutex;
+    // Group commit state for waitUntilDurable. A writer needing durability becomes the leader if
+    // no flush is running and issues a single sync on behalf of every writer that enqueued before
+    // it; writers that arrive while a flush is running wait for the next one. The started count is
+    // atomic so writers can snapshot it before taking the mutex; the completed count is guarded by
+    // the mutex.
+    AtomicUInt64 _journalFlushesStarted;
+    uint64_t _journalFlushesCompleted = 0;
+    stdx::mutex _journalFlushMutex;
+    stdx::condition_variable _journalFlushCond;
 
     // Mutex and cond var for waiting on prepare commit or abort.
     stdx::mutex _prepareCommittedOrAbortedMutex;
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
 
 #include <wiredtiger.h>
@@ -40,6 +41,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
@@ -57,6 +59,51 @@ namespace mongo {
  */
 class WiredTigerSizeStorer {
 public:
+    /**
+     * A 64-bit counter striped over several cache lines so that concurrent writers on different
+     * cores do not ping-pong a single line between them. add() touches only the stripe chosen by
+     * the calling thread's id; load() sums all stripes, so reads are only eventually consistent
+     * with respect to in-flight updates, which matches the approximate nature of size information.
+     * The aggregate is clamped at zero, replacing the negative-value repair previously done on
+     * update.
+     */
+    class StripedCounter {
+    public:
+        int64_t load() const {
+            int64_t total = 0;
+            for (size_t i = 0; i < kStripes; i++)
+                total += _stripes[i].value.load();
+            return std::max<int64_t>(total, 0);
+        }
+
+        /**
+         * Sets the aggregate value. Not atomic with respect to concurrent add() calls; updates
+         * racing with a store may be lost, as they already could be with a plain atomic.
+         */
+        void store(int64_t value) {
+            _stripes[0].value.store(value);
+            for (size_t i = 1; i < kStripes; i++)
+                _stripes[i].value.store(0);
+        }
+
+        void add(int64_t delta) {
+            _stripes[_myStripe()].value.fetchAndAdd(delta);
+        }
+
+    private:
+        static const size_t kStripes = 8;
+
+        struct alignas(64) Stripe {
+            AtomicInt64 value;
+        };
+
+        size_t _myStripe() const {
+            return std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) % kStripes;
+        }
+
+        Stripe _stripes[kStripes];
+    };
+
     /**
      * SizeInfo is a thread-safe buffer for keeping track of the number of documents in a collection
      * and their data size. Storing a SizeInfo in the WiredTigerSizeStorer results in shared
@@ -68,8 +115,8 @@ public:
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicInt64 numRecords;
-        AtomicInt64 dataSize;
+        StripedCounter numRecords;
+        StripedCounter dataSize;
 
     private:
         friend WiredTigerSizeStorer;
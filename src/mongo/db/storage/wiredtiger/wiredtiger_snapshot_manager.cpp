@@ -43,10 +43,10 @@
 namespace mongo {
 
 void WiredTigerSnapshotManager::setCommittedSnapshot(const Timestamp& timestamp) {
-    stdx::lock_guard<stdx::mutex> lock(_committedSnapshotMutex);
-
-    invariant(!_committedSnapshot || *_committedSnapshot <= timestamp);
-    _committedSnapshot = timestamp;
+    // Only the single replication thread advancing the committed view calls this, so the
+    // load-then-store pair does not race with other writers.
+    invariant(_committedSnapshot.load() <= timestamp.asULL());
+    _committedSnapshot.store(timestamp.asULL());
 }
 
 void WiredTigerSnapshotManager::setLocalSnapshot(const Timestamp& timestamp) {
@@ -60,8 +60,7 @@ boost::optional<Timestamp> WiredTigerSnapshotManager::getLocalSnapshot() {
 }
 
 void WiredTigerSnapshotManager::dropAllSnapshots() {
-    stdx::lock_guard<stdx::mutex> lock(_committedSnapshotMutex);
-    _committedSnapshot = boost::none;
+    _committedSnapshot.store(0);
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getMinSnapshotForNextCommittedRead() const {
@@ -69,24 +68,29 @@ boost::optional<Timestamp> WiredTigerSnapshotManager::getMinSnapshotForNextCommi
         return boost::none;
     }
 
-    stdx::lock_guard<stdx::mutex> lock(_committedSnapshotMutex);
-    return _committedSnapshot;
+    const uint64_t committedSnapshot = _committedSnapshot.load();
+    if (!committedSnapshot) {
+        return boost::none;
+    }
+    return Timestamp(committedSnapshot);
 }
 
 Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
     WT_SESSION* session, WiredTigerBeginTxnBlock::IgnorePrepared ignorePrepared) const {
     WiredTigerBeginTxnBlock txnOpen(session, ignorePrepared);
 
-    stdx::lock_guard<stdx::mutex> lock(_committedSnapshotMutex);
+    // A single lock-free load; this is on the hot path of every majority read.
+    const uint64_t committedSnapshot = _committedSnapshot.load();
     uassert(ErrorCodes::ReadConcernMajorityNotAvailableYet,
             "Committed view disappeared while running operation",
-            _committedSnapshot);
+            committedSnapshot);
 
-    auto status = txnOpen.setTimestamp(_committedSnapshot.get());
+    const Timestamp timestamp(committedSnapshot);
+    auto status = txnOpen.setTimestamp(timestamp);
     fassert(30635, status);
 
     txnOpen.done();
-    return *_committedSnapshot;
+    return timestamp;
 }
 
 Timestamp WiredTigerSnapshotManager::beginTransactionOnLocalSnapshot(
@@ -37,6 +37,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/storage/snapshot_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
 
 namespace mongo {
@@ -85,9 +86,10 @@ public:
     boost::optional<Timestamp> getMinSnapshotForNextCommittedRead() const;
 
 private:
-    // Snapshot to use for reads at a commit timestamp.
-    mutable stdx::mutex _committedSnapshotMutex;  // Guards _committedSnapshot.
-    boost::optional<Timestamp> _committedSnapshot;
+    // Snapshot to use for reads at a commit timestamp, encoded as Timestamp::asULL(). A value of
+    // zero means there is no committed snapshot. Stored lock-free because every majority read loads
+    // it; a mutex here is a top contention site under heavy majority-read workloads.
+    AtomicUInt64 _committedSnapshot{0};
 
     // Snapshot to use for reads at a local stable timestamp.
     mutable stdx::mutex _localSnapshotMutex;  // Guards _localSnapshot.
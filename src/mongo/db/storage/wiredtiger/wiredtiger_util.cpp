@@ -139,7 +139,9 @@ StatusWith<std::string> WiredTigerUtil::getMetadata(OperationContext* opCtx, Str
         session->getCursor("metadata:create", WiredTigerSession::kMetadataTableId, false);
     invariant(cursor);
     auto releaser =
-        MakeGuard([&] { session->releaseCursor(WiredTigerSession::kMetadataTableId, cursor); });
+        MakeGuard([&] {
+            session->releaseCursor(WiredTigerSession::kMetadataTableId, cursor, false);
+        });
 
     std::string strUri = uri.toString();
     cursor->set_key(cursor, strUri.c_str());
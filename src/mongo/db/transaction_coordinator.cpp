@@ -34,8 +34,11 @@
 
 #include "mongo/db/transaction_coordinator.h"
 
+#include <utility>
+
 #include "mongo/db/logical_clock.h"
 #include "mongo/db/transaction_coordinator_util.h"
+#include "mongo/db/wait_for_majority_service.h"
 #include "mongo/util/log.h"
 
 namespace mongo {
@@ -97,9 +100,15 @@ SharedSemiFuture<TransactionCoordinator::CommitDecision> TransactionCoordinator:
     txn::async(_callbackPool,
                [coordinator, participantShards] {
                    auto opCtx = Client::getCurrent()->makeOperationContext();
-                   txn::persistParticipantList(
+                   return txn::persistParticipantList(
                        opCtx.get(), coordinator->_lsid, coordinator->_txnNumber, participantShards);
                })
+        .then([](repl::OpTime opTime) {
+            // Wait for the participant list write off-thread, so that concurrent coordinators
+            // share a single majority wait instead of each blocking a thread pool thread.
+            return WaitForMajorityService::get(getGlobalServiceContext())
+                .waitUntilMajority(opTime);
+        })
         .then([coordinator, participantShards]() {
             return txn::sendPrepare(coordinator,
                                     coordinator->_networkExecutor,
@@ -114,14 +123,20 @@ SharedSemiFuture<TransactionCoordinator::CommitDecision> TransactionCoordinator:
                 auto opCtx = Client::getCurrent()->makeOperationContext();
                 const auto decision = makeDecisionFromPrepareVoteConsensus(
                     result, coordinator->_lsid, coordinator->_txnNumber);
-                txn::persistDecision(opCtx.get(),
-                                     coordinator->_lsid,
-                                     coordinator->_txnNumber,
-                                     participantShards,
-                                     decision.commitTimestamp);
-                return decision;
+                auto opTime = txn::persistDecision(opCtx.get(),
+                                                   coordinator->_lsid,
+                                                   coordinator->_txnNumber,
+                                                   participantShards,
+                                                   decision.commitTimestamp);
+                return std::make_pair(decision, opTime);
             });
         })
+        .then([](std::pair<txn::CoordinatorCommitDecision, repl::OpTime> decisionAndOpTime) {
+            auto decision = decisionAndOpTime.first;
+            return WaitForMajorityService::get(getGlobalServiceContext())
+                .waitUntilMajority(decisionAndOpTime.second)
+                .then([decision] { return decision; });
+        })
         .then([coordinator, participantShards](txn::CoordinatorCommitDecision decision) {
             return coordinator->_sendDecisionToParticipants(participantShards, decision)
                 .then([decision] { return decision.decision; });
@@ -61,11 +61,6 @@ using RemoteCommandCallbackArgs = executor::TaskExecutor::RemoteCommandCallbackA
 using ResponseStatus = executor::TaskExecutor::ResponseStatus;
 using CommitDecision = TransactionCoordinator::CommitDecision;
 
-const WriteConcernOptions kInternalMajorityNoSnapshotWriteConcern(
-    WriteConcernOptions::kInternalMajorityNoSnapshot,
-    WriteConcernOptions::SyncMode::UNSET,
-    WriteConcernOptions::kNoTimeout);
-
 /**
  * Finds the host and port for a shard.
  */
@@ -457,10 +452,10 @@ Future<void> sendAbort(executor::TaskExecutor* executor,
     return whenAll(responses);
 }
 
-void persistParticipantList(OperationContext* opCtx,
-                            LogicalSessionId lsid,
-                            TxnNumber txnNumber,
-                            const std::vector<ShardId>& participantList) {
+repl::OpTime persistParticipantList(OperationContext* opCtx,
+                                    LogicalSessionId lsid,
+                                    TxnNumber txnNumber,
+                                    const std::vector<ShardId>& participantList) {
     LOG(0) << "Going to write participant list for lsid: " << lsid.toBSON()
            << ", txnNumber: " << txnNumber;
 
@@ -533,19 +528,14 @@ void persistParticipantList(OperationContext* opCtx,
     MONGO_FAIL_POINT_PAUSE_WHILE_SET_OR_INTERRUPTED(
         opCtx, hangBeforeWaitingForParticipantListWriteConcern);
 
-    WriteConcernResult unusedWCResult;
-    uassertStatusOK(
-        waitForWriteConcern(opCtx,
-                            repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp(),
-                            kInternalMajorityNoSnapshotWriteConcern,
-                            &unusedWCResult));
+    return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
 }
 
-void persistDecision(OperationContext* opCtx,
-                     LogicalSessionId lsid,
-                     TxnNumber txnNumber,
-                     const std::vector<ShardId>& participantList,
-                     const boost::optional<Timestamp>& commitTimestamp) {
+repl::OpTime persistDecision(OperationContext* opCtx,
+                             LogicalSessionId lsid,
+                             TxnNumber txnNumber,
+                             const std::vector<ShardId>& participantList,
+                             const boost::optional<Timestamp>& commitTimestamp) {
     LOG(0) << "Going to write decision " << (commitTimestamp ? "commit" : "abort")
            << " for lsid: " << lsid.toBSON() << ", txnNumber: " << txnNumber;
 
@@ -639,12 +629,7 @@ void persistDecision(OperationContext* opCtx,
     MONGO_FAIL_POINT_PAUSE_WHILE_SET_OR_INTERRUPTED(opCtx,
                                                     hangBeforeWaitingForDecisionWriteConcern);
 
-    WriteConcernResult unusedWCResult;
-    uassertStatusOK(
-        waitForWriteConcern(opCtx,
-                            repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp(),
-                            kInternalMajorityNoSnapshotWriteConcern,
-                            &unusedWCResult));
+    return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
 }
 
 void deleteCoordinatorDoc(OperationContext* opCtx, LogicalSessionId lsid, TxnNumber txnNumber) {
@@ -32,6 +32,7 @@
 
 #include "mongo/db/logical_session_id.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/repl/optime.h"
 #include "mongo/db/transaction_coordinator.h"
 #include "mongo/db/transaction_coordinator_document_gen.h"
 #include "mongo/executor/task_executor.h"
@@ -145,16 +146,17 @@ Future<void> sendAbort(executor::TaskExecutor* executor,
  *    participants: ["shard0000", "shard0001"]
  * }
  *
- * into config.transaction_coordinators and waits for the upsert to be majority-committed.
+ * into config.transaction_coordinators and returns the upsert's optime, which the caller is
+ * expected to wait on to become majority-committed, e.g. through WaitForMajorityService.
  *
- * Throws if the upsert fails or waiting for writeConcern fails.
+ * Throws if the upsert fails.
  * If the upsert returns a DuplicateKey error, converts it to an anonymous error, because it means
  * a document for the (lsid, txnNumber) exists with a different participant list.
  */
-void persistParticipantList(OperationContext* opCtx,
-                            LogicalSessionId lsid,
-                            TxnNumber txnNumber,
-                            const std::vector<ShardId>& participantList);
+repl::OpTime persistParticipantList(OperationContext* opCtx,
+                                    LogicalSessionId lsid,
+                                    TxnNumber txnNumber,
+                                    const std::vector<ShardId>& participantList);
 
 /**
  * If 'commitTimestamp' is boost::none, updates the document in config.transaction_coordinators for
@@ -175,18 +177,19 @@ void persistParticipantList(OperationContext* opCtx,
  *    commitTimestamp: Timestamp(xxxxxxxx, x),
  * }
  *
- * and waits for the update to be majority-committed.
+ * and returns the update's optime, which the caller is expected to wait on to become
+ * majority-committed, e.g. through WaitForMajorityService.
  *
- * Throws if the update fails or waiting for writeConcern fails.
+ * Throws if the update fails.
  * If the update succeeds but did not update any document, throws an anonymous error, because it
  * means either no document for (lsid, txnNumber) exists, or a document exists but has a different
  * participant list, different decision, or different commit Timestamp.
  */
-void persistDecision(OperationContext* opCtx,
-                     LogicalSessionId lsid,
-                     TxnNumber txnNumber,
-                     const std::vector<ShardId>& participantList,
-                     const boost::optional<Timestamp>& commitTimestamp);
+repl::OpTime persistDecision(OperationContext* opCtx,
+                             LogicalSessionId lsid,
+                             TxnNumber txnNumber,
+                             const std::vector<ShardId>& participantList,
+                             const boost::optional<Timestamp>& commitTimestamp);
 
 /**
  * Deletes the document in config.transaction_coordinators for (lsid, txnNumber).
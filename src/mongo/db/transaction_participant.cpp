@@ -517,14 +517,17 @@ TransactionParticipant::OplogSlotReserver::~OplogSlotReserver() {
     }
 }
 
-TransactionParticipant::TxnResources::TxnResources(OperationContext* opCtx, bool keepTicket) {
+TransactionParticipant::TxnResources::TxnResources(OperationContext* opCtx,
+                                                   bool keepTicket,
+                                                   std::unique_ptr<Locker> scratchLocker) {
     // We must lock the Client to change the Locker on the OperationContext.
     stdx::lock_guard<Client> lk(*opCtx->getClient());
 
     _ruState = opCtx->getWriteUnitOfWork()->release();
     opCtx->setWriteUnitOfWork(nullptr);
 
-    _locker = opCtx->swapLockState(stdx::make_unique<LockerImpl>());
+    _locker = opCtx->swapLockState(scratchLocker ? std::move(scratchLocker)
+                                                 : stdx::make_unique<LockerImpl>());
     // Inherit the locking setting from the original one.
     opCtx->lockState()->setShouldConflictWithSecondaryBatchApplication(
         _locker->shouldConflictWithSecondaryBatchApplication());
@@ -571,7 +574,7 @@ TransactionParticipant::TxnResources::~TxnResources() {
     }
 }
 
-void TransactionParticipant::TxnResources::release(OperationContext* opCtx) {
+std::unique_ptr<Locker> TransactionParticipant::TxnResources::release(OperationContext* opCtx) {
     // Perform operations that can fail the release before marking the TxnResources as released.
 
     // Restore locks if they are yielded.
@@ -589,10 +592,10 @@ void TransactionParticipant::TxnResources::release(OperationContext* opCtx) {
     // It is necessary to lock the client to change the Locker on the OperationContext.
     stdx::lock_guard<Client> lk(*opCtx->getClient());
     invariant(opCtx->lockState()->getClientState() == Locker::ClientState::kInactive);
-    // We intentionally do not capture the return value of swapLockState(), which is just an empty
-    // locker. At the end of the operation, if the transaction is not complete, we will stash the
-    // operation context's locker and replace it with a new empty locker.
-    opCtx->swapLockState(std::move(_locker));
+    // The return value of swapLockState() is just an empty, inactive locker. We hand it back to
+    // the caller so that the next stash can leave it on the outgoing operation context instead of
+    // allocating a fresh one.
+    auto scratchLocker = opCtx->swapLockState(std::move(_locker));
     opCtx->lockState()->updateThreadIdToCurrentThread();
 
     auto oldState = opCtx->setRecoveryUnit(std::move(_recoveryUnit),
@@ -604,6 +607,8 @@ void TransactionParticipant::TxnResources::release(OperationContext* opCtx) {
 
     auto& readConcernArgs = repl::ReadConcernArgs::get(opCtx);
     readConcernArgs = _readConcernArgs;
+
+    return scratchLocker;
 }
 
 TransactionParticipant::SideTransactionBlock::SideTransactionBlock(OperationContext* opCtx)
@@ -634,7 +639,7 @@ void TransactionParticipant::_stashActiveTransaction(WithLock, OperationContext*
     }
 
     invariant(!_txnResourceStash);
-    _txnResourceStash = TxnResources(opCtx);
+    _txnResourceStash = TxnResources(opCtx, false /* keepTicket */, std::move(_scratchLocker));
 }
 
 
@@ -689,7 +694,7 @@ void TransactionParticipant::unstashTransactionResources(OperationContext* opCtx
             uassert(ErrorCodes::InvalidOptions,
                     "Only the first command in a transaction may specify a readConcern",
                     readConcernArgs.isEmpty());
-            _txnResourceStash->release(opCtx);
+            _scratchLocker = _txnResourceStash->release(opCtx);
             _txnResourceStash = boost::none;
             stdx::lock_guard<stdx::mutex> lm(_metricsMutex);
             _transactionMetricsObserver.onUnstash(ServerTransactionsMetrics::get(opCtx),
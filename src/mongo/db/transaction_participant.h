@@ -80,8 +80,14 @@ public:
         /**
          * Stashes transaction state from 'opCtx' in the newly constructed TxnResources.
          * Ephemerally holds the Client lock associated with opCtx.
+         *
+         * 'scratchLocker', if provided, is left on 'opCtx' in place of the stashed transaction
+         * locker instead of a newly allocated one; release() returns the displaced locker so
+         * callers stashing once per statement can recycle it.
          */
-        TxnResources(OperationContext* opCtx, bool keepTicket = false);
+        TxnResources(OperationContext* opCtx,
+                     bool keepTicket = false,
+                     std::unique_ptr<Locker> scratchLocker = nullptr);
 
         ~TxnResources();
 
@@ -100,8 +106,11 @@ public:
         /**
          * Releases stashed transaction state onto 'opCtx'. Must only be called once.
          * Ephemerally holds the Client lock associated with opCtx.
+         *
+         * Returns the inactive locker displaced from 'opCtx', which may be passed to a later
+         * TxnResources as its scratch locker. Callers may discard it.
          */
-        void release(OperationContext* opCtx);
+        std::unique_ptr<Locker> release(OperationContext* opCtx);
 
         /**
          * Returns the read concern arguments.
@@ -720,6 +729,11 @@ private:
     // Holds transaction resources between network operations.
     boost::optional<TxnResources> _txnResourceStash;
 
+    // An inactive locker recycled between the statements of a multi-statement transaction. Each
+    // stash leaves a scratch locker on the outgoing operation context; reusing the one displaced
+    // by the previous unstash avoids allocating a fresh LockerImpl per statement.
+    std::unique_ptr<Locker> _scratchLocker;
+
     // Maintains the transaction state and the transition table for legal state transitions.
     TransactionState _txnState;
 
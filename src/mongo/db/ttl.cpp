@@ -36,6 +36,9 @@
 
 #include "mongo/db/ttl.h"
 
+#include <algorithm>
+#include <map>
+
 #include "mongo/base/counter.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/user_name.h"
@@ -47,20 +50,24 @@
 #include "mongo/db/client.h"
 #include "mongo/db/commands/fsync_locked.h"
 #include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/locker.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/db_raii.h"
-#include "mongo/db/exec/delete.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/logical_session_id.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/ops/insert.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/ttl_collection_cache.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/exit.h"
 #include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
 
 namespace mongo {
 
@@ -79,6 +86,24 @@ MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorSleepSecs, int, 60)
         return Status::OK();
     });  // used for testing
 
+// Maximum number of documents deleted per WriteUnitOfWork. Expired documents beyond this are
+// removed by subsequent batches within the same pass, with pacing in between.
+MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorBatchSize, int, 100)
+    ->withValidator([](const int& newVal) {
+        if (newVal <= 0)
+            return Status(ErrorCodes::BadValue, "ttlMonitorBatchSize must be strictly positive");
+        return Status::OK();
+    });
+
+// Number of worker threads allowed to process TTL indexes of distinct collections concurrently.
+// The default of 1 preserves the historical single-threaded pass.
+MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorWorkers, int, 1)
+    ->withValidator([](const int& newVal) {
+        if (newVal <= 0)
+            return Status(ErrorCodes::BadValue, "ttlMonitorWorkers must be strictly positive");
+        return Status::OK();
+    });
+
 class TTLMonitor : public BackgroundJob {
 public:
     TTLMonitor() {}
@@ -135,7 +160,10 @@ private:
 
         TTLCollectionCache& ttlCollectionCache = TTLCollectionCache::get(getGlobalServiceContext());
         std::vector<std::string> ttlCollections = ttlCollectionCache.getCollections();
-        std::vector<BSONObj> ttlIndexes;
+
+        // TTL indexes are grouped by collection so that distinct collections may be processed by
+        // concurrent workers, while indexes on the same collection stay on a single worker.
+        std::map<std::string, std::vector<BSONObj>> ttlIndexesByCollection;
 
         ttlPasses.increment();
 
@@ -156,14 +184,47 @@ private:
             for (const std::string& name : indexNames) {
                 BSONObj spec = collEntry->getIndexSpec(&opCtx, name);
                 if (spec.hasField(secondsExpireField)) {
-                    ttlIndexes.push_back(spec.getOwned());
+                    ttlIndexesByCollection[collectionNS].push_back(spec.getOwned());
                 }
             }
         }
 
-        for (const BSONObj& idx : ttlIndexes) {
+        const size_t numWorkers = std::min(static_cast<size_t>(ttlMonitorWorkers.load()),
+                                           ttlIndexesByCollection.size());
+        if (numWorkers <= 1) {
+            for (const auto& entry : ttlIndexesByCollection) {
+                _doTTLForCollection(&opCtx, entry.second);
+            }
+            return;
+        }
+
+        ThreadPool::Options poolOptions;
+        poolOptions.poolName = "TTLMonitor";
+        poolOptions.threadNamePrefix = "TTLMonitor-";
+        poolOptions.minThreads = 0;
+        poolOptions.maxThreads = numWorkers;
+        poolOptions.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName.c_str());
+        };
+        ThreadPool pool(poolOptions);
+        pool.startup();
+
+        for (const auto& entry : ttlIndexesByCollection) {
+            uassertStatusOK(pool.schedule([ this, indexes = entry.second ] {
+                const ServiceContext::UniqueOperationContext workerOpCtxPtr =
+                    cc().makeOperationContext();
+                _doTTLForCollection(workerOpCtxPtr.get(), indexes);
+            }));
+        }
+
+        pool.shutdown();
+        pool.join();
+    }
+
+    void _doTTLForCollection(OperationContext* opCtx, const std::vector<BSONObj>& indexes) {
+        for (const BSONObj& idx : indexes) {
             try {
-                doTTLForIndex(&opCtx, idx);
+                doTTLForIndex(opCtx, idx);
             } catch (const DBException& dbex) {
                 error() << "Error processing ttl index: " << idx << " -- " << dbex.toString();
                 // Continue on to the next index.
@@ -175,6 +236,10 @@ private:
     /**
      * Remove documents from the collection using the specified TTL index after a sufficient amount
      * of time has passed according to its expiry specification.
+     *
+     * Documents are removed in bounded batches, each applied in a single WriteUnitOfWork. The
+     * collection lock is reacquired for every batch, so the pacing waits between batches never
+     * hold locks.
      */
     void doTTLForIndex(OperationContext* opCtx, BSONObj idx) {
         const NamespaceString collectionNSS(idx["ns"].String());
@@ -196,31 +261,65 @@ private:
 
         LOG(1) << "ns: " << collectionNSS << " key: " << key << " name: " << name;
 
+        const long long batchSize = ttlMonitorBatchSize.load();
+        long long totalDeleted = 0;
+        bool moreWork = true;
+        while (moreWork && !globalInShutdownDeprecated()) {
+            auto swMoreWork =
+                _deleteExpiredBatch(opCtx, collectionNSS, name, batchSize, &totalDeleted);
+            if (!swMoreWork.isOK()) {
+                error() << "ttl deletion for index " << idx
+                        << " failed with status: " << redact(swMoreWork.getStatus());
+                break;
+            }
+            moreWork = swMoreWork.getValue();
+            if (moreWork) {
+                _pauseForForegroundLoad(opCtx);
+            }
+        }
+
+        LOG(1) << "deleted: " << totalDeleted;
+    }
+
+    /**
+     * Deletes up to 'batchSize' expired documents in a single WriteUnitOfWork. Returns whether
+     * another batch may be needed, and adds the number of documents deleted to '*numDeletedOut'.
+     */
+    StatusWith<bool> _deleteExpiredBatch(OperationContext* opCtx,
+                                         const NamespaceString& collectionNSS,
+                                         StringData name,
+                                         long long batchSize,
+                                         long long* numDeletedOut) {
         AutoGetCollection autoGetCollection(opCtx, collectionNSS, MODE_IX);
         Collection* collection = autoGetCollection.getCollection();
         if (!collection) {
             // Collection was dropped.
-            return;
+            return false;
         }
 
         if (!repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, collectionNSS)) {
-            return;
+            return false;
         }
 
         IndexDescriptor* desc = collection->getIndexCatalog()->findIndexByName(opCtx, name);
         if (!desc) {
             LOG(1) << "index not found (index build in progress? index dropped?), skipping "
-                   << "ttl job for: " << idx;
-            return;
+                   << "ttl job for index: " << name;
+            return false;
         }
 
-        // Re-read 'idx' from the descriptor, in case the collection or index definition changed
-        // before we re-acquired the collection lock.
-        idx = desc->infoObj();
+        // Re-read the spec from the descriptor, in case the collection or index definition
+        // changed before we (re)acquired the collection lock.
+        const BSONObj idx = desc->infoObj();
+        const BSONObj key = idx["key"].Obj();
+        if (key.nFields() != 1) {
+            error() << "key for ttl index can only have 1 field, skipping ttl job for: " << idx;
+            return false;
+        }
 
         if (IndexType::INDEX_BTREE != IndexNames::nameToType(desc->getAccessMethodName())) {
             error() << "special index can't be used as a ttl index, skipping ttl job for: " << idx;
-            return;
+            return false;
         }
 
         BSONElement secondsExpireElt = idx[secondsExpireField];
@@ -228,7 +327,7 @@ private:
             error() << "ttl indexes require the " << secondsExpireField << " field to be "
                     << "numeric but received a type of " << typeName(secondsExpireElt.type())
                     << ", skipping ttl job for: " << idx;
-            return;
+            return false;
         }
 
         const Date_t kDawnOfTime =
@@ -242,9 +341,10 @@ private:
             ? InternalPlanner::Direction::FORWARD
             : InternalPlanner::Direction::BACKWARD;
 
-        // We need to pass into the DeleteStageParams (below) a CanonicalQuery with a BSONObj that
-        // queries for the expired documents correctly so that we do not delete documents that are
-        // not actually expired when our snapshot changes during deletion.
+        // A query matching only genuinely expired documents, so that we do not delete documents
+        // whose TTL index entry is expired but which are not actually expired (e.g. a multikey
+        // index on an array with both expired and unexpired dates), nor documents that changed
+        // between the scan below and the deletes.
         const char* keyFieldName = key.firstElement().fieldName();
         BSONObj query =
             BSON(keyFieldName << BSON("$gte" << kDawnOfTime << "$lte" << expirationTime));
@@ -252,32 +352,93 @@ private:
         qr->setFilter(query);
         auto canonicalQuery = CanonicalQuery::canonicalize(opCtx, std::move(qr));
         invariant(canonicalQuery.getStatus());
+        const MatchExpression* expiredMatcher = canonicalQuery.getValue()->root();
+
+        // Collect one batch of expired documents in TTL index order.
+        std::vector<std::pair<RecordId, BSONObj>> expired;
+        expired.reserve(batchSize);
+        {
+            auto exec = InternalPlanner::indexScan(opCtx,
+                                                   collection,
+                                                   desc,
+                                                   startKey,
+                                                   endKey,
+                                                   BoundInclusion::kIncludeBothStartAndEndKeys,
+                                                   PlanExecutor::NO_YIELD,
+                                                   direction,
+                                                   InternalPlanner::IXSCAN_FETCH);
+            BSONObj obj;
+            RecordId rid;
+            PlanExecutor::ExecState state = PlanExecutor::ADVANCED;
+            while (static_cast<long long>(expired.size()) < batchSize &&
+                   PlanExecutor::ADVANCED == (state = exec->getNext(&obj, &rid))) {
+                if (expiredMatcher->matchesBSON(obj)) {
+                    expired.emplace_back(rid, obj.getOwned());
+                }
+            }
+            if (PlanExecutor::ADVANCED != state && PlanExecutor::IS_EOF != state) {
+                return Status(ErrorCodes::OperationFailed,
+                              str::stream() << "ttl index scan died with state: "
+                                            << PlanExecutor::statestr(state));
+            }
+        }
 
-        DeleteStageParams params;
-        params.isMulti = true;
-        params.canonicalQuery = canonicalQuery.getValue().get();
-
-        auto exec =
-            InternalPlanner::deleteWithIndexScan(opCtx,
-                                                 collection,
-                                                 params,
-                                                 desc,
-                                                 startKey,
-                                                 endKey,
-                                                 BoundInclusion::kIncludeBothStartAndEndKeys,
-                                                 PlanExecutor::YIELD_AUTO,
-                                                 direction);
-
-        Status result = exec->executePlan();
-        if (!result.isOK()) {
-            error() << "ttl query execution for index " << idx
-                    << " failed with status: " << redact(result);
-            return;
+        if (expired.empty()) {
+            return false;
         }
 
-        const long long numDeleted = DeleteStage::getNumDeleted(*exec);
+        long long numDeleted = 0;
+        writeConflictRetry(opCtx, "ttl batch delete", collectionNSS.ns(), [&] {
+            numDeleted = 0;
+            WriteUnitOfWork wunit(opCtx);
+            for (const auto& doc : expired) {
+                // Re-verify the document under the current snapshot; it may have been updated or
+                // removed since the scan, in particular if this unit of work is being retried
+                // after a write conflict.
+                Snapshotted<BSONObj> current;
+                if (!collection->findDoc(opCtx, doc.first, &current)) {
+                    continue;
+                }
+                if (!expiredMatcher->matchesBSON(current.value())) {
+                    continue;
+                }
+                collection->deleteDocument(opCtx, kUninitializedStmtId, doc.first, nullptr);
+                numDeleted++;
+            }
+            wunit.commit();
+        });
+
         ttlDeletedDocuments.increment(numDeleted);
-        LOG(1) << "deleted: " << numDeleted;
+        *numDeletedOut += numDeleted;
+
+        // A full batch suggests more expired documents remain.
+        return static_cast<long long>(expired.size()) == batchSize;
+    }
+
+    /**
+     * Waits briefly between batches while foreground writers are queued for a global throttling
+     * ticket or the majority commit point is lagging, so that TTL deletes back off rather than
+     * add to an existing backlog. Bounded so a sustained load cannot stall the monitor forever.
+     */
+    void _pauseForForegroundLoad(OperationContext* opCtx) {
+        static constexpr long long kMaxCommitPointLagSecs = 10;
+        for (int i = 0; i < 10 && !globalInShutdownDeprecated(); i++) {
+            const bool writersQueued = Locker::getGlobalThrottlingQueueDepth(MODE_IX) > 0;
+
+            bool replicationLagging = false;
+            auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+            if (replCoord->getReplicationMode() == repl::ReplicationCoordinator::modeReplSet) {
+                const auto lastApplied = replCoord->getMyLastAppliedOpTime().getTimestamp();
+                const auto lastCommitted = replCoord->getLastCommittedOpTime().getTimestamp();
+                replicationLagging = lastApplied.getSecs() >
+                    lastCommitted.getSecs() + kMaxCommitPointLagSecs;
+            }
+
+            if (!writersQueued && !replicationLagging) {
+                return;
+            }
+            sleepmillis(100);
+        }
     }
 };
 
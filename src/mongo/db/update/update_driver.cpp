@@ -146,10 +146,22 @@ bool parseUpdateExpression(
     return positional;
 }
 
+// Update drivers are constructed and torn down once per operation. Routing their documents'
+// storage through a per-thread arena recycles the element vectors and leaf buffers across
+// operations instead of reallocating them each time. The arena requires that drivers be
+// destroyed on the thread that created them, which holds for the operation-scoped drivers
+// built here.
+mutablebson::DocumentArena& perThreadDocumentArena() {
+    static thread_local mutablebson::DocumentArena arena;
+    return arena;
+}
+
 }  // namespace
 
 UpdateDriver::UpdateDriver(const boost::intrusive_ptr<ExpressionContext>& expCtx)
-    : _expCtx(expCtx) {}
+    : _expCtx(expCtx),
+      _objDoc(perThreadDocumentArena()),
+      _logDoc(perThreadDocumentArena()) {}
 
 void UpdateDriver::parse(
     const BSONObj& updateExpr,
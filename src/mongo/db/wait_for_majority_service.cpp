@@ -0,0 +1,164 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/wait_for_majority_service.h"
+
+#include <utility>
+
+#include "mongo/db/client.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/write_concern.h"
+#include "mongo/db/write_concern_options.h"
+
+namespace mongo {
+namespace {
+
+const auto waitForMajorityServiceDecoration =
+    ServiceContext::declareDecoration<WaitForMajorityService>();
+
+const WriteConcernOptions kMajorityWriteConcern(WriteConcernOptions::kInternalMajorityNoSnapshot,
+                                                WriteConcernOptions::SyncMode::UNSET,
+                                                WriteConcernOptions::kNoTimeout);
+
+}  // namespace
+
+WaitForMajorityService::~WaitForMajorityService() {
+    shutDown();
+}
+
+WaitForMajorityService& WaitForMajorityService::get(ServiceContext* service) {
+    return waitForMajorityServiceDecoration(service);
+}
+
+Future<void> WaitForMajorityService::waitUntilMajority(const repl::OpTime& opTime) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    if (_inShutDown) {
+        return Future<void>::makeReady(
+            Status{ErrorCodes::ShutdownInProgress,
+                   "rejecting wait for majority because the server is shutting down"});
+    }
+
+    // The background thread is started lazily so that nodes which never wait for majority do not
+    // pay for it.
+    if (!_thread.joinable()) {
+        _thread = stdx::thread([this] { _waitForMajorityThread(); });
+    }
+
+    auto pf = makePromiseFuture<void>();
+    _queuedOpTimes[opTime].emplace_back(std::move(pf.promise));
+    _hasWorkCV.notify_one();
+
+    return std::move(pf.future);
+}
+
+void WaitForMajorityService::shutDown() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_inShutDown) {
+            return;
+        }
+        _inShutDown = true;
+
+        if (_opCtx) {
+            stdx::lock_guard<Client> clientLock(*_opCtx->getClient());
+            _opCtx->markKilled(ErrorCodes::InterruptedAtShutdown);
+        }
+
+        _hasWorkCV.notify_one();
+    }
+
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    for (auto&& entry : _queuedOpTimes) {
+        for (auto&& promise : entry.second) {
+            promise.setError({ErrorCodes::InterruptedAtShutdown,
+                              "wait for majority interrupted by shutdown"});
+        }
+    }
+    _queuedOpTimes.clear();
+}
+
+void WaitForMajorityService::_waitForMajorityThread() {
+    Client::initThread("WaitForMajority");
+
+    while (true) {
+        repl::OpTime lowestOpTime;
+
+        {
+            stdx::unique_lock<stdx::mutex> lk(_mutex);
+            _hasWorkCV.wait(lk, [&] { return _inShutDown || !_queuedOpTimes.empty(); });
+            if (_inShutDown) {
+                // shutDown() fails the remaining waiters after joining this thread.
+                return;
+            }
+
+            lowestOpTime = _queuedOpTimes.begin()->first;
+        }
+
+        auto uniqueOpCtx = cc().makeOperationContext();
+
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            if (_inShutDown) {
+                continue;
+            }
+            _opCtx = uniqueOpCtx.get();
+        }
+
+        WriteConcernResult ignoreResult;
+        auto status = waitForWriteConcern(
+            uniqueOpCtx.get(), lowestOpTime, kMajorityWriteConcern, &ignoreResult);
+
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _opCtx = nullptr;
+
+        // A single write concern wait covers every request at or below the optime waited on, so
+        // all of them are completed from this one round trip through the replication subsystem.
+        auto lastCovered = _queuedOpTimes.upper_bound(lowestOpTime);
+        for (auto it = _queuedOpTimes.begin(); it != lastCovered; ++it) {
+            for (auto&& promise : it->second) {
+                if (status.isOK()) {
+                    promise.emplaceValue();
+                } else {
+                    promise.setError(status);
+                }
+            }
+        }
+        _queuedOpTimes.erase(_queuedOpTimes.begin(), lastCovered);
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,94 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/future.h"
+
+namespace mongo {
+
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Provides a shared background thread for waiting until an optime has been majority committed.
+ * Callers queue the optime they need and get back a future; the thread performs one write concern
+ * wait on the lowest queued optime and completes every request that wait covers, so many
+ * concurrent requests - for example the transaction coordinators' state document writes - share a
+ * single majority wait instead of each occupying a thread of their own.
+ */
+class WaitForMajorityService {
+    MONGO_DISALLOW_COPYING(WaitForMajorityService);
+
+public:
+    WaitForMajorityService() = default;
+    ~WaitForMajorityService();
+
+    static WaitForMajorityService& get(ServiceContext* service);
+
+    /**
+     * Returns a future that becomes ready once 'opTime' has been majority committed, or with an
+     * error if the wait failed or the server is shutting down. The background thread is started
+     * lazily by the first call.
+     */
+    Future<void> waitUntilMajority(const repl::OpTime& opTime);
+
+    /**
+     * Interrupts any in-progress wait, fails all outstanding requests with
+     * InterruptedAtShutdown and joins the background thread. Called by the destructor.
+     */
+    void shutDown();
+
+private:
+    void _waitForMajorityThread();
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _hasWorkCV;
+
+    // Outstanding requests, ordered so the background thread always waits on the lowest optime.
+    std::map<repl::OpTime, std::vector<Promise<void>>> _queuedOpTimes;
+
+    // The operation context the background thread is currently waiting with, if any. Used to
+    // interrupt the wait at shutdown. Guarded by '_mutex'.
+    OperationContext* _opCtx{nullptr};
+
+    bool _inShutDown{false};  // Guarded by '_mutex'.
+
+    stdx::thread _thread;
+};
+
+}  // namespace mongo
@@ -37,6 +37,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/executor/connection_pool_stats.h"
 #include "mongo/executor/remote_command_request.h"
+#include "mongo/platform/random.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/destructor_guard.h"
@@ -151,6 +152,13 @@ public:
      */
     size_t createdConnections(const stdx::unique_lock<stdx::mutex>& lk);
 
+    /**
+     * Returns the number of connections that have completed setup in this pool and the total
+     * wall-clock time those setups took, for reporting setup latency in connPoolStats.
+     */
+    size_t setupCount(const stdx::unique_lock<stdx::mutex>& lk);
+    Milliseconds totalSetupTime(const stdx::unique_lock<stdx::mutex>& lk);
+
     /**
      * Returns the total number of connections currently open that belong to
      * this pool. This is the sum of refreshingConnections, availableConnections,
@@ -220,6 +228,11 @@ private:
     bool _inSpawnConnections;
 
     size_t _created;
+    size_t _setups;
+    Milliseconds _totalSetupTime;
+
+    // Used to stagger refresh deadlines when Options::refreshJitter is enabled.
+    PseudoRandom _refreshJitterSource;
 
     transport::Session::TagMask _tags = transport::Session::kPending;
 
@@ -254,6 +267,7 @@ size_t const ConnectionPool::kDefaultMaxConns = std::numeric_limits<size_t>::max
 size_t const ConnectionPool::kDefaultMinConns = 1;
 size_t const ConnectionPool::kDefaultMaxConnecting = std::numeric_limits<size_t>::max();
 constexpr Milliseconds ConnectionPool::kDefaultRefreshRequirement;
+constexpr Milliseconds ConnectionPool::kDefaultRefreshJitter;
 constexpr Milliseconds ConnectionPool::kDefaultRefreshTimeout;
 
 const Status ConnectionPool::kConnectionStateUnknown =
@@ -381,7 +395,9 @@ void ConnectionPool::appendConnectionStats(ConnectionPoolStats* stats) const {
         ConnectionStatsPer hostStats{pool->inUseConnections(lk),
                                      pool->availableConnections(lk),
                                      pool->createdConnections(lk),
-                                     pool->refreshingConnections(lk)};
+                                     pool->refreshingConnections(lk),
+                                     pool->setupCount(lk),
+                                     pool->totalSetupTime(lk)};
         stats->updateStatsForHost(_name, host, hostStats);
     }
 }
@@ -419,6 +435,9 @@ ConnectionPool::SpecificPool::SpecificPool(ConnectionPool* parent, const HostAnd
       _inFulfillRequests(false),
       _inSpawnConnections(false),
       _created(0),
+      _setups(0),
+      _totalSetupTime(0),
+      _refreshJitterSource(SecureRandom::create()->nextInt64()),
       _state(State::kRunning) {}
 
 ConnectionPool::SpecificPool::~SpecificPool() {
@@ -446,6 +465,15 @@ size_t ConnectionPool::SpecificPool::createdConnections(const stdx::unique_lock<
     return _created;
 }
 
+size_t ConnectionPool::SpecificPool::setupCount(const stdx::unique_lock<stdx::mutex>& lk) {
+    return _setups;
+}
+
+Milliseconds ConnectionPool::SpecificPool::totalSetupTime(
+    const stdx::unique_lock<stdx::mutex>& lk) {
+    return _totalSetupTime;
+}
+
 size_t ConnectionPool::SpecificPool::openConnections(const stdx::unique_lock<stdx::mutex>& lk) {
     return _checkedOutPool.size() + _readyPool.size() + _processingPool.size();
 }
@@ -566,8 +594,14 @@ void ConnectionPool::SpecificPool::addToReady(stdx::unique_lock<stdx::mutex>& lk
 
     // Our strategy for refreshing connections is to check them out and
     // immediately check them back in (which kicks off the refresh logic in
-    // returnConnection
-    connPtr->setTimeout(_parent->_options.refreshRequirement,
+    // returnConnection). The deadline is pushed out by a random amount of jitter, if configured,
+    // so that connections established together don't all wake up to ping the host at once.
+    auto refreshDelay = _parent->_options.refreshRequirement;
+    if (_parent->_options.refreshJitter > Milliseconds(0)) {
+        refreshDelay += Milliseconds(
+            _refreshJitterSource.nextInt64(_parent->_options.refreshJitter.count() + 1));
+    }
+    connPtr->setTimeout(refreshDelay,
                         guardCallback([this, connPtr](stdx::unique_lock<stdx::mutex> lk) {
                             auto conn = takeFromPool(_readyPool, connPtr);
 
@@ -743,10 +777,11 @@ void ConnectionPool::SpecificPool::spawnConnections(stdx::unique_lock<stdx::mute
         ++_created;
 
         // Run the setup callback
+        const auto setupStart = _parent->_factory->now();
         lk.unlock();
         handle->setup(
             _parent->_options.refreshTimeout,
-            guardCallback([this](
+            guardCallback([this, setupStart](
                 stdx::unique_lock<stdx::mutex> lk, ConnectionInterface* connPtr, Status status) {
                 auto conn = takeFromProcessingPool(connPtr);
 
@@ -755,6 +790,8 @@ void ConnectionPool::SpecificPool::spawnConnections(stdx::unique_lock<stdx::mute
                     return;
 
                 if (status.isOK()) {
+                    ++_setups;
+                    _totalSetupTime += _parent->_factory->now() - setupStart;
                     // If the host and port was dropped, let the connection lapse
                     if (conn->getGeneration() == _generation) {
                         addToReady(lk, std::move(conn));
@@ -80,6 +80,7 @@ public:
     static const size_t kDefaultMinConns;
     static const size_t kDefaultMaxConnecting;
     static constexpr Milliseconds kDefaultRefreshRequirement = Milliseconds(60000);  // 1min
+    static constexpr Milliseconds kDefaultRefreshJitter = Milliseconds(0);           // disabled
     static constexpr Milliseconds kDefaultRefreshTimeout = Milliseconds(20000);      // 20secs
 
     static const Status kConnectionStateUnknown;
@@ -119,6 +120,13 @@ public:
          */
         Milliseconds refreshRequirement = kDefaultRefreshRequirement;
 
+        /**
+         * Upper bound on the random delay added to each idle connection's refresh deadline so
+         * that connections established together do not all ping the host at the same instant.
+         * Zero disables jitter.
+         */
+        Milliseconds refreshJitter = kDefaultRefreshJitter;
+
         /**
          * Amount of time to keep a specific pool around without any checked
          * out connections or new requests
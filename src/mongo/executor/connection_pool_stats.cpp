@@ -41,8 +41,15 @@ namespace executor {
 ConnectionStatsPer::ConnectionStatsPer(size_t nInUse,
                                        size_t nAvailable,
                                        size_t nCreated,
-                                       size_t nRefreshing)
-    : inUse(nInUse), available(nAvailable), created(nCreated), refreshing(nRefreshing) {}
+                                       size_t nRefreshing,
+                                       size_t nSetups,
+                                       Milliseconds nTotalSetupTime)
+    : inUse(nInUse),
+      available(nAvailable),
+      created(nCreated),
+      refreshing(nRefreshing),
+      setups(nSetups),
+      totalSetupTime(nTotalSetupTime) {}
 
 ConnectionStatsPer::ConnectionStatsPer() = default;
 
@@ -51,6 +58,8 @@ ConnectionStatsPer& ConnectionStatsPer::operator+=(const ConnectionStatsPer& oth
     available += other.available;
     created += other.created;
     refreshing += other.refreshing;
+    setups += other.setups;
+    totalSetupTime += other.totalSetupTime;
 
     return *this;
 }
@@ -85,6 +94,8 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result) {
             poolInfo.appendNumber("poolAvailable", poolStats.available);
             poolInfo.appendNumber("poolCreated", poolStats.created);
             poolInfo.appendNumber("poolRefreshing", poolStats.refreshing);
+            poolInfo.appendNumber("poolSetups", poolStats.setups);
+            poolInfo.appendNumber("poolSetupTimeMillis", poolStats.totalSetupTime.count());
             for (auto&& host : statsByPoolHost[pool.first]) {
                 BSONObjBuilder hostInfo(poolInfo.subobjStart(host.first.toString()));
                 auto hostStats = host.second;
@@ -92,6 +103,8 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result) {
                 hostInfo.appendNumber("available", hostStats.available);
                 hostInfo.appendNumber("created", hostStats.created);
                 hostInfo.appendNumber("refreshing", hostStats.refreshing);
+                hostInfo.appendNumber("setups", hostStats.setups);
+                hostInfo.appendNumber("totalSetupTimeMillis", hostStats.totalSetupTime.count());
             }
         }
     }
@@ -104,6 +117,8 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result) {
             hostInfo.appendNumber("available", hostStats.available);
             hostInfo.appendNumber("created", hostStats.created);
             hostInfo.appendNumber("refreshing", hostStats.refreshing);
+            hostInfo.appendNumber("setups", hostStats.setups);
+            hostInfo.appendNumber("totalSetupTimeMillis", hostStats.totalSetupTime.count());
         }
     }
 }
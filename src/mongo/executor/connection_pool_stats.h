@@ -31,6 +31,7 @@
 #pragma once
 
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
 
 namespace mongo {
@@ -41,7 +42,12 @@ namespace executor {
  * a parent ConnectionPoolStats object and should not need to be created directly.
  */
 struct ConnectionStatsPer {
-    ConnectionStatsPer(size_t nInUse, size_t nAvailable, size_t nCreated, size_t nRefreshing);
+    ConnectionStatsPer(size_t nInUse,
+                       size_t nAvailable,
+                       size_t nCreated,
+                       size_t nRefreshing,
+                       size_t nSetups = 0u,
+                       Milliseconds nTotalSetupTime = Milliseconds(0));
 
     ConnectionStatsPer();
 
@@ -51,6 +57,11 @@ struct ConnectionStatsPer {
     size_t available = 0u;
     size_t created = 0u;
     size_t refreshing = 0u;
+
+    // Number of connection setups that have completed and their total wall-clock time, for
+    // deriving average setup latency.
+    size_t setups = 0u;
+    Milliseconds totalSetupTime{0};
 };
 
 /**
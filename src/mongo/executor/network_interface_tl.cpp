@@ -222,9 +222,12 @@ Status NetworkInterfaceTL::startCommand(const TaskExecutor::CallbackHandle& cbHa
     // return on the reactor thread.
     //
     // TODO: get rid of this cruft once we have a connection pool that's executor aware.
-    auto connFuture = _reactor->execute([this, state, request, baton] {
-        return makeReadyFutureWith(
-                   [this, request] { return _pool->get(request.target, request.timeout); })
+    // Capture the request through "state" rather than by value; it has already been copied into
+    // "state" above and further copies just churn refcounts and duplicate the metadata strings.
+    auto connFuture = _reactor->execute([this, state, baton] {
+        return makeReadyFutureWith([this, state] {
+                   return _pool->get(state->request.target, state->request.timeout);
+               })
             .tapError([state](Status error) {
                 LOG(2) << "Failed to get connection from pool for request " << state->request.id
                        << ": " << error;
@@ -97,6 +97,11 @@ public:
     WorkQueue::iterator iter;
     Date_t readyDate;
     bool isNetworkOperation = false;
+    // True while this callback sits in the executor's sleeper queue, so cancel() can move it out
+    // without searching the queue.
+    bool isSleeper = false;
+    // The callback's entry in the executor's sleeper wheel; only meaningful while isSleeper.
+    TimerWheel::TimerId wheelTimerId = 0;
     AtomicWord<bool> isFinished{false};
     boost::optional<stdx::condition_variable> finishedCondition;
     transport::BatonHandle baton;
@@ -132,7 +137,7 @@ public:
 
 ThreadPoolTaskExecutor::ThreadPoolTaskExecutor(std::unique_ptr<ThreadPoolInterface> pool,
                                                std::shared_ptr<NetworkInterface> net)
-    : _net(std::move(net)), _pool(std::move(pool)) {}
+    : _net(std::move(net)), _pool(std::move(pool)), _sleeperWheel(_net->now(), Milliseconds(1)) {}
 
 ThreadPoolTaskExecutor::~ThreadPoolTaskExecutor() {
     shutdown();
@@ -161,6 +166,9 @@ void ThreadPoolTaskExecutor::shutdown() {
     _setState_inlock(joinRequired);
     WorkQueue pending;
     pending.splice(pending.end(), _networkInProgressQueue);
+    for (auto&& cbState : _sleepersQueue) {
+        _sleeperWheel.cancel(cbState->wheelTimerId);
+    }
     pending.splice(pending.end(), _sleepersQueue);
     for (auto&& eventState : _unsignaledEvents) {
         pending.splice(pending.end(), eventState->waiters);
@@ -346,26 +354,59 @@ StatusWith<TaskExecutor::CallbackHandle> ThreadPoolTaskExecutor::scheduleWorkAt(
     if (!cbHandle.isOK()) {
         return cbHandle;
     }
+    const auto& cbState = _sleepersQueue.back();
+    cbState->isSleeper = true;
+    cbState->wheelTimerId = _sleeperWheel.schedule(when, [this, cbHandle] {
+        auto cbState = checked_cast<CallbackState*>(getCallbackFromHandle(cbHandle.getValue()));
+        if (cbState->canceled.load()) {
+            return;
+        }
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        if (cbState->canceled.load() || !cbState->isSleeper) {
+            // Canceled, or already moved out of the sleeper queue by shutdown.
+            return;
+        }
+        scheduleIntoPool_inlock(&_sleepersQueue, cbState->iter, std::move(lk));
+    });
+
+    // One alarm on the network interface drives the whole wheel; only arm it when this deadline
+    // is earlier than the one it is already armed for.
+    const bool mustSetAlarm = when < _nextWheelAlarm;
+    if (mustSetAlarm) {
+        _nextWheelAlarm = when;
+    }
     lk.unlock();
-    _net->setAlarm(when,
-                   [this, cbHandle] {
-                       auto cbState =
-                           checked_cast<CallbackState*>(getCallbackFromHandle(cbHandle.getValue()));
-                       if (cbState->canceled.load()) {
-                           return;
-                       }
-                       stdx::unique_lock<stdx::mutex> lk(_mutex);
-                       if (cbState->canceled.load()) {
-                           return;
-                       }
-                       scheduleIntoPool_inlock(&_sleepersQueue, cbState->iter, std::move(lk));
-                   },
-                   nullptr)
-        .transitional_ignore();
+    if (mustSetAlarm) {
+        _net->setAlarm(when, [this] { _advanceSleeperWheel(); }, nullptr).transitional_ignore();
+    }
 
     return cbHandle;
 }
 
+void ThreadPoolTaskExecutor::_advanceSleeperWheel() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        // This alarm is spent; deadlines scheduled from here on must arm their own.
+        _nextWheelAlarm = Date_t::max();
+    }
+    _sleeperWheel.advance(_net->now());
+
+    // Re-arm for whatever is still pending. nextDeadline() is conservative for deadlines still
+    // parked in the wheel's upper levels, so this may wake a bounded number of extra times as
+    // they cascade toward level zero.
+    const auto next = _sleeperWheel.nextDeadline();
+    if (!next) {
+        return;
+    }
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    if (*next >= _nextWheelAlarm) {
+        return;
+    }
+    _nextWheelAlarm = *next;
+    lk.unlock();
+    _net->setAlarm(*next, [this] { _advanceSleeperWheel(); }, nullptr).transitional_ignore();
+}
+
 namespace {
 
 using ResponseStatus = TaskExecutor::ResponseStatus;
@@ -459,18 +500,12 @@ void ThreadPoolTaskExecutor::cancel(const CallbackHandle& cbHandle) {
         _net->cancelCommand(cbHandle, cbState->baton);
         return;
     }
-    if (cbState->readyDate != Date_t{}) {
-        // This callback might still be in the sleeper queue; if it is, schedule it now
-        // rather than when the alarm fires.
-        auto iter = std::find_if(_sleepersQueue.begin(),
-                                 _sleepersQueue.end(),
-                                 [cbState](const std::shared_ptr<CallbackState>& other) {
-                                     return cbState == other.get();
-                                 });
-        if (iter != _sleepersQueue.end()) {
-            invariant(iter == cbState->iter);
-            scheduleIntoPool_inlock(&_sleepersQueue, cbState->iter, std::move(lk));
-        }
+    if (cbState->isSleeper) {
+        // Drop the wheel entry so it does not retain the callback until its deadline passes.
+        _sleeperWheel.cancel(cbState->wheelTimerId);
+        // This callback is still in the sleeper queue; schedule it now rather than when
+        // the wheel fires.
+        scheduleIntoPool_inlock(&_sleepersQueue, cbState->iter, std::move(lk));
     }
 }
 
@@ -549,6 +584,9 @@ void ThreadPoolTaskExecutor::scheduleIntoPool_inlock(WorkQueue* fromQueue,
                                                      stdx::unique_lock<stdx::mutex> lk) {
     dassert(fromQueue != &_poolInProgressQueue);
     std::vector<std::shared_ptr<CallbackState>> todo(begin, end);
+    for (const auto& cbState : todo) {
+        cbState->isSleeper = false;
+    }
     _poolInProgressQueue.splice(_poolInProgressQueue.end(), *fromQueue, begin, end);
 
     lk.unlock();
@@ -39,6 +39,7 @@
 #include "mongo/stdx/mutex.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/transport/baton.h"
+#include "mongo/util/timer_wheel.h"
 
 namespace mongo {
 
@@ -181,12 +182,24 @@ private:
     void _setState_inlock(State newState);
     stdx::unique_lock<stdx::mutex> _join(stdx::unique_lock<stdx::mutex> lk);
 
+    /**
+     * Advances _sleeperWheel to the current time, firing due sleepers, and re-arms the network
+     * interface alarm that drives the wheel. Must be called without holding _mutex.
+     */
+    void _advanceSleeperWheel();
+
     // The network interface used for remote command execution and waiting.
     std::shared_ptr<NetworkInterface> _net;
 
     // The thread pool that executes scheduled work items.
     std::unique_ptr<ThreadPoolInterface> _pool;
 
+    // Deadlines of entries in _sleepersQueue. Thread-safe with its own lock; schedule() and
+    // cancel() are O(1), versus the O(log n) timer structure one alarm per sleeper would build
+    // up inside the network interface. The wheel owns no thread: it is advanced by a single
+    // alarm on _net, re-armed at the wheel's next deadline (see _advanceSleeperWheel()).
+    TimerWheel _sleeperWheel;
+
     // Mutex guarding all remaining fields.
     mutable stdx::mutex _mutex;
 
@@ -199,6 +212,10 @@ private:
     // Queue containing all items waiting for a particular point in time to execute.
     WorkQueue _sleepersQueue;
 
+    // Deadline of the alarm currently armed on _net to advance _sleeperWheel, or Date_t::max()
+    // when none is armed; a new sleeper only sets an alarm when its deadline is earlier.
+    Date_t _nextWheelAlarm = Date_t::max();
+
     // List of all events that have yet to be signaled.
     EventList _unsignaledEvents;
 
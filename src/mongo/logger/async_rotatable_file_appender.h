@@ -0,0 +1,172 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/status.h"
+#include "mongo/logger/appender.h"
+#include "mongo/logger/encoder.h"
+#include "mongo/logger/rotatable_file_writer.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+namespace logger {
+
+/**
+ * Appender for writing to instances of RotatableFileWriter without blocking the logging thread
+ * on file I/O.
+ *
+ * append() encodes the event on the calling thread (events hold non-owning StringData, so they
+ * cannot be queued directly) and hands the encoded line to a dedicated writer thread, which
+ * drains the queue in batches under a single RotatableFileWriter::Use and flushes once per
+ * batch. The calling thread therefore never waits on the log disk or on the writer mutex.
+ *
+ * If the writer thread falls behind and the queue reaches its cap, behavior is governed by the
+ * overflow policy: kDropWithCounter discards the line and the writer thread later records how
+ * many lines were lost; kBlock makes append() wait for space, restoring synchronous-style
+ * back-pressure.
+ *
+ * Because the write happens after append() returns, I/O errors cannot be reported to the
+ * caller; append() returns the encoding status only.
+ */
+template <typename Event>
+class AsyncRotatableFileAppender : public Appender<Event> {
+    MONGO_DISALLOW_COPYING(AsyncRotatableFileAppender);
+
+public:
+    typedef Encoder<Event> EventEncoder;
+
+    enum class OverflowPolicy { kDropWithCounter, kBlock };
+
+    /**
+     * Constructs an appender that owns "encoder", but not "writer."  Caller must keep "writer"
+     * in scope at least as long as the constructed appender.  Starts the writer thread.
+     */
+    AsyncRotatableFileAppender(std::unique_ptr<EventEncoder> encoder,
+                               RotatableFileWriter* writer,
+                               OverflowPolicy overflowPolicy = OverflowPolicy::kDropWithCounter,
+                               size_t maxQueuedLines = kDefaultMaxQueuedLines)
+        : _encoder(std::move(encoder)),
+          _writer(writer),
+          _overflowPolicy(overflowPolicy),
+          _maxQueuedLines(maxQueuedLines) {
+        _writerThread = stdx::thread([this] { _writerThreadMain(); });
+    }
+
+    /**
+     * Drains any queued lines to the writer, then joins the writer thread.
+     */
+    ~AsyncRotatableFileAppender() {
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            _shutdown = true;
+        }
+        _flushNeeded.notify_one();
+        _writerThread.join();
+    }
+
+    virtual Status append(const Event& event) {
+        std::ostringstream os;
+        _encoder->encode(event, os);
+
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        while (_queue.size() >= _maxQueuedLines && !_shutdown) {
+            if (_overflowPolicy == OverflowPolicy::kDropWithCounter) {
+                ++_droppedLines;
+                return Status::OK();
+            }
+            _spaceAvailable.wait(lk);
+        }
+        _queue.push_back(os.str());
+        lk.unlock();
+        _flushNeeded.notify_one();
+        return Status::OK();
+    }
+
+private:
+    // Roughly a few megabytes of typical log lines; deep enough to absorb a burst while the
+    // log disk stalls, shallow enough to bound memory if it never recovers.
+    static const size_t kDefaultMaxQueuedLines = 16384;
+
+    void _writerThreadMain() {
+        std::vector<std::string> batch;
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        while (true) {
+            _flushNeeded.wait(lk, [&] { return _shutdown || !_queue.empty(); });
+            if (_queue.empty() && _shutdown)
+                return;
+            batch.swap(_queue);
+            long long dropped = _droppedLines;
+            _droppedLines = 0;
+            lk.unlock();
+            _spaceAvailable.notify_all();
+            _writeBatch(batch, dropped);
+            batch.clear();
+            lk.lock();
+        }
+    }
+
+    void _writeBatch(const std::vector<std::string>& batch, long long dropped) {
+        RotatableFileWriter::Use useWriter(_writer);
+        if (!useWriter.status().isOK())
+            return;
+        for (const auto& line : batch) {
+            useWriter.stream() << line;
+        }
+        if (dropped > 0) {
+            useWriter.stream() << "==> async log appender dropped " << dropped
+                               << " line(s) because the queue was full <==" << std::endl;
+        }
+        useWriter.stream().flush();
+    }
+
+    std::unique_ptr<EventEncoder> _encoder;
+    RotatableFileWriter* _writer;
+    const OverflowPolicy _overflowPolicy;
+    const size_t _maxQueuedLines;
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _flushNeeded;
+    stdx::condition_variable _spaceAvailable;
+    std::vector<std::string> _queue;
+    long long _droppedLines = 0;
+    bool _shutdown = false;
+    stdx::thread _writerThread;
+};
+
+}  // namespace logger
+}  // namespace mongo
@@ -82,11 +82,14 @@ OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage) {
     }
 }
 
-std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol) {
+std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol,
+                                                        SharedBuffer initialBuffer) {
     switch (protocol) {
         case Protocol::kOpMsg:
-            return stdx::make_unique<OpMsgReplyBuilder>();
+            return stdx::make_unique<OpMsgReplyBuilder>(std::move(initialBuffer));
         case Protocol::kOpQuery:
+            // The legacy builder assembles the reply from several pieces and cannot build into a
+            // caller-provided buffer.
             return stdx::make_unique<LegacyReplyBuilder>();
     }
     MONGO_UNREACHABLE;
@@ -68,9 +68,11 @@ inline Message messageFromOpMsgRequest(ProtocolSet clientProtos,
 OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage);
 
 /**
- * Returns the appropriate concrete ReplyBuilder.
+ * Returns the appropriate concrete ReplyBuilder. If 'initialBuffer' is non-empty and the
+ * protocol supports it, the reply is built into that buffer rather than a fresh allocation.
  */
-std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol);
+std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol,
+                                                        SharedBuffer initialBuffer = SharedBuffer());
 
 }  // namespace rpc
 }  // namespace mongo
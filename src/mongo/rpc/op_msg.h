@@ -168,6 +168,18 @@ public:
         skipHeaderAndFlags();
     }
 
+    /**
+     * Constructs a builder that writes into 'initialBuffer' rather than allocating a fresh one,
+     * growing it only if the message outgrows its capacity. The buffer must not be shared. An
+     * empty SharedBuffer is equivalent to the default constructor.
+     */
+    explicit OpMsgBuilder(SharedBuffer initialBuffer) {
+        if (initialBuffer) {
+            _buf.useSharedBuffer(std::move(initialBuffer));
+        }
+        skipHeaderAndFlags();
+    }
+
     /**
      * See the documentation for DocSequenceBuilder below.
      */
@@ -313,6 +325,14 @@ public:
         _buf->appendBuf(obj.objdata(), obj.objsize());
     }
 
+    /**
+     * Reserves and claims the bytes requested in the underlying BufBuilder.
+     */
+    void reserveBytes(const std::size_t bytes) {
+        _buf->reserveBytes(bytes);
+        _buf->claimReservedBytes(bytes);
+    }
+
     /**
      * Returns a BSONObjBuilder that appends a single document to this sequence in place.
      * It is illegal to call any methods on this DocSequenceBuilder until the returned builder
@@ -54,6 +54,14 @@ private:
 
 class OpMsgReplyBuilder final : public rpc::ReplyBuilderInterface {
 public:
+    OpMsgReplyBuilder() = default;
+
+    /**
+     * Builds the reply into 'initialBuffer' instead of allocating, falling back to a fresh
+     * allocation if the reply outgrows it. See OpMsgBuilder.
+     */
+    explicit OpMsgReplyBuilder(SharedBuffer initialBuffer) : _builder(std::move(initialBuffer)) {}
+
     ReplyBuilderInterface& setRawCommandReply(const BSONObj& reply) override {
         _builder.beginBody().appendElements(reply);
         return *this;
@@ -826,6 +826,33 @@ TEST(OpMsgSerializer, SetFlagWorks) {
     }
 }
 
+TEST(OpMsgSerializer, InitialBufferIsReusedWhenBigEnough) {
+    auto buffer = SharedBuffer::allocate(1024);
+    const char* const bufferStart = buffer.get();
+
+    OpMsgBuilder builder(std::move(buffer));
+    builder.beginBody().append("ping", 1);
+
+    auto message = builder.finish();
+    ASSERT_EQ(static_cast<const void*>(message.buf()), static_cast<const void*>(bufferStart));
+
+    testSerializer(message,
+                   OpMsgBytes{
+                       kNoFlags,  //
+                       kBodySection,
+                       fromjson("{ping: 1}"),
+                   });
+}
+
+TEST(OpMsgSerializer, InitialBufferGrowsWhenTooSmall) {
+    OpMsgBuilder builder(SharedBuffer::allocate(64));
+    const std::string filler(1024, 'x');
+    builder.beginBody().append("filler", filler);
+
+    auto msg = OpMsg::parse(builder.finish());
+    ASSERT_EQ(msg.body["filler"].String(), filler);
+}
+
 TEST(OpMsgRequest, GetDatabaseWorks) {
     OpMsgRequest msg;
     msg.body = fromjson("{$db: 'foo'}");
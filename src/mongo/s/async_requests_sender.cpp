@@ -51,11 +51,25 @@ namespace mongo {
 
 MONGO_EXPORT_SERVER_PARAMETER(AsyncRequestsSenderUseBaton, bool, true);
 
+// How long an outstanding request must go unanswered before a hedged duplicate is dispatched to a
+// second eligible host, for operations that allow hedging. A negative value disables hedging.
+MONGO_EXPORT_SERVER_PARAMETER(AsyncRequestsSenderHedgingDelayMS, int, 100);
+
 namespace {
 
 // Maximum number of retries for network and replication notMaster errors (per host).
 const int kMaxNumFailedHostRetryAttempts = 3;
 
+// Maximum number of times the targeter is probed for a hedging host distinct from the one the
+// original request was sent to.
+const int kMaxHedgeHostResolutionAttempts = 3;
+
+bool readPreferenceAllowsHedging(const ReadPreferenceSetting& readPreference) {
+    return readPreference.pref == ReadPreference::Nearest ||
+        readPreference.pref == ReadPreference::SecondaryOnly ||
+        readPreference.pref == ReadPreference::SecondaryPreferred;
+}
+
 }  // namespace
 
 AsyncRequestsSender::AsyncRequestsSender(OperationContext* opCtx,
@@ -63,13 +77,18 @@ AsyncRequestsSender::AsyncRequestsSender(OperationContext* opCtx,
                                          StringData dbName,
                                          const std::vector<AsyncRequestsSender::Request>& requests,
                                          const ReadPreferenceSetting& readPreference,
-                                         Shard::RetryPolicy retryPolicy)
+                                         Shard::RetryPolicy retryPolicy,
+                                         HedgingMode hedgingMode)
     : _opCtx(opCtx),
       _executor(executor),
       _baton(opCtx),
       _db(dbName.toString()),
       _readPreference(readPreference),
-      _retryPolicy(retryPolicy) {
+      _retryPolicy(retryPolicy),
+      _hedgingAllowed(hedgingMode == HedgingMode::kAllowed &&
+                      readPreferenceAllowsHedging(readPreference) &&
+                      AsyncRequestsSenderHedgingDelayMS.load() >= 0),
+      _hedgingDelay(AsyncRequestsSenderHedgingDelayMS.load()) {
     for (const auto& request : requests) {
         auto cmdObj = request.cmdObj;
         _remotes.emplace_back(request.shardId, cmdObj);
@@ -133,6 +152,9 @@ void AsyncRequestsSender::_cancelPendingRequests() {
         if (remote.cbHandle.isValid()) {
             _executor->cancel(remote.cbHandle);
         }
+        if (remote.hedgeCbHandle.isValid()) {
+            _executor->cancel(remote.hedgeCbHandle);
+        }
     }
 }
 
@@ -146,6 +168,16 @@ boost::optional<AsyncRequestsSender::Response> AsyncRequestsSender::_ready() {
     for (auto& remote : _remotes) {
         if (remote.swResponse && !remote.done) {
             remote.done = true;
+
+            // If either half of a hedged pair is still outstanding, its response no longer has a
+            // consumer; cancel it.
+            if (remote.cbHandle.isValid()) {
+                _executor->cancel(remote.cbHandle);
+            }
+            if (remote.hedgeCbHandle.isValid()) {
+                _executor->cancel(remote.hedgeCbHandle);
+            }
+
             if (remote.swResponse->isOK()) {
                 invariant(remote.shardHostAndPort);
                 return Response(std::move(remote.shardId),
@@ -207,7 +239,9 @@ void AsyncRequestsSender::_scheduleRequests() {
         }
 
         // If the remote does not have a response or pending request, schedule remote work for it.
-        if (!remote.swResponse && !remote.cbHandle.isValid()) {
+        // A still-outstanding hedged request counts as pending: its response may yet arrive, so a
+        // retry of the original is held off until then.
+        if (!remote.swResponse && !remote.cbHandle.isValid() && !remote.hedgeCbHandle.isValid()) {
             auto scheduleStatus = _scheduleRequest(i);
             if (!scheduleStatus.isOK()) {
                 remote.swResponse = std::move(scheduleStatus);
@@ -231,38 +265,175 @@ Status AsyncRequestsSender::_scheduleRequest(size_t remoteIndex) {
         return resolveStatus;
     }
 
+    auto callbackStatus =
+        _scheduleRemoteCommand(*remote.shardHostAndPort, remoteIndex, false /* isHedge */);
+    if (!callbackStatus.isOK()) {
+        return callbackStatus.getStatus();
+    }
+
+    remote.cbHandle = callbackStatus.getValue();
+
+    // Only the first dispatch of the command is eligible for a hedged duplicate; a retry is
+    // already a reaction to trouble and should not multiply the load further.
+    if (_hedgingAllowed && !remote.hedgeSent && remote.retryCount == 0) {
+        remote.hedgeDeadline =
+            _opCtx->getServiceContext()->getPreciseClockSource()->now() + _hedgingDelay;
+    } else {
+        remote.hedgeDeadline = boost::none;
+    }
+
+    return Status::OK();
+}
+
+StatusWith<executor::TaskExecutor::CallbackHandle> AsyncRequestsSender::_scheduleRemoteCommand(
+    const HostAndPort& host, size_t remoteIndex, bool isHedge) {
     executor::RemoteCommandRequest request(
-        *remote.shardHostAndPort, _db, remote.cmdObj, _metadataObj, _opCtx);
+        host, _db, _remotes[remoteIndex].cmdObj, _metadataObj, _opCtx);
 
-    auto callbackStatus = _executor->scheduleRemoteCommand(
+    return _executor->scheduleRemoteCommand(
         request,
-        [ remoteIndex, producer = _responseQueue.producer ](
+        [ remoteIndex, isHedge, producer = _responseQueue.producer ](
             const executor::TaskExecutor::RemoteCommandCallbackArgs& cbData) {
-            producer.push(Job{cbData, remoteIndex});
+            try {
+                producer.push(Job{cbData, remoteIndex, isHedge});
+            } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+                // The ARS was destroyed after taking the other response of a hedged pair; the
+                // losing response has no consumer.
+            }
         },
         _baton);
+}
+
+boost::optional<Date_t> AsyncRequestsSender::_nextHedgeDeadline() const {
+    if (!_hedgingAllowed || _stopRetrying || !_interruptStatus.isOK()) {
+        return boost::none;
+    }
+
+    boost::optional<Date_t> nextDeadline;
+    for (const auto& remote : _remotes) {
+        if (remote.hedgeSent || remote.done || remote.swResponse || !remote.cbHandle.isValid() ||
+            !remote.hedgeDeadline) {
+            continue;
+        }
+        if (!nextDeadline || *remote.hedgeDeadline < *nextDeadline) {
+            nextDeadline = remote.hedgeDeadline;
+        }
+    }
+    return nextDeadline;
+}
+
+void AsyncRequestsSender::_scheduleHedgeRequests() {
+    const auto now = _opCtx->getServiceContext()->getPreciseClockSource()->now();
+    for (size_t i = 0; i < _remotes.size(); ++i) {
+        auto& remote = _remotes[i];
+        if (remote.hedgeSent || remote.done || remote.swResponse || !remote.cbHandle.isValid() ||
+            !remote.hedgeDeadline || now < *remote.hedgeDeadline) {
+            continue;
+        }
+        _scheduleHedgeRequest(i);
+    }
+}
+
+void AsyncRequestsSender::_scheduleHedgeRequest(size_t remoteIndex) {
+    auto& remote = _remotes[remoteIndex];
+
+    // Hedging is best effort, and each remote gets at most one attempt at it.
+    remote.hedgeSent = true;
+
+    auto shard = remote.getShard();
+    if (!shard) {
+        return;
+    }
+
+    // The targeter hands out one host at a time, so probe it a few times for a host other than the
+    // one already running the request; with secondary and nearest read preferences the selection
+    // rotates among the eligible hosts. If no distinct host turns up, skip the hedge.
+    boost::optional<HostAndPort> hedgeHost;
+    for (int i = 0; i < kMaxHedgeHostResolutionAttempts; ++i) {
+        auto findHostStatus = shard->getTargeter()->findHostNoWait(_readPreference);
+        if (!findHostStatus.isOK()) {
+            return;
+        }
+        if (findHostStatus.getValue() != *remote.shardHostAndPort) {
+            hedgeHost = std::move(findHostStatus.getValue());
+            break;
+        }
+    }
+    if (!hedgeHost) {
+        return;
+    }
+
+    auto callbackStatus = _scheduleRemoteCommand(*hedgeHost, remoteIndex, true /* isHedge */);
     if (!callbackStatus.isOK()) {
-        return callbackStatus.getStatus();
+        return;
     }
 
-    remote.cbHandle = callbackStatus.getValue();
-    return Status::OK();
+    remote.hedgeHostAndPort = std::move(hedgeHost);
+    remote.hedgeCbHandle = std::move(callbackStatus.getValue());
+
+    LOG(1) << "Dispatched hedged request for remote " << remote.shardId << " to host "
+           << *remote.hedgeHostAndPort << "; the request to host " << *remote.shardHostAndPort
+           << " remains outstanding";
 }
 
 // Passing opCtx means you'd like to opt into opCtx interruption.  During cleanup we actually don't.
 void AsyncRequestsSender::_makeProgress() {
-    auto job = _responseQueue.consumer.pop(_opCtx);
+    boost::optional<Job> job;
+
+    if (auto hedgeDeadline = _nextHedgeDeadline()) {
+        // An outstanding request becomes due for a hedged duplicate once the hedging delay
+        // elapses without a response, so bound the wait by the earliest such deadline.
+        try {
+            _opCtx->runWithDeadline(*hedgeDeadline, ErrorCodes::ExceededTimeLimit, [&] {
+                job = _responseQueue.consumer.pop(_opCtx);
+            });
+        } catch (const ExceptionFor<ErrorCodes::ExceededTimeLimit>&) {
+            if (_opCtx->getServiceContext()->getPreciseClockSource()->now() < *hedgeDeadline) {
+                // The operation's own deadline expired, not the hedging deadline.
+                throw;
+            }
+            _scheduleHedgeRequests();
+            return;
+        }
+    } else {
+        job = _responseQueue.consumer.pop(_opCtx);
+    }
 
     if (!job) {
         return;
     }
 
     auto& remote = _remotes[job->remoteIndex];
-    invariant(!remote.swResponse);
 
-    // Clear the callback handle. This indicates that we are no longer waiting on a response from
-    // 'remote'.
-    remote.cbHandle = executor::TaskExecutor::CallbackHandle();
+    // Clear the callback handle for the request this response belongs to. This indicates that we
+    // are no longer waiting on it.
+    if (job->isHedge) {
+        remote.hedgeCbHandle = executor::TaskExecutor::CallbackHandle();
+    } else {
+        remote.cbHandle = executor::TaskExecutor::CallbackHandle();
+    }
+
+    if (remote.swResponse || remote.done) {
+        // The other request of a hedged pair already produced this remote's response; this is the
+        // (typically canceled) loser, and its response is dropped.
+        return;
+    }
+
+    if (job->isHedge) {
+        // A failed hedged request must not preempt the original request, which may still succeed;
+        // drop errors while the original is outstanding. An error that arrives once the original
+        // is no longer in flight is kept, so the regular retry logic can deal with it.
+        Status status = job->cbData.response.status;
+        if (status.isOK()) {
+            status = getStatusFromCommandResult(job->cbData.response.data);
+        }
+        if (!status.isOK() && remote.cbHandle.isValid()) {
+            return;
+        }
+
+        // The hedged request won the race; report its host as the one that ran the command.
+        remote.shardHostAndPort = remote.hedgeHostAndPort;
+    }
 
     // Store the response or error.
     if (job->cbData.response.status.isOK()) {
@@ -98,6 +98,20 @@ public:
         const BSONObj cmdObj;
     };
 
+    /**
+     * Controls whether the ARS may hedge an outstanding request by dispatching a duplicate of it
+     * to a second eligible host and taking whichever response arrives first.
+     *
+     * Only callers whose commands are idempotent and leave no state behind on the losing host may
+     * allow hedging. In particular, commands that establish cursors must not be hedged, since the
+     * losing host would be left with an orphaned cursor. Even when allowed, requests are hedged
+     * only if the read preference tolerates secondaries (secondary or nearest modes).
+     */
+    enum class HedgingMode {
+        kDisallowed,
+        kAllowed,
+    };
+
     /**
      * Defines a response for a request to a remote shard.
      */
@@ -128,7 +142,8 @@ public:
                         StringData dbName,
                         const std::vector<AsyncRequestsSender::Request>& requests,
                         const ReadPreferenceSetting& readPreference,
-                        Shard::RetryPolicy retryPolicy);
+                        Shard::RetryPolicy retryPolicy,
+                        HedgingMode hedgingMode = HedgingMode::kDisallowed);
 
     /**
      * Ensures pending network I/O for any outstanding requests has been canceled and waits for
@@ -202,6 +217,21 @@ private:
         // The callback handle to an outstanding request for this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
+        // The host on which a hedged duplicate of the request was run. Is unset until a hedged
+        // request has been sent.
+        boost::optional<HostAndPort> hedgeHostAndPort;
+
+        // The callback handle to an outstanding hedged request for this remote.
+        executor::TaskExecutor::CallbackHandle hedgeCbHandle;
+
+        // The time at which the outstanding request becomes due for a hedged duplicate. Is unset
+        // if the request is not eligible for hedging.
+        boost::optional<Date_t> hedgeDeadline;
+
+        // Whether dispatch of a hedged request has been attempted for this remote. At most one
+        // hedged request is ever sent per remote.
+        bool hedgeSent = false;
+
         // Whether this remote's result has been returned.
         bool done = false;
     };
@@ -213,6 +243,10 @@ private:
     struct Job {
         executor::TaskExecutor::RemoteCommandCallbackArgs cbData;
         size_t remoteIndex;
+
+        // Whether this is the response to a hedged request, rather than to the original request,
+        // for the remote at 'remoteIndex'.
+        bool isHedge = false;
     };
 
     /**
@@ -281,10 +315,37 @@ private:
      */
     Status _scheduleRequest(size_t remoteIndex);
 
+    /**
+     * Schedules the command for 'remoteIndex' to be run on 'host', routing the response through
+     * the response queue. 'isHedge' marks the resulting Job as belonging to a hedged request.
+     */
+    StatusWith<executor::TaskExecutor::CallbackHandle> _scheduleRemoteCommand(
+        const HostAndPort& host, size_t remoteIndex, bool isHedge);
+
+    /**
+     * Returns the earliest time at which an outstanding request becomes due for a hedged
+     * duplicate, or boost::none if no remote is eligible for hedging.
+     */
+    boost::optional<Date_t> _nextHedgeDeadline() const;
+
+    /**
+     * Dispatches hedged requests for all remotes whose hedging deadline has passed.
+     */
+    void _scheduleHedgeRequests();
+
+    /**
+     * Best-effort dispatch of a duplicate of 'remoteIndex''s command to a second eligible host.
+     * The original request remains outstanding; whichever response arrives first wins, and the
+     * loser is canceled. Failures (no distinct host available, scheduling error) leave the remote
+     * waiting on the original request alone.
+     */
+    void _scheduleHedgeRequest(size_t remoteIndex);
+
     /**
      * Waits for forward progress in gathering responses from a remote.
      *
-     * Stores the response or error in the remote.
+     * Stores the response or error in the remote. May instead dispatch hedged requests if one
+     * becomes due before any response arrives.
      */
     void _makeProgress();
 
@@ -306,6 +367,14 @@ private:
     // The policy to use when deciding whether to retry on an error.
     Shard::RetryPolicy _retryPolicy;
 
+    // Whether requests may be hedged. True only if the caller allows hedging, the read preference
+    // tolerates secondaries and the hedging delay server parameter is non-negative.
+    const bool _hedgingAllowed;
+
+    // How long a request must go unanswered before a hedged duplicate is dispatched. Sampled from
+    // the server parameter at construction; meaningless if '_hedgingAllowed' is false.
+    const Milliseconds _hedgingDelay;
+
     // Is set to a non-OK status if the client operation is interrupted.
     // When waiting for a remote to be ready, we only check for interrupt if the _interruptStatus
     // has not already been set to an error (so we can wait for callbacks for (canceled) outstanding
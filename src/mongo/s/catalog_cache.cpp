@@ -116,7 +116,8 @@ std::shared_ptr<RoutingTableHistory> refreshCollectionRoutingInfo(
 
 }  // namespace
 
-CatalogCache::CatalogCache(CatalogCacheLoader& cacheLoader) : _cacheLoader(cacheLoader) {}
+CatalogCache::CatalogCache(CatalogCacheLoader& cacheLoader)
+    : _cacheLoader(cacheLoader), _routingInfoSnapshot(std::make_shared<RoutingInfoSnapshot>()) {}
 
 CatalogCache::~CatalogCache() = default;
 
@@ -127,6 +128,17 @@ StatusWith<CachedDatabaseInfo> CatalogCache::getDatabase(OperationContext* opCtx
               "hold the lock during a network call, and can lead to a deadlock as described in "
               "SERVER-37398.");
     try {
+        // Fast path - consult the currently published snapshot without taking the mutex. Misses
+        // and stale entries fall through to the locked path below, which knows how to join an
+        // ongoing refresh.
+        const auto snapshot = std::atomic_load(&_routingInfoSnapshot);
+        const auto itSnapshotDb = snapshot->databases.find(dbName);
+        if (itSnapshotDb != snapshot->databases.end()) {
+            auto primaryShard = uassertStatusOK(Grid::get(opCtx)->shardRegistry()->getShard(
+                opCtx, itSnapshotDb->second.dbt.getPrimary()));
+            return {CachedDatabaseInfo(itSnapshotDb->second.dbt, std::move(primaryShard))};
+        }
+
         while (true) {
             stdx::unique_lock<stdx::mutex> ul(_mutex);
 
@@ -172,6 +184,10 @@ StatusWith<CachedDatabaseInfo> CatalogCache::getDatabase(OperationContext* opCtx
                 }
                 _collectionsByDb[dbName] = std::move(collectionEntries);
                 dbEntry->mustLoadShardedCollections = false;
+
+                // The database is now fully loaded and fresh, so it becomes eligible for the
+                // lock-free read path.
+                _publishRoutingInfoSnapshot(ul);
             }
 
             auto primaryShard = uassertStatusOK(
@@ -210,6 +226,36 @@ CatalogCache::RefreshResult CatalogCache::_getCollectionRoutingInfoAt(
     // the caller is getCollectionRoutingInfoWithRefresh with the parameter
     // forceRefreshFromThisThread set to true
     RefreshAction refreshActionTaken(RefreshAction::kDidNotPerformRefresh);
+
+    // Fast path - serve the lookup from the currently published snapshot without taking the mutex.
+    // Only fresh entries are served this way; a missing database or a collection in the
+    // 'needsRefresh' state falls through to the locked path below, which knows how to join an
+    // ongoing refresh. A collection missing from a fresh database's snapshot is unsharded, same as
+    // on the locked path.
+    const auto snapshot = std::atomic_load(&_routingInfoSnapshot);
+    const auto itSnapshotDb = snapshot->databases.find(nss.db());
+    if (itSnapshotDb != snapshot->databases.end()) {
+        const auto itSnapshotColl = itSnapshotDb->second.collections.find(nss.ns());
+        const bool collIsFresh = itSnapshotColl == itSnapshotDb->second.collections.end() ||
+            !itSnapshotColl->second.needsRefresh;
+        if (collIsFresh) {
+            try {
+                auto primaryShard = uassertStatusOK(Grid::get(opCtx)->shardRegistry()->getShard(
+                    opCtx, itSnapshotDb->second.dbt.getPrimary()));
+                CachedDatabaseInfo dbInfo(itSnapshotDb->second.dbt, std::move(primaryShard));
+
+                auto cm = (itSnapshotColl != itSnapshotDb->second.collections.end())
+                    ? std::make_shared<ChunkManager>(itSnapshotColl->second.routingInfo,
+                                                     atClusterTime)
+                    : nullptr;
+                return {CachedCollectionRoutingInfo(nss, std::move(dbInfo), std::move(cm)),
+                        refreshActionTaken};
+            } catch (const DBException& ex) {
+                return {ex.toStatus(), refreshActionTaken};
+            }
+        }
+    }
+
     while (true) {
         const auto swDbInfo = getDatabase(opCtx, nss.db());
         if (!swDbInfo.isOK()) {
@@ -327,6 +373,7 @@ void CatalogCache::onStaleDatabaseVersion(const StringData dbName,
         // If the versions match, the cached database info is stale, so mark it as needs refresh.
         log() << "Marking cached database entry for '" << dbName << "' as stale";
         itDbEntry->second->needsRefresh = true;
+        _publishRoutingInfoSnapshot(lg);
     }
 }
 
@@ -365,6 +412,7 @@ void CatalogCache::onStaleShardVersion(CachedCollectionRoutingInfo&& ccriToInval
         // If the versions match, the last version of the routing information that we used is no
         // longer valid, so trigger a refresh.
         itColl->second->needsRefresh = true;
+        _publishRoutingInfoSnapshot(lg);
     }
 }
 
@@ -407,6 +455,7 @@ void CatalogCache::invalidateDatabaseEntry(const StringData dbName) {
         return;
     }
     itDbEntry->second->needsRefresh = true;
+    _publishRoutingInfoSnapshot(lg);
 }
 
 void CatalogCache::invalidateShardedCollection(const NamespaceString& nss) {
@@ -421,18 +470,21 @@ void CatalogCache::invalidateShardedCollection(const NamespaceString& nss) {
         itDb->second[nss.ns()] = std::make_shared<CollectionRoutingInfoEntry>();
     }
     itDb->second[nss.ns()]->needsRefresh = true;
+    _publishRoutingInfoSnapshot(lg);
 }
 
 void CatalogCache::purgeDatabase(StringData dbName) {
     stdx::lock_guard<stdx::mutex> lg(_mutex);
     _databases.erase(dbName);
     _collectionsByDb.erase(dbName);
+    _publishRoutingInfoSnapshot(lg);
 }
 
 void CatalogCache::purgeAllDatabases() {
     stdx::lock_guard<stdx::mutex> lg(_mutex);
     _databases.clear();
     _collectionsByDb.clear();
+    _publishRoutingInfoSnapshot(lg);
 }
 
 void CatalogCache::report(BSONObjBuilder* builder) const {
@@ -494,6 +546,7 @@ void CatalogCache::_scheduleDatabaseRefresh(WithLock,
             // The refresh found that the database was dropped, so remove its entry from the cache.
             _databases.erase(dbName);
             _collectionsByDb.erase(dbName);
+            _publishRoutingInfoSnapshot(lk);
             return;
         }
     };
@@ -504,6 +557,7 @@ void CatalogCache::_scheduleDatabaseRefresh(WithLock,
         dbEntry->needsRefresh = false;
         dbEntry->refreshCompletionNotification->set(Status::OK());
         dbEntry->refreshCompletionNotification = nullptr;
+        _publishRoutingInfoSnapshot(lk);
     };
 
     const auto updateCatalogCacheFn =
@@ -627,9 +681,11 @@ void CatalogCache::_scheduleCollectionRefresh(WithLock lk,
                 return;
             }
             itDb->second.erase(nss.ns());
+            _publishRoutingInfoSnapshot(lg);
             return;
         }
         collEntry->routingInfo = std::move(newRoutingInfo);
+        _publishRoutingInfoSnapshot(lg);
     };
 
     const ChunkVersion startingCollectionVersion =
@@ -653,6 +709,36 @@ void CatalogCache::_scheduleCollectionRefresh(WithLock lk,
     }
 }
 
+void CatalogCache::_publishRoutingInfoSnapshot(WithLock) {
+    auto snapshot = std::make_shared<RoutingInfoSnapshot>();
+
+    for (const auto& dbEntry : _databases) {
+        const auto& entry = dbEntry.second;
+
+        // Only fully loaded, fresh databases can be served without joining a refresh
+        if (entry->needsRefresh || entry->mustLoadShardedCollections || !entry->dbt) {
+            continue;
+        }
+
+        RoutingInfoSnapshot::DatabaseEntry dbSnapshot{*entry->dbt, {}};
+
+        const auto itCollections = _collectionsByDb.find(dbEntry.first);
+        if (itCollections != _collectionsByDb.end()) {
+            for (const auto& collEntry : itCollections->second) {
+                dbSnapshot.collections.emplace(
+                    collEntry.first,
+                    RoutingInfoSnapshot::CollectionEntry{collEntry.second->needsRefresh,
+                                                         collEntry.second->routingInfo});
+            }
+        }
+
+        snapshot->databases.emplace(dbEntry.first, std::move(dbSnapshot));
+    }
+
+    std::atomic_store(&_routingInfoSnapshot,
+                      std::shared_ptr<const RoutingInfoSnapshot>(std::move(snapshot)));
+}
+
 void CatalogCache::Stats::report(BSONObjBuilder* builder) const {
     builder->append("countStaleConfigErrors", countStaleConfigErrors.load());
 
@@ -286,6 +286,35 @@ private:
         boost::optional<DatabaseType> dbt;
     };
 
+    /**
+     * Point-in-time, immutable view of the fresh entries in the cache, published so that routing
+     * lookups can run without acquiring '_mutex'. Entries which are missing here or are marked as
+     * needing refresh must be looked up through the locked path, which knows how to join an
+     * ongoing refresh.
+     */
+    struct RoutingInfoSnapshot {
+        struct CollectionEntry {
+            // Mirrors CollectionRoutingInfoEntry::needsRefresh as of the time the snapshot was
+            // taken
+            bool needsRefresh;
+
+            // Shared reference to the immutable routing table (only set if needsRefresh is false)
+            std::shared_ptr<RoutingTableHistory> routingInfo;
+        };
+
+        struct DatabaseEntry {
+            // Cached info for a fully loaded, fresh database
+            DatabaseType dbt;
+
+            // All known sharded collections for the database, fresh or not, so that a collection
+            // missing from this map can safely be treated as unsharded
+            StringMap<CollectionEntry> collections;
+        };
+
+        // Only contains databases which are fresh and whose sharded collections have been loaded
+        StringMap<DatabaseEntry> databases;
+    };
+
     /**
      * Non-blocking call which schedules an asynchronous refresh for the specified database. The
      * database entry must be in the 'needsRefresh' state.
@@ -302,6 +331,15 @@ private:
                                     std::shared_ptr<CollectionRoutingInfoEntry> collEntry,
                                     NamespaceString const& nss,
                                     int refreshAttempt);
+
+    /**
+     * Rebuilds the lock-free routing snapshot from the cached entries and publishes it with a
+     * single atomic store. Must be called before releasing '_mutex' by any code path which adds,
+     * invalidates or removes a fresh entry. The rebuild is linear in the number of cached entries,
+     * which is acceptable because entries change orders of magnitude less often than they are read.
+     */
+    void _publishRoutingInfoSnapshot(WithLock);
+
     /**
      * Used as a flag to indicate whether or not this thread performed its own
      * refresh for certain helper functions
@@ -388,6 +426,10 @@ private:
     DatabaseInfoMap _databases;
     // Map from full collection name to the routing info for that collection, grouped by database
     CollectionsByDbMap _collectionsByDb;
+
+    // Immutable snapshot of the fresh entries above. Read with std::atomic_load without holding
+    // '_mutex'; replaced wholesale with std::atomic_store while holding '_mutex'. Never null.
+    std::shared_ptr<const RoutingInfoSnapshot> _routingInfoSnapshot;
 };
 
 }  // namespace mongo
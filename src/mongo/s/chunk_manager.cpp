@@ -34,6 +34,8 @@
 
 #include "mongo/s/chunk_manager.h"
 
+#include <algorithm>
+
 #include "mongo/base/owned_pointer_vector.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
@@ -71,6 +73,198 @@ std::string extractKeyStringInternal(const BSONObj& shardKeyValue, Ordering orde
 
 }  // namespace
 
+constexpr size_t ChunkInfoMap::kMaxBucketSize;
+
+ChunkInfoMap::const_iterator ChunkInfoMap::upper_bound(const std::string& key) const {
+    // The first bucket whose last chunk's max key is greater than 'key' is the bucket containing
+    // the result (if any)
+    const auto bucketIt = _buckets.upper_bound(key);
+    if (bucketIt == _buckets.end()) {
+        return end();
+    }
+
+    const auto& bucket = *bucketIt->second;
+    const auto pos = std::upper_bound(bucket.begin(),
+                                      bucket.end(),
+                                      key,
+                                      [](const std::string& k, const value_type& entry) {
+                                          return k < entry.first;
+                                      }) -
+        bucket.begin();
+    return {bucketIt, static_cast<size_t>(pos)};
+}
+
+ChunkInfoMap::const_iterator ChunkInfoMap::lower_bound(const std::string& key) const {
+    const auto bucketIt = _buckets.lower_bound(key);
+    if (bucketIt == _buckets.end()) {
+        return end();
+    }
+
+    const auto& bucket = *bucketIt->second;
+    const auto pos = std::lower_bound(bucket.begin(),
+                                      bucket.end(),
+                                      key,
+                                      [](const value_type& entry, const std::string& k) {
+                                          return entry.first < k;
+                                      }) -
+        bucket.begin();
+    return {bucketIt, static_cast<size_t>(pos)};
+}
+
+const std::shared_ptr<ChunkInfo>& ChunkInfoMap::at(const std::string& key) const {
+    const auto it = lower_bound(key);
+    if (it == end() || it->first != key) {
+        throw std::out_of_range("ChunkInfoMap::at");
+    }
+    return it->second;
+}
+
+std::shared_ptr<ChunkInfo> ChunkInfoMap::replaceOverlappingChunks(
+    const std::string& minKeyString,
+    const std::string& maxKeyString,
+    std::shared_ptr<ChunkInfo> chunk) {
+    const auto positionOf = [this](const std::string& key) {
+        size_t pos = 0;
+        auto bucketIt = _buckets.upper_bound(key);
+        if (bucketIt != _buckets.end()) {
+            const auto& bucket = *bucketIt->second;
+            pos = std::upper_bound(bucket.begin(),
+                                   bucket.end(),
+                                   key,
+                                   [](const std::string& k, const value_type& entry) {
+                                       return k < entry.first;
+                                   }) -
+                bucket.begin();
+        }
+        return std::make_pair(bucketIt, pos);
+    };
+
+    // The first chunk with a max key that is > min - implies that the chunk overlaps min
+    auto low = positionOf(minKeyString);
+
+    // The first chunk with a max key that is > max - implies that the next chunk cannot overlap
+    // max
+    auto high = positionOf(maxKeyString);
+
+    // If the update replaces exactly zero or one chunk, the new chunk is the result of a split and
+    // the chunk being split is the one at 'low' (for zero, both bounds fall within the chunk being
+    // split, whose own update has not been applied yet)
+    std::shared_ptr<ChunkInfo> chunkBeingReplacedBySplit;
+    if (low.first != _buckets.end()) {
+        auto next = low;
+        if (++next.second == next.first->second->size()) {
+            ++next.first;
+            next.second = 0;
+        }
+        if (low == high || next == high) {
+            chunkBeingReplacedBySplit = (*low.first->second)[low.second].second;
+        }
+    }
+
+    // Erase all chunks which overlap the chunk we got from the persistent store
+    if (low.first != _buckets.end() && low != high) {
+        if (low.first == high.first) {
+            // The whole range falls within a single bucket, which cannot become empty because the
+            // chunk at 'high' remains
+            auto& bucket = low.first->second;
+            _makeBucketUniquelyOwned(&bucket);
+            bucket->erase(bucket->begin() + low.second, bucket->begin() + high.second);
+            _size -= high.second - low.second;
+        } else {
+            auto bucketIt = low.first;
+
+            // Truncate the tail of the first overlapping bucket, re-keying it by its new last
+            // chunk
+            if (low.second == 0) {
+                _size -= bucketIt->second->size();
+                bucketIt = _buckets.erase(bucketIt);
+            } else {
+                auto& bucket = bucketIt->second;
+                _size -= bucket->size() - low.second;
+                _makeBucketUniquelyOwned(&bucket);
+                bucket->resize(low.second);
+
+                auto newKey = bucket->back().first;
+                auto bucketOwned = std::move(bucket);
+                bucketIt = _buckets.erase(bucketIt);
+                bucketIt = _buckets.emplace_hint(bucketIt, std::move(newKey), std::move(bucketOwned));
+                ++bucketIt;
+            }
+
+            // Buckets covered entirely by the overlap are simply dropped
+            while (bucketIt != high.first) {
+                _size -= bucketIt->second->size();
+                bucketIt = _buckets.erase(bucketIt);
+            }
+
+            // Trim the head of the last overlapping bucket, which cannot become empty because the
+            // chunk at 'high' remains and its key (the bucket's last chunk) does not change
+            if (high.first != _buckets.end() && high.second > 0) {
+                auto& bucket = high.first->second;
+                _makeBucketUniquelyOwned(&bucket);
+                bucket->erase(bucket->begin(), bucket->begin() + high.second);
+                _size -= high.second;
+            }
+        }
+    }
+
+    // Insert the new chunk. Every chunk remaining in the map either compares less than the new
+    // chunk's max key or lives in the bucket at 'high', so the chunk goes either into that bucket
+    // or at the very end of the map.
+    if (high.first != _buckets.end()) {
+        auto& bucket = high.first->second;
+        _makeBucketUniquelyOwned(&bucket);
+        const auto insertPos = std::upper_bound(bucket->begin(),
+                                                bucket->end(),
+                                                maxKeyString,
+                                                [](const std::string& k, const value_type& entry) {
+                                                    return k < entry.first;
+                                                });
+        bucket->insert(insertPos, value_type(maxKeyString, std::move(chunk)));
+        ++_size;
+        _splitBucketIfNeeded(high.first);
+    } else if (!_buckets.empty()) {
+        const auto lastBucketIt = std::prev(_buckets.end());
+        auto& bucket = lastBucketIt->second;
+        _makeBucketUniquelyOwned(&bucket);
+        bucket->emplace_back(maxKeyString, std::move(chunk));
+        ++_size;
+
+        auto bucketOwned = std::move(bucket);
+        _buckets.erase(lastBucketIt);
+        const auto insertedIt =
+            _buckets.emplace(maxKeyString, std::move(bucketOwned)).first;
+        _splitBucketIfNeeded(insertedIt);
+    } else {
+        auto bucket = std::make_shared<Bucket>();
+        bucket->emplace_back(maxKeyString, std::move(chunk));
+        _buckets.emplace(maxKeyString, std::move(bucket));
+        ++_size;
+    }
+
+    return chunkBeingReplacedBySplit;
+}
+
+void ChunkInfoMap::_makeBucketUniquelyOwned(std::shared_ptr<Bucket>* bucket) {
+    if (!bucket->unique()) {
+        *bucket = std::make_shared<Bucket>(**bucket);
+    }
+}
+
+void ChunkInfoMap::_splitBucketIfNeeded(BucketMap::iterator bucketIt) {
+    auto& bucket = bucketIt->second;
+    if (bucket->size() <= kMaxBucketSize) {
+        return;
+    }
+
+    // Move the first half of the chunks into a new bucket, keyed by its last chunk's max key. A
+    // single split is always sufficient, because buckets grow by one chunk at a time.
+    const auto splitPoint = bucket->begin() + bucket->size() / 2;
+    auto firstHalf = std::make_shared<Bucket>(bucket->begin(), splitPoint);
+    bucket->erase(bucket->begin(), splitPoint);
+    _buckets.emplace_hint(bucketIt, firstHalf->back().first, std::move(firstHalf));
+}
+
 RoutingTableHistory::RoutingTableHistory(NamespaceString nss,
                                          boost::optional<UUID> uuid,
                                          KeyPattern shardKeyPattern,
@@ -514,6 +708,9 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
     const std::vector<ChunkType>& changedChunks) {
 
     const auto startingCollectionVersion = getVersion();
+
+    // Copying the map only copies its bucket index; the buckets themselves stay shared with this
+    // routing table and are duplicated below only when a changed chunk actually touches them
     auto chunkMap = _chunkMap;
 
     ChunkVersion collectionVersion = startingCollectionVersion;
@@ -530,44 +727,18 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
         invariant(chunkVersion >= collectionVersion);
         collectionVersion = chunkVersion;
 
-        const auto chunkMinKeyString = _extractKeyString(chunk.getMin());
-        const auto chunkMaxKeyString = _extractKeyString(chunk.getMax());
-
-        // Returns the first chunk with a max key that is > min - implies that the chunk overlaps
-        // min
-        const auto low = chunkMap.upper_bound(chunkMinKeyString);
-
-        // Returns the first chunk with a max key that is > max - implies that the next chunk cannot
-        // not overlap max
-        const auto high = chunkMap.upper_bound(chunkMaxKeyString);
-
-        // If we are in the middle of splitting a chunk, for the first few
-        // chunks inserted, low == high, because both lookups will point to the
-        // same chunk (the one being split). If we're inserting the last chunk
-        // for the current chunk being split, low will point to the chunk that
-        // we're splitting, and high will point to the next chunk past the one
-        // we're splitting (which could be chunkMap.end()). In this case,
-        // std::distance(low, high) == 1. Lastly, this does not apply during
-        // the creation of the original routing table, in which case the map is
-        // empty and the first chunk that is inserted will find that low ==
-        // high, but low == chunkMap.end(), and we aren't doing a split in that
-        // case.
-        auto foundSingleChunk =
-            ((low == high || std::distance(low, high) == 1) && low != chunkMap.end());
-
         auto newChunk = std::make_shared<ChunkInfo>(chunk);
-        if (foundSingleChunk) {
-            auto chunkBeingReplacedBySplit = low->second;
+
+        // Replace all chunks overlapping the chunk we got from the persistent store with the chunk
+        // itself. If this update is a split of a single chunk, carry the bytes written over from
+        // the chunk being split so that the auto-splitter keeps an accurate estimate.
+        auto chunkBeingReplacedBySplit = chunkMap.replaceOverlappingChunks(
+            _extractKeyString(chunk.getMin()), _extractKeyString(chunk.getMax()), newChunk);
+        if (chunkBeingReplacedBySplit) {
             auto bytesInReplacedChunk =
                 chunkBeingReplacedBySplit->getWritesTracker()->getBytesWritten();
             newChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
         }
-
-        // Erase all chunks from the map, which overlap the chunk we got from the persistent store
-        chunkMap.erase(low, high);
-
-        // Insert only the chunk itself
-        chunkMap.insert(std::make_pair(chunkMaxKeyString, newChunk));
     }
 
     // If at least one diff was applied, the metadata is correct, but it might not have changed so
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <iterator>
 #include <map>
 #include <set>
 #include <string>
@@ -51,8 +52,159 @@ struct QuerySolutionNode;
 class OperationContext;
 class ChunkManager;
 
-// Ordered map from the max for each chunk to an entry describing the chunk
-using ChunkInfoMap = std::map<std::string, std::shared_ptr<ChunkInfo>>;
+/**
+ * Ordered map from the max for each chunk to an entry describing the chunk.
+ *
+ * Chunks are stored in buckets of at most kMaxBucketSize entries, held through shared pointers.
+ * Copying the map copies only the bucket index and shares the buckets themselves with the
+ * original, so a copy is linear in the number of buckets rather than the number of chunks. A
+ * mutation clones just the buckets it touches (and never mutates a bucket which another map still
+ * references), which makes applying a refresh with a small number of changed chunks cheap even for
+ * collections with very large routing tables.
+ */
+class ChunkInfoMap {
+public:
+    using value_type = std::pair<std::string, std::shared_ptr<ChunkInfo>>;
+
+private:
+    using Bucket = std::vector<value_type>;
+
+    // Keyed by the max key of each bucket's last chunk, so lookup is a search on the bucket index
+    // followed by a binary search within the target bucket
+    using BucketMap = std::map<std::string, std::shared_ptr<Bucket>>;
+
+public:
+    // The maximum number of chunks per bucket. Chosen so that for large routing tables the cost of
+    // cloning the buckets touched by an update and the cost of copying the bucket index are both
+    // small relative to the total number of chunks.
+    static constexpr size_t kMaxBucketSize = 512;
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = ChunkInfoMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            return (*_bucketIt->second)[_pos];
+        }
+        pointer operator->() const {
+            return &(*_bucketIt->second)[_pos];
+        }
+
+        const_iterator& operator++() {
+            if (++_pos == _bucketIt->second->size()) {
+                ++_bucketIt;
+                _pos = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+        const_iterator& operator--() {
+            if (_pos == 0) {
+                --_bucketIt;
+                _pos = _bucketIt->second->size() - 1;
+            } else {
+                --_pos;
+            }
+            return *this;
+        }
+        const_iterator operator--(int) {
+            auto ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return _bucketIt == other._bucketIt && _pos == other._pos;
+        }
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        friend class ChunkInfoMap;
+
+        const_iterator(BucketMap::const_iterator bucketIt, size_t pos)
+            : _bucketIt(std::move(bucketIt)), _pos(pos) {}
+
+        BucketMap::const_iterator _bucketIt;
+        size_t _pos{0};
+    };
+
+    const_iterator begin() const {
+        return {_buckets.begin(), 0};
+    }
+    const_iterator end() const {
+        return {_buckets.end(), 0};
+    }
+    const_iterator cbegin() const {
+        return begin();
+    }
+    const_iterator cend() const {
+        return end();
+    }
+
+    size_t size() const {
+        return _size;
+    }
+    bool empty() const {
+        return _size == 0;
+    }
+
+    /**
+     * Returns an iterator to the first chunk whose max key compares greater than (respectively,
+     * not less than) 'key', same as the equivalently named std::map methods.
+     */
+    const_iterator upper_bound(const std::string& key) const;
+    const_iterator lower_bound(const std::string& key) const;
+
+    /**
+     * Returns the chunk whose max key is exactly 'key'. Throws std::out_of_range if there is no
+     * such chunk, same as std::map::at.
+     */
+    const std::shared_ptr<ChunkInfo>& at(const std::string& key) const;
+
+    /**
+     * Applies a single changed chunk from a refresh: removes all chunks which overlap the range
+     * ('minKeyString', 'maxKeyString'] and inserts 'chunk' keyed by 'maxKeyString'.
+     *
+     * Returns the chunk being replaced when the update replaces exactly zero or one chunk, which
+     * indicates that 'chunk' is the result of a split (for the first few chunks inserted during a
+     * split both bounds resolve to the chunk being split, because its own update has not been seen
+     * yet). This does not apply during the creation of the original routing table, in which case
+     * the map is empty and nothing is returned. The caller uses the returned chunk to carry over
+     * the bytes-written tracking to the chunks resulting from the split.
+     */
+    std::shared_ptr<ChunkInfo> replaceOverlappingChunks(const std::string& minKeyString,
+                                                        const std::string& maxKeyString,
+                                                        std::shared_ptr<ChunkInfo> chunk);
+
+private:
+    /**
+     * Clones the pointed-to bucket unless this map is its only owner. Must be called before any
+     * in-place mutation, because buckets are shared with the previous routing table generations
+     * this map was copied from.
+     */
+    static void _makeBucketUniquelyOwned(std::shared_ptr<Bucket>* bucket);
+
+    /**
+     * Splits the specified bucket in two if it has grown beyond kMaxBucketSize entries. The bucket
+     * must already be uniquely owned.
+     */
+    void _splitBucketIfNeeded(BucketMap::iterator bucketIt);
+
+    BucketMap _buckets;
+    size_t _size{0};
+};
 
 // Map from a shard is to the max chunk version on that shard
 using ShardVersionMap = std::map<ShardId, ChunkVersion>;
@@ -181,7 +181,8 @@ std::vector<AsyncRequestsSender::Response> gatherResponses(
     StringData dbName,
     const ReadPreferenceSetting& readPref,
     Shard::RetryPolicy retryPolicy,
-    const std::vector<AsyncRequestsSender::Request>& requests) {
+    const std::vector<AsyncRequestsSender::Request>& requests,
+    AsyncRequestsSender::HedgingMode hedgingMode) {
 
     // Send the requests.
     MultiStatementTransactionRequestsSender ars(
@@ -190,7 +191,8 @@ std::vector<AsyncRequestsSender::Response> gatherResponses(
         dbName,
         requests,
         readPref,
-        retryPolicy);
+        retryPolicy,
+        hedgingMode);
 
     // Get the responses.
 
@@ -273,8 +275,14 @@ std::vector<AsyncRequestsSender::Response> scatterGatherUnversionedTargetAllShar
     const BSONObj& cmdObj,
     const ReadPreferenceSetting& readPref,
     Shard::RetryPolicy retryPolicy) {
-    return gatherResponses(
-        opCtx, dbName, readPref, retryPolicy, buildUnversionedRequestsForAllShards(opCtx, cmdObj));
+    // The commands broadcast through here gather single responses in full and leave no cursor open
+    // on the shards, so the sender may hedge them when the read preference tolerates secondaries.
+    return gatherResponses(opCtx,
+                           dbName,
+                           readPref,
+                           retryPolicy,
+                           buildUnversionedRequestsForAllShards(opCtx, cmdObj),
+                           AsyncRequestsSender::HedgingMode::kAllowed);
 }
 
 std::vector<AsyncRequestsSender::Response> scatterGatherVersionedTargetByRoutingTable(
@@ -290,7 +298,14 @@ std::vector<AsyncRequestsSender::Response> scatterGatherVersionedTargetByRouting
     const auto requests =
         buildVersionedRequestsForTargetedShards(opCtx, nss, routingInfo, cmdObj, query, collation);
 
-    return gatherResponses(opCtx, dbName, readPref, retryPolicy, requests);
+    // None of the commands dispatched through here establishes a cursor on the shards, so hedging
+    // a slow request leaves nothing behind on the losing host.
+    return gatherResponses(opCtx,
+                           dbName,
+                           readPref,
+                           retryPolicy,
+                           requests,
+                           AsyncRequestsSender::HedgingMode::kAllowed);
 }
 
 std::vector<AsyncRequestsSender::Response> scatterGatherOnlyVersionIfUnsharded(
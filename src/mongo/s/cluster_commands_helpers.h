@@ -62,7 +62,8 @@ std::vector<AsyncRequestsSender::Response> gatherResponses(
     StringData dbName,
     const ReadPreferenceSetting& readPref,
     Shard::RetryPolicy retryPolicy,
-    const std::vector<AsyncRequestsSender::Request>& requests);
+    const std::vector<AsyncRequestsSender::Request>& requests,
+    AsyncRequestsSender::HedgingMode hedgingMode = AsyncRequestsSender::HedgingMode::kDisallowed);
 
 /**
  * Returns a copy of 'cmdObj' with 'version' appended.
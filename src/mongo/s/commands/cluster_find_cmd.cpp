@@ -37,6 +37,7 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/query/cursor_response.h"
+#include "mongo/db/query/find_common.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/views/resolved_view.h"
 #include "mongo/rpc/get_status_from_command_result.h"
@@ -197,10 +198,18 @@ public:
                 auto cursorId =
                     ClusterFind::runQuery(opCtx, *cq, ReadPreferenceSetting::get(opCtx), &batch);
 
-                // Build the response document.
+                // Build the response document. The entire batch is buffered at this point, so its
+                // total size is known; reserve it in the reply buffer before appending so that
+                // each document is copied into the outbound message exactly once.
                 CursorResponseBuilder::Options options;
                 options.isInitialResponse = true;
                 CursorResponseBuilder firstBatch(result, options);
+                int bytesToReserve = 0;
+                for (const auto& obj : batch) {
+                    bytesToReserve +=
+                        obj.objsize() + FindCommon::kPerDocumentOverheadBytesUpperBound;
+                }
+                firstBatch.reserveReplyBuffer(bytesToReserve);
                 for (const auto& obj : batch) {
                     firstBatch.append(obj);
                 }
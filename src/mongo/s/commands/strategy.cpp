@@ -39,9 +39,11 @@
 #include "mongo/base/status.h"
 #include "mongo/bson/util/bson_extract.h"
 #include "mongo/bson/util/builder.h"
+#include "mongo/client/read_preference.h"
 #include "mongo/db/audit.h"
 #include "mongo/db/auth/action_type.h"
 #include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/test_commands_enabled.h"
 #include "mongo/db/curop.h"
@@ -91,12 +93,52 @@ namespace {
 
 const auto kOperationTime = "operationTime"_sd;
 
+/**
+ * Per-client cache of the most recently parsed $readPreference document. Drivers attach the same
+ * read preference to every command they send on a connection, so in steady state the mode lookup,
+ * tag set construction and validation can all be skipped whenever the raw bytes match those of the
+ * previous command. The cached setting is a pure function of the key bytes and therefore never
+ * needs invalidating.
+ */
+struct LastParsedReadPreference {
+    BSONObj key;  // Owned copy of the $readPreference document the cached setting was parsed from.
+    ReadPreferenceSetting value;
+};
+
+const auto getLastParsedReadPreference = Client::declareDecoration<LastParsedReadPreference>();
+
+/**
+ * Extracts the $readPreference from the command body, consulting the per-client cache before
+ * falling back to a full parse.
+ */
+ReadPreferenceSetting extractReadPreference(OperationContext* opCtx, const BSONObj& cmdObj) {
+    auto elem = cmdObj["$readPreference"];
+    if (!elem) {
+        return ReadPreferenceSetting(ReadPreference::PrimaryOnly);
+    }
+
+    if (elem.type() == Object) {
+        auto& cache = getLastParsedReadPreference(opCtx->getClient());
+        auto readPrefObj = elem.Obj();
+        if (readPrefObj.binaryEqual(cache.key)) {
+            return cache.value;
+        }
+
+        auto parsed = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(readPrefObj));
+        cache.key = readPrefObj.getOwned();
+        cache.value = parsed;
+        return parsed;
+    }
+
+    // Let the parser produce the type error for non-object $readPreference values.
+    return uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(elem));
+}
+
 /**
  * Extract and process metadata from the command request body.
  */
 Status processCommandMetadata(OperationContext* opCtx, const BSONObj& cmdObj) {
-    ReadPreferenceSetting::get(opCtx) =
-        uassertStatusOK(ReadPreferenceSetting::fromContainingBSON(cmdObj));
+    ReadPreferenceSetting::get(opCtx) = extractReadPreference(opCtx, cmdObj);
 
     auto logicalClock = LogicalClock::get(opCtx);
     invariant(logicalClock);
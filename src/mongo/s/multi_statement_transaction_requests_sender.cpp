@@ -64,11 +64,19 @@ MultiStatementTransactionRequestsSender::MultiStatementTransactionRequestsSender
     StringData dbName,
     const std::vector<AsyncRequestsSender::Request>& requests,
     const ReadPreferenceSetting& readPreference,
-    Shard::RetryPolicy retryPolicy)
+    Shard::RetryPolicy retryPolicy,
+    AsyncRequestsSender::HedgingMode hedgingMode)
     : _opCtx(opCtx),
-      _ars(
-          opCtx, executor, dbName, attachTxnDetails(opCtx, requests), readPreference, retryPolicy) {
-}
+      _ars(opCtx,
+           executor,
+           dbName,
+           attachTxnDetails(opCtx, requests),
+           readPreference,
+           retryPolicy,
+           // Statements in a multi-statement transaction must be executed exactly once, on the
+           // participant the transaction has pinned; never hedge them.
+           TransactionRouter::get(opCtx) ? AsyncRequestsSender::HedgingMode::kDisallowed
+                                         : hedgingMode) {}
 
 bool MultiStatementTransactionRequestsSender::done() {
     return _ars.done();
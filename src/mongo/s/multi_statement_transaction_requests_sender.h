@@ -52,7 +52,9 @@ public:
         StringData dbName,
         const std::vector<AsyncRequestsSender::Request>& requests,
         const ReadPreferenceSetting& readPreference,
-        Shard::RetryPolicy retryPolicy);
+        Shard::RetryPolicy retryPolicy,
+        AsyncRequestsSender::HedgingMode hedgingMode =
+            AsyncRequestsSender::HedgingMode::kDisallowed);
 
     bool done();
 
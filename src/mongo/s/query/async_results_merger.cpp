@@ -40,6 +40,7 @@
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/getmore_request.h"
 #include "mongo/db/query/killcursors_request.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/remote_command_response.h"
 #include "mongo/util/assert_util.h"
@@ -80,6 +81,17 @@ int compareSortKeys(BSONObj leftSortKey, BSONObj rightSortKey, BSONObj sortKeyPa
     return leftSortKey.woCompare(rightSortKey, sortKeyPattern, considerFieldName);
 }
 
+/**
+ * Returns the KeyString-serialized form of the $sortKey in 'obj'. Memcmp of two such strings
+ * yields the same order as compareSortKeys() on the corresponding sort keys, since 'ordering'
+ * inverts the encoding of descending sort fields. The sort key's field names are empty, so they
+ * do not participate in the encoding.
+ */
+std::string extractSortKeyString(BSONObj obj, bool compareWholeSortKey, const Ordering& ordering) {
+    const KeyString ks(KeyString::Version::V1, extractSortKey(obj, compareWholeSortKey), ordering);
+    return {ks.getBuffer(), ks.getSize()};
+}
+
 }  // namespace
 
 AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
@@ -92,9 +104,8 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(_remotes,
-                                    _params.getSort() ? *_params.getSort() : BSONObj(),
-                                    _params.getCompareWholeSortKey())) {
+      _sortKeyOrdering(Ordering::make(_params.getSort() ? *_params.getSort() : BSONObj())),
+      _mergeQueue(MergingComparator(_remotes)) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
     }
@@ -226,7 +237,7 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock) {
     }
 
     auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
+    auto smallestResult = _remotes[smallestRemote].docBuffer.front().result;
     auto keyWeWantToReturn =
         extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
     for (const auto& remote : _remotes) {
@@ -292,7 +303,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     invariant(!_remotes[smallestRemote].docBuffer.empty());
     invariant(_remotes[smallestRemote].status.isOK());
 
-    ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
+    ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front().result;
     _remotes[smallestRemote].docBuffer.pop();
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
@@ -311,7 +322,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
         invariant(_remotes[_gettingFromRemote].status.isOK());
 
         if (_remotes[_gettingFromRemote].hasNext()) {
-            ClusterQueryResult front = _remotes[_gettingFromRemote].docBuffer.front();
+            ClusterQueryResult front = _remotes[_gettingFromRemote].docBuffer.front().result;
             _remotes[_gettingFromRemote].docBuffer.pop();
 
             if (_tailableMode == TailableModeEnum::kTailable &&
@@ -578,7 +589,7 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
         remote.status = Status::OK();
 
         // Clear the results buffer and cursor id.
-        std::queue<ClusterQueryResult> emptyBuffer;
+        std::queue<BufferedResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
         remote.cursorId = 0;
     }
@@ -652,8 +663,12 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             }
         }
 
-        ClusterQueryResult result(obj);
-        remote.docBuffer.push(result);
+        BufferedResult bufferedResult{ClusterQueryResult(obj), std::string()};
+        if (_params.getSort()) {
+            bufferedResult.sortKeyString =
+                extractSortKeyString(obj, _params.getCompareWholeSortKey(), _sortKeyOrdering);
+        }
+        remote.docBuffer.push(std::move(bufferedResult));
         ++remote.fetchedCount;
     }
 
@@ -772,12 +787,10 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    // The serialized sort keys already account for the sort direction of each field, so a plain
+    // string comparison suffices here.
+    return _remotes[lhs].docBuffer.front().sortKeyString >
+        _remotes[rhs].docBuffer.front().sortKeyString;
 }
 
 }  // namespace mongo
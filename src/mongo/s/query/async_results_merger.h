@@ -32,11 +32,13 @@
 
 #include <boost/optional.hpp>
 #include <queue>
+#include <string>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/s/query/async_results_merger_params_gen.h"
@@ -235,6 +237,20 @@ public:
     executor::TaskExecutor::EventHandle kill(OperationContext* opCtx);
 
 private:
+    /**
+     * A single result buffered from a remote host, together with the KeyString-serialized form of
+     * its sort key. The sort key is serialized once, when the result enters the buffer, so that
+     * each comparison made by the merging heap is a cheap memcmp rather than a BSON traversal.
+     */
+    struct BufferedResult {
+        ClusterQueryResult result;
+
+        // Serialized sort key for 'result'. Comparing two of these with operator< yields the same
+        // order as comparing the $sortKey fields with woCompare against the sort pattern, since
+        // descending sort fields are inverted during serialization. Empty if there is no sort.
+        std::string sortKeyString;
+    };
+
     /**
      * We instantiate one of these per remote host. It contains the buffer of results we've
      * retrieved from the host but not yet returned, as well as the cursor id, and any error
@@ -283,7 +299,7 @@ private:
         ShardId shardId;
 
         // The buffer of results that have been retrieved but not yet returned to the caller.
-        std::queue<ClusterQueryResult> docBuffer;
+        std::queue<BufferedResult> docBuffer;
 
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
@@ -299,22 +315,12 @@ private:
 
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const std::vector<RemoteCursorData>& remotes) : _remotes(remotes) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
     private:
         const std::vector<RemoteCursorData>& _remotes;
-
-        const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     enum LifecycleState { kAlive, kKillStarted, kKillComplete };
@@ -426,6 +432,10 @@ private:
     TailableModeEnum _tailableMode;
     AsyncResultsMergerParams _params;
 
+    // Per-element directions of the sort pattern, used when serializing sort keys into their
+    // KeyString form. All-ascending (and unused) if there is no sort.
+    const Ordering _sortKeyOrdering;
+
     // Must be acquired before accessing any data members (other than _params, which is read-only).
     mutable stdx::mutex _mutex;
 
@@ -78,12 +78,6 @@ static const BSONObj kSortKeyMetaProjection = BSON("$meta"
 static const BSONObj kGeoNearDistanceMetaProjection = BSON("$meta"
                                                            << "geoNearDistance");
 
-// We must allow some amount of overhead per result document, since when we make a cursor response
-// the documents are elements of a BSONArray. The overhead is 1 byte/doc for the type + 1 byte/doc
-// for the field name's null terminator + 1 byte per digit in the array index. The index can be no
-// more than 8 decimal digits since the response is at most 16MB, and 16 * 1024 * 1024 < 1 * 10^8.
-static const int kPerDocumentOverheadBytesUpperBound = 10;
-
 const char kFindCmdName[] = "find";
 
 /**
@@ -309,6 +303,7 @@ CursorId runQueryWithoutRetrying(OperationContext* opCtx,
 
     auto cursorState = ClusterCursorManager::CursorState::NotExhausted;
     int bytesBuffered = 0;
+    bool stashedResult = false;
 
     while (!FindCommon::enoughForFirstBatch(query.getQueryRequest(), results->size())) {
         auto next = uassertStatusOK(ccc->next(RouterExecStage::ExecContext::kInitialFind));
@@ -330,15 +325,30 @@ CursorId runQueryWithoutRetrying(OperationContext* opCtx,
         // for later.
         if (!FindCommon::haveSpaceForNext(nextObj, results->size(), bytesBuffered)) {
             ccc->queueResult(nextObj);
+            stashedResult = true;
             break;
         }
 
         // Add doc to the batch. Account for the space overhead associated with returning this doc
         // inside a BSON array.
-        bytesBuffered += (nextObj.objsize() + kPerDocumentOverheadBytesUpperBound);
+        bytesBuffered += (nextObj.objsize() + FindCommon::kPerDocumentOverheadBytesUpperBound);
         results->push_back(std::move(nextObj));
     }
 
+    // If the first batch filled up just as the remotes ran out of results, probe for one more
+    // result so that a cursor which can never return another document is not registered with the
+    // cursor manager only to be reaped by a no-op getMore. The probe cannot block, since every
+    // remote cursor has already been closed by its shard.
+    if (cursorState == ClusterCursorManager::CursorState::NotExhausted && !stashedResult &&
+        !ccc->isTailable() && ccc->remotesExhausted()) {
+        auto next = uassertStatusOK(ccc->next(RouterExecStage::ExecContext::kInitialFind));
+        if (next.isEOF()) {
+            cursorState = ClusterCursorManager::CursorState::Exhausted;
+        } else {
+            ccc->queueResult(next);
+        }
+    }
+
     ccc->detachFromOperationContext();
 
     if (!query.getQueryRequest().wantMore() && !ccc->isTailable()) {
@@ -644,7 +654,8 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
         // Add doc to the batch. Account for the space overhead associated with returning this doc
         // inside a BSON array.
         bytesBuffered +=
-            (next.getValue().getResult()->objsize() + kPerDocumentOverheadBytesUpperBound);
+            (next.getValue().getResult()->objsize() +
+             FindCommon::kPerDocumentOverheadBytesUpperBound);
         batch.push_back(std::move(*next.getValue().getResult()));
     }
 
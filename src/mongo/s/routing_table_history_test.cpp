@@ -319,5 +319,49 @@ TEST_F(RoutingTableHistoryTestThreeInitialChunks,
                               expectedBytesInChunksNotSplit);
 }
 
+TEST_F(RoutingTableHistoryTest, UpdatesSpanningManyBucketsPreserveOrderAndSharing) {
+    // Use enough chunks to spread the routing table across several buckets of the chunk map
+    const size_t numChunks = 3 * ChunkInfoMap::kMaxBucketSize + 10;
+
+    std::vector<BSONObj> newChunkBoundaryPoints;
+    newChunkBoundaryPoints.push_back(getShardKeyPattern().globalMin());
+    for (size_t i = 1; i < numChunks; ++i) {
+        newChunkBoundaryPoints.push_back(BSON("a" << static_cast<int>(i)));
+    }
+    newChunkBoundaryPoints.push_back(getShardKeyPattern().globalMax());
+
+    auto rt = splitChunk(getInitialRoutingTable(), newChunkBoundaryPoints);
+    ASSERT_EQ(rt->getChunkMap().size(), numChunks);
+
+    // The chunks must come back in ascending shard key order regardless of bucketing
+    boost::optional<BSONObj> previousMax;
+    for (const auto& kv : rt->getChunkMap()) {
+        if (previousMax) {
+            ASSERT_BSONOBJ_LT(*previousMax, kv.second->getMax());
+        }
+        previousMax = kv.second->getMax();
+    }
+
+    // Merge a range which spans multiple buckets into a single chunk
+    const size_t numMergedChunks = 2 * ChunkInfoMap::kMaxBucketSize;
+    auto mergedMin = BSON("a" << 1);
+    auto mergedMax = BSON("a" << static_cast<int>(1 + numMergedChunks));
+    auto mergedVersion = rt->getVersion();
+    mergedVersion.incMajor();
+
+    auto mergedRt = rt->makeUpdated(
+        {ChunkType{kNss, ChunkRange{mergedMin, mergedMax}, mergedVersion, kThisShard}});
+    ASSERT_EQ(mergedRt->getChunkMap().size(), numChunks - numMergedChunks + 1);
+
+    auto mergedChunks = getChunksInRange(mergedRt, mergedMin, mergedMax);
+    ASSERT_EQ(mergedChunks.size(), 1ull);
+
+    // The routing table the update started from must not be affected, because it shares its
+    // buckets with the updated one
+    ASSERT_EQ(rt->getChunkMap().size(), numChunks);
+    auto originalChunks = getChunksInRange(rt, mergedMin, mergedMax);
+    ASSERT_EQ(originalChunks.size(), numMergedChunks);
+}
+
 }  // namespace
 }  // namespace mongo
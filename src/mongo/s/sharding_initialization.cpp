@@ -98,6 +98,11 @@ MONGO_EXPORT_STARTUP_SERVER_PARAMETER(ShardingTaskExecutorPoolRefreshTimeoutMS,
                                       int,
                                       ConnectionPool::kDefaultRefreshTimeout.count());
 
+// Spread each idle connection's refresh deadline over an extra random interval of up to this many
+// milliseconds so that a pool warmed up by a burst doesn't ping its host with all of its refreshes
+// at once.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(ShardingTaskExecutorPoolRefreshJitterMS, int, 5000);
+
 namespace {
 
 using executor::NetworkInterface;
@@ -192,6 +197,7 @@ Status initializeGlobalShardingState(OperationContext* opCtx,
         : ConnectionPool::kDefaultMaxConnecting;
     connPoolOptions.minConnections = ShardingTaskExecutorPoolMinSize;
     connPoolOptions.refreshRequirement = Milliseconds(ShardingTaskExecutorPoolRefreshRequirementMS);
+    connPoolOptions.refreshJitter = Milliseconds(ShardingTaskExecutorPoolRefreshJitterMS);
     connPoolOptions.refreshTimeout = Milliseconds(ShardingTaskExecutorPoolRefreshTimeoutMS);
 
     if (connPoolOptions.refreshRequirement <= connPoolOptions.refreshTimeout) {
@@ -205,6 +211,16 @@ Status initializeGlobalShardingState(OperationContext* opCtx,
         connPoolOptions.refreshTimeout = newRefreshTimeout;
     }
 
+    if (connPoolOptions.refreshJitter >= connPoolOptions.refreshRequirement) {
+        auto newRefreshJitter = connPoolOptions.refreshRequirement / 2;
+        warning() << "ShardingTaskExecutorPoolRefreshJitterMS (" << connPoolOptions.refreshJitter
+                  << ") set at or above ShardingTaskExecutorPoolRefreshRequirementMS ("
+                  << connPoolOptions.refreshRequirement
+                  << "). Adjusting ShardingTaskExecutorPoolRefreshJitterMS to "
+                  << newRefreshJitter;
+        connPoolOptions.refreshJitter = newRefreshJitter;
+    }
+
     if (connPoolOptions.hostTimeout <=
         connPoolOptions.refreshRequirement + connPoolOptions.refreshTimeout) {
         auto newHostTimeout =
@@ -45,7 +45,6 @@
 #include "mongo/db/session_catalog.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/cluster_commands_helpers.h"
-#include "mongo/s/grid.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 
@@ -142,7 +141,8 @@ BSONObjBuilder appendFieldsForStartTransaction(BSONObj cmd,
 // Commands that are idempotent in a transaction context and can be blindly retried in the middle of
 // a transaction. Aggregate with $out is disallowed in a transaction, so aggregates must be read
 // operations. Note: aggregate and find do have the side-effect of creating cursors, but any
-// established during an unsuccessful attempt are best-effort killed.
+// established during an unsuccessful attempt are best-effort killed. Since none of these commands
+// can write, the set doubles as the commands that leave a participant read-only.
 const StringMap<int> alwaysRetryableCmds = {
     {"aggregate", 1}, {"distinct", 1}, {"find", 1}, {"getMore", 1}, {"killCursors", 1}};
 
@@ -230,6 +230,14 @@ StmtId TransactionRouter::Participant::getStmtIdCreatedAt() const {
     return _stmtIdCreatedAt;
 }
 
+bool TransactionRouter::Participant::mightHaveWritten() const {
+    return _mightHaveWritten;
+}
+
+void TransactionRouter::Participant::markMightHaveWritten() {
+    _mightHaveWritten = true;
+}
+
 LogicalTime TransactionRouter::AtClusterTime::getTime() const {
     invariant(_atClusterTime != LogicalTime::kUninitialized);
     invariant(_stmtIdSelectedAt != kUninitializedStmtId);
@@ -273,11 +281,23 @@ const boost::optional<ShardId>& TransactionRouter::getCoordinatorId() const {
 }
 
 BSONObj TransactionRouter::attachTxnFieldsIfNeeded(const ShardId& shardId, const BSONObj& cmdObj) {
+    // Remember which participants may have written, so commit can skip the two phase commit
+    // protocol when at most one shard did. The always retryable commands are exactly the ones
+    // that cannot write in a transaction; any other statement is assumed to write.
+    const bool mightWrite = !isTransactionCommand(cmdObj) &&
+        !alwaysRetryableCmds.count(cmdObj.firstElement().fieldNameStringData());
+
     if (auto txnPart = getParticipant(shardId)) {
+        if (mightWrite) {
+            txnPart->markMightHaveWritten();
+        }
         return txnPart->attachTxnFieldsIfNeeded(cmdObj, false);
     }
 
-    auto txnPart = _createParticipant(shardId);
+    auto& txnPart = _createParticipant(shardId);
+    if (mightWrite) {
+        txnPart.markMightHaveWritten();
+    }
     return txnPart.attachTxnFieldsIfNeeded(cmdObj, true);
 }
 
@@ -529,30 +549,81 @@ const LogicalSessionId& TransactionRouter::_sessionId() const {
     return owningSession->getSessionId();
 }
 
-Shard::CommandResponse TransactionRouter::_commitSingleShardTransaction(OperationContext* opCtx) {
-    auto shardRegistry = Grid::get(opCtx)->shardRegistry();
+Shard::CommandResponse TransactionRouter::_runTransactionCommandOnShard(OperationContext* opCtx,
+                                                                        const ShardId& shardId,
+                                                                        const BSONObj& cmdObj) {
+    invariant(_participants.find(shardId.toString()) != _participants.end());
+
+    // Send through the requests sender rather than Shard::runCommand so the wait for the shard's
+    // response can poll the network on this thread via its baton instead of handing off to the
+    // reactor thread and back.
+    std::vector<AsyncRequestsSender::Request> requests;
+    requests.emplace_back(shardId, cmdObj);
 
-    auto citer = _participants.cbegin();
-    ShardId shardId(citer->first);
-    auto shard = uassertStatusOK(shardRegistry->getShard(opCtx, shardId));
+    auto response = std::move(gatherResponses(opCtx,
+                                              NamespaceString::kAdminDb,
+                                              ReadPreferenceSetting{ReadPreference::PrimaryOnly},
+                                              Shard::RetryPolicy::kIdempotent,
+                                              requests)
+                                  .front());
 
+    auto commandResponse = uassertStatusOK(std::move(response.swResponse));
+    auto commandStatus = getStatusFromCommandResult(commandResponse.data);
+    auto writeConcernStatus = getWriteConcernStatusFromCommandResult(commandResponse.data);
+    return Shard::CommandResponse(std::move(response.shardHostAndPort),
+                                  std::move(commandResponse.data),
+                                  std::move(commandStatus),
+                                  std::move(writeConcernStatus));
+}
+
+Shard::CommandResponse TransactionRouter::_commitTransactionOnShard(OperationContext* opCtx,
+                                                                    const ShardId& shardId) {
     CommitTransaction commitCmd;
     commitCmd.setDbName("admin");
 
-    const auto& participant = citer->second;
-    return uassertStatusOK(shard->runCommandWithFixedRetryAttempts(
-        opCtx,
-        ReadPreferenceSetting{ReadPreference::PrimaryOnly},
-        "admin",
-        participant.attachTxnFieldsIfNeeded(commitCmd.toBSON(opCtx->getWriteConcern().toBSON()),
-                                            false),
-        Shard::RetryPolicy::kIdempotent));
+    return _runTransactionCommandOnShard(
+        opCtx, shardId, commitCmd.toBSON(opCtx->getWriteConcern().toBSON()));
+}
+
+Shard::CommandResponse TransactionRouter::_commitSingleShardTransaction(OperationContext* opCtx) {
+    return _commitTransactionOnShard(opCtx, ShardId(_participants.cbegin()->first));
+}
+
+Shard::CommandResponse TransactionRouter::_commitSingleWriteShardTransaction(
+    OperationContext* opCtx, const ShardId& writeShardId) {
+    // Commit the read-only participants first. They hold no uncommitted writes, so a direct
+    // commitTransaction merely ends the transaction on them, and a failure at this point leaves
+    // nothing durable behind. The transaction fields are attached by the sender.
+    CommitTransaction commitCmd;
+    commitCmd.setDbName("admin");
+    const auto commitCmdObj = commitCmd.toBSON(opCtx->getWriteConcern().toBSON());
+
+    std::vector<AsyncRequestsSender::Request> readOnlyCommitRequests;
+    for (const auto& participantEntry : _participants) {
+        if (writeShardId == ShardId(participantEntry.first)) {
+            continue;
+        }
+        readOnlyCommitRequests.emplace_back(ShardId(participantEntry.first), commitCmdObj);
+    }
+
+    auto responses = gatherResponses(opCtx,
+                                     NamespaceString::kAdminDb,
+                                     ReadPreferenceSetting{ReadPreference::PrimaryOnly},
+                                     Shard::RetryPolicy::kIdempotent,
+                                     readOnlyCommitRequests);
+    for (const auto& response : responses) {
+        auto commandResponse = uassertStatusOK(response.swResponse);
+        uassertStatusOK(getStatusFromCommandResult(commandResponse.data));
+    }
+
+    // Every read-only participant has committed, so the write shard's commit alone decides the
+    // transaction's outcome.
+    return _commitTransactionOnShard(opCtx, writeShardId);
 }
 
 Shard::CommandResponse TransactionRouter::_commitMultiShardTransaction(OperationContext* opCtx) {
     invariant(_coordinatorId);
-    auto coordinatorIter = _participants.find(*_coordinatorId);
-    invariant(coordinatorIter != _participants.end());
+    invariant(_participants.find(*_coordinatorId) != _participants.end());
 
     std::vector<CommitParticipant> participantList;
     for (const auto& participantEntry : _participants) {
@@ -561,22 +632,14 @@ Shard::CommandResponse TransactionRouter::_commitMultiShardTransaction(Operation
         participantList.push_back(std::move(commitParticipant));
     }
 
-    auto coordinatorShard =
-        uassertStatusOK(Grid::get(opCtx)->shardRegistry()->getShard(opCtx, *_coordinatorId));
-
     CoordinateCommitTransaction coordinateCommitCmd;
     coordinateCommitCmd.setDbName("admin");
     coordinateCommitCmd.setParticipants(participantList);
 
     _initiatedTwoPhaseCommit = true;
 
-    return uassertStatusOK(coordinatorShard->runCommandWithFixedRetryAttempts(
-        opCtx,
-        ReadPreferenceSetting{ReadPreference::PrimaryOnly},
-        "admin",
-        coordinatorIter->second.attachTxnFieldsIfNeeded(
-            coordinateCommitCmd.toBSON(opCtx->getWriteConcern().toBSON()), false),
-        Shard::RetryPolicy::kIdempotent));
+    return _runTransactionCommandOnShard(
+        opCtx, *_coordinatorId, coordinateCommitCmd.toBSON(opCtx->getWriteConcern().toBSON()));
 }
 
 Shard::CommandResponse TransactionRouter::commitTransaction(OperationContext* opCtx) {
@@ -586,6 +649,27 @@ Shard::CommandResponse TransactionRouter::commitTransaction(OperationContext* op
         return _commitSingleShardTransaction(opCtx);
     }
 
+    // Handing commit off to a coordinator is only necessary when more than one participant may
+    // have written. Otherwise the read-only participants can be committed directly, followed by
+    // the lone write shard (or the coordinator, if every participant was read-only).
+    boost::optional<ShardId> writeShardId;
+    bool multipleWriteShards = false;
+    for (const auto& participantEntry : _participants) {
+        if (!participantEntry.second.mightHaveWritten()) {
+            continue;
+        }
+        if (writeShardId) {
+            multipleWriteShards = true;
+            break;
+        }
+        writeShardId = ShardId(participantEntry.first);
+    }
+
+    if (!multipleWriteShards) {
+        return _commitSingleWriteShardTransaction(opCtx,
+                                                  writeShardId ? *writeShardId : *_coordinatorId);
+    }
+
     return _commitMultiShardTransaction(opCtx);
 }
 
@@ -93,6 +93,17 @@ public:
          */
         StmtId getStmtIdCreatedAt() const;
 
+        /**
+         * True if this participant may have been sent a statement that writes. Participants that
+         * only executed reads can be committed without a two phase commit.
+         */
+        bool mightHaveWritten() const;
+
+        /**
+         * Marks this participant as having possibly executed a write.
+         */
+        void markMightHaveWritten();
+
         /**
          * Returns the shared transaction options this participant was created with.
          */
@@ -107,6 +118,9 @@ public:
         const StmtId _stmtIdCreatedAt{kUninitializedStmtId};
 
         const SharedTransactionOptions _sharedOptions;
+
+        // Whether any statement sent to this participant could have written.
+        bool _mightHaveWritten{false};
     };
 
     /**
@@ -225,8 +239,9 @@ public:
     const boost::optional<ShardId>& getCoordinatorId() const;
 
     /**
-     * Commits the transaction. For transactions with multiple participants, this will initiate
-     * the two phase commit procedure.
+     * Commits the transaction. For transactions where more than one participant may have written,
+     * this will initiate the two phase commit procedure; if at most one participant may have
+     * written, the participants are committed directly instead.
      */
     Shard::CommandResponse commitTransaction(OperationContext* opCtx);
 
@@ -256,13 +271,36 @@ private:
     // Shortcut to obtain the id of the session under which this transaction router runs
     const LogicalSessionId& _sessionId() const;
 
+    /**
+     * Sends the given command to the given participant shard and waits for its response. The
+     * transaction fields are attached by the sender, and the wait polls the network on this
+     * thread through its baton.
+     */
+    Shard::CommandResponse _runTransactionCommandOnShard(OperationContext* opCtx,
+                                                         const ShardId& shardId,
+                                                         const BSONObj& cmdObj);
+
+    /**
+     * Sends commitTransaction directly to the given participant shard and returns its response.
+     */
+    Shard::CommandResponse _commitTransactionOnShard(OperationContext* opCtx,
+                                                     const ShardId& shardId);
+
     /**
      * Run basic commit for transactions that touched a single shard.
      */
     Shard::CommandResponse _commitSingleShardTransaction(OperationContext* opCtx);
 
     /**
-     * Run two phase commit for transactions that touched multiple shards.
+     * Run commit for transactions where at most the participant 'writeShardId' may have written.
+     * The read-only participants are committed directly in parallel, then 'writeShardId' is
+     * committed and its response returned, skipping the two phase commit protocol.
+     */
+    Shard::CommandResponse _commitSingleWriteShardTransaction(OperationContext* opCtx,
+                                                              const ShardId& writeShardId);
+
+    /**
+     * Run two phase commit for transactions where multiple shards may have written.
      */
     Shard::CommandResponse _commitMultiShardTransaction(OperationContext* opCtx);
 
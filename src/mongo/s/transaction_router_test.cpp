@@ -647,7 +647,7 @@ TEST_F(TransactionRouterTest, SendCommitDirectlyForSingleParticipants) {
 
     auto future = launchAsync([&] { txnRouter->commitTransaction(operationContext()); });
 
-    onCommand([&](const RemoteCommandRequest& request) {
+    onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
         ASSERT_EQ(hostAndPort1, request.target);
         ASSERT_EQ("admin", request.dbname);
 
@@ -680,7 +680,7 @@ TEST_F(TransactionRouterTest, SendCoordinateCommitForMultipleParticipants) {
 
     auto future = launchAsync([&] { txnRouter->commitTransaction(operationContext()); });
 
-    onCommand([&](const RemoteCommandRequest& request) {
+    onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
         ASSERT_EQ(hostAndPort1, request.target);
         ASSERT_EQ("admin", request.dbname);
 
@@ -705,6 +705,106 @@ TEST_F(TransactionRouterTest, SendCoordinateCommitForMultipleParticipants) {
     future.timed_get(kFutureTimeout);
 }
 
+TEST_F(TransactionRouterTest, SendCommitDirectlyForSingleWriteShard) {
+    LogicalSessionId lsid(makeLogicalSessionIdForTest());
+    TxnNumber txnNum{3};
+
+    auto opCtx = operationContext();
+    opCtx->setLogicalSessionId(lsid);
+    opCtx->setTxnNumber(txnNum);
+
+    RouterOperationContextSession scopedSession(opCtx);
+    auto txnRouter = TransactionRouter::get(opCtx);
+
+    txnRouter->beginOrContinueTxn(opCtx, txnNum, true);
+    txnRouter->setDefaultAtClusterTime(operationContext());
+    txnRouter->attachTxnFieldsIfNeeded(shard1,
+                                       BSON("find"
+                                            << "test"));
+    txnRouter->attachTxnFieldsIfNeeded(shard2,
+                                       BSON("insert"
+                                            << "test"));
+
+    auto future = launchAsync([&] { txnRouter->commitTransaction(operationContext()); });
+
+    // The read-only participant is committed directly before the lone write shard.
+    onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
+        ASSERT_EQ(hostAndPort1, request.target);
+        ASSERT_EQ("admin", request.dbname);
+
+        auto cmdName = request.cmdObj.firstElement().fieldNameStringData();
+        ASSERT_EQ(cmdName, "commitTransaction");
+
+        checkSessionDetails(request.cmdObj, lsid, txnNum, true);
+
+        return BSON("ok" << 1);
+    });
+
+    onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
+        ASSERT_EQ(hostAndPort2, request.target);
+        ASSERT_EQ("admin", request.dbname);
+
+        auto cmdName = request.cmdObj.firstElement().fieldNameStringData();
+        ASSERT_EQ(cmdName, "commitTransaction");
+
+        checkSessionDetails(request.cmdObj, lsid, txnNum, boost::none);
+
+        return BSON("ok" << 1);
+    });
+
+    future.timed_get(kFutureTimeout);
+}
+
+TEST_F(TransactionRouterTest, SendCommitDirectlyForReadOnlyParticipants) {
+    LogicalSessionId lsid(makeLogicalSessionIdForTest());
+    TxnNumber txnNum{3};
+
+    auto opCtx = operationContext();
+    opCtx->setLogicalSessionId(lsid);
+    opCtx->setTxnNumber(txnNum);
+
+    RouterOperationContextSession scopedSession(opCtx);
+    auto txnRouter = TransactionRouter::get(opCtx);
+
+    txnRouter->beginOrContinueTxn(opCtx, txnNum, true);
+    txnRouter->setDefaultAtClusterTime(operationContext());
+    txnRouter->attachTxnFieldsIfNeeded(shard1,
+                                       BSON("find"
+                                            << "test"));
+    txnRouter->attachTxnFieldsIfNeeded(shard2,
+                                       BSON("find"
+                                            << "test"));
+
+    auto future = launchAsync([&] { txnRouter->commitTransaction(operationContext()); });
+
+    // With no write shard, the coordinator is committed last.
+    onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
+        ASSERT_EQ(hostAndPort2, request.target);
+        ASSERT_EQ("admin", request.dbname);
+
+        auto cmdName = request.cmdObj.firstElement().fieldNameStringData();
+        ASSERT_EQ(cmdName, "commitTransaction");
+
+        checkSessionDetails(request.cmdObj, lsid, txnNum, boost::none);
+
+        return BSON("ok" << 1);
+    });
+
+    onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
+        ASSERT_EQ(hostAndPort1, request.target);
+        ASSERT_EQ("admin", request.dbname);
+
+        auto cmdName = request.cmdObj.firstElement().fieldNameStringData();
+        ASSERT_EQ(cmdName, "commitTransaction");
+
+        checkSessionDetails(request.cmdObj, lsid, txnNum, true);
+
+        return BSON("ok" << 1);
+    });
+
+    future.timed_get(kFutureTimeout);
+}
+
 TEST_F(TransactionRouterTestWithDefaultSession, SnapshotErrorsResetAtClusterTime) {
     TxnNumber txnNum{3};
 
@@ -335,6 +335,9 @@ Status ChunkManagerTargeter::init(OperationContext* opCtx) {
 
     _routingInfo = std::move(routingInfoStatus.getValue());
 
+    // A chunk targeted against the previous routing info may no longer exist
+    _lastTargetedChunk.reset();
+
     if (_targetEpoch) {
         uassert(ErrorCodes::StaleEpoch, "Collection has been dropped", _routingInfo->cm());
         uassert(ErrorCodes::StaleEpoch,
@@ -378,7 +381,19 @@ StatusWith<ShardEndpoint> ChunkManagerTargeter::targetInsert(OperationContext* o
 
     // Target the shard key or database primary
     if (!shardKey.isEmpty()) {
-        return _targetShardKey(shardKey, CollationSpec::kSimpleSpec, doc.objsize());
+        // Try the chunk targeted by the previous insert first - consecutive documents of a bulk
+        // insert frequently fall on the same chunk, and checking the cached range is much cheaper
+        // than descending the chunk map again
+        if (_lastTargetedChunk && _lastTargetedChunk->range.containsKey(shardKey)) {
+            return _lastTargetedChunk->endpoint;
+        }
+
+        const auto chunk = _routingInfo->cm()->findIntersectingChunkWithSimpleCollation(shardKey);
+        ShardEndpoint endpoint(chunk.getShardId(),
+                               _routingInfo->cm()->getVersion(chunk.getShardId()));
+        _lastTargetedChunk =
+            TargetedChunkCache{ChunkRange(chunk.getMin(), chunk.getMax()), endpoint};
+        return endpoint;
     } else {
         if (!_routingInfo->db().primary()) {
             return Status(ErrorCodes::NamespaceNotFound,
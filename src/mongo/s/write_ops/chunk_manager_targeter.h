@@ -36,6 +36,7 @@
 #include "mongo/bson/bsonobj_comparator_interface.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/catalog_cache.h"
 #include "mongo/s/ns_targeter.h"
 
@@ -173,6 +174,19 @@ private:
     // The latest loaded routing cache entry
     boost::optional<CachedCollectionRoutingInfo> _routingInfo;
 
+    /**
+     * The range and endpoint of the chunk targeted by the most recent insert. Bulk inserts
+     * commonly contain long runs of documents whose shard keys fall on the same chunk, in which
+     * case targeting can reuse this endpoint instead of descending the chunk map for every
+     * document. Reset whenever '_routingInfo' is reloaded, so the cached endpoint can never be
+     * stale with respect to the routing info used for targeting.
+     */
+    struct TargetedChunkCache {
+        ChunkRange range;
+        ShardEndpoint endpoint;
+    };
+    mutable boost::optional<TargetedChunkCache> _lastTargetedChunk;
+
     // Set to the epoch of the namespace we are targeting. If we ever refresh the catalog cache and
     // find a new epoch, we immediately throw a StaleEpoch exception.
     boost::optional<OID> _targetEpoch;
@@ -363,7 +363,8 @@ public:
                 std::shared_ptr<Scope> scope = it->scope;
                 _pools.erase(it);
                 scope->incTimesUsed();
-                scope->reset();
+                // No reset() here: scopes are only pooled via release(), which has already reset
+                // them.
                 scope->registerOperation(opCtx);
                 return scope;
             }
@@ -386,7 +387,12 @@ private:
 
     // Note: if these numbers change, reconsider choice of datastructure for _pools
     static const unsigned kMaxPoolSize = 10;
-    static const int kMaxScopeReuse = 10;
+
+    // Discarding a scope throws away its JS runtime and its compiled-function cache, so the next
+    // checkout pays for runtime construction, core file setup and recompilation of the function
+    // being run. Reuse scopes generously; memory growth is bounded since a scope can only cache
+    // one compiled function per checkout.
+    static const int kMaxScopeReuse = 100;
 
     typedef std::deque<ScopeAndPool> Pools;  // More-recently used Scopes are kept at the front.
     Pools _pools;                            // protected by _mutex
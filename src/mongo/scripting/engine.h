@@ -253,6 +253,14 @@ public:
     virtual int getJSHeapLimitMB() const = 0;
     virtual void setJSHeapLimitMB(int limit) = 0;
 
+    /**
+     * Returns the number of bytes currently allocated to JavaScript heaps across all scopes, for
+     * serverStatus reporting. Engines that do not track allocation return 0.
+     */
+    virtual size_t getTotalJSHeapBytes() const {
+        return 0;
+    }
+
     static void setup();
     static void dropScopeCache();
 
@@ -35,6 +35,7 @@
 #include "mongo/scripting/mozjs/engine.h"
 
 #include <js/Initialization.h>
+#include <jscustomallocator.h>
 
 #include "mongo/db/operation_context.h"
 #include "mongo/db/server_parameters.h"
@@ -149,6 +150,10 @@ void MozJSScriptEngine::setJSHeapLimitMB(int limit) {
     jsHeapLimitMB.store(limit);
 }
 
+size_t MozJSScriptEngine::getTotalJSHeapBytes() const {
+    return mongo::sm::get_total_bytes();
+}
+
 void MozJSScriptEngine::registerOperation(OperationContext* opCtx, MozJSImplScope* scope) {
     stdx::lock_guard<stdx::mutex> giLock(_globalInterruptLock);
 
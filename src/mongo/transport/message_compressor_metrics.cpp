@@ -37,6 +37,7 @@ namespace mongo {
 namespace {
 const auto kBytesIn = "bytesIn"_sd;
 const auto kBytesOut = "bytesOut"_sd;
+const auto kBytesSaved = "bytesSaved"_sd;
 }  // namespace
 
 void appendMessageCompressionStats(BSONObjBuilder* b) {
@@ -60,6 +61,12 @@ void appendMessageCompressionStats(BSONObjBuilder* b) {
         decompressorSection << kBytesIn << compressor->getDecompressorBytesIn() << kBytesOut
                             << compressor->getDecompressorBytesOut();
         decompressorSection.doneFast();
+
+        // The number of wire bytes this compressor avoided sending or receiving: input minus
+        // output when compressing, plus output minus input when decompressing.
+        base << kBytesSaved
+             << (compressor->getCompressorBytesIn() - compressor->getCompressorBytesOut()) +
+                (compressor->getDecompressorBytesOut() - compressor->getDecompressorBytesIn());
         base.doneFast();
     }
     compressionSection.doneFast();
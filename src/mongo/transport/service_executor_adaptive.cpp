@@ -77,6 +77,11 @@ MONGO_EXPORT_SERVER_PARAMETER(adaptiveServiceExecutorMaxQueueLatencyMicros, int,
 // doing actual work.
 MONGO_EXPORT_SERVER_PARAMETER(adaptiveServiceExecutorIdlePctThreshold, int, 60);
 
+// The controller thread will start up to this many worker threads in a single pass when the
+// executor is starved. The actual number started is never more than the task queue's deficit
+// over the currently available threads.
+MONGO_EXPORT_SERVER_PARAMETER(adaptiveServiceExecutorMaxStarvationThreadStarts, int, 4);
+
 // Tasks scheduled with MayRecurse may be called recursively if the recursion depth is below this
 // value.
 MONGO_EXPORT_SERVER_PARAMETER(adaptiveServiceExecutorRecursionLimit, int, 8);
@@ -143,6 +148,10 @@ struct ServerParameterOptions : public ServiceExecutorAdaptive::Options {
         return adaptiveServiceExecutorIdlePctThreshold.load();
     }
 
+    int maxStarvationThreadStarts() const final {
+        return adaptiveServiceExecutorMaxStarvationThreadStarts.load();
+    }
+
     int recursionLimit() const final {
         return adaptiveServiceExecutorRecursionLimit.load();
     }
@@ -450,11 +459,18 @@ void ServiceExecutorAdaptive::_controllerThreadRoutine() {
                  (sinceLastStuckThreadCheck.sinceStart() < stuckThreadTimeout));
 
         // If the number of pending tasks is greater than the number of running threads minus the
-        // number of tasks executing (the number of free threads), then start a new worker to
-        // avoid starvation.
+        // number of tasks executing (the number of free threads), then start new workers to avoid
+        // starvation. Starting one thread per pass recovers too slowly from connection bursts (each
+        // pass also waits out maxQueueLatency above), so cover as much of the deficit as the
+        // configured per-pass limit allows.
         if (_isStarved()) {
-            log() << "Starting worker thread to avoid starvation.";
-            _startWorkerThread(ThreadCreationReason::kStarvation);
+            auto deficit = _tasksQueued.load() - (_threadsRunning.load() - _threadsInUse.load());
+            auto threadsToStart =
+                std::max(1, std::min(deficit, _config->maxStarvationThreadStarts()));
+            log() << "Starting " << threadsToStart << " worker thread(s) to avoid starvation.";
+            for (auto i = 0; i < threadsToStart; i++) {
+                _startWorkerThread(ThreadCreationReason::kStarvation);
+            }
         }
     }
 }
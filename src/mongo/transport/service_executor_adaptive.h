@@ -78,6 +78,11 @@ public:
         // period will exit
         virtual int idlePctThreshold() const = 0;
 
+        // The maximum number of worker threads the controller will start in a single pass when it
+        // finds the executor starved, so a burst of connections ramps the pool up in a few passes
+        // rather than one thread per pass.
+        virtual int maxStarvationThreadStarts() const = 0;
+
         // The maximum allowable depth of recursion for tasks scheduled with the MayRecurse flag
         // before stack unwinding is forced.
         virtual int recursionLimit() const = 0;
@@ -71,6 +71,11 @@ struct TestOptions : public ServiceExecutorAdaptive::Options {
         return 0;
     }
 
+    // Keep single-thread starts so the thread-count assertions below stay exact.
+    int maxStarvationThreadStarts() const final {
+        return 1;
+    }
+
     int recursionLimit() const final {
         return 0;
     }
@@ -101,6 +106,10 @@ struct RecursionOptions : public ServiceExecutorAdaptive::Options {
         return 0;
     }
 
+    int maxStarvationThreadStarts() const final {
+        return 1;
+    }
+
     int recursionLimit() const final {
         return 10;
     }
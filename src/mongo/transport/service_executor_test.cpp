@@ -79,6 +79,10 @@ struct TestOptions : public ServiceExecutorAdaptive::Options {
         return 0;
     }
 
+    int maxStarvationThreadStarts() const final {
+        return 1;
+    }
+
     int recursionLimit() const final {
         return 0;
     }
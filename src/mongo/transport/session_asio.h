@@ -30,8 +30,11 @@
 
 #pragma once
 
+#include <array>
+#include <map>
 #include <utility>
 
+#include "mongo/base/disallow_copying.h"
 #include "mongo/base/system_error.h"
 #include "mongo/config.h"
 #include "mongo/db/stats/counters.h"
@@ -72,6 +75,87 @@ Future<void> futurize(const std::error_code& ec) {
     return Result::makeReady();
 }
 
+#ifdef MONGO_CONFIG_SSL
+#if MONGO_CONFIG_SSL_PROVIDER == MONGO_CONFIG_SSL_PROVIDER_OPENSSL
+/**
+ * Remembers the most recently negotiated TLS session for each egress peer so new connections to
+ * the same host can offer it in their ClientHello. A peer that still holds the session (or can
+ * decrypt the session ticket) performs an abbreviated handshake, skipping the full key exchange.
+ * This mostly benefits connection pools refilling many connections to the same host in a burst;
+ * a peer that has forgotten the session simply falls back to a full handshake.
+ *
+ * OpenSSL only: the SChannel and Secure Transport providers cache client sessions inside the OS
+ * libraries. With TLS 1.3 the session ticket may arrive after the handshake completes, in which
+ * case the captured session may not be resumable and the offer is ignored by the peer.
+ */
+class EgressSSLSessionCache {
+    MONGO_DISALLOW_COPYING(EgressSSLSessionCache);
+
+public:
+    static EgressSSLSessionCache& get() {
+        static EgressSSLSessionCache cache;
+        return cache;
+    }
+
+    EgressSSLSessionCache() = default;
+
+    ~EgressSSLSessionCache() {
+        for (auto&& entry : _sessions) {
+            SSL_SESSION_free(entry.second);
+        }
+    }
+
+    /**
+     * If we hold a session for this target, offers it on the given handle before the client
+     * handshake starts. The handle takes its own reference; the cached one stays valid.
+     */
+    void offerTo(SSL* handle, const HostAndPort& target) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        auto it = _sessions.find(target);
+        if (it != _sessions.end()) {
+            SSL_set_session(handle, it->second);
+        }
+    }
+
+    /**
+     * Captures the session negotiated on the given handle after a successful handshake,
+     * replacing whatever was previously held for this target. No-op when the handshake was
+     * itself a resumption, since the stored session is already current.
+     */
+    void captureFrom(SSL* handle, const HostAndPort& target) {
+        if (SSL_session_reused(handle)) {
+            return;
+        }
+
+        SSL_SESSION* session = SSL_get1_session(handle);
+        if (!session) {
+            return;
+        }
+
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_sessions.size() >= kMaxCachedPeers && _sessions.count(target) == 0) {
+            // More distinct egress peers than any reasonable topology; stop caching new ones
+            // rather than tracking LRU order.
+            SSL_SESSION_free(session);
+            return;
+        }
+
+        auto& slot = _sessions[target];
+        if (slot) {
+            SSL_SESSION_free(slot);
+        }
+        slot = session;
+    }
+
+private:
+    static constexpr size_t kMaxCachedPeers = 1024;
+
+    stdx::mutex _mutex;
+    std::map<HostAndPort, SSL_SESSION*> _sessions;
+};
+#endif  // MONGO_CONFIG_SSL_PROVIDER == MONGO_CONFIG_SSL_PROVIDER_OPENSSL
+#endif  // MONGO_CONFIG_SSL
+
 using GenericSocket = asio::generic::stream_protocol::socket;
 
 class TransportLayerASIO::ASIOSession final : public Session {
@@ -225,6 +309,12 @@ protected:
             std::move(_socket), *_tl->_egressSSLContext, removeFQDNRoot(target.host()));
         lk.unlock();
 
+#if MONGO_CONFIG_SSL_PROVIDER == MONGO_CONFIG_SSL_PROVIDER_OPENSSL
+        // Offer the last session negotiated with this peer so it can elect an abbreviated
+        // handshake. This must happen before the handshake begins.
+        EgressSSLSessionCache::get().offerTo(_sslSocket->native_handle(), target);
+#endif
+
         auto doHandshake = [&] {
             if (_blockingMode == Sync) {
                 std::error_code ec;
@@ -244,6 +334,12 @@ protected:
             if (swPeerInfo) {
                 SSLPeerInfo::forSession(shared_from_this()) = std::move(*swPeerInfo);
             }
+
+#if MONGO_CONFIG_SSL_PROVIDER == MONGO_CONFIG_SSL_PROVIDER_OPENSSL
+            // Only cache sessions whose peer certificate validated, so a resumed connection
+            // never carries weaker guarantees than the full handshake it descends from.
+            EgressSSLSessionCache::get().captureFrom(_sslSocket->native_handle(), target);
+#endif
         });
     }
 
@@ -346,15 +442,17 @@ private:
     Future<Message> sourceMessageImpl(const transport::BatonHandle& baton = nullptr) {
         static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
-        auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
-        auto ptr = headerBuffer.get();
-        return read(asio::buffer(ptr, kHeaderSize), baton)
-            .then([ headerBuffer = std::move(headerBuffer), this, baton ]() mutable {
-                if (checkForHTTPRequest(asio::buffer(headerBuffer.get(), kHeaderSize))) {
+        // Read the header into the session's fixed-size buffer instead of a freshly allocated
+        // one. A session only ever has one sourceMessage() in progress, so the buffer cannot be
+        // clobbered by a concurrent read, and reusing it saves an allocation per message.
+        return read(asio::buffer(_headerBuffer.data(), kHeaderSize), baton)
+            .then([this, baton]() mutable {
+                if (checkForHTTPRequest(asio::buffer(_headerBuffer.data(), kHeaderSize))) {
                     return sendHTTPResponse(baton);
                 }
 
-                const auto msgLen = size_t(MSGHEADER::View(headerBuffer.get()).getMessageLength());
+                const auto msgLen =
+                    size_t(MSGHEADER::View(_headerBuffer.data()).getMessageLength());
                 if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
                     StringBuilder sb;
                     sb << "recv(): message msgLen " << msgLen << " is invalid. "
@@ -370,11 +468,13 @@ private:
                     if (_isIngressSession) {
                         networkCounter.hitPhysicalIn(msgLen);
                     }
-                    return Future<Message>::makeReady(Message(std::move(headerBuffer)));
+                    auto buffer = SharedBuffer::allocate(kHeaderSize);
+                    memcpy(buffer.get(), _headerBuffer.data(), kHeaderSize);
+                    return Future<Message>::makeReady(Message(std::move(buffer)));
                 }
 
                 auto buffer = SharedBuffer::allocate(msgLen);
-                memcpy(buffer.get(), headerBuffer.get(), kHeaderSize);
+                memcpy(buffer.get(), _headerBuffer.data(), kHeaderSize);
 
                 MsgData::View msgView(buffer.get());
                 return read(asio::buffer(msgView.data(), msgView.dataLen()), baton)
@@ -713,6 +813,10 @@ private:
 
     TransportLayerASIO* const _tl;
     bool _isIngressSession;
+
+    // Scratch space for reading message headers, reused across messages. Only valid while a
+    // sourceMessage() is in progress.
+    std::array<char, sizeof(MSGHEADER::Value)> _headerBuffer;
 };
 
 }  // namespace transport
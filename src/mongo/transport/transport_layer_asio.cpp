@@ -42,6 +42,7 @@
 
 #include "mongo/base/system_error.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/transport/asio_utils.h"
 #include "mongo/transport/service_entry_point.h"
@@ -66,6 +67,11 @@ namespace transport {
 
 MONGO_FAIL_POINT_DEFINE(transportLayerASIOasyncConnectTimesOut);
 
+// The number of threads that service the acceptor reactor. Running more than one lets the
+// session setup for an accepted connection overlap with accepting the next one, which helps
+// when large numbers of clients reconnect at once.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(transportLayerASIOListenerThreads, int, 1);
+
 class ASIOReactorTimer final : public ReactorTimer {
 public:
     explicit ASIOReactorTimer(asio::io_context& ctx)
@@ -778,12 +784,22 @@ Status TransportLayerASIO::start() {
             _acceptConnection(acceptor.second);
         }
 
-        _listenerThread = stdx::thread([this] {
-            setThreadName("listener");
-            while (_running.load()) {
-                _acceptorReactor->run();
-            }
-        });
+        int listenerThreads = transportLayerASIOListenerThreads;
+        if (listenerThreads < 1) {
+            warning() << "transportLayerASIOListenerThreads must be at least 1, adjusting from "
+                      << listenerThreads;
+            listenerThreads = 1;
+        }
+        for (int i = 0; i < listenerThreads; i++) {
+            const std::string threadName =
+                i == 0 ? "listener" : static_cast<std::string>(str::stream() << "listener-" << i);
+            _listenerThreads.emplace_back([this, threadName] {
+                setThreadName(threadName);
+                while (_running.load()) {
+                    _acceptorReactor->run();
+                }
+            });
+        }
 
         const char* ssl = "";
 #ifdef MONGO_CONFIG_SSL
@@ -818,15 +834,17 @@ void TransportLayerASIO::shutdown() {
         }
     }
 
-    // If the listener thread is joinable (that is, we created/started a listener thread), then
-    // the io_context is owned exclusively by the TransportLayer and we should stop it and join
-    // the listener thread.
+    // If we created/started listener threads, then the io_context is owned exclusively by the
+    // TransportLayer and we should stop it and join the listener threads.
     //
     // Otherwise the ServiceExecutor may need to continue running the io_context to drain running
     // connections, so we just cancel the acceptors and return.
-    if (_listenerThread.joinable()) {
+    if (!_listenerThreads.empty()) {
         _acceptorReactor->stop();
-        _listenerThread.join();
+        for (auto& listenerThread : _listenerThreads) {
+            listenerThread.join();
+        }
+        _listenerThreads.clear();
     }
 }
 
@@ -855,6 +873,11 @@ void TransportLayerASIO::_acceptConnection(GenericAcceptor& acceptor) {
             return;
         }
 
+        // Rearm the acceptor before doing session setup so that, with more than one listener
+        // thread, the next connection can be accepted while this one is being set up. Only one
+        // async_accept is outstanding per acceptor, so this never races with another rearm.
+        _acceptConnection(acceptor);
+
         try {
             std::shared_ptr<ASIOSession> session(
                 new ASIOSession(this, std::move(peerSocket), true));
@@ -862,8 +885,6 @@ void TransportLayerASIO::_acceptConnection(GenericAcceptor& acceptor) {
         } catch (const DBException& e) {
             warning() << "Error accepting new connection " << e;
         }
-
-        _acceptConnection(acceptor);
     };
 
     acceptor.async_accept(*_ingressReactor, std::move(acceptCb));
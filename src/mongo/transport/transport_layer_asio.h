@@ -193,8 +193,9 @@ private:
 
     std::vector<std::pair<SockAddr, GenericAcceptor>> _acceptors;
 
-    // Only used if _listenerOptions.async is false.
-    stdx::thread _listenerThread;
+    // Only used if _listenerOptions.async is false. There may be more than one thread running
+    // the acceptor reactor so that accepting one connection can overlap with setting up another.
+    std::vector<stdx::thread> _listenerThreads;
 
     ServiceEntryPoint* const _sep = nullptr;
     AtomicWord<bool> _running{false};
@@ -38,6 +38,10 @@
 
 #include <array>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace mongo {
 
 using std::begin;
@@ -78,51 +82,92 @@ private:
         "0123456789+/"};
     std::array<unsigned char, 256> decode;
 } alphabet;
-}  // namespace
 
-void base64::encode(stringstream& ss, const char* data, int size) {
-    for (int i = 0; i < size; i += 3) {
-        int left = size - i;
-        const unsigned char* start = (const unsigned char*)data + i;
+/**
+ * Encodes 'size' bytes of 'data' into 'out', which must have room for encodedLength(size)
+ * characters, including any '=' padding.
+ */
+void encodeImpl(char* out, const unsigned char* data, size_t size) {
+    size_t i = 0;
+
+#if defined(__SSSE3__)
+    // Shuffle-based vector encoding after Muła: each iteration turns 12 input bytes into 16
+    // output characters. The 16-byte load needs 4 bytes of slack past the 12 it consumes, so
+    // stop early and let the scalar loop finish.
+    while (i + 16 <= size) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+
+        // Spread each 3-byte group into a 32-bit lane as [b1, b0, b2, b1] (LSB first).
+        const __m128i shuf = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        in = _mm_shuffle_epi8(in, shuf);
+
+        // Isolate the four 6-bit indices of each lane into separate bytes.
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(t1, t3);
+
+        // Translate indices 0..63 to ASCII by adding a per-range offset found by shuffle.
+        __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+        const __m128i shiftLUT = _mm_setr_epi8('a' - 26,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '0' - 52,
+                                               '+' - 62,
+                                               '/' - 63,
+                                               'A',
+                                               0,
+                                               0);
+        result = _mm_add_epi8(_mm_shuffle_epi8(shiftLUT, result), indices);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), result);
+        out += 16;
+        i += 12;
+    }
+#endif
 
-        // byte 0
-        ss << alphabet.e(start[0] >> 2);
+    for (; i + 2 < size; i += 3) {
+        *out++ = alphabet.e(data[i] >> 2);
+        *out++ = alphabet.e((data[i] << 4) | (data[i + 1] >> 4));
+        *out++ = alphabet.e((data[i + 1] << 2) | (data[i + 2] >> 6));
+        *out++ = alphabet.e(data[i + 2]);
+    }
 
-        // byte 1
-        unsigned char temp = (start[0] << 4);
-        if (left == 1) {
-            ss << alphabet.e(temp);
-            break;
-        }
-        temp |= ((start[1] >> 4) & 0xF);
-        ss << alphabet.e(temp);
-
-        // byte 2
-        temp = (start[1] & 0xF) << 2;
-        if (left == 2) {
-            ss << alphabet.e(temp);
-            break;
+    if (i < size) {
+        *out++ = alphabet.e(data[i] >> 2);
+        if (i + 1 < size) {
+            *out++ = alphabet.e((data[i] << 4) | (data[i + 1] >> 4));
+            *out++ = alphabet.e(data[i + 1] << 2);
+            *out++ = '=';
+        } else {
+            *out++ = alphabet.e(data[i] << 4);
+            *out++ = '=';
+            *out++ = '=';
         }
-        temp |= ((start[2] >> 6) & 0x3);
-        ss << alphabet.e(temp);
-
-        // byte 3
-        ss << alphabet.e(start[2] & 0x3f);
     }
+}
+}  // namespace
 
-    int mod = size % 3;
-    if (mod == 1) {
-        ss << "==";
-    } else if (mod == 2) {
-        ss << "=";
-    }
+void base64::encode(std::ostream& ss, const char* data, int size) {
+    ss << encode(data, size);
 }
 
 
 string base64::encode(const char* data, int size) {
-    stringstream ss;
-    encode(ss, data, size);
-    return ss.str();
+    string out;
+    out.resize(encodedLength(size));
+    encodeImpl(&out[0], reinterpret_cast<const unsigned char*>(data), size);
+    return out;
 }
 
 string base64::encode(const string& s) {
@@ -131,9 +176,22 @@ string base64::encode(const string& s) {
 
 
 void base64::decode(stringstream& ss, const string& s) {
+    ss << decode(s);
+}
+
+string base64::decode(const string& s) {
     uassert(10270, "invalid base64", s.size() % 4 == 0);
     auto const data = reinterpret_cast<const unsigned char*>(s.c_str());
     auto const size = s.size();
+    if (size == 0) {
+        return {};
+    }
+
+    // Decode straight into the result, over-allocated by up to two bytes for padding, and trim
+    // to what was actually written.
+    string result;
+    result.resize(size / 4 * 3);
+    char* out = &result[0];
     bool done = false;
 
     for (size_t i = 0; i < size; i += 4) {
@@ -142,22 +200,17 @@ void base64::decode(stringstream& ss, const string& s) {
         auto const start = data + i;
         done = (start[2] == '=') || (start[3] == '=');
 
-        ss << (char)(((alphabet.d(start[0]) << 2) & 0xFC) | ((alphabet.d(start[1]) >> 4) & 0x3));
+        *out++ = ((alphabet.d(start[0]) << 2) & 0xFC) | ((alphabet.d(start[1]) >> 4) & 0x3);
         if (start[2] != '=') {
-            ss << (char)(((alphabet.d(start[1]) << 4) & 0xF0) |
-                         ((alphabet.d(start[2]) >> 2) & 0xF));
+            *out++ = ((alphabet.d(start[1]) << 4) & 0xF0) | ((alphabet.d(start[2]) >> 2) & 0xF);
             if (!done) {
-                ss << (char)(((alphabet.d(start[2]) << 6) & 0xC0) |
-                             ((alphabet.d(start[3]) & 0x3F)));
+                *out++ = ((alphabet.d(start[2]) << 6) & 0xC0) | (alphabet.d(start[3]) & 0x3F);
             }
         }
     }
-}
 
-string base64::decode(const string& s) {
-    stringstream ss;
-    decode(ss, s);
-    return ss.str();
+    result.resize(out - result.data());
+    return result;
 }
 
 bool base64::validate(const StringData s) {
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <sstream>
 #include <string>
 
@@ -40,7 +41,7 @@
 namespace mongo {
 namespace base64 {
 
-void encode(std::stringstream& ss, const char* data, int size);
+void encode(std::ostream& ss, const char* data, int size);
 std::string encode(const char* data, int size);
 std::string encode(const std::string& s);
 
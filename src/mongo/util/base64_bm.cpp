@@ -0,0 +1,81 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "mongo/util/base64.h"
+#include "mongo/util/hex.h"
+
+namespace mongo {
+namespace {
+
+std::string makeInput(size_t size) {
+    std::string input(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = static_cast<char>(i * 131 + 7);
+    }
+    return input;
+}
+
+void BM_Base64Encode(benchmark::State& state) {
+    const auto input = makeInput(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(base64::encode(input));
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void BM_Base64Decode(benchmark::State& state) {
+    const auto encoded = base64::encode(makeInput(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(base64::decode(encoded));
+    }
+    state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
+void BM_ToHex(benchmark::State& state) {
+    const auto input = makeInput(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toHex(input.data(), input.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+// 32 bytes covers a SCRAM proof; the larger sizes cover binary payload formatting.
+BENCHMARK(BM_Base64Encode)->Arg(32)->Arg(1024)->Arg(64 * 1024);
+BENCHMARK(BM_Base64Decode)->Arg(32)->Arg(1024)->Arg(64 * 1024);
+BENCHMARK(BM_ToHex)->Arg(16)->Arg(1024);
+
+}  // namespace
+}  // namespace mongo
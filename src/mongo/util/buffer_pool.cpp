@@ -0,0 +1,194 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/buffer_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/allocator.h"
+
+namespace mongo {
+namespace {
+
+// Classes are 512B, 1KB, ..., 64KB: the sizes that BufBuilder's doubling growth produces for
+// the vast majority of builders.
+const int kMinClassLog = 9;
+const int kNumClasses = 8;
+const size_t kMaxPooledSize = size_t{1} << (kMinClassLog + kNumClasses - 1);
+
+// Depths are deliberately small: the pool only needs to cover the builders a thread churns
+// through between scheduling points, and the central lists bound how much memory an idle
+// process retains.
+const size_t kThreadCacheDepth = 4;
+const size_t kCentralFreeListDepth = 64;
+
+AtomicInt64 poolHits(0);
+AtomicInt64 poolMisses(0);
+AtomicInt64 oversizedAllocations(0);
+
+size_t classSize(int sizeClass) {
+    return size_t{1} << (kMinClassLog + sizeClass);
+}
+
+// Smallest class that holds 'size'. Caller must ensure size <= kMaxPooledSize.
+int classForSize(size_t size) {
+    int sizeClass = 0;
+    while (classSize(sizeClass) < size) {
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+struct CentralFreeList {
+    stdx::mutex mutex;
+    std::vector<void*> buffers;
+};
+
+CentralFreeList& centralFreeList(int sizeClass) {
+    static CentralFreeList lists[kNumClasses];
+    return lists[sizeClass];
+}
+
+// Returns 'ptr' to the central freelist for its class, or to the heap if the list is full.
+void returnToCentral(void* ptr, int sizeClass) {
+    auto& central = centralFreeList(sizeClass);
+    {
+        stdx::lock_guard<stdx::mutex> lk(central.mutex);
+        if (central.buffers.size() < kCentralFreeListDepth) {
+            central.buffers.push_back(ptr);
+            return;
+        }
+    }
+    std::free(ptr);
+}
+
+struct ThreadCache {
+    struct ClassCache {
+        void* buffers[kThreadCacheDepth];
+        size_t count = 0;
+    };
+
+    ClassCache classes[kNumClasses];
+
+    ~ThreadCache() {
+        for (int sizeClass = 0; sizeClass < kNumClasses; sizeClass++) {
+            auto& cache = classes[sizeClass];
+            while (cache.count > 0) {
+                returnToCentral(cache.buffers[--cache.count], sizeClass);
+            }
+        }
+    }
+};
+
+thread_local ThreadCache threadCache;
+
+}  // namespace
+
+char* BufferPool::allocate(size_t size) {
+    if (size > kMaxPooledSize) {
+        oversizedAllocations.addAndFetch(1);
+        return static_cast<char*>(mongoMalloc(size));
+    }
+
+    const int sizeClass = classForSize(size);
+    auto& cache = threadCache.classes[sizeClass];
+    if (cache.count > 0) {
+        poolHits.addAndFetch(1);
+        return static_cast<char*>(cache.buffers[--cache.count]);
+    }
+
+    auto& central = centralFreeList(sizeClass);
+    {
+        stdx::lock_guard<stdx::mutex> lk(central.mutex);
+        if (!central.buffers.empty()) {
+            void* ptr = central.buffers.back();
+            central.buffers.pop_back();
+            poolHits.addAndFetch(1);
+            return static_cast<char*>(ptr);
+        }
+    }
+
+    poolMisses.addAndFetch(1);
+    return static_cast<char*>(mongoMalloc(classSize(sizeClass)));
+}
+
+char* BufferPool::reallocate(char* ptr, size_t oldSize, size_t newSize) {
+    if (!ptr) {
+        return allocate(newSize);
+    }
+
+    if (oldSize > kMaxPooledSize && newSize > kMaxPooledSize) {
+        return static_cast<char*>(mongoRealloc(ptr, newSize));
+    }
+
+    if (oldSize <= kMaxPooledSize && newSize <= kMaxPooledSize &&
+        classForSize(oldSize) == classForSize(newSize)) {
+        // The existing buffer is the full class size, so it already fits.
+        return ptr;
+    }
+
+    char* newPtr = allocate(newSize);
+    memcpy(newPtr, ptr, std::min(oldSize, newSize));
+    deallocate(ptr, oldSize);
+    return newPtr;
+}
+
+void BufferPool::deallocate(char* ptr, size_t size) {
+    if (!ptr) {
+        return;
+    }
+
+    if (size > kMaxPooledSize) {
+        std::free(ptr);
+        return;
+    }
+
+    const int sizeClass = classForSize(size);
+    auto& cache = threadCache.classes[sizeClass];
+    if (cache.count < kThreadCacheDepth) {
+        cache.buffers[cache.count++] = ptr;
+        return;
+    }
+
+    returnToCentral(ptr, sizeClass);
+}
+
+BufferPool::Stats BufferPool::stats() {
+    return {poolHits.load(), poolMisses.load(), oversizedAllocations.load()};
+}
+
+}  // namespace mongo
@@ -0,0 +1,84 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace mongo {
+
+/**
+ * Global recycling pool for builder buffers.
+ *
+ * Buffers are grouped into power-of-two size classes from 512 bytes to 64KB. Each thread keeps
+ * a small cache of recently freed buffers per class, refilled from and spilled to bounded
+ * central freelists shared by all threads, so the common allocate/deallocate pair is a pair of
+ * thread-local pointer moves with no lock and no malloc. Requests outside the pooled range fall
+ * through to the general-purpose allocator.
+ *
+ * Allocations are made by requested size; deallocate must be passed the same size that was
+ * passed to allocate (or to the last reallocate) so the buffer returns to the right class.
+ */
+class BufferPool {
+    BufferPool() = delete;
+
+public:
+    /**
+     * Returns a buffer of at least 'size' bytes. Never returns nullptr; aborts on out of
+     * memory like mongoMalloc.
+     */
+    static char* allocate(size_t size);
+
+    /**
+     * Grows 'ptr' from 'oldSize' to at least 'newSize' bytes, preserving contents. Accepts a
+     * null 'ptr' when 'oldSize' is zero.
+     */
+    static char* reallocate(char* ptr, size_t oldSize, size_t newSize);
+
+    /**
+     * Returns 'ptr' to the pool. 'size' must match the size the buffer was allocated with.
+     */
+    static void deallocate(char* ptr, size_t size);
+
+    /**
+     * Cumulative counters for the process: allocations served from a freelist (hits),
+     * allocations within the pooled range that had to call malloc (misses), and allocations
+     * too large to pool (oversized).
+     */
+    struct Stats {
+        long long hits;
+        long long misses;
+        long long oversized;
+    };
+
+    static Stats stats();
+};
+
+}  // namespace mongo
@@ -0,0 +1,94 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/coarse_clock_source.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+namespace {
+
+#if defined(__linux__)
+bool getCoarseResolution(Milliseconds* resolution) {
+    timespec ts;
+    if (clock_getres(CLOCK_REALTIME_COARSE, &ts) != 0) {
+        return false;
+    }
+    const auto millis =
+        ts.tv_sec * 1000 + (ts.tv_nsec + 1000 * 1000 - 1) / (1000 * 1000);
+    *resolution = Milliseconds(std::max<long long>(millis, 1));
+    return true;
+}
+#endif
+
+}  // namespace
+
+CoarseClockSource::CoarseClockSource() {
+#if defined(__linux__)
+    invariant(getCoarseResolution(&_precision));
+#else
+    MONGO_UNREACHABLE;
+#endif
+}
+
+Milliseconds CoarseClockSource::getPrecision() {
+    return _precision;
+}
+
+Date_t CoarseClockSource::now() {
+#if defined(__linux__)
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+    return Date_t::fromMillisSinceEpoch(static_cast<long long>(ts.tv_sec) * 1000 +
+                                        ts.tv_nsec / (1000 * 1000));
+#else
+    MONGO_UNREACHABLE;
+#endif
+}
+
+bool CoarseClockSource::isAvailable(Milliseconds granularity) {
+#if defined(__linux__)
+    Milliseconds resolution;
+    return getCoarseResolution(&resolution) && resolution <= granularity;
+#else
+    return false;
+#endif
+}
+
+}  // namespace mongo
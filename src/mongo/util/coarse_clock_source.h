@@ -0,0 +1,66 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/util/clock_source.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * Clock source reading the kernel's coarse wall clock (CLOCK_REALTIME_COARSE). The kernel
+ * updates that clock every scheduler tick, and reading it goes through the vDSO with no
+ * syscall and no synchronization, so now() costs a few nanoseconds on any thread with no
+ * dedicated updater thread behind it.
+ *
+ * Only usable where the platform exposes a coarse clock; check isAvailable() first.
+ */
+class CoarseClockSource final : public ClockSource {
+public:
+    /**
+     * Callers must have checked isAvailable().
+     */
+    CoarseClockSource();
+
+    Milliseconds getPrecision() override;
+    Date_t now() override;
+
+    /**
+     * Returns true when the platform has a coarse clock whose resolution is no coarser than
+     * 'granularity'.
+     */
+    static bool isAvailable(Milliseconds granularity);
+
+private:
+    Milliseconds _precision;
+};
+
+}  // namespace mongo
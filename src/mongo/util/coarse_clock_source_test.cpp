@@ -0,0 +1,59 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/coarse_clock_source.h"
+#include "mongo/util/system_clock_source.h"
+
+namespace mongo {
+namespace {
+
+TEST(CoarseClockSourceTest, StaysNearSystemClock) {
+    if (!CoarseClockSource::isAvailable(Milliseconds(100))) {
+        // Platform without a usable coarse clock; nothing to verify.
+        return;
+    }
+
+    CoarseClockSource coarse;
+    ASSERT_GTE(coarse.getPrecision(), Milliseconds(1));
+
+    // The coarse clock may trail the precise clock by up to its resolution plus a scheduler
+    // tick; anything more means we are reading the wrong clock.
+    const auto precise = SystemClockSource::get()->now();
+    const auto approximate = coarse.now();
+    const auto delta =
+        (precise > approximate) ? (precise - approximate) : (approximate - precise);
+    ASSERT_LTE(delta, coarse.getPrecision() + Milliseconds(500));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -221,6 +221,41 @@ Status ThreadPool::schedule(Task task) {
     return Status::OK();
 }
 
+Status ThreadPool::scheduleMany(std::vector<Task> tasks) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    switch (_state) {
+        case joinRequired:
+        case joining:
+        case shutdownComplete:
+            return Status(ErrorCodes::ShutdownInProgress,
+                          str::stream() << "Shutdown of thread pool " << _options.poolName
+                                        << " in progress");
+        case preStart:
+        case running:
+            break;
+        default:
+            MONGO_UNREACHABLE;
+    }
+    const auto numTasks = tasks.size();
+    for (auto& task : tasks) {
+        _pendingTasks.emplace_back(std::move(task));
+    }
+    if (_state == preStart || numTasks == 0) {
+        return Status::OK();
+    }
+    // Bound the number of thread starts by the batch size in case starting a thread fails.
+    for (size_t i = 0; i < numTasks && _numIdleThreads < _pendingTasks.size() &&
+         _threads.size() < _options.maxThreads;
+         ++i) {
+        _startWorkerThread_inlock();
+    }
+    if (_numIdleThreads <= _pendingTasks.size()) {
+        _lastFullUtilizationDate = Date_t::now();
+    }
+    _workAvailable.notify_all();
+    return Status::OK();
+}
+
 void ThreadPool::waitForIdle() {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
     // If there are any pending tasks, or non-idle threads, the pool is not idle.
@@ -120,6 +120,7 @@ public:
     void shutdown() override;
     void join() override;
     Status schedule(Task task) override;
+    Status scheduleMany(std::vector<Task> tasks) override;
 
     /**
      * Blocks the caller until there are no pending tasks on this pool.
@@ -30,13 +30,14 @@
 
 #pragma once
 
+#include <vector>
+
 #include "mongo/base/disallow_copying.h"
+#include "mongo/base/status.h"
 #include "mongo/util/functional.h"
 
 namespace mongo {
 
-class Status;
-
 /**
  * Interface for a thread pool.
  */
@@ -85,6 +86,24 @@ public:
      */
     virtual Status schedule(Task task) = 0;
 
+    /**
+     * Schedules every task in "tasks" to run in the thread pool, in order, as if by calling
+     * schedule() on each. Returns the first non-OK status if scheduling fails part way through;
+     * tasks scheduled before the failure remain scheduled.
+     *
+     * Implementations may override this to amortize synchronization and wakeup costs across the
+     * batch.
+     */
+    virtual Status scheduleMany(std::vector<Task> tasks) {
+        for (auto& task : tasks) {
+            auto status = schedule(std::move(task));
+            if (!status.isOK()) {
+                return status;
+            }
+        }
+        return Status::OK();
+    }
+
 protected:
     ThreadPoolInterface() = default;
 };
@@ -33,6 +33,7 @@
 #include "mongo/platform/basic.h"
 
 #include <boost/optional.hpp>
+#include <vector>
 
 #include "mongo/base/init.h"
 #include "mongo/stdx/condition_variable.h"
@@ -241,6 +242,39 @@ DEATH_TEST(ThreadPoolTest,
     t.join();
 }
 
+TEST_F(ThreadPoolTest, ScheduleManyRunsAllTasks) {
+    ThreadPool::Options options;
+    options.minThreads = 0;
+    options.maxThreads = 4;
+    auto& pool = makePool(options);
+    pool.startup();
+    ASSERT_EQ(0U, pool.getStats().numThreads);
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0U; i < 10U; ++i) {
+        tasks.emplace_back([this] { blockingWork(); });
+    }
+    stdx::unique_lock<stdx::mutex> lk(mutex);
+    ASSERT_OK(pool.scheduleMany(std::move(tasks)));
+    while (count1 < 4U) {
+        cv1.wait(lk);
+    }
+    auto stats = pool.getStats();
+    ASSERT_EQ(4U, stats.numThreads);
+    ASSERT_EQ(0U, stats.numIdleThreads);
+    flag2 = true;
+    cv2.notify_all();
+    while (count1 < 10U) {
+        cv1.wait(lk);
+    }
+    lk.unlock();
+    pool.waitForIdle();
+    ASSERT_EQ(0U, pool.getStats().numPendingTasks);
+    pool.shutdown();
+    std::vector<ThreadPool::Task> rejected;
+    rejected.emplace_back([] {});
+    ASSERT_EQ(ErrorCodes::ShutdownInProgress, pool.scheduleMany(std::move(rejected)));
+}
+
 TEST_F(ThreadPoolTest, ThreadPoolRunsOnCreateThreadFunctionBeforeConsumingTasks) {
     unittest::Barrier barrier(2U);
 
@@ -38,6 +38,8 @@
 
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -94,6 +96,18 @@ void TicketHolder::waitForTicket(OperationContext* opCtx) {
 }
 
 bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
+    // Attempt to get a ticket without blocking so the queue accounting below only covers waiters.
+    if (tryAcquire())
+        return true;
+
+    _queued.addAndFetch(1);
+    _totalWaits.addAndFetch(1);
+    Timer queueTimer;
+    auto queuedGuard = MakeGuard([&] {
+        _queued.subtractAndFetch(1);
+        _totalTimeQueuedMicros.addAndFetch(queueTimer.micros());
+    });
+
     const Milliseconds intervalMs(500);
     struct timespec ts;
 
@@ -169,6 +183,10 @@ int TicketHolder::outof() const {
     return _outof.load();
 }
 
+int TicketHolder::queued() const {
+    return _queued.load();
+}
+
 #else
 
 TicketHolder::TicketHolder(int num) : _outof(num), _num(num) {}
@@ -182,6 +200,16 @@ bool TicketHolder::tryAcquire() {
 
 void TicketHolder::waitForTicket(OperationContext* opCtx) {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
+    if (_tryAcquire())
+        return;
+
+    _queued.addAndFetch(1);
+    _totalWaits.addAndFetch(1);
+    Timer queueTimer;
+    auto queuedGuard = MakeGuard([&] {
+        _queued.subtractAndFetch(1);
+        _totalTimeQueuedMicros.addAndFetch(queueTimer.micros());
+    });
 
     if (opCtx) {
         opCtx->waitForConditionOrInterrupt(_newTicket, lk, [this] { return _tryAcquire(); });
@@ -192,6 +220,16 @@ void TicketHolder::waitForTicket(OperationContext* opCtx) {
 
 bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
+    if (_tryAcquire())
+        return true;
+
+    _queued.addAndFetch(1);
+    _totalWaits.addAndFetch(1);
+    Timer queueTimer;
+    auto queuedGuard = MakeGuard([&] {
+        _queued.subtractAndFetch(1);
+        _totalTimeQueuedMicros.addAndFetch(queueTimer.micros());
+    });
 
     if (opCtx) {
         return opCtx->waitForConditionOrInterruptUntil(
@@ -244,6 +282,10 @@ int TicketHolder::outof() const {
     return _outof.load();
 }
 
+int TicketHolder::queued() const {
+    return _queued.load();
+}
+
 bool TicketHolder::_tryAcquire() {
     if (_num <= 0) {
         if (_num < 0) {
@@ -255,4 +297,12 @@ bool TicketHolder::_tryAcquire() {
     return true;
 }
 #endif
+
+long long TicketHolder::totalWaits() const {
+    return _totalWaits.load();
+}
+
+long long TicketHolder::totalTimeQueuedMicros() const {
+    return _totalTimeQueuedMicros.load();
+}
 }
@@ -82,17 +82,41 @@ public:
 
     int outof() const;
 
+    /**
+     * Returns the number of threads currently blocked waiting for a ticket. This is a snapshot of
+     * a constantly changing value and is only suitable as a cheap load signal.
+     */
+    int queued() const;
+
+    /**
+     * Returns the cumulative number of ticket acquisitions which could not be satisfied
+     * immediately and had to queue.
+     */
+    long long totalWaits() const;
+
+    /**
+     * Returns the cumulative time, in microseconds, that acquisitions have spent queued waiting
+     * for a ticket.
+     */
+    long long totalTimeQueuedMicros() const;
+
 private:
+    AtomicInt64 _totalWaits{0};
+    AtomicInt64 _totalTimeQueuedMicros{0};
+
 #if defined(__linux__)
     mutable sem_t _sem;
 
     // You can read _outof without a lock, but have to hold _resizeMutex to change.
     AtomicInt32 _outof;
     stdx::mutex _resizeMutex;
+
+    AtomicInt32 _queued{0};
 #else
     bool _tryAcquire();
 
     AtomicInt32 _outof;
+    AtomicInt32 _queued{0};
     int _num;
     stdx::mutex _mutex;
     stdx::condition_variable _newTicket;
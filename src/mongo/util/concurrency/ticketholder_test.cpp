@@ -73,4 +73,22 @@ TEST(TicketholderTest, BasicTimeout) {
     holder.release();
     ASSERT_EQ(holder.used(), 0);
 }
+
+TEST(TicketholderTest, WaitAccounting) {
+    TicketHolder holder(1);
+    ASSERT_EQ(holder.totalWaits(), 0);
+    ASSERT_EQ(holder.totalTimeQueuedMicros(), 0);
+
+    // Uncontended acquisitions never count as waits.
+    holder.waitForTicket();
+    ASSERT_EQ(holder.totalWaits(), 0);
+
+    // A timed-out acquisition counts as a wait and accrues queued time.
+    ASSERT_FALSE(holder.waitForTicketUntil(Date_t::now() + Milliseconds(2)));
+    ASSERT_EQ(holder.totalWaits(), 1);
+    ASSERT_GT(holder.totalTimeQueuedMicros(), 0);
+
+    holder.release();
+    ASSERT_EQ(holder.used(), 0);
+}
 }  // namespace
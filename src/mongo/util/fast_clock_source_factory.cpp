@@ -36,14 +36,20 @@
 
 #include "mongo/stdx/memory.h"
 #include "mongo/util/background_thread_clock_source.h"
+#include "mongo/util/coarse_clock_source.h"
 #include "mongo/util/system_clock_source.h"
 
 namespace mongo {
 
 std::unique_ptr<ClockSource> FastClockSourceFactory::create(Milliseconds granularity) {
-    // TODO: Create the fastest to read wall clock available on the system.
-    // For now, assume there is no built-in fast wall clock so instead
-    // create a background-thread-based timer.
+    // Prefer the kernel's coarse clock where it meets the requested granularity: it is
+    // updated every scheduler tick and read through the vDSO, so there is no dedicated
+    // updater thread waking up for the life of the process.
+    if (CoarseClockSource::isAvailable(granularity)) {
+        return stdx::make_unique<CoarseClockSource>();
+    }
+
+    // Otherwise fall back to a background-thread-based timer.
     return stdx::make_unique<BackgroundThreadClockSource>(stdx::make_unique<SystemClockSource>(),
                                                           granularity);
 }
@@ -93,17 +93,18 @@ inline bool isValidHex(StringData hexString) {
 inline std::string toHex(const void* inRaw, int len) {
     static const char hexchars[] = "0123456789ABCDEF";
 
-    StringBuilder out;
+    // Write both nibbles straight into a pre-sized string rather than streaming characters
+    // through a builder; this is on the UUID/OID formatting path.
+    std::string out(static_cast<size_t>(len) * 2, '\0');
+    char* pos = &out[0];
     const char* in = reinterpret_cast<const char*>(inRaw);
     for (int i = 0; i < len; ++i) {
         char c = in[i];
-        char hi = hexchars[(c & 0xF0) >> 4];
-        char lo = hexchars[(c & 0x0F)];
-
-        out << hi << lo;
+        *pos++ = hexchars[(c & 0xF0) >> 4];
+        *pos++ = hexchars[(c & 0x0F)];
     }
 
-    return out.str();
+    return out;
 }
 
 template <typename T>
@@ -112,17 +113,16 @@ std::string integerToHex(T val);
 inline std::string toHexLower(const void* inRaw, int len) {
     static const char hexchars[] = "0123456789abcdef";
 
-    StringBuilder out;
+    std::string out(static_cast<size_t>(len) * 2, '\0');
+    char* pos = &out[0];
     const char* in = reinterpret_cast<const char*>(inRaw);
     for (int i = 0; i < len; ++i) {
         char c = in[i];
-        char hi = hexchars[(c & 0xF0) >> 4];
-        char lo = hexchars[(c & 0x0F)];
-
-        out << hi << lo;
+        *pos++ = hexchars[(c & 0xF0) >> 4];
+        *pos++ = hexchars[(c & 0x0F)];
     }
 
-    return out.str();
+    return out;
 }
 
 /**
@@ -129,6 +129,15 @@ public:
         return sysInfo().hasNuma;
     }
 
+    /**
+     * Get the number of NUMA memory nodes the host exposes. Returns 1 on hosts and platforms
+     * without NUMA topology information. The per-node CPU lists are reported in the extra system
+     * stats.
+     */
+    static unsigned getNumNumaNodes() {
+        return sysInfo().numNumaNodes;
+    }
+
     /**
      * Determine if file zeroing is necessary for newly allocated data files.
      */
@@ -203,6 +212,7 @@ private:
         unsigned long long pageSize;
         std::string cpuArch;
         bool hasNuma;
+        unsigned numNumaNodes;
         BSONObj _extraStats;
 
         // This is an OS specific value, which determines whether files should be zero-filled
@@ -223,6 +233,7 @@ private:
               numCores(0),
               pageSize(0),
               hasNuma(false),
+              numNumaNodes(1),
               fileZeroNeeded(false),
               preferMsyncOverFSync(true) {
             // populate SystemInfo during construction
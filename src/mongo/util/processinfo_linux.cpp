@@ -546,6 +546,31 @@ void ProcessInfo::SystemInfo::collectSystemInfo() {
     bExtra.append("numPages", static_cast<int>(sysconf(_SC_PHYS_PAGES)));
     bExtra.append("maxOpenFiles", static_cast<int>(sysconf(_SC_OPEN_MAX)));
 
+    // Enumerate the NUMA topology, so thread pool sizing and placement decisions (and anyone
+    // reading hostInfo) can see which CPUs belong to which memory node.
+    {
+        BSONObjBuilder bNuma;
+        unsigned numNodes = 0;
+        try {
+            while (true) {
+                std::string node = "node" + std::to_string(numNodes);
+                std::string cpuListPath = "/sys/devices/system/node/" + node + "/cpulist";
+                if (!boost::filesystem::exists(cpuListPath))
+                    break;
+                bNuma.append(node, LinuxSysHelper::readLineFromFile(cpuListPath.c_str()));
+                numNodes++;
+            }
+        } catch (const boost::filesystem::filesystem_error& e) {
+            log() << "WARNING: Cannot enumerate NUMA topology. "
+                  << "Failed to probe \"" << e.path1().string() << "\": " << e.code().message();
+        }
+        if (numNodes > 0) {
+            numNumaNodes = numNodes;
+            bExtra.append("numaNodes", static_cast<int>(numNodes));
+            bExtra.append("numaNodeCpus", bNuma.obj());
+        }
+    }
+
     _extraStats = bExtra.obj();
 }
 
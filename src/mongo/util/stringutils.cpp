@@ -190,9 +190,31 @@ int versionCmp(const StringData rhs, const StringData lhs) {
 }
 
 std::string escape(StringData sd, bool escape_slash) {
+    // True for the characters escape() may need to replace: quote, backslash, forward slash
+    // (only when escape_slash is set, which is checked separately) and the C0 control range.
+    auto needsEscape = [](char c) {
+        return c == '"' || c == '\\' || c == '/' || static_cast<unsigned char>(c) < 0x20;
+    };
+
     StringBuilder ret;
     ret.reset(sd.size());
-    for (const auto& c : sd) {
+    const char* p = sd.rawData();
+    const char* const end = p + sd.size();
+    while (p != end) {
+        // Most strings need no escaping at all, so find the longest clean run and append it
+        // in one shot rather than copying character by character.
+        const char* runEnd = p;
+        while (runEnd != end && (!needsEscape(*runEnd) || (*runEnd == '/' && !escape_slash))) {
+            ++runEnd;
+        }
+        if (runEnd != p) {
+            ret << StringData(p, runEnd - p);
+            p = runEnd;
+            if (p == end)
+                break;
+        }
+
+        const char c = *p++;
         switch (c) {
             case '"':
                 ret << "\\\"";
@@ -201,7 +223,7 @@ std::string escape(StringData sd, bool escape_slash) {
                 ret << "\\\\";
                 break;
             case '/':
-                ret << (escape_slash ? "\\/" : "/");
+                ret << "\\/";
                 break;
             case '\b':
                 ret << "\\b";
@@ -219,12 +241,8 @@ std::string escape(StringData sd, bool escape_slash) {
                 ret << "\\t";
                 break;
             default:
-                if (c >= 0 && c <= 0x1f) {
-                    // For c < 0x7f, ASCII value == Unicode code point.
-                    ret << "\\u00" << toHexLower(&c, 1);
-                } else {
-                    ret << c;
-                }
+                // For c < 0x7f, ASCII value == Unicode code point.
+                ret << "\\u00" << toHexLower(&c, 1);
         }
     }
     return ret.str();
@@ -0,0 +1,102 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kControl
+
+#include "mongo/platform/basic.h"
+
+#include <gperftools/malloc_extension.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "mongo/base/init.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/util/log.h"
+
+namespace mongo {
+namespace {
+
+// When enabled, every large region tcmalloc obtains from the kernel is marked with
+// madvise(MADV_HUGEPAGE). On hosts with transparent huge pages set to 'madvise' this backs the
+// heap - including the WiredTiger cache, which allocates through tcmalloc - with huge pages and
+// relieves dTLB pressure on large-memory nodes, without the bloat and compaction stalls of
+// enabling THP globally: memory the process never hints, such as thread stacks and mapped
+// files, stays on small pages. The hint is a no-op when THP is 'never'.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(tcmallocHugePageHint, bool, false);
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+
+class HugePageHintingSysAllocator : public SysAllocator {
+public:
+    explicit HugePageHintingSysAllocator(SysAllocator* inner) : _inner(inner) {}
+
+    void* Alloc(size_t size, size_t* actual_size, size_t alignment) override {
+        void* ptr = _inner->Alloc(size, actual_size, alignment);
+        if (!ptr) {
+            return nullptr;
+        }
+        const size_t length = actual_size ? *actual_size : size;
+        if (length >= kHugePageSize) {
+            // Best effort: failure just leaves the region on small pages.
+            madvise(ptr, length, MADV_HUGEPAGE);
+        }
+        return ptr;
+    }
+
+private:
+    static const size_t kHugePageSize = 2 * 1024 * 1024;
+
+    SysAllocator* _inner;
+};
+
+MONGO_INITIALIZER_GENERAL(TcmallocHugePageHint, ("EndStartupOptionHandling"), ("default"))
+(InitializerContext*) {
+    if (!tcmallocHugePageHint) {
+        return Status::OK();
+    }
+
+    auto inner = MallocExtension::instance()->GetSystemAllocator();
+    if (!inner) {
+        warning() << "tcmallocHugePageHint requested but the allocator does not support "
+                     "pluggable system allocators; ignoring";
+        return Status::OK();
+    }
+
+    // Deliberately leaked: tcmalloc keeps using the allocator until process exit.
+    MallocExtension::instance()->SetSystemAllocator(new HugePageHintingSysAllocator(inner));
+    log() << "requesting huge pages for large heap regions (tcmallocHugePageHint=true)";
+    return Status::OK();
+}
+
+#endif  // __linux__ && MADV_HUGEPAGE
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,212 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+TimerWheel::TimerWheel(Date_t now, Milliseconds tickInterval)
+    : _startOfTime(now), _tickInterval(tickInterval) {
+    invariant(tickInterval > Milliseconds::zero());
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Date_t when, stdx::function<void()> callback) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    std::uint64_t expirationTick = _currentTick + 1;
+    if (when > _startOfTime) {
+        const auto sinceStart =
+            static_cast<std::uint64_t>(durationCount<Milliseconds>(when - _startOfTime));
+        expirationTick = std::max(expirationTick,
+                                  (sinceStart + durationCount<Milliseconds>(_tickInterval) - 1) /
+                                      durationCount<Milliseconds>(_tickInterval));
+    }
+
+    auto timer = std::make_shared<Timer>();
+    const TimerId id = _nextId++;
+    timer->id = id;
+    timer->expirationTick = expirationTick;
+    timer->callback = std::move(callback);
+
+    _pending[id] = timer;
+    _insert_inlock(std::move(timer));
+    return id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _pending.find(id);
+    if (it == _pending.end()) {
+        return false;
+    }
+
+    // Tombstone the entry; the slot holding it drops it when drained. Release the callback now
+    // so whatever it captured is not retained until the slot's turn comes around.
+    it->second->canceled = true;
+    it->second->callback = stdx::function<void()>();
+    _pending.erase(it);
+    return true;
+}
+
+void TimerWheel::advance(Date_t now) {
+    std::vector<stdx::function<void()>> expired;
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+        std::uint64_t targetTick = 0;
+        if (now > _startOfTime) {
+            targetTick = static_cast<std::uint64_t>(durationCount<Milliseconds>(now - _startOfTime)) /
+                durationCount<Milliseconds>(_tickInterval);
+        }
+
+        while (_currentTick < targetTick) {
+            // Fast-forward over stretches where no slot can expire or cascade, so catching up
+            // after a long idle period costs one slot scan instead of one iteration per tick.
+            const std::uint64_t nextEventTick = _nextEventTick_inlock();
+            if (nextEventTick > targetTick) {
+                _currentTick = targetTick;
+                break;
+            }
+            _currentTick = std::max(_currentTick, nextEventTick - 1);
+            _currentTick++;
+
+            // When a level's cursor wraps to zero, pull the next slot of the level above down
+            // into the wheel.
+            for (int level = 1; level < kNumLevels; level++) {
+                const std::uint64_t levelMask =
+                    (std::uint64_t{1} << (kSlotBits * level)) - 1;
+                if (_currentTick & levelMask) {
+                    break;
+                }
+                _cascade_inlock(level, (_currentTick >> (kSlotBits * level)) & (kNumSlots - 1));
+            }
+
+            TimerList due;
+            due.splice(due.end(), _slots[0][_currentTick & (kNumSlots - 1)]);
+            for (auto&& timer : due) {
+                if (timer->canceled) {
+                    continue;
+                }
+                if (timer->expirationTick > _currentTick) {
+                    // A far-future timer that had been parked; put it back in its place.
+                    _insert_inlock(timer);
+                    continue;
+                }
+                _pending.erase(timer->id);
+                expired.emplace_back(std::move(timer->callback));
+            }
+        }
+    }
+
+    for (auto&& callback : expired) {
+        callback();
+    }
+}
+
+size_t TimerWheel::size() const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    return _pending.size();
+}
+
+boost::optional<Date_t> TimerWheel::nextDeadline() const {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_pending.empty()) {
+        return boost::none;
+    }
+    const std::uint64_t tick = _nextEventTick_inlock();
+    if (tick == std::numeric_limits<std::uint64_t>::max()) {
+        return boost::none;
+    }
+    return _startOfTime +
+        Milliseconds(durationCount<Milliseconds>(_tickInterval) * static_cast<std::int64_t>(tick));
+}
+
+std::uint64_t TimerWheel::_nextEventTick_inlock() const {
+    std::uint64_t best = std::numeric_limits<std::uint64_t>::max();
+
+    // Level 0 slots hold exact ticks in (_currentTick, _currentTick + kNumSlots).
+    for (std::uint64_t tick = _currentTick + 1; tick < _currentTick + kNumSlots; tick++) {
+        if (!_slots[0][tick & (kNumSlots - 1)].empty()) {
+            best = tick;
+            break;
+        }
+    }
+    if (best == _currentTick + 1) {
+        return best;
+    }
+
+    // An occupied slot in a higher level next matters at its cascade boundary, when its timers
+    // redistribute toward level zero; that boundary can precede any occupied level-0 slot.
+    for (int level = 1; level < kNumLevels; level++) {
+        const int shift = kSlotBits * level;
+        const std::uint64_t levelCursor = _currentTick >> shift;
+        for (std::uint64_t j = 1; j <= kNumSlots; j++) {
+            if (!_slots[level][(levelCursor + j) & (kNumSlots - 1)].empty()) {
+                best = std::min(best, (levelCursor + j) << shift);
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+void TimerWheel::_insert_inlock(std::shared_ptr<Timer> timer) {
+    const std::uint64_t delta =
+        std::min(timer->expirationTick - _currentTick, kMaxDelta - 1);
+
+    int level = 0;
+    while (level < kNumLevels - 1 && delta >= (std::uint64_t{1} << (kSlotBits * (level + 1)))) {
+        level++;
+    }
+
+    const size_t slot = ((_currentTick + delta) >> (kSlotBits * level)) & (kNumSlots - 1);
+    _slots[level][slot].emplace_back(std::move(timer));
+}
+
+void TimerWheel::_cascade_inlock(int level, size_t slot) {
+    TimerList timers;
+    timers.splice(timers.end(), _slots[level][slot]);
+    for (auto&& timer : timers) {
+        if (timer->canceled) {
+            continue;
+        }
+        _insert_inlock(std::move(timer));
+    }
+}
+
+}  // namespace mongo
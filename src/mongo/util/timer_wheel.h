@@ -0,0 +1,138 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/stdx/functional.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * A hierarchical timer wheel: schedule() and cancel() are O(1) regardless of how many timers
+ * are pending, unlike the O(log n) sorted containers they are meant to replace for workloads
+ * that arm and disarm a deadline per operation.
+ *
+ * Time is quantized into ticks of 'tickInterval'; timers fire at the first advance() past
+ * their deadline, so firing accuracy is one tick plus however often the owner drives
+ * advance(). The wheel has four levels of 64 slots, covering a horizon of 64^4 ticks;
+ * farther deadlines are parked in the top level and re-bucketed as the wheel turns.
+ *
+ * The wheel does not own a thread or a clock. The owner calls advance(now) from wherever its
+ * timing conveniently originates (a periodic job, a network thread's poll loop); expired
+ * callbacks run on the advancing thread, outside the wheel's lock. All methods are
+ * thread-safe.
+ */
+class TimerWheel {
+    MONGO_DISALLOW_COPYING(TimerWheel);
+
+public:
+    using TimerId = std::uint64_t;
+
+    /**
+     * Constructs a wheel whose tick 0 is 'now'.
+     */
+    explicit TimerWheel(Date_t now, Milliseconds tickInterval = Milliseconds(10));
+
+    /**
+     * Schedules 'callback' to run at the first advance() whose time reaches 'when'. Deadlines
+     * at or before the wheel's current position fire on the next advance that crosses a tick.
+     * Returns an id usable with cancel().
+     */
+    TimerId schedule(Date_t when, stdx::function<void()> callback);
+
+    /**
+     * Cancels a pending timer. Returns false if the timer already fired, was already
+     * canceled, or never existed. Does not block on a concurrently firing callback.
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Moves the wheel forward to 'now' and runs the callbacks of every timer that came due.
+     */
+    void advance(Date_t now);
+
+    /**
+     * Number of pending (scheduled, not yet fired or canceled) timers.
+     */
+    size_t size() const;
+
+    /**
+     * The next time advance() must be called for the wheel to make progress, or boost::none if
+     * no timers are pending. For deadlines within the lowest level this is the exact due time;
+     * for deadlines still parked in upper levels it is the cascade boundary where they move
+     * toward the lowest level, so callers re-arming a wake-up from this value may wake a
+     * bounded number of extra times (at most once per level) before a far-future timer fires.
+     */
+    boost::optional<Date_t> nextDeadline() const;
+
+private:
+    static const int kSlotBits = 6;
+    static const size_t kNumSlots = size_t{1} << kSlotBits;
+    static const int kNumLevels = 4;
+    // Largest tick delta directly representable; anything farther parks in the top level.
+    static const std::uint64_t kMaxDelta = std::uint64_t{1} << (kSlotBits * kNumLevels);
+
+    struct Timer {
+        TimerId id;
+        std::uint64_t expirationTick;
+        bool canceled = false;
+        stdx::function<void()> callback;
+    };
+
+    using TimerList = std::list<std::shared_ptr<Timer>>;
+
+    void _insert_inlock(std::shared_ptr<Timer> timer);
+    void _cascade_inlock(int level, size_t slot);
+    std::uint64_t _nextEventTick_inlock() const;
+
+    const Date_t _startOfTime;
+    const Milliseconds _tickInterval;
+
+    mutable stdx::mutex _mutex;
+    std::uint64_t _currentTick = 0;
+    TimerId _nextId = 1;
+    TimerList _slots[kNumLevels][kNumSlots];
+    // Pending timers by id, for O(1) cancel. Canceled timers are tombstoned in place and
+    // reclaimed when their slot is drained.
+    stdx::unordered_map<TimerId, std::shared_ptr<Timer>> _pending;
+};
+
+}  // namespace mongo
@@ -0,0 +1,141 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/timer_wheel.h"
+
+namespace mongo {
+namespace {
+
+const Date_t kStart = Date_t::fromMillisSinceEpoch(1000000);
+
+TEST(TimerWheelTest, FiresAtDeadline) {
+    TimerWheel wheel(kStart, Milliseconds(10));
+
+    int fired = 0;
+    wheel.schedule(kStart + Milliseconds(50), [&fired] { fired++; });
+    ASSERT_EQUALS(1U, wheel.size());
+
+    wheel.advance(kStart + Milliseconds(40));
+    ASSERT_EQUALS(0, fired);
+
+    wheel.advance(kStart + Milliseconds(60));
+    ASSERT_EQUALS(1, fired);
+    ASSERT_EQUALS(0U, wheel.size());
+}
+
+TEST(TimerWheelTest, PastDeadlineFiresOnNextAdvance) {
+    TimerWheel wheel(kStart, Milliseconds(10));
+
+    int fired = 0;
+    wheel.schedule(kStart - Seconds(5), [&fired] { fired++; });
+    wheel.advance(kStart + Milliseconds(20));
+    ASSERT_EQUALS(1, fired);
+}
+
+TEST(TimerWheelTest, CancelPreventsFiring) {
+    TimerWheel wheel(kStart, Milliseconds(10));
+
+    int fired = 0;
+    auto id = wheel.schedule(kStart + Milliseconds(50), [&fired] { fired++; });
+    ASSERT_TRUE(wheel.cancel(id));
+    ASSERT_EQUALS(0U, wheel.size());
+
+    // A second cancel, or canceling after firing, reports failure.
+    ASSERT_FALSE(wheel.cancel(id));
+
+    wheel.advance(kStart + Seconds(1));
+    ASSERT_EQUALS(0, fired);
+}
+
+TEST(TimerWheelTest, FarDeadlinesCascadeThroughLevels) {
+    TimerWheel wheel(kStart, Milliseconds(10));
+
+    // Deadlines beyond the first level's 64-tick span must survive re-bucketing.
+    int fired = 0;
+    wheel.schedule(kStart + Seconds(10), [&fired] { fired++; });     // 1000 ticks, level 1
+    wheel.schedule(kStart + Minutes(10), [&fired] { fired++; });     // 60000 ticks, level 2
+    wheel.schedule(kStart + Hours(100), [&fired] { fired++; });      // beyond the horizon
+
+    wheel.advance(kStart + Seconds(9));
+    ASSERT_EQUALS(0, fired);
+    wheel.advance(kStart + Seconds(11));
+    ASSERT_EQUALS(1, fired);
+    wheel.advance(kStart + Minutes(11));
+    ASSERT_EQUALS(2, fired);
+    ASSERT_EQUALS(1U, wheel.size());
+}
+
+TEST(TimerWheelTest, NextDeadlineTracksPendingTimers) {
+    TimerWheel wheel(kStart, Milliseconds(10));
+
+    ASSERT_FALSE(wheel.nextDeadline());
+
+    // An exact answer for a deadline within the lowest level.
+    auto id = wheel.schedule(kStart + Milliseconds(50), [] {});
+    ASSERT_TRUE(wheel.nextDeadline());
+    ASSERT_EQUALS(kStart + Milliseconds(50), *wheel.nextDeadline());
+
+    // A conservative answer (no later than the due time) for a deadline parked in an upper
+    // level, converging on the exact time after the advances it asks for.
+    const auto farDeadline = kStart + Minutes(10);
+    wheel.schedule(farDeadline, [] {});
+    ASSERT_TRUE(wheel.cancel(id));
+    auto next = wheel.nextDeadline();
+    int hops = 0;
+    while (next && *next < farDeadline) {
+        wheel.advance(*next);
+        next = wheel.nextDeadline();
+        ASSERT_LESS_THAN(++hops, 10);
+    }
+    ASSERT_TRUE(next);
+    ASSERT_EQUALS(farDeadline, *next);
+
+    wheel.advance(farDeadline);
+    ASSERT_FALSE(wheel.nextDeadline());
+}
+
+TEST(TimerWheelTest, ManyTimersFireInOnePass) {
+    TimerWheel wheel(kStart, Milliseconds(10));
+
+    int fired = 0;
+    for (int i = 0; i < 1000; i++) {
+        wheel.schedule(kStart + Milliseconds(10 * (i % 100)), [&fired] { fired++; });
+    }
+
+    wheel.advance(kStart + Seconds(2));
+    ASSERT_EQUALS(1000, fired);
+    ASSERT_EQUALS(0U, wheel.size());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -46,6 +46,26 @@ namespace {
 stdx::mutex uuidGenMutex;
 auto uuidGen = SecureRandom::create();
 
+// Number of 64-bit words of secure random data each thread buffers locally, i.e. 16 UUIDs per
+// refill. Threads only take the global generator mutex on refill, so UUID generation no longer
+// serializes on it; under a connection storm every new session would otherwise contend here.
+constexpr size_t kEntropyBufferWords = 32;
+
+struct EntropyBuffer {
+    int64_t words[kEntropyBufferWords];
+    size_t remaining = 0;
+};
+
+thread_local EntropyBuffer uuidEntropy;
+
+void refillEntropyBuffer() {
+    stdx::lock_guard<stdx::mutex> lk(uuidGenMutex);
+    for (size_t i = 0; i < kEntropyBufferWords; ++i) {
+        uuidEntropy.words[i] = uuidGen->nextInt64();
+    }
+    uuidEntropy.remaining = kEntropyBufferWords;
+}
+
 // Regex to match valid version 4 UUIDs with variant bits set
 std::regex uuidRegex("[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}",
                      std::regex::optimize);
@@ -98,16 +118,16 @@ bool UUID::isRFC4122v4() const {
 }
 
 UUID UUID::gen() {
-    int64_t randomWords[2];
-
-    {
-        stdx::lock_guard<stdx::mutex> lk(uuidGenMutex);
-
-        // Generate 128 random bits
-        randomWords[0] = uuidGen->nextInt64();
-        randomWords[1] = uuidGen->nextInt64();
+    // Take 128 random bits from this thread's entropy buffer, refilling it in bulk from the
+    // global generator when it runs dry.
+    if (uuidEntropy.remaining < 2) {
+        refillEntropyBuffer();
     }
 
+    int64_t randomWords[2];
+    randomWords[0] = uuidEntropy.words[--uuidEntropy.remaining];
+    randomWords[1] = uuidEntropy.words[--uuidEntropy.remaining];
+
     UUIDStorage randomBytes;
     memcpy(&randomBytes, randomWords, sizeof(randomBytes));
 